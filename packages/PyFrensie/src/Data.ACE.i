@@ -262,6 +262,11 @@ shown below:
 // Ignore the original getTableZAIDs but keep the extened version
 %ignore Data::ACEFileHandler::getTableZAIDs() const;
 
+// Ignore the node-local shared memory interface
+%ignore Data::ACEFileHandler::ACEFileHandler( const boost::filesystem::path&, const std::string&, const size_t, const Utility::Communicator&, const bool );
+%ignore Data::ACEFileHandler::ACEFileHandler( const boost::filesystem::path&, const std::string&, const size_t, const Utility::Communicator& );
+%ignore Data::ACEFileHandler::getTableXSSArrayData() const;
+
 // Include ACEFileHandler
 %include "Data_ACEFileHandler.hpp"
 
@@ -286,6 +291,9 @@ shown below:
   matplotlib.pyplot.show()
 "
 
+// Ignore the raw xss array constructor
+%ignore Data::XSSNeutronDataExtractor::XSSNeutronDataExtractor( const Utility::ArrayView<const int>&, const Utility::ArrayView<const int>&, const std::shared_ptr<const double>&, const size_t );
+
 // Include XSSNeutronDataExtractor
 %include "Data_XSSNeutronDataExtractor.hpp"
 
@@ -19,6 +19,7 @@
 #include "MonteCarlo_BremsstrahlungAngularDistributionType.hpp"
 #include "MonteCarlo_ElectroionizationSamplingType.hpp"
 #include "MonteCarlo_ElasticElectronDistributionType.hpp"
+#include "MonteCarlo_HistoryScheduleType.hpp"
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "MonteCarlo_SimulationNeutronProperties.hpp"
 #include "MonteCarlo_SimulationPhotonProperties.hpp"
@@ -113,6 +114,9 @@ using namespace MonteCarlo;
 // Import the ElasticElectronDistributionType
 %include "MonteCarlo_ElasticElectronDistributionType.hpp"
 
+// Import the HistoryScheduleType
+%include "MonteCarlo_HistoryScheduleType.hpp"
+
 //---------------------------------------------------------------------------//
 // Add support for the SimulationGeneralProperties
 //---------------------------------------------------------------------------//
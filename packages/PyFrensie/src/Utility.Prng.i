@@ -35,6 +35,8 @@ Prng.RandomNumberGenerator proxy class.
 // Frensie Includes
 #include "PyFrensie_PythonTypeTraits.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_PhiloxGenerator.hpp"
 %}
 
 // Include the vector support
@@ -120,9 +122,48 @@ this class is shown below:
   }
 };
 
+// Include the PseudoRandomNumberGenerator base class
+%ignore Utility::PseudoRandomNumberGenerator::operator new;
+%ignore Utility::PseudoRandomNumberGenerator::operator delete;
+%ignore Utility::PseudoRandomNumberGenerator::getRandomNumbers;
+%include "Utility_PseudoRandomNumberGenerator.hpp"
+
 // Include LinearCongruentialGenerator
 %include "Utility_LinearCongruentialGenerator.hpp"
 
+//---------------------------------------------------------------------------//
+// Add support for the Philox generator
+//---------------------------------------------------------------------------//
+// Add more detailed docstrings for the Philox generator
+%feature("docstring")
+Utility::PhiloxGenerator
+"
+The PhiloxGenerator is a counter-based (Philox4x32-10) generator that can be
+used to generate a uniform deviate in [0,1). Every random number is a function
+of the history number and a counter, which is why the 'changeHistory' method
+can start any history without advancing the stream state. It has the same
+interface as the LinearCongruentialGenerator.
+"
+
+// Add some useful methods to the Philox generator
+%extend Utility::PhiloxGenerator
+{
+  // String representation method
+  PyObject* __repr__() const
+  {
+    std::ostringstream oss;
+    oss << "PhiloxGenerator(stream state: "
+        << $self->getGeneratorState() << ")";
+
+    return PyString_FromString( oss.str().c_str() );
+  }
+};
+
+// Include PhiloxGenerator
+%ignore Utility::PhiloxGenerator::getRandomNumbers;
+%ignore Utility::PhiloxGenerator::computeBlock;
+%include "Utility_PhiloxGenerator.hpp"
+
 //---------------------------------------------------------------------------//
 // Add support for the RandomNumberGenerator interface
 //---------------------------------------------------------------------------//
@@ -208,6 +249,7 @@ that the original random number stream state will be reset as well.
 }
 
 // Include the RandomNumberGenerator
+%ignore Utility::RandomNumberGenerator::getRandomNumbers;
 %include "Utility_RandomNumberGenerator.hpp"
 
 // Instantiate the getRandomNumber template method
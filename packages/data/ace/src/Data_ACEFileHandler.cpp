@@ -38,7 +38,8 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
     d_atomic_weight_ratios(),
     d_nxs(),
     d_jxs(),
-    d_xss( new std::vector<double> )
+    d_xss( new std::vector<double> ),
+    d_shared_xss()
 {
   // Convert to the preferred path format
   d_ace_library_name.make_preferred();
@@ -52,6 +53,66 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
   this->readACETable( table_name, table_start_line );
 }
 
+// Constructor (XSS array stored in node-local shared memory)
+/*! \details This is a collective operation - every process in the node
+ * communicator (see Utility::Communicator::splitShared) must construct the
+ * handler with the same table. Every process will read the (small) table
+ * header but only the process with rank 0 in the node communicator will read
+ * the XSS array, which is stored in a block of memory that is shared by all of
+ * the processes on the node. This reduces the file I/O and the memory
+ * required to store the XSS array on a node by a factor of the number of
+ * processes on the node. The XSS array can only be accessed through
+ * getTableXSSArrayData when this constructor is used.
+ */
+ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+				const std::string& table_name,
+				const size_t table_start_line,
+                                const Utility::Communicator& node_comm,
+				const bool is_ascii )
+  : d_ace_file_id( 1 ),
+    d_ace_library_name( file_name_with_path ),
+    d_ace_table_name( 10, ' ' ),
+    d_ace_table_processing_date( 10, ' ' ),
+    d_ace_table_comment( 70, ' ' ),
+    d_ace_table_material_id( 10, ' ' ),
+    d_atomic_weight_ratio( 0.0 ),
+    d_temperature( 0.0*Utility::Units::MeV ),
+    d_zaids(),
+    d_atomic_weight_ratios(),
+    d_nxs(),
+    d_jxs(),
+    d_xss(),
+    d_shared_xss()
+{
+  // Make sure that the node communicator is valid
+  testPrecondition( node_comm.isValid() );
+  
+  // Convert to the preferred path format
+  d_ace_library_name.make_preferred();
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( d_ace_library_name ),
+                      std::runtime_error,
+                      "ACE file " << d_ace_library_name.string() <<
+                      " does not exist!" );
+
+  this->openACEFile( d_ace_library_name.string(), is_ascii );
+  this->readACETableHeader( table_name, table_start_line );
+
+  std::shared_ptr<double> shared_xss =
+    Utility::allocateSharedArray<double>( node_comm, d_nxs[0] );
+
+  // Only the node root process reads the xss array
+  if( node_comm.rank() == 0 )
+    readAceTableXSSArray( d_ace_file_id, shared_xss.get(), d_nxs[0] );
+
+  closeFileUsingFortran( d_ace_file_id );
+
+  // Wait for the xss array to be read
+  node_comm.barrier();
+
+  d_shared_xss = shared_xss;
+}
+
 // Destructor
 ACEFileHandler::~ACEFileHandler()
 {}
@@ -96,6 +157,25 @@ void ACEFileHandler::openACEFile( const std::string& file_name,
 // Read a table in the ACE file
 void ACEFileHandler::readACETable( const std::string& table_name,
 				   const size_t table_start_line )
+{
+  this->readACETableHeader( table_name, table_start_line );
+  
+  // Resize the xss array
+  d_xss->resize( d_nxs[0] );
+
+  // Read the xss array
+  readAceTableXSSArray( d_ace_file_id, d_xss->data(), d_xss->size() );
+
+  // Close the ACE File
+  closeFileUsingFortran( d_ace_file_id );
+}
+
+// Read the header of a table in the ACE file
+/*! \details The file will be positioned at the start of the XSS array after
+ * the header (including the NXS and JXS arrays) has been read.
+ */
+void ACEFileHandler::readACETableHeader( const std::string& table_name,
+                                         const size_t table_start_line )
 {
   testPrecondition( table_start_line <= (size_t)std::numeric_limits<int>::max() );
   
@@ -151,15 +231,6 @@ void ACEFileHandler::readACETable( const std::string& table_name,
 
   // Read the jxs array
   readAceTableJXSArray( d_ace_file_id, d_jxs.data() );
-
-  // Resize the xss array
-  d_xss->resize( d_nxs[0] );
-
-  // Read the xss array
-  readAceTableXSSArray( d_ace_file_id, d_xss->data(), d_xss->size() );
-
-  // Close the ACE File
-  closeFileUsingFortran( d_ace_file_id );
 }
 
 // Get the library name
@@ -230,11 +301,47 @@ Utility::ArrayView<const int> ACEFileHandler::getTableJXSArray() const
 }
 
 // Get the table XSS array
+/*! \details The XSS array cannot be returned as a vector if it is stored in
+ * shared memory (use getTableXSSArrayData instead).
+ */
 std::shared_ptr<const std::vector<double> > ACEFileHandler::getTableXSSArray() const
 {
+  TEST_FOR_EXCEPTION( !d_xss,
+                      std::logic_error,
+                      "The XSS array of table " << d_ace_table_name <<
+                      " is stored in shared memory and cannot be returned "
+                      "as a vector!" );
+  
   return d_xss;
 }
 
+// Get the table XSS array data
+/*! \details The returned pointer shares ownership of the XSS array storage
+ * (regardless of whether or not the array is stored in shared memory).
+ */
+std::shared_ptr<const double> ACEFileHandler::getTableXSSArrayData() const
+{
+  if( d_shared_xss )
+    return d_shared_xss;
+  else
+    return std::shared_ptr<const double>( d_xss, d_xss->data() );
+}
+
+// Get the table XSS array size
+size_t ACEFileHandler::getTableXSSArraySize() const
+{
+  if( d_xss )
+    return d_xss->size();
+  else
+    return d_nxs[0];
+}
+
+// Check if the table XSS array is stored in shared memory
+bool ACEFileHandler::isTableXSSArrayShared() const
+{
+  return d_shared_xss.get() != NULL;
+}
+
 } // end Data namespace
 
 //---------------------------------------------------------------------------//
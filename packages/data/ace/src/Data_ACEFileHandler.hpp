@@ -22,6 +22,7 @@
 #include "Utility_Vector.hpp"
 #include "Utility_Array.hpp"
 #include "Utility_ArrayView.hpp"
+#include "Utility_Communicator.hpp"
 
 namespace Data{
 
@@ -60,6 +61,13 @@ public:
 		  const size_t table_start_line,
 		  const bool is_ascii = true );
 
+  //! Constructor (XSS array stored in node-local shared memory)
+  ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+		  const std::string& table_name,
+		  const size_t table_start_line,
+                  const Utility::Communicator& node_comm,
+		  const bool is_ascii = true );
+
   //! Destructor
   ~ACEFileHandler();
 
@@ -99,6 +107,15 @@ public:
   //! Get the table XSS array
   std::shared_ptr<const std::vector<double> > getTableXSSArray() const;
 
+  //! Get the table XSS array data
+  std::shared_ptr<const double> getTableXSSArrayData() const;
+
+  //! Get the table XSS array size
+  size_t getTableXSSArraySize() const;
+
+  //! Check if the table XSS array is stored in shared memory
+  bool isTableXSSArrayShared() const;
+
 private:
 
   // Open the ACE file
@@ -109,6 +126,10 @@ private:
   void readACETable( const std::string& table_name,
 		     const size_t table_start_line );
 
+  // Read the ACE table header
+  void readACETableHeader( const std::string& table_name,
+                           const size_t table_start_line );
+
   // The ace file id used by the ace_helpers fortran module (always set to 1)
   int d_ace_file_id;
 
@@ -147,6 +168,9 @@ private:
 
   // The ace table XSS array
   std::shared_ptr<std::vector<double> > d_xss;
+
+  // The ace table XSS array stored in node-local shared memory
+  std::shared_ptr<const double> d_shared_xss;
 };
 
 } // end Data namespace
@@ -30,6 +30,24 @@ XSSNeutronDataExtractor::XSSNeutronDataExtractor(
             const Utility::ArrayView<const int>& nxs,
             const Utility::ArrayView<const int>& jxs,
             const std::shared_ptr<const std::vector<double> >& xss )
+  : XSSNeutronDataExtractor( nxs,
+                             jxs,
+                             (xss ?
+                              std::shared_ptr<const double>( xss, xss->data() ) :
+                              std::shared_ptr<const double>()),
+                             (xss ? xss->size() : 0) )
+{ /* ... */ }
+
+// Constructor (raw xss array that may be stored in shared memory)
+/*! \details The xss pointer must own (or share ownership of) the xss array
+ * storage, which allows the array to be stored in node-local shared memory
+ * (see Data::ACEFileHandler::getTableXSSArrayData).
+ */
+XSSNeutronDataExtractor::XSSNeutronDataExtractor(
+            const Utility::ArrayView<const int>& nxs,
+            const Utility::ArrayView<const int>& jxs,
+            const std::shared_ptr<const double>& xss,
+            const size_t xss_size )
   : d_nxs( nxs.begin(), nxs.end() ),
     d_jxs( jxs.begin(), jxs.end() ),
     d_xss( xss ),
@@ -48,11 +66,11 @@ XSSNeutronDataExtractor::XSSNeutronDataExtractor(
                       std::runtime_error,
                       "Invalid jxs array encountered!" );
 
-  TEST_FOR_EXCEPTION( xss->size() != nxs[0],
+  TEST_FOR_EXCEPTION( xss_size != nxs[0],
                       std::runtime_error,
                       "The nxs array expected the xss array to have size "
                       << nxs[0] << " but it was found to have size "
-                      << xss->size() << "!" );
+                      << xss_size << "!" );
 
   // Adjust the indices in the JXS array so that they correspond to a C-array
   for( size_t i = 0; i < d_jxs.size(); ++i )
@@ -64,7 +82,7 @@ XSSNeutronDataExtractor::XSSNeutronDataExtractor(
   d_jxs[end]+=1;
 
   // Create the XSS view
-  d_xss_view = Utility::arrayViewOfConst( *d_xss );
+  d_xss_view = Utility::ArrayView<const double>( d_xss.get(), xss_size );
 
   // Extract and cache the ESZ block
   d_esz_block = d_xss_view( d_jxs[esz], 5*d_nxs[nes] );
@@ -249,6 +267,16 @@ Utility::ArrayView<const double> XSSNeutronDataExtractor::extractESZBlock() cons
   return d_esz_block;
 }
 
+// Get the XSS array data
+/*! \details The returned pointer shares ownership of the XSS array storage.
+ * Objects that keep views of the extracted blocks (instead of copies) must
+ * also keep a copy of this pointer.
+ */
+std::shared_ptr<const double> XSSNeutronDataExtractor::getXSSArrayData() const
+{
+  return d_xss;
+}
+
 // Extract the energy grid from the XSS array
 Utility::ArrayView<const double> XSSNeutronDataExtractor::extractEnergyGrid() const
 {
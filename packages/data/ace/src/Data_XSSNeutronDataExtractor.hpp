@@ -59,6 +59,12 @@ public:
 			   const Utility::ArrayView<const int>& jxs,
 			   const std::shared_ptr<const std::vector<double> >& xss );
 
+  //! Constructor (raw xss array that may be stored in shared memory)
+  XSSNeutronDataExtractor( const Utility::ArrayView<const int>& nxs,
+			   const Utility::ArrayView<const int>& jxs,
+			   const std::shared_ptr<const double>& xss,
+                           const size_t xss_size );
+
   //! Destructor
   ~XSSNeutronDataExtractor()
   { /* ... */ }
@@ -93,6 +99,9 @@ public:
   //! Extract the ESZ block from the XSS array
   Utility::ArrayView<const double> extractESZBlock() const;
 
+  //! Get the XSS array data
+  std::shared_ptr<const double> getXSSArrayData() const;
+
   //! Extract the energy grid from the XSS array
   Utility::ArrayView<const double> extractEnergyGrid() const;
 
@@ -239,7 +248,7 @@ private:
   std::vector<int> d_jxs;
 
   // The xss array (data in this array should never be directly modified)
-  std::shared_ptr<const std::vector<double> > d_xss;
+  std::shared_ptr<const double> d_xss;
 
   // The xss array view (stored for quicker slicing)
   Utility::ArrayView<const double> d_xss_view;
@@ -89,6 +89,41 @@ FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron )
   FRENSIE_CHECK_EQUAL( xss->size(), nxs[0] );
   FRENSIE_CHECK_EQUAL( xss->front(), 1e-11 );
   FRENSIE_CHECK_EQUAL( xss->back(), 102 );
+  FRENSIE_CHECK( !ace_file_handler->isTableXSSArrayShared() );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableXSSArraySize(), nxs[0] );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableXSSArrayData().get(),
+                       xss->data() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the ACEFileHandler can store the xss array in node-local shared
+// memory
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_shared_neutron )
+{
+  std::string table_name( "1001.70c" );
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitShared();
+
+  // Create the ace file handler
+  std::shared_ptr<Data::ACEFileHandler> ace_file_handler(
+			  new Data::ACEFileHandler( test_neutron_ace_file_name,
+						    table_name,
+						    1u,
+                                                    *node_comm ) );
+
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableName(), table_name );
+  FRENSIE_CHECK( ace_file_handler->isTableXSSArrayShared() );
+  FRENSIE_CHECK_THROW( ace_file_handler->getTableXSSArray(),
+                       std::logic_error );
+
+  std::shared_ptr<const double> xss =
+    ace_file_handler->getTableXSSArrayData();
+
+  FRENSIE_REQUIRE( xss.get() != NULL );
+  FRENSIE_CHECK_EQUAL( ace_file_handler->getTableXSSArraySize(), 8177 );
+  FRENSIE_CHECK_EQUAL( xss.get()[0], 1e-11 );
+  FRENSIE_CHECK_EQUAL( xss.get()[8176], 102 );
 }
 
 //---------------------------------------------------------------------------//
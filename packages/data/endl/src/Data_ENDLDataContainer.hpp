@@ -20,6 +20,7 @@
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_InterpolationPolicy.hpp"
 #include "Utility_ArchivableObject.hpp"
+#include "Utility_FlatBinaryArchive.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
@@ -1746,6 +1747,7 @@ private:
 
 BOOST_SERIALIZATION_CLASS_VERSION( ENDLDataContainer, Data, 0 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ENDLDataContainer, Data );
+FLAT_BINARY_ARCHIVABLE_CLASS( ENDLDataContainer, Data );
 
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Data, ENDLDataContainer );
 
@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "Utility_ArchivableObject.hpp"
+#include "Utility_FlatBinaryArchive.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
@@ -1319,6 +1320,7 @@ private:
 
 BOOST_SERIALIZATION_CLASS_VERSION( ElectronPhotonRelaxationDataContainer, Data, 0 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ElectronPhotonRelaxationDataContainer, Data );
+FLAT_BINARY_ARCHIVABLE_CLASS( ElectronPhotonRelaxationDataContainer, Data );
 
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Data, ElectronPhotonRelaxationDataContainer );
 
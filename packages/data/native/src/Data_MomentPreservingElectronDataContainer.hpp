@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "Utility_ArchivableObject.hpp"
+#include "Utility_FlatBinaryArchive.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
@@ -138,6 +139,7 @@ private:
   
 BOOST_SERIALIZATION_CLASS_VERSION( MomentPreservingElectronDataContainer, Data, 0 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( MomentPreservingElectronDataContainer, Data );
+FLAT_BINARY_ARCHIVABLE_CLASS( MomentPreservingElectronDataContainer, Data );
 
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Data, MomentPreservingElectronDataContainer );
 
@@ -2171,6 +2171,240 @@ FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
                        0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data can be exported and imported (memory mapped)
+FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
+                   export_importData_fbin )
+{
+  const std::string test_fbin_file_name( "test_epr_data_container.fbin" );
+
+  epr_data_container.saveToFile( test_fbin_file_name, true );
+
+  const Data::ElectronPhotonRelaxationDataContainer
+    epr_data_container_copy( test_fbin_file_name );
+
+  // Table Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNotes(), notes );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMinPhotonEnergy(), 0.001 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMaxPhotonEnergy(), 20.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMinElectronEnergy(), 1.0e-5 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getMaxElectronEnergy(), 1.0e5 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getOccupationNumberEvaluationTolerance(),
+                       1e-4 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellIncoherentEvaluationTolerance(),
+                       1e-3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container.getPhotonThresholdEnergyNudgeFactor(),
+                       1.01 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffAngleCosine(),
+                       0.9 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNumberOfMomentPreservingAngles(),
+                       1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonGridConvergenceTolerance(),
+                       0.001 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonGridAbsoluteDifferenceTolerance(),
+                       1e-42 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonGridDistanceTolerance(),
+                       1e-15 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronGridConvergenceTolerance(),
+                       0.001 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronGridAbsoluteDifferenceTolerance(),
+                       1e-42 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronGridDistanceTolerance(),
+                       1e-15 );
+
+  // Relaxation Tests
+  FRENSIE_CHECK( epr_data_container_copy.getSubshells().count( 1 ) );
+  FRENSIE_CHECK( !epr_data_container_copy.getSubshells().count( 0 ) );
+  FRENSIE_CHECK( !epr_data_container_copy.getSubshells().count( 2 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellOccupancy( 1 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellBindingEnergy( 1 ),
+                       1.361e-5 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationTransitions(1),
+                       1 );
+  FRENSIE_CHECK( epr_data_container_copy.hasRelaxationData() );
+  FRENSIE_CHECK( epr_data_container_copy.hasSubshellRelaxationData( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationVacancies( 1 ).size(),
+                       1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationParticleEnergies( 1 ).size(),
+                       1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationProbabilities( 1 ).size(),
+                       1 );
+
+  // Photon Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfileMomentumGrid( 1 ).size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfile( 1 ).size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getOccupationNumberMomentumGrid( 1 ).size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getOccupationNumber( 1 ).size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeScatteringFunctionMomentumGrid().size(),
+                       4 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeScatteringFunction().size(),
+                       4 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeAtomicFormFactorMomentumGrid().size(),
+                       4 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeAtomicFormFactor().size(),
+                       4 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid().size(),
+                       4 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeSquaredAtomicFormFactor().size(),
+                       4 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonEnergyGrid().size(),
+                       3 );
+  FRENSIE_CHECK( epr_data_container.hasAveragePhotonHeatingNumbers() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAveragePhotonHeatingNumbers().size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeIncoherentCrossSection().size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeIncoherentCrossSectionThresholdEnergyIndex(),
+                       0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getImpulseApproxIncoherentCrossSection().size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getImpulseApproxIncoherentCrossSectionThresholdEnergyIndex(),
+                       0u );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getImpulseApproxSubshellIncoherentCrossSection( 1 ).size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( 1 ),
+                       0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeCoherentCrossSection().size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeCoherentCrossSectionThresholdEnergyIndex(),
+                       0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPairProductionCrossSection().size(),
+                       2 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPairProductionCrossSectionThresholdEnergyIndex(),
+                       1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getTripletProductionCrossSection().size(),
+                       2 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getTripletProductionCrossSectionThresholdEnergyIndex(),
+                       1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotoelectricCrossSection().size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotoelectricCrossSectionThresholdEnergyIndex(),
+                       0u );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellPhotoelectricCrossSection( 1 ).size(),
+                       3 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellPhotoelectricCrossSectionThresholdEnergyIndex( 1 ),
+                       0u );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getWallerHartreeTotalCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getImpulseApproxTotalCrossSection().size(),
+                       3u );
+
+  // Electron Tests
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getCutoffAngleCosine(), 0.9 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElasticAngularEnergyGrid().size(),
+    1 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElasticAngularEnergyGrid().front(),
+    1.0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getCutoffElasticAngles(1.0).size(), 3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getCutoffElasticPDF(1.0).size(), 3 );
+//  FRENSIE_CHECK( epr_data_container_copy.hasScreenedRutherfordData() );
+//  FRENSIE_CHECK_EQUAL(
+//    epr_data_container_copy.getScreenedRutherfordNormalizationConstant().size(), 3 );
+//  FRENSIE_CHECK_EQUAL(
+//    epr_data_container_copy.getMoliereScreeningConstant().size(), 3 );
+  FRENSIE_CHECK( epr_data_container_copy.hasMomentPreservingData() );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getMomentPreservingCrossSectionReduction().size(), 1 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getMomentPreservingElasticDiscreteAngles(1.0).size(), 3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getMomentPreservingElasticWeights(1.0).size(), 3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationEnergyGrid(1u).size(),
+    2 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationEnergyGrid(1u).front(),
+    1.0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationEnergyGrid(1u).back(),
+    2.0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationRecoilEnergy(1u, 1.0).size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationRecoilPDF(1u, 1.0).size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationOutgoingEnergy(1u, 1.0).size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationOutgoingPDF(1u, 1.0).size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungEnergyGrid().size(),
+    2 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungEnergyGrid().front(),
+    1.0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungEnergyGrid().back(),
+    2.0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungPhotonEnergy(1.0).size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungPhotonPDF(1.0).size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getAtomicExcitationEnergyGrid().size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getAtomicExcitationEnergyLoss().size(),
+    3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectronEnergyGrid().size(), 3 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getTotalElectronCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getCutoffElasticCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getCutoffElasticCrossSectionThresholdEnergyIndex(),
+                       0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getScreenedRutherfordElasticCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex(),
+                       0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getTotalElasticCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getTotalElasticCrossSectionThresholdEnergyIndex(),
+                       0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationCrossSection(1u).size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationCrossSectionThresholdEnergyIndex(1u),
+                       0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getBremsstrahlungCrossSectionThresholdEnergyIndex(),
+                       0 );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getAtomicExcitationCrossSection().size(),
+                       3u );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getAtomicExcitationCrossSectionThresholdEnergyIndex(),
+                       0 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
@@ -11,6 +11,8 @@
 
 // FRENSIE Includes
 #include "Geometry_Navigator.hpp"
+#include "Utility_ThreadLocalMemoryPool.hpp"
+#include "Utility_DesignByContract.hpp"
 
 namespace Geometry{
 
@@ -28,6 +30,77 @@ Navigator::Navigator( const Navigator& other )
   : d_on_advance_complete( other.d_on_advance_complete )
 { /* ... */ }
 
+// Allocate the memory for a navigator (thread local memory pool)
+/*! \details A navigator is cloned for every particle that is created during
+ * a simulation. The memory of released navigators will be reused by the
+ * thread that released them.
+ */
+void* Navigator::operator new( size_t size )
+{
+  return Utility::ThreadLocalMemoryPool::allocate( size );
+}
+
+// Deallocate the memory of a navigator (thread local memory pool)
+void Navigator::operator delete( void* navigator, size_t size )
+{
+  Utility::ThreadLocalMemoryPool::deallocate( navigator, size );
+}
+
+// Calculate the optical depth along the internal ray
+/*! \details The optical depth is accumulated cell by cell until the distance
+ * has been traversed or the max optical depth has been reached (once the
+ * max optical depth has been reached the current optical depth will be
+ * returned immediately). The internal ray will not be restored - the ray
+ * state should be reset before the navigator is used again. Note that the
+ * advance complete callback will be called for every cell boundary crossing.
+ */
+double Navigator::getOpticalDepthAlongRay(
+                            const Length distance,
+                            const CellCrossSectionFunction& cell_cross_section,
+                            const double max_optical_depth )
+{
+  // Make sure that the internal ray has been set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the distance is valid
+  testPrecondition( distance.value() >= 0.0 );
+  // Make sure that the max optical depth is valid
+  testPrecondition( max_optical_depth >= 0.0 );
+
+  double optical_depth = 0.0;
+
+  Length remaining_distance = distance;
+
+  while( remaining_distance.value() > 0.0 )
+  {
+    const double cross_section =
+      cell_cross_section( this->getCurrentCell() );
+
+    const Length distance_to_boundary = this->fireRay();
+
+    if( distance_to_boundary >= remaining_distance )
+    {
+      if( cross_section > 0.0 )
+        optical_depth += cross_section*remaining_distance.value();
+
+      break;
+    }
+
+    if( cross_section > 0.0 && distance_to_boundary.value() > 0.0 )
+      optical_depth += cross_section*distance_to_boundary.value();
+
+    if( optical_depth >= max_optical_depth )
+      break;
+
+    remaining_distance -= distance_to_boundary;
+
+    // The line of sight is blocked by a reflecting surface
+    if( this->advanceToCellBoundary() )
+      return std::numeric_limits<double>::infinity();
+  }
+
+  return optical_depth;
+}
+
 // The invalid cell id
 auto Navigator::invalidCellId() -> EntityId
 {
@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <functional>
 #include <sstream>
+#include <limits>
 
 #include <boost/units/systems/cgs/length.hpp>
 #include <boost/units/systems/cgs/volume.hpp>
@@ -54,6 +55,9 @@ public:
   //! The advance callback
   typedef std::function<void(const Length)> AdvanceCompleteCallback;
 
+  //! The cell total macroscopic cross section function (1/cm)
+  typedef std::function<double(const EntityId)> CellCrossSectionFunction;
+
   //! Constructor
   Navigator( const AdvanceCompleteCallback& advance_complete_callback =
              AdvanceCompleteCallback() );
@@ -62,6 +66,12 @@ public:
   virtual ~Navigator()
   { /* ... */ }
 
+  //! Allocate the memory for a navigator (thread local memory pool)
+  static void* operator new( size_t size );
+
+  //! Deallocate the memory of a navigator (thread local memory pool)
+  static void operator delete( void* navigator, size_t size );
+
   /*! Get the location of a point w.r.t. a given cell
    *
    * The direction can be used to help determine if the point is inside or
@@ -270,6 +280,19 @@ public:
   //! Change the internal ray direction
   void changeDirection( const double direction[3] );
 
+  /*! Calculate the optical depth along the internal ray
+   *
+   * The internal ray will be advanced through the geometry. If a reflecting
+   * surface is hit before the distance has been traversed, infinity will be
+   * returned. A std::runtime_error (or class derived from it) will be thrown
+   * if a ray tracing error occurs.
+   */
+  double getOpticalDepthAlongRay(
+                  const Length distance,
+                  const CellCrossSectionFunction& cell_cross_section,
+                  const double max_optical_depth =
+                  std::numeric_limits<double>::infinity() );
+
   //! The invalid cell id
   static EntityId invalidCellId();
 
@@ -426,6 +426,43 @@ FRENSIE_UNIT_TEST( InfiniteMediumNavigator, changeDirection )
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[2], 0.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the optical depth along the internal ray can be calculated
+FRENSIE_UNIT_TEST( InfiniteMediumNavigator, getOpticalDepthAlongRay )
+{
+  std::unique_ptr<Geometry::Navigator>
+    navigator( new Geometry::InfiniteMediumNavigator( 1 ) );
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  Geometry::Navigator::CellCrossSectionFunction cell_cross_section =
+    []( const Geometry::Navigator::EntityId cell ){ return cell == 1 ? 2.0 : 0.0; };
+
+  double optical_depth =
+    navigator->getOpticalDepthAlongRay( 3.0*cgs::centimeter,
+                                        cell_cross_section );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( optical_depth, 6.0, 1e-15 );
+
+  optical_depth =
+    navigator->getOpticalDepthAlongRay( 0.0*cgs::centimeter,
+                                        cell_cross_section );
+
+  FRENSIE_CHECK_EQUAL( optical_depth, 0.0 );
+
+  cell_cross_section =
+    []( const Geometry::Navigator::EntityId ){ return 0.0; };
+
+  optical_depth =
+    navigator->getOpticalDepthAlongRay( 3.0*cgs::centimeter,
+                                        cell_cross_section );
+
+  FRENSIE_CHECK_EQUAL( optical_depth, 0.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the navigator can be cloned
 FRENSIE_UNIT_TEST( InfiniteMediumNavigator, clone )
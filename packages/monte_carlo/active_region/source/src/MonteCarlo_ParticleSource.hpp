@@ -70,6 +70,9 @@ public:
   //! Get the number of components
   virtual size_t getNumberOfComponents() const = 0;
 
+  //! Check if the sampled particle directions are isotropic
+  virtual bool isDirectionallyUniform() const = 0;
+
   //! Return the number of sampling trials
   virtual Counter getNumberOfTrials() const = 0;
 
@@ -95,6 +95,9 @@ public:
   //! Return the sampling efficiency from the source
   double getSamplingEfficiency() const;
 
+  //! Check if the sampled particle directions are isotropic
+  virtual bool isDirectionallyUniform() const = 0;
+
   //! Return the number of sampling trials in the phase space dimension
   virtual Counter getNumberOfDimensionTrials(
                                const PhaseSpaceDimension dimension ) const = 0;
@@ -24,9 +24,18 @@ StandardParticleSource::StandardParticleSource()
 { /* ... */ }
   
 // Constructor
+/*! \details By default the source component will be selected by searching
+ * the component selection CDF. If alias component sampling is requested, the
+ * component will be selected using an alias table so that the cost of
+ * selecting a component does not grow with the number of components. Note
+ * that the alias table maps random numbers to components differently than
+ * the CDF so the random number stream of an existing source will change
+ * when alias component sampling is requested.
+ */
 StandardParticleSource::StandardParticleSource(
                   const std::vector<std::shared_ptr<ParticleSourceComponent> >&
-                  source_components )
+                  source_components,
+                  const bool use_alias_component_sampling )
   : ParticleSource(),
     d_components( source_components ),
     d_component_sampling_dist()
@@ -48,7 +57,10 @@ StandardParticleSource::StandardParticleSource(
 
   d_component_sampling_dist.reset( new Utility::DiscreteDistribution(
                                                           independent_values,
-                                                          dependent_values ) );
+                                                          dependent_values,
+                                                          false,
+                                                          false,
+                                                          use_alias_component_sampling ) );
 }
   
 // Enable thread support
@@ -125,6 +137,21 @@ size_t StandardParticleSource::getNumberOfComponents() const
   return d_components.size();
 }
 
+// Check if the sampled particle directions are isotropic
+/*! \details The particle directions are only isotropic if the particle
+ * directions sampled by every component are isotropic.
+ */
+bool StandardParticleSource::isDirectionallyUniform() const
+{
+  for( size_t i = 0; i < d_components.size(); ++i )
+  {
+    if( !d_components[i]->isDirectionallyUniform() )
+      return false;
+  }
+
+  return true;
+}
+
 // Return the number of sampling trials
 /*! \details Only the master thread should call this method.
  */
@@ -30,7 +30,8 @@ public:
   //! Constructor
   StandardParticleSource(
                   const std::vector<std::shared_ptr<ParticleSourceComponent> >&
-                  source_components );
+                  source_components,
+                  const bool use_alias_component_sampling = false );
 
   //! Destructor
   ~StandardParticleSource()
@@ -59,6 +60,9 @@ public:
   //! Get the number of components
   size_t getNumberOfComponents() const final override;
 
+  //! Check if the sampled particle directions are isotropic
+  bool isDirectionallyUniform() const final override;
+
   //! Return the number of sampling trials
   Counter getNumberOfTrials() const final override;
 
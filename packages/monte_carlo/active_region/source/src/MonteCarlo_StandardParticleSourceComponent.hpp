@@ -82,6 +82,9 @@ public:
   double getDimensionSamplingEfficiency(
                     const PhaseSpaceDimension dimension ) const final override;
 
+  //! Check if the sampled particle directions are isotropic
+  bool isDirectionallyUniform() const final override;
+
   //! Print a summary of the sampling statistics
   void printSummary( std::ostream& os ) const final override;
 
@@ -59,6 +59,7 @@ FRENSIE_UNIT_TEST( StandardParticleSource, constructor )
     source( new MonteCarlo::StandardParticleSource( source_components ) );
 
   FRENSIE_CHECK_EQUAL( source->getNumberOfComponents(), 2 );
+  FRENSIE_CHECK( source->isDirectionallyUniform() );
 
   MonteCarlo::ParticleSource::CellIdSet starting_cells;
   source->getStartingCells( starting_cells );
@@ -165,6 +166,96 @@ FRENSIE_UNIT_TEST( StandardParticleSource, sampleParticleState )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the source components are selected with the cdf by default
+FRENSIE_UNIT_TEST( StandardParticleSource, sampleParticleState_component_cdf )
+{
+  std::vector<std::shared_ptr<MonteCarlo::ParticleSourceComponent> >
+    source_components( 2 );
+
+  source_components[0].reset( new MonteCarlo::StandardNeutronSourceComponent( 0, 1.0, model, particle_distribution ) );
+  source_components[1].reset( new MonteCarlo::StandardPhotonSourceComponent( 1, 3.0, model, particle_distribution ) );
+
+  std::unique_ptr<MonteCarlo::ParticleSource>
+    source( new MonteCarlo::StandardParticleSource( source_components ) );
+
+  MonteCarlo::ParticleBank bank;
+
+  // Set the random number generator stream
+  std::vector<double> fake_stream( 8 );
+  fake_stream[0] = 0.1; // neutron source component
+  fake_stream[1] = 0.0; // x
+  fake_stream[2] = 0.5; // energy
+  fake_stream[3] = 0.5; // y
+  fake_stream[4] = 1.0-1e-15; // z
+  fake_stream[5] = 0.0; // theta
+  fake_stream[6] = 1.0-1e-15; // mu
+  fake_stream[7] = 0.0; // time
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  source->sampleParticleState( bank, 0ull );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+
+  bank.pop();
+
+  // An alias table would map this random number to the neutron component
+  fake_stream[0] = 0.3; // photon source component
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  source->sampleParticleState( bank, 1ull );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the source components can be selected with an alias table
+FRENSIE_UNIT_TEST( StandardParticleSource, sampleParticleState_component_alias )
+{
+  std::vector<std::shared_ptr<MonteCarlo::ParticleSourceComponent> >
+    source_components( 3 );
+
+  source_components[0].reset( new MonteCarlo::StandardNeutronSourceComponent( 0, 1.0, model, particle_distribution ) );
+  source_components[1].reset( new MonteCarlo::StandardPhotonSourceComponent( 1, 3.0, model, particle_distribution ) );
+  source_components[2].reset( new MonteCarlo::StandardPhotonSourceComponent( 2, 6.0, model, particle_distribution ) );
+
+  std::unique_ptr<MonteCarlo::ParticleSource>
+    source( new MonteCarlo::StandardParticleSource( source_components, true ) );
+
+  MonteCarlo::ParticleBank bank;
+
+  const int number_of_samples = 20000;
+
+  for( int i = 0; i < number_of_samples; ++i )
+  {
+    source->sampleParticleState( bank, i );
+
+    bank.pop();
+  }
+
+  FRENSIE_CHECK_EQUAL( source->getNumberOfSamples(), number_of_samples );
+
+  // The component selection frequencies must match the selection weights
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   source->getNumberOfSamples( 0 )/(double)number_of_samples,
+                   0.1,
+                   0.1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   source->getNumberOfSamples( 1 )/(double)number_of_samples,
+                   0.3,
+                   0.05 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   source->getNumberOfSamples( 2 )/(double)number_of_samples,
+                   0.6,
+                   0.05 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the source can accumulate sampling statistics
 FRENSIE_UNIT_TEST( StandardParticleSource, sampling_statistics )
@@ -92,6 +92,9 @@ public:
   //! Return the total absorption cross section from nuclear interactions
   virtual double getNuclearAbsorptionCrossSection( const double energy ) const;
 
+  //! Add the energy grid points of the atomic reactions to the vector
+  void getEnergyGridPoints( std::vector<double>& energy_grid_points ) const;
+
   //! Return the survival probability at the desired energy
   double getSurvivalProbability( const double energy ) const;
 
@@ -308,6 +308,34 @@ inline double Atom<AtomCore>::getAtomicScatteringCrossSection(
   return cross_section;
 }
 
+// Add the energy grid points of the atomic reactions to the vector
+/*! \details The points will be added in reaction order (they are not sorted
+ * and duplicate points are not removed).
+ */
+template<typename AtomCore>
+void Atom<AtomCore>::getEnergyGridPoints(
+                             std::vector<double>& energy_grid_points ) const
+{
+  typename ConstReactionMap::const_iterator atomic_reaction =
+    d_core.getScatteringReactions().begin();
+
+  while( atomic_reaction != d_core.getScatteringReactions().end() )
+  {
+    atomic_reaction->second->getEnergyGridPoints( energy_grid_points );
+
+    ++atomic_reaction;
+  }
+
+  atomic_reaction = d_core.getAbsorptionReactions().begin();
+
+  while( atomic_reaction != d_core.getAbsorptionReactions().end() )
+  {
+    atomic_reaction->second->getEnergyGridPoints( energy_grid_points );
+
+    ++atomic_reaction;
+  }
+}
+
 // Return the survival probability at the desired energy
 template<typename AtomCore>
 double Atom<AtomCore>::getSurvivalProbability( const double energy ) const
@@ -0,0 +1,222 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ElectronStoppingCrossSectionNativeFactory.cpp
+//! \author Alex Robinson
+//! \brief  The electron stopping cross section native factory definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectronStoppingCrossSectionNativeFactory.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Create the total stopping cross section (MeV-b)
+/*! \details The total stopping cross section is the sum of the energy loss
+ * weighted cross sections of the atomic excitation, bremsstrahlung and
+ * electroionization reactions (the elastic reactions do not contribute). It
+ * is evaluated on the electron energy grid and is linearly interpolated
+ * between the grid points. All of the energy transferred to secondary
+ * particles is treated as lost by the electron (i.e. this is the unrestricted
+ * stopping cross section that determines the CSDA range).
+ */
+void ElectronStoppingCrossSectionNativeFactory::createTotalStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::shared_ptr<const Utility::UnivariateDistribution>&
+            total_stopping_cross_section )
+{
+  const std::vector<double>& energy_grid =
+    data_container.getElectronEnergyGrid();
+
+  std::vector<double> stopping_cross_section( energy_grid.size(), 0.0 );
+
+  ThisType::addAtomicExcitationStoppingCrossSection( data_container,
+                                                     stopping_cross_section );
+
+  ThisType::addBremsstrahlungStoppingCrossSection( data_container,
+                                                   stopping_cross_section );
+
+  ThisType::addElectroionizationStoppingCrossSection( data_container,
+                                                      stopping_cross_section );
+
+  total_stopping_cross_section.reset(
+            new Utility::TabularDistribution<Utility::LinLin>(
+                                                    energy_grid,
+                                                    stopping_cross_section ) );
+}
+
+// Add the atomic excitation stopping cross section on the energy grid
+/*! \details The atomic excitation cross section is multiplied by the atomic
+ * excitation energy loss.
+ */
+void ElectronStoppingCrossSectionNativeFactory::addAtomicExcitationStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section )
+{
+  const std::vector<double>& energy_grid =
+    data_container.getElectronEnergyGrid();
+
+  Utility::TabularDistribution<Utility::LogLog> energy_loss_function(
+                         data_container.getAtomicExcitationEnergyGrid(),
+                         data_container.getAtomicExcitationEnergyLoss() );
+
+  const std::vector<double>& excitation_cross_section =
+    data_container.getAtomicExcitationCrossSection();
+
+  const size_t threshold_index =
+    data_container.getAtomicExcitationCrossSectionThresholdEnergyIndex();
+
+  for( size_t i = threshold_index; i < energy_grid.size(); ++i )
+  {
+    stopping_cross_section[i] +=
+      excitation_cross_section[i-threshold_index]*
+      energy_loss_function.evaluate( energy_grid[i] );
+  }
+}
+
+// Add the bremsstrahlung stopping cross section on the energy grid
+/*! \details The bremsstrahlung cross section is multiplied by the mean
+ * emitted photon energy.
+ */
+void ElectronStoppingCrossSectionNativeFactory::addBremsstrahlungStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section )
+{
+  ThisType::addStoppingCrossSection(
+             data_container.getElectronEnergyGrid(),
+             data_container.getBremsstrahlungCrossSection(),
+             data_container.getBremsstrahlungCrossSectionThresholdEnergyIndex(),
+             data_container.getBremsstrahlungPhotonEnergy(),
+             data_container.getBremsstrahlungPhotonPDF(),
+             0.0,
+             stopping_cross_section );
+}
+
+// Add the electroionization stopping cross section on the energy grid
+/*! \details The electroionization cross section of each subshell is
+ * multiplied by the sum of the subshell binding energy and the mean knock-on
+ * electron energy.
+ */
+void ElectronStoppingCrossSectionNativeFactory::addElectroionizationStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section )
+{
+  for( auto&& subshell : data_container.getSubshells() )
+  {
+    ThisType::addStoppingCrossSection(
+       data_container.getElectronEnergyGrid(),
+       data_container.getElectroionizationCrossSection( subshell ),
+       data_container.getElectroionizationCrossSectionThresholdEnergyIndex( subshell ),
+       data_container.getElectroionizationRecoilEnergy( subshell ),
+       data_container.getElectroionizationRecoilPDF( subshell ),
+       data_container.getSubshellBindingEnergy( subshell ),
+       stopping_cross_section );
+  }
+}
+
+// Add a reaction's energy loss weighted cross section on the energy grid
+/*! \details The mean secondary energy is calculated at each tabulated
+ * incoming energy of the secondary distribution and is linearly
+ * interpolated between them (the values at the first and last incoming
+ * energies are used outside of the tabulated range). The additional energy
+ * loss (e.g. a binding energy) is added to the mean secondary energy.
+ */
+void ElectronStoppingCrossSectionNativeFactory::addStoppingCrossSection(
+                  const std::vector<double>& energy_grid,
+                  const std::vector<double>& cross_section,
+                  const size_t threshold_index,
+                  const std::map<double,std::vector<double> >& secondary_energy,
+                  const std::map<double,std::vector<double> >& secondary_pdf,
+                  const double additional_energy_loss,
+                  std::vector<double>& stopping_cross_section )
+{
+  // Make sure the data is valid
+  testPrecondition( secondary_energy.size() == secondary_pdf.size() );
+  testPrecondition( stopping_cross_section.size() == energy_grid.size() );
+
+  if( secondary_energy.empty() )
+    return;
+
+  // Calculate the mean secondary energy at each tabulated incoming energy
+  std::vector<double> incoming_energy_grid, mean_secondary_energy;
+  incoming_energy_grid.reserve( secondary_energy.size() );
+  mean_secondary_energy.reserve( secondary_energy.size() );
+
+  for( auto&& energy_secondaries_pair : secondary_energy )
+  {
+    incoming_energy_grid.push_back( energy_secondaries_pair.first );
+
+    mean_secondary_energy.push_back(
+          ThisType::calculateMeanEnergy(
+                      energy_secondaries_pair.second,
+                      secondary_pdf.find( energy_secondaries_pair.first )->second ) );
+  }
+
+  for( size_t i = threshold_index; i < energy_grid.size(); ++i )
+  {
+    double mean_energy;
+
+    if( energy_grid[i] <= incoming_energy_grid.front() )
+      mean_energy = mean_secondary_energy.front();
+    else if( energy_grid[i] >= incoming_energy_grid.back() )
+      mean_energy = mean_secondary_energy.back();
+    else
+    {
+      const size_t bin_index =
+        Utility::Search::binaryLowerBoundIndex( incoming_energy_grid.begin(),
+                                                incoming_energy_grid.end(),
+                                                energy_grid[i] );
+
+      const double interp_fraction =
+        (energy_grid[i] - incoming_energy_grid[bin_index])/
+        (incoming_energy_grid[bin_index+1] - incoming_energy_grid[bin_index]);
+
+      mean_energy = mean_secondary_energy[bin_index] +
+        interp_fraction*(mean_secondary_energy[bin_index+1] -
+                         mean_secondary_energy[bin_index]);
+    }
+
+    stopping_cross_section[i] += cross_section[i-threshold_index]*
+      (mean_energy + additional_energy_loss);
+  }
+}
+
+// Calculate the mean energy of a tabulated secondary energy distribution
+/*! \details The pdf is assumed to be linear between the tabulated energies,
+ * which allows the moments to be integrated exactly.
+ */
+double ElectronStoppingCrossSectionNativeFactory::calculateMeanEnergy(
+                                             const std::vector<double>& energies,
+                                             const std::vector<double>& pdf )
+{
+  // Make sure the distribution is valid
+  testPrecondition( energies.size() == pdf.size() );
+  testPrecondition( energies.size() > 1 );
+
+  double norm = 0.0;
+  double first_moment = 0.0;
+
+  for( size_t i = 0; i < energies.size()-1; ++i )
+  {
+    const double bin_width = energies[i+1] - energies[i];
+
+    norm += 0.5*bin_width*(pdf[i] + pdf[i+1]);
+
+    first_moment += bin_width*(energies[i]*(2.0*pdf[i] + pdf[i+1]) +
+                               energies[i+1]*(pdf[i] + 2.0*pdf[i+1]))/6.0;
+  }
+
+  if( norm > 0.0 )
+    return first_moment/norm;
+  else
+    return 0.0;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ElectronStoppingCrossSectionNativeFactory.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ElectronStoppingCrossSectionNativeFactory.hpp
+//! \author Alex Robinson
+//! \brief  The electron stopping cross section native factory declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ELECTRON_STOPPING_CROSS_SECTION_NATIVE_FACTORY_HPP
+#define MONTE_CARLO_ELECTRON_STOPPING_CROSS_SECTION_NATIVE_FACTORY_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_UnivariateDistribution.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+//! The electron stopping cross section factory class that uses Native data
+class ElectronStoppingCrossSectionNativeFactory
+{
+
+public:
+
+  using ThisType = ElectronStoppingCrossSectionNativeFactory;
+
+  //! Create the total stopping cross section (MeV-b)
+  static void createTotalStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::shared_ptr<const Utility::UnivariateDistribution>&
+            total_stopping_cross_section );
+
+protected:
+
+  //! Add the atomic excitation stopping cross section on the energy grid
+  static void addAtomicExcitationStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section );
+
+  //! Add the bremsstrahlung stopping cross section on the energy grid
+  static void addBremsstrahlungStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section );
+
+  //! Add the electroionization stopping cross section on the energy grid
+  static void addElectroionizationStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section );
+
+  //! Add a reaction's energy loss weighted cross section on the energy grid
+  static void addStoppingCrossSection(
+                  const std::vector<double>& energy_grid,
+                  const std::vector<double>& cross_section,
+                  const size_t threshold_index,
+                  const std::map<double,std::vector<double> >& secondary_energy,
+                  const std::map<double,std::vector<double> >& secondary_pdf,
+                  const double additional_energy_loss,
+                  std::vector<double>& stopping_cross_section );
+
+  //! Calculate the mean energy of a tabulated secondary energy distribution
+  static double calculateMeanEnergy( const std::vector<double>& energies,
+                                     const std::vector<double>& pdf );
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ELECTRON_STOPPING_CROSS_SECTION_NATIVE_FACTORY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ElectronStoppingCrossSectionNativeFactory.hpp
+//---------------------------------------------------------------------------//
@@ -19,6 +19,7 @@
 #include "Utility_Vector.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_QuantityTraits.hpp"
+#include "Utility_HashBasedGridSearcher.hpp"
 
 namespace MonteCarlo{
 
@@ -72,6 +73,17 @@ public:
   //! Return the scattering center number density
   double getScatteringCenterNumberDensity( const std::string& name ) const;
 
+  //! Unionize the energy grid of the material
+  void unionizeEnergyGrid( const double min_energy,
+                           const double max_energy,
+                           const double thinning_tol = 0.0 );
+
+  //! Check if the energy grid of the material has been unionized
+  bool isEnergyGridUnionized() const;
+
+  //! Return the unionized energy grid
+  const std::vector<double>& getUnionizedEnergyGrid() const;
+
   //! Return the macroscopic total cross section (1/cm)
   double getMacroscopicTotalCrossSection( const double energy ) const;
 
@@ -141,6 +153,9 @@ protected:
   //! Return the scattering center at the desired index
   const ScatteringCenter& getScatteringCenter( const size_t index ) const;
 
+  //! Return the number density of the scattering center at the desired index
+  double getScatteringCenterNumberDensity( const size_t index ) const;
+
 private:
 
   // Get the atomic weight from an atom pointer
@@ -150,6 +165,42 @@ private:
   // Sample the atom that is collided with
   size_t sampleCollisionScatteringCenter( const double energy ) const;
 
+  // Find the unionized energy grid bin that an energy falls in
+  bool findUnionizedEnergyGridBin( const double energy,
+                                   size_t& bin_index,
+                                   double& interpolation_fraction ) const;
+
+  // Evaluate the values that are tabulated on the unionized energy grid
+  void evaluateUnionizedValues( const double energy,
+                                std::vector<double>& values ) const;
+
+  // Check if the unionized values at a bin midpoint can be interpolated
+  static bool canUnionizedMidpointValuesBeInterpolated(
+                                 const std::vector<double>& lower_values,
+                                 const std::vector<double>& upper_values,
+                                 const std::vector<double>& midpoint_values );
+
+  // Check if the unionized grid points between two grid points can be removed
+  static bool canUnionizedGridPointsBeRemoved(
+                 const std::vector<double>& energy_grid,
+                 const std::vector<double>& cumulative_total_cross_sections,
+                 const std::vector<double>& absorption_cross_section,
+                 const size_t number_of_scattering_centers,
+                 const size_t lower_index,
+                 const size_t upper_index,
+                 const double thinning_tol );
+
+  // Interpolate a value tabulated on the unionized energy grid
+  static double interpolateUnionizedValue( const double lower_value,
+                                           const double upper_value,
+                                           const double interpolation_fraction );
+
+  // The unionized energy grid refinement tolerance
+  static const double s_unionized_energy_grid_refinement_tol;
+
+  // The min relative width of a refined unionized energy grid bin
+  static const double s_min_relative_unionized_energy_grid_bin_width;
+
   // The ScatteringCenter::getTotalCrossSection function wrapper
   static MicroscopicCrossSectionEvaluationFunctor s_total_cs_evaluation_functor;
   // The ScatteringCenter::getAbsorptionCrossSection function wrapper
@@ -170,6 +221,23 @@ private:
   // The getMacroscopicTotalCrossSection function wrapper
   MacroscopicCrossSectionEvaluationFunctor
   d_macroscopic_total_cs_evaluation_functor;
+
+  // The unionized energy grid (empty if the grid has not been unionized)
+  std::shared_ptr<const std::vector<double> > d_unionized_energy_grid;
+
+  // The unionized energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_unionized_energy_grid_searcher;
+
+  // The cumulative macroscopic total cross sections of the scattering
+  // centers evaluated on the unionized energy grid (the row for grid point
+  // i starts at i*number_of_scattering_centers and the last entry in each
+  // row is the macroscopic total cross section)
+  std::vector<double> d_unionized_cumulative_total_cross_sections;
+
+  // The macroscopic absorption cross section evaluated on the unionized
+  // energy grid
+  std::vector<double> d_unionized_absorption_cross_section;
 };
 
 } // end MonteCarlo namespace
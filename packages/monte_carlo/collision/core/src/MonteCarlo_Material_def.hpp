@@ -9,8 +9,13 @@
 #ifndef MONTE_CARLO_MATERIAL_DEF_HPP
 #define MONTE_CARLO_MATERIAL_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
 // FRENSIE Includes
 #include "MonteCarlo_MaterialHelpers.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -33,6 +38,12 @@ Material<ScatteringCenter>::s_absorption_cs_evaluation_functor(
                                                    std::placeholders::_1,
                                                    std::placeholders::_2 ) );
 
+template<typename ScatteringCenter>
+const double Material<ScatteringCenter>::s_unionized_energy_grid_refinement_tol = 1e-6;
+
+template<typename ScatteringCenter>
+const double Material<ScatteringCenter>::s_min_relative_unionized_energy_grid_bin_width = 1e-9;
+
 // Constructor (without photonuclear data)
 template<typename ScatteringCenter>
 Material<ScatteringCenter>::Material(
@@ -176,13 +187,279 @@ double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const std::
   return Utility::get<0>( d_scattering_centers[index] );
 }
 
+// Unionize the energy grid of the material
+/*! \details The energy grid points of every scattering center that fall
+ * between the min and max energy will be merged (along with the min and max
+ * energy) into a single sorted energy grid without duplicate points. The
+ * macroscopic absorption cross section and the cumulative macroscopic total
+ * cross sections of the scattering centers will then be tabulated on this
+ * grid. The scattering center cross sections are evaluated in their native
+ * interpolation schemes (e.g. log-log), which linear interpolation on the
+ * unionized grid cannot reproduce between the grid points. The bins of the
+ * merged grid will therefore be bisected until linear interpolation
+ * reproduces the tabulated values at the bin midpoints to within a relative
+ * tolerance of 1e-6 (bins at cross section discontinuities stop being
+ * bisected once their relative width falls below 1e-9). If a thinning
+ * tolerance greater than zero is requested, grid points where the tabulated
+ * values can be linearly interpolated from the neighboring points to within
+ * the relative tolerance will be removed. Once the grid has been unionized,
+ * the macroscopic total and absorption cross section evaluations and the
+ * collision scattering center sampling will only require a single grid
+ * search (at the cost of storing the tabulated cross sections). Energies
+ * outside of the unionized energy grid will still be handled by evaluating
+ * the scattering center cross sections directly.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::unionizeEnergyGrid(
+                                                 const double min_energy,
+                                                 const double max_energy,
+                                                 const double thinning_tol )
+{
+  // Make sure the energies are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( min_energy < max_energy );
+  // Make sure the thinning tolerance is valid
+  testPrecondition( thinning_tol >= 0.0 );
+  testPrecondition( thinning_tol < 1.0 );
+
+  // Discard the old unionized data so that the scattering center cross
+  // sections are evaluated directly while the new grid is being tabulated
+  d_unionized_energy_grid.reset();
+  d_unionized_energy_grid_searcher.reset();
+  d_unionized_cumulative_total_cross_sections.clear();
+  d_unionized_absorption_cross_section.clear();
+
+  // Merge the energy grids of the scattering centers
+  std::vector<double> merged_energy_grid;
+
+  merged_energy_grid.push_back( min_energy );
+  merged_energy_grid.push_back( max_energy );
+
+  for( size_t j = 0; j < d_scattering_centers.size(); ++j )
+  {
+    Utility::get<1>( d_scattering_centers[j] )->getEnergyGridPoints(
+                                                          merged_energy_grid );
+  }
+
+  std::sort( merged_energy_grid.begin(), merged_energy_grid.end() );
+
+  merged_energy_grid.erase(
+              std::unique( merged_energy_grid.begin(), merged_energy_grid.end() ),
+              merged_energy_grid.end() );
+
+  merged_energy_grid.erase(
+         merged_energy_grid.begin(),
+         std::lower_bound( merged_energy_grid.begin(),
+                           merged_energy_grid.end(),
+                           min_energy ) );
+
+  merged_energy_grid.erase(
+         std::upper_bound( merged_energy_grid.begin(),
+                           merged_energy_grid.end(),
+                           max_energy ),
+         merged_energy_grid.end() );
+
+  // Tabulate the cross sections on the refined unionized energy grid
+  const size_t number_of_scattering_centers = d_scattering_centers.size();
+
+  std::shared_ptr<std::vector<double> >
+    energy_grid( new std::vector<double> );
+
+  energy_grid->reserve( merged_energy_grid.size() );
+
+  std::vector<double> cumulative_total_cross_sections;
+
+  cumulative_total_cross_sections.reserve(
+                     merged_energy_grid.size()*number_of_scattering_centers );
+
+  std::vector<double> absorption_cross_section;
+
+  absorption_cross_section.reserve( merged_energy_grid.size() );
+
+  try{
+    // The values at the last grid point (the cumulative total cross sections
+    // followed by the absorption cross section)
+    std::vector<double> lower_values;
+
+    this->evaluateUnionizedValues( merged_energy_grid.front(), lower_values );
+
+    energy_grid->push_back( merged_energy_grid.front() );
+
+    cumulative_total_cross_sections.insert(
+                        cumulative_total_cross_sections.end(),
+                        lower_values.begin(),
+                        lower_values.begin()+number_of_scattering_centers );
+
+    absorption_cross_section.push_back( lower_values.back() );
+
+    // The upper bin boundaries that have not been added to the grid yet
+    std::vector<double> upper_energies;
+    std::vector<std::vector<double> > upper_values;
+
+    std::vector<double> midpoint_values;
+
+    for( size_t i = 1; i < merged_energy_grid.size(); ++i )
+    {
+      upper_energies.assign( 1, merged_energy_grid[i] );
+      upper_values.resize( 1 );
+
+      this->evaluateUnionizedValues( merged_energy_grid[i],
+                                     upper_values.back() );
+
+      while( !upper_energies.empty() )
+      {
+        const double lower_energy = energy_grid->back();
+        const double upper_energy = upper_energies.back();
+
+        bool bisect_bin = false;
+
+        if( upper_energy - lower_energy >
+            s_min_relative_unionized_energy_grid_bin_width*upper_energy )
+        {
+          this->evaluateUnionizedValues( 0.5*(lower_energy + upper_energy),
+                                         midpoint_values );
+
+          bisect_bin = !ThisType::canUnionizedMidpointValuesBeInterpolated(
+                                                         lower_values,
+                                                         upper_values.back(),
+                                                         midpoint_values );
+        }
+
+        if( bisect_bin )
+        {
+          upper_energies.push_back( 0.5*(lower_energy + upper_energy) );
+          upper_values.push_back( midpoint_values );
+        }
+        else
+        {
+          lower_values.swap( upper_values.back() );
+
+          energy_grid->push_back( upper_energy );
+
+          cumulative_total_cross_sections.insert(
+                        cumulative_total_cross_sections.end(),
+                        lower_values.begin(),
+                        lower_values.begin()+number_of_scattering_centers );
+
+          absorption_cross_section.push_back( lower_values.back() );
+
+          upper_energies.pop_back();
+          upper_values.pop_back();
+        }
+      }
+    }
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Could not unionize the energy grid of material "
+                           << d_id << "!" );
+
+  // Thin the unionized energy grid
+  if( thinning_tol > 0.0 && energy_grid->size() > 2 )
+  {
+    std::vector<size_t> kept_point_indices( 1, 0 );
+
+    size_t upper_index = 2;
+
+    while( upper_index < energy_grid->size() )
+    {
+      if( !ThisType::canUnionizedGridPointsBeRemoved(
+                                             *energy_grid,
+                                             cumulative_total_cross_sections,
+                                             absorption_cross_section,
+                                             number_of_scattering_centers,
+                                             kept_point_indices.back(),
+                                             upper_index,
+                                             thinning_tol ) )
+      {
+        kept_point_indices.push_back( upper_index-1 );
+      }
+
+      ++upper_index;
+    }
+
+    kept_point_indices.push_back( energy_grid->size()-1 );
+
+    // Compact the tabulated data
+    for( size_t k = 0; k < kept_point_indices.size(); ++k )
+    {
+      const size_t i = kept_point_indices[k];
+
+      (*energy_grid)[k] = (*energy_grid)[i];
+      absorption_cross_section[k] = absorption_cross_section[i];
+
+      for( size_t j = 0; j < number_of_scattering_centers; ++j )
+      {
+        cumulative_total_cross_sections[k*number_of_scattering_centers+j] =
+          cumulative_total_cross_sections[i*number_of_scattering_centers+j];
+      }
+    }
+
+    energy_grid->resize( kept_point_indices.size() );
+    energy_grid->shrink_to_fit();
+
+    absorption_cross_section.resize( kept_point_indices.size() );
+    absorption_cross_section.shrink_to_fit();
+
+    cumulative_total_cross_sections.resize(
+                     kept_point_indices.size()*number_of_scattering_centers );
+    cumulative_total_cross_sections.shrink_to_fit();
+  }
+
+  d_unionized_cumulative_total_cross_sections.swap(
+                                             cumulative_total_cross_sections );
+  d_unionized_absorption_cross_section.swap( absorption_cross_section );
+
+  d_unionized_energy_grid_searcher.reset(
+        new Utility::StandardHashBasedGridSearcher<std::vector<double>,false>(
+                                                         energy_grid,
+                                                         energy_grid->size() ) );
+
+  d_unionized_energy_grid = energy_grid;
+}
+
+// Check if the energy grid of the material has been unionized
+template<typename ScatteringCenter>
+bool Material<ScatteringCenter>::isEnergyGridUnionized() const
+{
+  return d_unionized_energy_grid.get() != NULL;
+}
+
+// Return the unionized energy grid
+template<typename ScatteringCenter>
+const std::vector<double>& Material<ScatteringCenter>::getUnionizedEnergyGrid() const
+{
+  TEST_FOR_EXCEPTION( !this->isEnergyGridUnionized(),
+                      std::runtime_error,
+                      "The energy grid of material " << d_id << " has not "
+                      "been unionized!" );
+
+  return *d_unionized_energy_grid;
+}
+
 // Return the macroscopic total cross section (1/cm)
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicTotalCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection( energy,
-                                           s_total_cs_evaluation_functor );
+  size_t bin_index;
+  double interpolation_fraction;
+
+  if( this->findUnionizedEnergyGridBin( energy,
+                                        bin_index,
+                                        interpolation_fraction ) )
+  {
+    const size_t number_of_scattering_centers = d_scattering_centers.size();
+
+    return ThisType::interpolateUnionizedValue(
+             d_unionized_cumulative_total_cross_sections[(bin_index+1)*number_of_scattering_centers-1],
+             d_unionized_cumulative_total_cross_sections[(bin_index+2)*number_of_scattering_centers-1],
+             interpolation_fraction );
+  }
+  else
+  {
+    return this->getMacroscopicCrossSection( energy,
+                                             s_total_cs_evaluation_functor );
+  }
 }
 
 // Return the macroscopic absorption cross section (1/cm)
@@ -190,9 +467,24 @@ template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicAbsorptionCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection(
+  size_t bin_index;
+  double interpolation_fraction;
+
+  if( this->findUnionizedEnergyGridBin( energy,
+                                        bin_index,
+                                        interpolation_fraction ) )
+  {
+    return ThisType::interpolateUnionizedValue(
+                          d_unionized_absorption_cross_section[bin_index],
+                          d_unionized_absorption_cross_section[bin_index+1],
+                          interpolation_fraction );
+  }
+  else
+  {
+    return this->getMacroscopicCrossSection(
                                           energy,
                                           s_absorption_cs_evaluation_functor );
+  }
 }
 
 // Return the macroscopic cross section (1/cm) for a specific reaction
@@ -356,6 +648,15 @@ const ScatteringCenter& Material<ScatteringCenter>::getScatteringCenter( const s
   return *Utility::get<1>( d_scattering_centers[index] );
 }
 
+// Return the number density of the scattering center at the desired index
+template<typename ScatteringCenter>
+double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const size_t index ) const
+{
+  testPrecondition( index < d_scattering_centers.size() );
+
+  return Utility::get<0>( d_scattering_centers[index] );
+}
+
 // Get the atomic weight from an atom pointer
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getAtomicWeightFromPair(
@@ -408,10 +709,199 @@ size_t Material<ScatteringCenter>::sampleCollisionScatteringCenterImpl(
 template<typename ScatteringCenter>
 size_t Material<ScatteringCenter>::sampleCollisionScatteringCenter( const double energy ) const
 {
-  return this->sampleCollisionScatteringCenterImpl(
+  size_t bin_index;
+  double interpolation_fraction;
+
+  if( this->findUnionizedEnergyGridBin( energy,
+                                        bin_index,
+                                        interpolation_fraction ) )
+  {
+    const size_t number_of_scattering_centers = d_scattering_centers.size();
+
+    const double* lower_cumulative_cs =
+      d_unionized_cumulative_total_cross_sections.data() +
+      bin_index*number_of_scattering_centers;
+
+    const double* upper_cumulative_cs =
+      lower_cumulative_cs + number_of_scattering_centers;
+
+    const size_t last_index = number_of_scattering_centers - 1;
+
+    const double scaled_random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      ThisType::interpolateUnionizedValue( lower_cumulative_cs[last_index],
+                                           upper_cumulative_cs[last_index],
+                                           interpolation_fraction );
+
+    for( size_t i = 0u; i < last_index; ++i )
+    {
+      if( scaled_random_number <
+          ThisType::interpolateUnionizedValue( lower_cumulative_cs[i],
+                                               upper_cumulative_cs[i],
+                                               interpolation_fraction ) )
+        return i;
+    }
+
+    return last_index;
+  }
+  else
+  {
+    return this->sampleCollisionScatteringCenterImpl(
                                      energy,
                                      d_macroscopic_total_cs_evaluation_functor,
                                      s_total_cs_evaluation_functor );
+  }
+}
+
+// Find the unionized energy grid bin that an energy falls in
+/*! \details If the energy grid has not been unionized or the energy is
+ * outside of the unionized energy grid false will be returned.
+ */
+template<typename ScatteringCenter>
+inline bool Material<ScatteringCenter>::findUnionizedEnergyGridBin(
+                                         const double energy,
+                                         size_t& bin_index,
+                                         double& interpolation_fraction ) const
+{
+  if( !d_unionized_energy_grid )
+    return false;
+
+  if( !d_unionized_energy_grid_searcher->isValueWithinGridBounds( energy ) )
+    return false;
+
+  bin_index = d_unionized_energy_grid_searcher->findLowerBinIndex( energy );
+
+  // The upper grid boundary is assigned to the last bin
+  if( bin_index >= d_unionized_energy_grid->size() - 1 )
+    bin_index = d_unionized_energy_grid->size() - 2;
+
+  const double lower_energy = (*d_unionized_energy_grid)[bin_index];
+  const double upper_energy = (*d_unionized_energy_grid)[bin_index+1];
+
+  interpolation_fraction =
+    (energy - lower_energy)/(upper_energy - lower_energy);
+
+  return true;
+}
+
+// Check if the unionized grid points between two grid points can be removed
+/*! \details The points can be removed if the absorption cross section and
+ * the cumulative total cross sections at every point between the lower and
+ * upper grid point can be linearly interpolated from the values at the lower
+ * and upper grid point to within the relative tolerance.
+ */
+template<typename ScatteringCenter>
+bool Material<ScatteringCenter>::canUnionizedGridPointsBeRemoved(
+                const std::vector<double>& energy_grid,
+                const std::vector<double>& cumulative_total_cross_sections,
+                const std::vector<double>& absorption_cross_section,
+                const size_t number_of_scattering_centers,
+                const size_t lower_index,
+                const size_t upper_index,
+                const double thinning_tol )
+{
+  // Make sure the indices are valid
+  testPrecondition( lower_index < upper_index );
+  testPrecondition( upper_index < energy_grid.size() );
+
+  const double lower_energy = energy_grid[lower_index];
+  const double energy_bin_width = energy_grid[upper_index] - lower_energy;
+
+  for( size_t i = lower_index+1; i < upper_index; ++i )
+  {
+    const double interpolation_fraction =
+      (energy_grid[i] - lower_energy)/energy_bin_width;
+
+    const double interpolated_absorption_cs =
+      ThisType::interpolateUnionizedValue(
+                                      absorption_cross_section[lower_index],
+                                      absorption_cross_section[upper_index],
+                                      interpolation_fraction );
+
+    if( std::fabs( interpolated_absorption_cs - absorption_cross_section[i] ) >
+        thinning_tol*std::fabs( absorption_cross_section[i] ) )
+      return false;
+
+    for( size_t j = 0; j < number_of_scattering_centers; ++j )
+    {
+      const double interpolated_cumulative_total_cs =
+        ThisType::interpolateUnionizedValue(
+          cumulative_total_cross_sections[lower_index*number_of_scattering_centers+j],
+          cumulative_total_cross_sections[upper_index*number_of_scattering_centers+j],
+          interpolation_fraction );
+
+      const double cumulative_total_cs =
+        cumulative_total_cross_sections[i*number_of_scattering_centers+j];
+
+      if( std::fabs( interpolated_cumulative_total_cs - cumulative_total_cs ) >
+          thinning_tol*std::fabs( cumulative_total_cs ) )
+        return false;
+    }
+  }
+
+  return true;
+}
+
+// Evaluate the values that are tabulated on the unionized energy grid
+/*! \details The cumulative macroscopic total cross sections of the
+ * scattering centers will be stored first, followed by the macroscopic
+ * absorption cross section.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::evaluateUnionizedValues(
+                                             const double energy,
+                                             std::vector<double>& values ) const
+{
+  values.resize( d_scattering_centers.size()+1 );
+
+  double cumulative_total_cs = 0.0;
+
+  for( size_t j = 0; j < d_scattering_centers.size(); ++j )
+  {
+    cumulative_total_cs += Utility::get<0>( d_scattering_centers[j] )*
+      s_total_cs_evaluation_functor(
+                            *Utility::get<1>( d_scattering_centers[j] ), energy );
+
+    values[j] = cumulative_total_cs;
+  }
+
+  values.back() = this->getMacroscopicAbsorptionCrossSection( energy );
+}
+
+// Check if the unionized values at a bin midpoint can be interpolated
+template<typename ScatteringCenter>
+bool Material<ScatteringCenter>::canUnionizedMidpointValuesBeInterpolated(
+                                  const std::vector<double>& lower_values,
+                                  const std::vector<double>& upper_values,
+                                  const std::vector<double>& midpoint_values )
+{
+  // Make sure the values are valid
+  testPrecondition( lower_values.size() == midpoint_values.size() );
+  testPrecondition( upper_values.size() == midpoint_values.size() );
+
+  for( size_t k = 0; k < midpoint_values.size(); ++k )
+  {
+    const double interpolated_value = ThisType::interpolateUnionizedValue(
+                                                               lower_values[k],
+                                                               upper_values[k],
+                                                               0.5 );
+
+    if( std::fabs( interpolated_value - midpoint_values[k] ) >
+        s_unionized_energy_grid_refinement_tol*std::fabs( midpoint_values[k] ) )
+      return false;
+  }
+
+  return true;
+}
+
+// Interpolate a value tabulated on the unionized energy grid
+template<typename ScatteringCenter>
+inline double Material<ScatteringCenter>::interpolateUnionizedValue(
+                                          const double lower_value,
+                                          const double upper_value,
+                                          const double interpolation_fraction )
+{
+  return lower_value + interpolation_fraction*(upper_value - lower_value);
 }
 
 } // end MonteCarlo namespace
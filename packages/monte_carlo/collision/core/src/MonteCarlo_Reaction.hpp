@@ -9,7 +9,9 @@
 #ifndef MONTE_CARLO_REACTION_HPP
 #define MONTE_CARLO_REACTION_HPP
 
+// Std Lib Includes
 #include <cstddef>
+#include <vector>
 
 namespace MonteCarlo{
 
@@ -39,6 +41,10 @@ public:
   //! Return the max energy
   virtual double getMaxEnergy() const = 0;
 
+  //! Add the energy grid points of the reaction to the vector
+  virtual void getEnergyGridPoints(
+                            std::vector<double>& energy_grid_points ) const;
+
   //! Return the cross section at the given energy
   virtual double getCrossSection( const double energy ) const = 0;
 
@@ -58,6 +64,18 @@ inline bool Reaction::isEnergyGridShared( const Reaction& other_reaction ) const
   return this->getEnergyGridHead() == other_reaction.getEnergyGridHead();
 }
 
+// Add the energy grid points of the reaction to the vector
+/*! \details Only the threshold energy and the max energy are known by the
+ * base class. Reactions that store a tabulated energy grid should add every
+ * point of the grid.
+ */
+inline void Reaction::getEnergyGridPoints(
+                             std::vector<double>& energy_grid_points ) const
+{
+  energy_grid_points.push_back( this->getThresholdEnergy() );
+  energy_grid_points.push_back( this->getMaxEnergy() );
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_REACTION_HPP
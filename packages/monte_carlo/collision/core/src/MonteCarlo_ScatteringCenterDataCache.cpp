@@ -0,0 +1,447 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ScatteringCenterDataCache.cpp
+//! \author Alex Robinson
+//! \brief  The scattering center data cache class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_ScatteringCenterDataCache.hpp"
+#include "MonteCarlo_ParticleModeTypeTraits.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Collect the data tables that are required by the scattering centers
+/*! \details Only the data tables that are required by the particle mode
+ * of the simulation will be collected. Nuclear data tables will not be
+ * collected when the node shared memory data mode is on since those tables
+ * must be loaded collectively by every process on a node.
+ */
+void ScatteringCenterDataCache::addRequiredDataTables(
+                 const boost::filesystem::path& data_directory,
+                 const ScatteringCenterNameSet& scattering_center_names,
+                 const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
+                 const SimulationProperties& properties )
+{
+  const ParticleModeType mode = properties.getParticleMode();
+
+  ScatteringCenterNameSet::const_iterator scattering_center_name =
+    scattering_center_names.begin();
+
+  while( scattering_center_name != scattering_center_names.end() )
+  {
+    // Missing definitions will be reported by the scattering center factories
+    if( !scattering_center_definitions.doesDefinitionExist( *scattering_center_name ) )
+    {
+      ++scattering_center_name;
+
+      continue;
+    }
+
+    const ScatteringCenterDefinition& definition =
+      scattering_center_definitions.getDefinition( *scattering_center_name );
+
+    if( MonteCarlo::isParticleTypeCompatible( mode, NEUTRON ) &&
+        !properties.isNodeSharedMemoryDataModeOn() &&
+        definition.hasNuclearDataProperties() )
+    {
+      const Data::NuclearDataProperties& data_properties =
+        definition.getNuclearDataProperties();
+
+      if( data_properties.fileType() == Data::NuclearDataProperties::ACE_FILE )
+      {
+        this->addRequiredDataTable(
+                               ACE_TABLE,
+                               this->constructDataFilePath( data_directory,
+                                                            data_properties.filePath() ),
+                               data_properties.tableName(),
+                               data_properties.fileStartLine() );
+      }
+    }
+
+    if( MonteCarlo::isParticleTypeCompatible( mode, PHOTON ) &&
+        definition.hasPhotoatomicDataProperties() )
+    {
+      const Data::PhotoatomicDataProperties& data_properties =
+        definition.getPhotoatomicDataProperties();
+
+      if( data_properties.fileType() ==
+          Data::PhotoatomicDataProperties::ACE_EPR_FILE )
+      {
+        this->addRequiredDataTable(
+                               ACE_TABLE,
+                               this->constructDataFilePath( data_directory,
+                                                            data_properties.filePath() ),
+                               data_properties.tableName(),
+                               data_properties.fileStartLine() );
+      }
+      else if( data_properties.fileType() ==
+               Data::PhotoatomicDataProperties::Native_EPR_FILE )
+      {
+        this->addRequiredDataTable(
+                               NATIVE_EPR_TABLE,
+                               this->constructDataFilePath( data_directory,
+                                                            data_properties.filePath() ),
+                               "",
+                               0 );
+      }
+    }
+
+    // The electroatom and positronatom factories use the same data
+    if( MonteCarlo::isParticleTypeCompatible( mode, ELECTRON ) &&
+        definition.hasElectroatomicDataProperties() )
+    {
+      const Data::ElectroatomicDataProperties& data_properties =
+        definition.getElectroatomicDataProperties();
+
+      if( data_properties.fileType() ==
+          Data::ElectroatomicDataProperties::ACE_EPR_FILE )
+      {
+        this->addRequiredDataTable(
+                               ACE_TABLE,
+                               this->constructDataFilePath( data_directory,
+                                                            data_properties.filePath() ),
+                               data_properties.tableName(),
+                               data_properties.fileStartLine() );
+      }
+      else if( data_properties.fileType() ==
+               Data::ElectroatomicDataProperties::Native_EPR_FILE )
+      {
+        this->addRequiredDataTable(
+                               NATIVE_EPR_TABLE,
+                               this->constructDataFilePath( data_directory,
+                                                            data_properties.filePath() ),
+                               "",
+                               0 );
+      }
+    }
+
+    if( MonteCarlo::isParticleTypeCompatible( mode, ADJOINT_PHOTON ) &&
+        definition.hasAdjointPhotoatomicDataProperties() )
+    {
+      const Data::AdjointPhotoatomicDataProperties& data_properties =
+        definition.getAdjointPhotoatomicDataProperties();
+
+      if( data_properties.fileType() ==
+          Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE )
+      {
+        this->addRequiredDataTable(
+                               NATIVE_AEPR_TABLE,
+                               this->constructDataFilePath( data_directory,
+                                                            data_properties.filePath() ),
+                               "",
+                               0 );
+      }
+    }
+
+    if( MonteCarlo::isParticleTypeCompatible( mode, ADJOINT_ELECTRON ) &&
+        definition.hasAdjointElectroatomicDataProperties() )
+    {
+      const Data::AdjointElectroatomicDataProperties& data_properties =
+        definition.getAdjointElectroatomicDataProperties();
+
+      if( data_properties.fileType() ==
+          Data::AdjointElectroatomicDataProperties::Native_EPR_FILE )
+      {
+        this->addRequiredDataTable(
+                               NATIVE_AEPR_TABLE,
+                               this->constructDataFilePath( data_directory,
+                                                            data_properties.filePath() ),
+                               "",
+                               0 );
+      }
+    }
+
+    ++scattering_center_name;
+  }
+}
+
+// Load the required data tables
+/*! \details Every required data table will be read exactly once. The native
+ * tables stored in the flat binary format (.fbin) will be loaded
+ * concurrently using the requested number of OpenMP threads. The ACE tables
+ * will be loaded serially since every ACE file handler reads through the
+ * same Fortran unit (and the node shared memory ACE loads are collective
+ * over the node communicator). The other native tables will also be loaded
+ * serially since the boost archive loaders temporarily modify global
+ * serializer state.
+ */
+void ScatteringCenterDataCache::loadRequiredDataTables( const bool verbose )
+{
+  std::vector<DataTableInfo> concurrent_tables, serial_tables;
+
+  for( auto&& table : d_unloaded_tables )
+  {
+    if( this->canDataTableBeLoadedConcurrently( table.second ) )
+      concurrent_tables.push_back( table.second );
+    else
+      serial_tables.push_back( table.second );
+  }
+
+  d_unloaded_tables.clear();
+
+  if( verbose )
+  {
+    FRENSIE_LOG_NOTIFICATION( " Loading " << concurrent_tables.size() +
+                              serial_tables.size() << " data tables ("
+                              << concurrent_tables.size() <<
+                              " concurrently) ... " );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  // Load the tables that can be loaded concurrently
+  std::vector<std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer> >
+    epr_tables( concurrent_tables.size() );
+
+  std::vector<std::shared_ptr<const Data::AdjointElectronPhotonRelaxationDataContainer> >
+    aepr_tables( concurrent_tables.size() );
+
+  // Exceptions cannot leave the parallel region
+  std::vector<std::string> error_messages( concurrent_tables.size() );
+
+  const long long number_of_concurrent_tables = concurrent_tables.size();
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() ) schedule( dynamic )
+  for( long long i = 0; i < number_of_concurrent_tables; ++i )
+  {
+    const DataTableInfo& table = concurrent_tables[i];
+
+    try{
+      switch( table.type )
+      {
+        case NATIVE_EPR_TABLE:
+        {
+          epr_tables[i].reset( new Data::ElectronPhotonRelaxationDataContainer( table.file_path ) );
+          break;
+        }
+        case NATIVE_AEPR_TABLE:
+        {
+          aepr_tables[i].reset( new Data::AdjointElectronPhotonRelaxationDataContainer( table.file_path ) );
+          break;
+        }
+        default:
+        {
+          error_messages[i] = "the table cannot be loaded concurrently";
+        }
+      }
+    }
+    catch( const std::exception& exception )
+    {
+      error_messages[i] = exception.what();
+    }
+  }
+
+  for( size_t i = 0; i < concurrent_tables.size(); ++i )
+  {
+    const DataTableInfo& table = concurrent_tables[i];
+
+    TEST_FOR_EXCEPTION( !error_messages[i].empty(),
+                        std::runtime_error,
+                        "Could not load data table " << table.table_name <<
+                        " from " << table.file_path.string() << ": "
+                        << error_messages[i] );
+
+    const DataTableKey key( table.file_path.string(), table.table_name );
+
+    switch( table.type )
+    {
+      case NATIVE_EPR_TABLE:
+        d_epr_tables[key] = epr_tables[i];
+        break;
+      case NATIVE_AEPR_TABLE:
+        d_aepr_tables[key] = aepr_tables[i];
+        break;
+      default:
+        break;
+    }
+  }
+
+  // Load the remaining tables
+  for( auto&& table : serial_tables )
+  {
+    switch( table.type )
+    {
+      case ACE_TABLE:
+        this->getACETable( table.file_path,
+                           table.table_name,
+                           table.table_start_line );
+        break;
+      case NATIVE_EPR_TABLE:
+        this->getElectronPhotonRelaxationTable( table.file_path );
+        break;
+      case NATIVE_AEPR_TABLE:
+        this->getAdjointElectronPhotonRelaxationTable( table.file_path );
+        break;
+    }
+  }
+
+  if( verbose )
+  {
+    FRENSIE_LOG_NOTIFICATION( " Finished loading data tables." );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+}
+
+// Return the number of required data tables that have not been loaded
+size_t ScatteringCenterDataCache::getNumberOfUnloadedDataTables() const
+{
+  return d_unloaded_tables.size();
+}
+
+// Return the number of loaded data tables
+size_t ScatteringCenterDataCache::getNumberOfLoadedDataTables() const
+{
+  return d_ace_tables.size() + d_epr_tables.size() + d_aepr_tables.size();
+}
+
+// Get an ACE table
+/*! \details If the table has not been loaded yet it will be loaded and
+ * cached.
+ */
+std::shared_ptr<const Data::ACEFileHandler>
+ScatteringCenterDataCache::getACETable(
+                                  const boost::filesystem::path& ace_file_path,
+                                  const std::string& table_name,
+                                  const size_t table_start_line )
+{
+  const DataTableKey key( ace_file_path.string(), table_name );
+
+  std::shared_ptr<const Data::ACEFileHandler>& table = d_ace_tables[key];
+
+  if( !table )
+  {
+    table.reset( new Data::ACEFileHandler( ace_file_path,
+                                           table_name,
+                                           table_start_line,
+                                           true ) );
+
+    d_unloaded_tables.erase( key );
+  }
+
+  return table;
+}
+
+// Get a native electron-photon-relaxation table
+/*! \details If the table has not been loaded yet it will be loaded and
+ * cached.
+ */
+std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer>
+ScatteringCenterDataCache::getElectronPhotonRelaxationTable(
+                               const boost::filesystem::path& native_file_path )
+{
+  const DataTableKey key( native_file_path.string(), "" );
+
+  std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer>& table =
+    d_epr_tables[key];
+
+  if( !table )
+  {
+    table.reset( new Data::ElectronPhotonRelaxationDataContainer( native_file_path ) );
+
+    d_unloaded_tables.erase( key );
+  }
+
+  return table;
+}
+
+// Get a native adjoint electron-photon-relaxation table
+/*! \details If the table has not been loaded yet it will be loaded and
+ * cached.
+ */
+std::shared_ptr<const Data::AdjointElectronPhotonRelaxationDataContainer>
+ScatteringCenterDataCache::getAdjointElectronPhotonRelaxationTable(
+                               const boost::filesystem::path& native_file_path )
+{
+  const DataTableKey key( native_file_path.string(), "" );
+
+  std::shared_ptr<const Data::AdjointElectronPhotonRelaxationDataContainer>&
+    table = d_aepr_tables[key];
+
+  if( !table )
+  {
+    table.reset( new Data::AdjointElectronPhotonRelaxationDataContainer( native_file_path ) );
+
+    d_unloaded_tables.erase( key );
+  }
+
+  return table;
+}
+
+// Release all of the cached data tables
+void ScatteringCenterDataCache::clear()
+{
+  d_unloaded_tables.clear();
+  d_ace_tables.clear();
+  d_epr_tables.clear();
+  d_aepr_tables.clear();
+}
+
+// Construct the path to a data file
+/*! \details The path will be constructed in the same way as in the
+ * scattering center factories so that the cache keys match.
+ */
+boost::filesystem::path ScatteringCenterDataCache::constructDataFilePath(
+                                const boost::filesystem::path& data_directory,
+                                const boost::filesystem::path& file_path )
+{
+  boost::filesystem::path data_file_path = data_directory;
+  data_file_path /= file_path;
+  data_file_path.make_preferred();
+
+  return data_file_path;
+}
+
+// Check if a data table can be loaded concurrently with other tables
+/*! \details ACE tables can never be loaded concurrently since the ACE file
+ * handlers share a single Fortran unit.
+ */
+bool ScatteringCenterDataCache::canDataTableBeLoadedConcurrently(
+                                                   const DataTableInfo& info )
+{
+  if( info.type == ACE_TABLE )
+    return false;
+  else
+    return info.file_path.extension().string() == ".fbin";
+}
+
+// Add a required data table
+void ScatteringCenterDataCache::addRequiredDataTable(
+                                      const DataTableType type,
+                                      const boost::filesystem::path& file_path,
+                                      const std::string& table_name,
+                                      const size_t table_start_line )
+{
+  const DataTableKey key( file_path.string(), table_name );
+
+  if( !this->isDataTableLoaded( key ) )
+  {
+    DataTableInfo& info = d_unloaded_tables[key];
+
+    info.type = type;
+    info.file_path = file_path;
+    info.table_name = table_name;
+    info.table_start_line = table_start_line;
+  }
+}
+
+// Check if a data table has been loaded
+bool ScatteringCenterDataCache::isDataTableLoaded( const DataTableKey& key ) const
+{
+  return d_ace_tables.find( key ) != d_ace_tables.end() ||
+    d_epr_tables.find( key ) != d_epr_tables.end() ||
+    d_aepr_tables.find( key ) != d_aepr_tables.end();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ScatteringCenterDataCache.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,151 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ScatteringCenterDataCache.hpp
+//! \author Alex Robinson
+//! \brief  The scattering center data cache class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SCATTERING_CENTER_DATA_CACHE_HPP
+#define MONTE_CARLO_SCATTERING_CENTER_DATA_CACHE_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <string>
+#include <map>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
+#include "MonteCarlo_MaterialDefinitionDatabase.hpp"
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
+
+namespace MonteCarlo{
+
+/*! The scattering center data cache class
+ * \details This class will cache the raw data tables that are used to
+ * construct the scattering centers so that each table is only read once
+ * (e.g. when constructing a photoatom and an electroatom from the same
+ * table). The tables that will be required by a simulation can be collected
+ * from the scattering center definitions and loaded before any scattering
+ * centers are constructed (the native flat binary tables are loaded
+ * concurrently using the requested number of OpenMP threads). Tables that
+ * have not been collected will be loaded on demand.
+ * The cache should only be kept for as long as the scattering centers are
+ * being constructed since every loaded table will be kept in memory.
+ */
+class ScatteringCenterDataCache
+{
+
+public:
+
+  //! The scattering center name set
+  typedef MaterialDefinitionDatabase::ScatteringCenterNameSet ScatteringCenterNameSet;
+
+  //! Constructor
+  ScatteringCenterDataCache()
+  { /* ... */ }
+
+  //! Destructor
+  ~ScatteringCenterDataCache()
+  { /* ... */ }
+
+  //! Collect the data tables that are required by the scattering centers
+  void addRequiredDataTables(
+                 const boost::filesystem::path& data_directory,
+                 const ScatteringCenterNameSet& scattering_center_names,
+                 const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
+                 const SimulationProperties& properties );
+
+  //! Load the required data tables
+  void loadRequiredDataTables( const bool verbose = false );
+
+  //! Return the number of required data tables that have not been loaded
+  size_t getNumberOfUnloadedDataTables() const;
+
+  //! Return the number of loaded data tables
+  size_t getNumberOfLoadedDataTables() const;
+
+  //! Get an ACE table
+  std::shared_ptr<const Data::ACEFileHandler> getACETable(
+                                const boost::filesystem::path& ace_file_path,
+                                const std::string& table_name,
+                                const size_t table_start_line );
+
+  //! Get a native electron-photon-relaxation table
+  std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer>
+  getElectronPhotonRelaxationTable( const boost::filesystem::path& native_file_path );
+
+  //! Get a native adjoint electron-photon-relaxation table
+  std::shared_ptr<const Data::AdjointElectronPhotonRelaxationDataContainer>
+  getAdjointElectronPhotonRelaxationTable( const boost::filesystem::path& native_file_path );
+
+  //! Release all of the cached data tables
+  void clear();
+
+private:
+
+  // The data table type
+  enum DataTableType{
+    ACE_TABLE = 0,
+    NATIVE_EPR_TABLE,
+    NATIVE_AEPR_TABLE
+  };
+
+  // The data table key (file path, table name)
+  typedef std::pair<std::string,std::string> DataTableKey;
+
+  // The data table info
+  struct DataTableInfo
+  {
+    DataTableType type;
+    boost::filesystem::path file_path;
+    std::string table_name;
+    size_t table_start_line;
+  };
+
+  // Construct the path to a data file
+  static boost::filesystem::path constructDataFilePath(
+                                const boost::filesystem::path& data_directory,
+                                const boost::filesystem::path& file_path );
+
+  // Check if a data table can be loaded concurrently with other tables
+  static bool canDataTableBeLoadedConcurrently( const DataTableInfo& info );
+
+  // Add a required data table
+  void addRequiredDataTable( const DataTableType type,
+                             const boost::filesystem::path& file_path,
+                             const std::string& table_name,
+                             const size_t table_start_line );
+
+  // Check if a data table has been loaded
+  bool isDataTableLoaded( const DataTableKey& key ) const;
+
+  // The required data tables that have not been loaded
+  std::map<DataTableKey,DataTableInfo> d_unloaded_tables;
+
+  // The cached ACE tables
+  std::map<DataTableKey,std::shared_ptr<const Data::ACEFileHandler> >
+  d_ace_tables;
+
+  // The cached native epr tables
+  std::map<DataTableKey,std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer> >
+  d_epr_tables;
+
+  // The cached native aepr tables
+  std::map<DataTableKey,std::shared_ptr<const Data::AdjointElectronPhotonRelaxationDataContainer> >
+  d_aepr_tables;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SCATTERING_CENTER_DATA_CACHE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ScatteringCenterDataCache.hpp
+//---------------------------------------------------------------------------//
@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "Utility_Vector.hpp"
+#include "Utility_ArrayView.hpp"
 #include "Utility_InterpolationPolicy.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 
@@ -55,6 +56,15 @@ public:
      const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
      grid_searcher );
 
+  //! Constructor (cross section values stored in external memory)
+  StandardReactionBaseImpl(
+     const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+     const Utility::ArrayView<const double>& cross_section,
+     const std::shared_ptr<const void>& cross_section_storage,
+     const size_t threshold_energy_index,
+     const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+     grid_searcher );
+
   //! Destructor
   virtual ~StandardReactionBaseImpl()
   { /* ... */ }
@@ -75,13 +85,18 @@ public:
   //! Return the threshold energy
   double getThresholdEnergy() const final override;
 
+  //! Add the energy grid points of the reaction to the vector
+  void getEnergyGridPoints(
+               std::vector<double>& energy_grid_points ) const final override;
+
 protected:
 
   //! Return the head of the energy grid
   const double* getEnergyGridHead() const final override;
 
   //! Return the cross section at the given energy
-  double getCrossSectionImpl( const std::vector<double>& cross_section,
+  template<typename ArrayType>
+  double getCrossSectionImpl( const ArrayType& cross_section,
                               const double energy,
                               const size_t bin_index ) const;
 
@@ -99,8 +114,11 @@ private:
   // The processed incoming energy grid
   std::shared_ptr<const std::vector<double> > d_incoming_energy_grid;
 
+  // The storage that the cross section values are stored in
+  std::shared_ptr<const void> d_cross_section_storage;
+
   // The processed cross section values evaluated on the incoming e. grid
-  std::shared_ptr<const std::vector<double> > d_cross_section;
+  Utility::ArrayView<const double> d_cross_section;
 
   // The threshold energy index
   size_t d_threshold_energy_index;
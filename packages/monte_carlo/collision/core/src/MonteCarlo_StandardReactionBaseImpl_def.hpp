@@ -285,7 +285,10 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
        const std::shared_ptr<const std::vector<double> >& cross_section,
        const size_t threshold_energy_index )
   : d_incoming_energy_grid( incoming_energy_grid ),
-    d_cross_section( cross_section ),
+    d_cross_section_storage( cross_section ),
+    d_cross_section( cross_section ?
+                     Utility::arrayViewOfConst( *cross_section ) :
+                     Utility::ArrayView<const double>() ),
     d_threshold_energy_index( threshold_energy_index ),
     d_max_energy_index()
 {
@@ -326,7 +329,10 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
       grid_searcher )
   : d_incoming_energy_grid( incoming_energy_grid ),
-    d_cross_section( cross_section ),
+    d_cross_section_storage( cross_section ),
+    d_cross_section( cross_section ?
+                     Utility::arrayViewOfConst( *cross_section ) :
+                     Utility::ArrayView<const double>() ),
     d_threshold_energy_index( threshold_energy_index ),
     d_grid_searcher( grid_searcher )
 {
@@ -353,6 +359,51 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
   this->setGetCrossSectionFirstBinMethod();
 }
 
+// Constructor (cross section values stored in external memory)
+/*! \details The cross section values will not be copied. The cross section
+ * storage must own (or share ownership of) the memory that the cross section
+ * values are stored in, which allows the values to be stored in a raw data
+ * table (e.g. an ACE XSS array stored in node-local shared memory).
+ */
+template<typename ReactionBase,
+         typename InterpPolicy,
+         bool processed_cross_section>
+StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::StandardReactionBaseImpl(
+      const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+      const Utility::ArrayView<const double>& cross_section,
+      const std::shared_ptr<const void>& cross_section_storage,
+      const size_t threshold_energy_index,
+      const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+      grid_searcher )
+  : d_incoming_energy_grid( incoming_energy_grid ),
+    d_cross_section_storage( cross_section_storage ),
+    d_cross_section( cross_section ),
+    d_threshold_energy_index( threshold_energy_index ),
+    d_grid_searcher( grid_searcher )
+{
+  // Make sure the incoming energy grid is valid
+  testPrecondition( incoming_energy_grid.get() );
+  testPrecondition( incoming_energy_grid->size() > 0 );
+  testPrecondition( Utility::Sort::isSortedAscending(
+                        incoming_energy_grid->begin(),
+                        incoming_energy_grid->end() ) );
+  // Make sure the threshold energy is valid
+  testPrecondition( threshold_energy_index < incoming_energy_grid->size() );
+  // Make sure the cross section is valid
+  testPrecondition( cross_section_storage.get() );
+  testPrecondition( cross_section.size() > 0 );
+  testPrecondition( cross_section.size() + threshold_energy_index <=
+                    incoming_energy_grid->size() );
+  // Make sure the grid searcher is valid
+  testPrecondition( grid_searcher.get() );
+
+  // Set the max energy index
+  this->setMaxEnergyIndex();
+
+  // Set the get cross section first bin method
+  this->setGetCrossSectionFirstBinMethod();
+}
+
 // Test if the energy falls within the energy grid
 template<typename ReactionBase,
          typename InterpPolicy,
@@ -384,7 +435,7 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
                                                const double energy,
                                                const size_t bin_index ) const
 {
-  return this->getCrossSectionImpl( *d_cross_section, energy, bin_index );
+  return this->getCrossSectionImpl( d_cross_section, energy, bin_index );
 }
 
 // Return the cross section at the given energy
@@ -396,8 +447,9 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
 template<typename ReactionBase,
          typename InterpPolicy,
          bool processed_cross_section>
+template<typename ArrayType>
 double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::getCrossSectionImpl(
-                                      const std::vector<double>& cross_section,
+                                      const ArrayType& cross_section,
                                       const double energy,
                                       const size_t bin_index ) const
 {
@@ -455,6 +507,21 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
   return Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section>::returnEnergyOfInterest( (*d_incoming_energy_grid)[d_threshold_energy_index] );
 }
 
+// Add the energy grid points of the reaction to the vector
+/*! \details Every grid point from the threshold energy to the max energy
+ * will be added (processed grid points will be recovered first).
+ */
+template<typename ReactionBase,
+         typename InterpPolicy,
+         bool processed_cross_section>
+void StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::getEnergyGridPoints( std::vector<double>& energy_grid_points ) const
+{
+  for( size_t i = d_threshold_energy_index; i <= d_max_energy_index; ++i )
+  {
+    energy_grid_points.push_back( Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section>::returnEnergyOfInterest( (*d_incoming_energy_grid)[i] ) );
+  }
+}
+
 // Return the head of the energy grid
 template<typename ReactionBase,
          typename InterpPolicy,
@@ -470,7 +537,7 @@ template<typename ReactionBase,
          bool processed_cross_section>
 void StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::setMaxEnergyIndex()
 {
-  d_max_energy_index = d_threshold_energy_index + d_cross_section->size() - 1;
+  d_max_energy_index = d_threshold_energy_index + d_cross_section.size() - 1;
 }
 
 // Set the max energy index
@@ -0,0 +1,286 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstScatteringCenterDataCache.cpp
+//! \author Alex Robinson
+//! \brief  Scattering center data cache unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "MonteCarlo_ScatteringCenterDataCache.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::unique_ptr<const boost::filesystem::path> data_directory;
+std::unique_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase> scattering_center_definitions;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the required data tables can be collected
+FRENSIE_UNIT_TEST( ScatteringCenterDataCache, addRequiredDataTables )
+{
+  MonteCarlo::ScatteringCenterDataCache::ScatteringCenterNameSet
+    scattering_center_names( {"Pb", "Pb-Native", "Pb-Alias"} );
+
+  MonteCarlo::SimulationProperties properties;
+  properties.setParticleMode( MonteCarlo::PHOTON_MODE );
+
+  MonteCarlo::ScatteringCenterDataCache data_cache;
+
+  data_cache.addRequiredDataTables( *data_directory,
+                                    scattering_center_names,
+                                    *scattering_center_definitions,
+                                    properties );
+
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfUnloadedDataTables(), 2 );
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfLoadedDataTables(), 0 );
+
+  // The electroatoms use the same tables as the photoatoms
+  properties.setParticleMode( MonteCarlo::PHOTON_ELECTRON_MODE );
+
+  data_cache.addRequiredDataTables( *data_directory,
+                                    scattering_center_names,
+                                    *scattering_center_definitions,
+                                    properties );
+
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfUnloadedDataTables(), 2 );
+
+  // Adjoint tables are only required in adjoint modes
+  properties.setParticleMode( MonteCarlo::NEUTRON_MODE );
+
+  data_cache.clear();
+  data_cache.addRequiredDataTables( *data_directory,
+                                    scattering_center_names,
+                                    *scattering_center_definitions,
+                                    properties );
+
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfUnloadedDataTables(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the required data tables can be loaded
+FRENSIE_UNIT_TEST( ScatteringCenterDataCache, loadRequiredDataTables )
+{
+  MonteCarlo::ScatteringCenterDataCache::ScatteringCenterNameSet
+    scattering_center_names( {"Pb", "Pb-Native"} );
+
+  MonteCarlo::SimulationProperties properties;
+  properties.setParticleMode( MonteCarlo::PHOTON_ELECTRON_MODE );
+
+  MonteCarlo::ScatteringCenterDataCache data_cache;
+
+  data_cache.addRequiredDataTables( *data_directory,
+                                    scattering_center_names,
+                                    *scattering_center_definitions,
+                                    properties );
+
+  FRENSIE_REQUIRE_NO_THROW( data_cache.loadRequiredDataTables( true ) );
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfUnloadedDataTables(), 0 );
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfLoadedDataTables(), 2 );
+
+  // Collecting the tables again will not add the loaded tables
+  data_cache.addRequiredDataTables( *data_directory,
+                                    scattering_center_names,
+                                    *scattering_center_definitions,
+                                    properties );
+
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfUnloadedDataTables(), 0 );
+
+  // The cached tables will be returned
+  const Data::PhotoatomicDataProperties& ace_properties =
+    scattering_center_definitions->getDefinition( "Pb" ).getPhotoatomicDataProperties();
+
+  boost::filesystem::path ace_file_path = *data_directory;
+  ace_file_path /= ace_properties.filePath();
+  ace_file_path.make_preferred();
+
+  std::shared_ptr<const Data::ACEFileHandler> ace_table =
+    data_cache.getACETable( ace_file_path,
+                            ace_properties.tableName(),
+                            ace_properties.fileStartLine() );
+
+  FRENSIE_REQUIRE( ace_table.get() != NULL );
+  FRENSIE_CHECK_EQUAL( ace_table->getTableName(), "82000.12p" );
+  FRENSIE_CHECK_EQUAL( data_cache.getACETable( ace_file_path,
+                                               ace_properties.tableName(),
+                                               ace_properties.fileStartLine() ),
+                       ace_table );
+
+  const Data::PhotoatomicDataProperties& native_properties =
+    scattering_center_definitions->getDefinition( "Pb-Native" ).getPhotoatomicDataProperties();
+
+  boost::filesystem::path native_file_path = *data_directory;
+  native_file_path /= native_properties.filePath();
+  native_file_path.make_preferred();
+
+  std::shared_ptr<const Data::ElectronPhotonRelaxationDataContainer>
+    native_table = data_cache.getElectronPhotonRelaxationTable( native_file_path );
+
+  FRENSIE_REQUIRE( native_table.get() != NULL );
+  FRENSIE_CHECK_EQUAL( native_table->getAtomicNumber(), 82 );
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfLoadedDataTables(), 2 );
+
+  data_cache.clear();
+
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfLoadedDataTables(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that several ACE tables can be loaded when multiple threads are used
+FRENSIE_UNIT_TEST( ScatteringCenterDataCache, loadRequiredDataTables_ace_threads )
+{
+  MonteCarlo::ScatteringCenterDataCache::ScatteringCenterNameSet
+    scattering_center_names( {"Pb", "B", "O"} );
+
+  MonteCarlo::SimulationProperties properties;
+  properties.setParticleMode( MonteCarlo::PHOTON_MODE );
+
+  MonteCarlo::ScatteringCenterDataCache data_cache;
+
+  data_cache.addRequiredDataTables( *data_directory,
+                                    scattering_center_names,
+                                    *scattering_center_definitions,
+                                    properties );
+
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfUnloadedDataTables(), 3 );
+
+  FRENSIE_REQUIRE_NO_THROW( data_cache.loadRequiredDataTables( false ) );
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfUnloadedDataTables(), 0 );
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfLoadedDataTables(), 3 );
+
+  // Every cached table must match a table loaded on its own
+  for( auto&& scattering_center_name : scattering_center_names )
+  {
+    const Data::PhotoatomicDataProperties& ace_properties =
+      scattering_center_definitions->getDefinition( scattering_center_name ).getPhotoatomicDataProperties();
+
+    boost::filesystem::path ace_file_path = *data_directory;
+    ace_file_path /= ace_properties.filePath();
+    ace_file_path.make_preferred();
+
+    std::shared_ptr<const Data::ACEFileHandler> cached_ace_table =
+      data_cache.getACETable( ace_file_path,
+                              ace_properties.tableName(),
+                              ace_properties.fileStartLine() );
+
+    FRENSIE_REQUIRE( cached_ace_table.get() != NULL );
+    FRENSIE_CHECK_EQUAL( cached_ace_table->getTableName(),
+                         ace_properties.tableName() );
+
+    Data::ACEFileHandler ace_table( ace_file_path,
+                                    ace_properties.tableName(),
+                                    ace_properties.fileStartLine(),
+                                    true );
+
+    FRENSIE_CHECK_EQUAL( cached_ace_table->getTableNXSArray(),
+                         ace_table.getTableNXSArray() );
+    FRENSIE_CHECK_EQUAL( cached_ace_table->getTableJXSArray(),
+                         ace_table.getTableJXSArray() );
+    FRENSIE_CHECK_EQUAL( *cached_ace_table->getTableXSSArray(),
+                         *ace_table.getTableXSSArray() );
+  }
+
+  FRENSIE_CHECK_EQUAL( data_cache.getNumberOfLoadedDataTables(), 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_scattering_center_database_name;
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 4,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+  // Determine the database directory
+  boost::filesystem::path database_path =
+    test_scattering_center_database_name;
+
+  data_directory.reset(
+                  new boost::filesystem::path( database_path.parent_path() ) );
+  // Load the database
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::AtomProperties& pb_properties =
+    database.getAtomProperties( Data::Pb_ATOM );
+
+  // Initialize the scattering center definitions
+  scattering_center_definitions.reset( new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+  MonteCarlo::ScatteringCenterDefinition& pb_definition =
+    scattering_center_definitions->createDefinition( "Pb", Data::Pb_ATOM );
+
+  pb_definition.setPhotoatomicDataProperties(
+           pb_properties.getSharedPhotoatomicDataProperties(
+                                 Data::PhotoatomicDataProperties::ACE_EPR_FILE,
+                                 12 ) );
+
+  pb_definition.setElectroatomicDataProperties(
+           pb_properties.getSharedElectroatomicDataProperties(
+                               Data::ElectroatomicDataProperties::ACE_EPR_FILE,
+                               12 ) );
+
+  MonteCarlo::ScatteringCenterDefinition& pb_native_definition =
+    scattering_center_definitions->createDefinition( "Pb-Native",
+                                                     Data::Pb_ATOM );
+
+  pb_native_definition.setPhotoatomicDataProperties(
+           pb_properties.getSharedPhotoatomicDataProperties(
+                              Data::PhotoatomicDataProperties::Native_EPR_FILE,
+                              0 ) );
+
+  pb_native_definition.setElectroatomicDataProperties(
+           pb_properties.getSharedElectroatomicDataProperties(
+                            Data::ElectroatomicDataProperties::Native_EPR_FILE,
+                            0 ) );
+
+  scattering_center_definitions->createDefinitionAlias( "Pb", "Pb-Alias" );
+
+  // Initialize the additional ACE scattering center definitions
+  MonteCarlo::ScatteringCenterDefinition& b_definition =
+    scattering_center_definitions->createDefinition( "B", Data::B_ATOM );
+
+  b_definition.setPhotoatomicDataProperties(
+           database.getAtomProperties( Data::B_ATOM ).getSharedPhotoatomicDataProperties(
+                                 Data::PhotoatomicDataProperties::ACE_EPR_FILE,
+                                 12 ) );
+
+  MonteCarlo::ScatteringCenterDefinition& o_definition =
+    scattering_center_definitions->createDefinition( "O", Data::O_ATOM );
+
+  o_definition.setPhotoatomicDataProperties(
+           database.getAtomProperties( Data::O_ATOM ).getSharedPhotoatomicDataProperties(
+                                 Data::PhotoatomicDataProperties::ACE_EPR_FILE,
+                                 12 ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstScatteringCenterDataCache.cpp
+//---------------------------------------------------------------------------//
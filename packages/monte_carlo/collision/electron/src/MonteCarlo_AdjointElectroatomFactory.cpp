@@ -25,11 +25,17 @@ AdjointElectroatomFactory::AdjointElectroatomFactory(
      const ScatteringCenterNameSet& adjoint_electroatom_names,
      const ScatteringCenterDefinitionDatabase& adjoint_electroatom_definitions,
      const SimulationProperties& properties,
-     const bool verbose )
+     const bool verbose,
+     const std::shared_ptr<ScatteringCenterDataCache>& data_cache )
   : d_adjoint_electroatom_name_map(),
     d_adjoint_electroatomic_table_name_map(),
-    d_verbose( verbose )
+    d_verbose( verbose ),
+    d_data_cache( data_cache )
 {
+  // Create a private data table cache if one was not provided
+  if( !d_data_cache )
+    d_data_cache.reset( new ScatteringCenterDataCache );
+
   FRENSIE_LOG_NOTIFICATION( "Starting to load adjoint electroatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
@@ -131,9 +137,9 @@ void AdjointElectroatomFactory::createAdjointElectroatomFromNativeTable(
       FRENSIE_FLUSH_ALL_LOGS();
     }
 
-    // Create the native data container
-    Data::AdjointElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+    // Get the native data container
+    const Data::AdjointElectronPhotonRelaxationDataContainer& data_container =
+      *d_data_cache->getAdjointElectronPhotonRelaxationTable( native_file_path );
 
     // Make sure the min adjoint electron energy are within the energy grid limits
     TEST_FOR_EXCEPTION( properties.getMinAdjointElectronEnergy() < data_container.getAdjointElectronEnergyGrid().front(),
@@ -0,0 +1,256 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronScatteringDistribution.cpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron scattering distribution class def.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+CondensedHistoryElectronScatteringDistribution::CondensedHistoryElectronScatteringDistribution(
+                          const std::vector<double>& energy_grid,
+                          const std::vector<double>& transport_cross_section,
+                          const std::vector<double>& stopping_cross_section )
+  : d_energy_grid( energy_grid ),
+    d_transport_cross_section( transport_cross_section ),
+    d_stopping_cross_section( stopping_cross_section )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid.begin(),
+                                                      energy_grid.end() ) );
+  // Make sure the cross sections are valid
+  testPrecondition( transport_cross_section.size() == energy_grid.size() );
+  testPrecondition( stopping_cross_section.size() == energy_grid.size() );
+}
+
+// Return the elastic transport cross section (b)
+double CondensedHistoryElectronScatteringDistribution::getTransportCrossSection(
+                                                    const double energy ) const
+{
+  return this->interpolate( d_transport_cross_section, energy );
+}
+
+// Return the stopping cross section (MeV-b)
+double CondensedHistoryElectronScatteringDistribution::getStoppingCrossSection(
+                                                    const double energy ) const
+{
+  return this->interpolate( d_stopping_cross_section, energy );
+}
+
+// Interpolate the tabulated values at the desired energy
+/*! \details Energies outside of the energy grid will be assigned the value at
+ * the closest grid point.
+ */
+double CondensedHistoryElectronScatteringDistribution::interpolate(
+                                            const std::vector<double>& values,
+                                            const double energy ) const
+{
+  if( energy <= d_energy_grid.front() )
+    return values.front();
+  else if( energy >= d_energy_grid.back() )
+    return values.back();
+  else
+  {
+    const size_t bin_index =
+      Utility::Search::binaryLowerBoundIndex( d_energy_grid.begin(),
+                                              d_energy_grid.end(),
+                                              energy );
+
+    const double interp_fraction = (energy - d_energy_grid[bin_index])/
+      (d_energy_grid[bin_index+1] - d_energy_grid[bin_index]);
+
+    return values[bin_index] +
+      interp_fraction*(values[bin_index+1] - values[bin_index]);
+  }
+}
+
+// Calculate the screening parameter that reproduces the mean angle cosine
+/*! \details The screened Rutherford distribution,
+ * \f$p(\mu) \propto (1-\mu+2\eta)^{-2}\f$, has a mean value of
+ * \f$1-\mu\f$ equal to \f$2\eta\left[(1+\eta)\ln(1+1/\eta)-1\right]\f$, which
+ * increases monotonically from 0 to 1 with \f$\eta\f$. Since the mean angle
+ * cosine over a step only depends on \f$\Sigma_1 s\f$, a single table of
+ * \f$\ln\eta\f$ vs. \f$\ln\left[(1-\bar{\mu})/\bar{\mu}\right]\f$ covers every
+ * energy and step length. The table is calculated once and the
+ * interpolated screening parameter is refined with a single Newton
+ * iteration. If the mean angle cosine is not greater than 0 the distribution
+ * is isotropic and infinity will be returned.
+ */
+double CondensedHistoryElectronScatteringDistribution::calculateScreeningParameter(
+                                               const double mean_angle_cosine )
+{
+  // Make sure the mean angle cosine is valid
+  testPrecondition( mean_angle_cosine >= -1.0 );
+  testPrecondition( mean_angle_cosine < 1.0 );
+
+  if( mean_angle_cosine <= 0.0 )
+    return std::numeric_limits<double>::infinity();
+
+  const std::vector<double>& log_mean_ratios =
+    ThisType::getScreeningParameterTableLogMeanRatios();
+
+  const std::vector<double>& log_screening_parameters =
+    ThisType::getScreeningParameterTableLogScreeningParameters();
+
+  const double target_mean = 1.0 - mean_angle_cosine;
+
+  const double log_mean_ratio =
+    std::log( target_mean ) - std::log( mean_angle_cosine );
+
+  // Strongly peaked distribution
+  if( log_mean_ratio <= log_mean_ratios.front() )
+    return std::exp( log_screening_parameters.front() );
+
+  // Nearly isotropic distribution (1-mu_bar ~ 1/(3 eta))
+  else if( log_mean_ratio >= log_mean_ratios.back() )
+    return 1.0/(3.0*mean_angle_cosine);
+
+  const size_t bin_index =
+    Utility::Search::binaryLowerBoundIndex( log_mean_ratios.begin(),
+                                            log_mean_ratios.end(),
+                                            log_mean_ratio );
+
+  const double interp_fraction =
+    (log_mean_ratio - log_mean_ratios[bin_index])/
+    (log_mean_ratios[bin_index+1] - log_mean_ratios[bin_index]);
+
+  double log_eta = log_screening_parameters[bin_index] +
+    interp_fraction*(log_screening_parameters[bin_index+1] -
+                     log_screening_parameters[bin_index]);
+
+  // Refine the screening parameter (Newton iteration on ln(eta))
+  const double eta = std::exp( log_eta );
+
+  log_eta -= (ThisType::calculateMeanAngularDeflection( eta ) - target_mean)/
+    (eta*ThisType::calculateMeanAngularDeflectionDerivative( eta ));
+
+  return std::exp( log_eta );
+}
+
+// Calculate the mean value of 1-mu of the screened Rutherford distribution
+double CondensedHistoryElectronScatteringDistribution::calculateMeanAngularDeflection(
+                                                              const double eta )
+{
+  return 2.0*eta*((1.0 + eta)*std::log1p( 1.0/eta ) - 1.0);
+}
+
+// Calculate the derivative of the mean value of 1-mu w.r.t. eta
+double CondensedHistoryElectronScatteringDistribution::calculateMeanAngularDeflectionDerivative(
+                                                              const double eta )
+{
+  return 2.0*((1.0 + 2.0*eta)*std::log1p( 1.0/eta ) - 2.0);
+}
+
+// Return the screening parameter table log mean ratios
+/*! \details The table is created on the first call (this is thread safe).
+ */
+const std::vector<double>&
+CondensedHistoryElectronScatteringDistribution::getScreeningParameterTableLogMeanRatios()
+{
+  static const std::vector<double> log_mean_ratios =
+    ThisType::createScreeningParameterTable( true );
+
+  return log_mean_ratios;
+}
+
+// Return the screening parameter table log screening parameters
+/*! \details The table is created on the first call (this is thread safe).
+ */
+const std::vector<double>&
+CondensedHistoryElectronScatteringDistribution::getScreeningParameterTableLogScreeningParameters()
+{
+  static const std::vector<double> log_screening_parameters =
+    ThisType::createScreeningParameterTable( false );
+
+  return log_screening_parameters;
+}
+
+// Create the screening parameter table
+/*! \details The screening parameters are spaced logarithmically
+ * (20 points per decade) between 1e-20 and 1e6. Above 1e6 the mean value of
+ * 1-mu can no longer be distinguished from 1 accurately.
+ */
+std::vector<double>
+CondensedHistoryElectronScatteringDistribution::createScreeningParameterTable(
+                                                   const bool log_mean_ratios )
+{
+  const size_t points_per_decade = 20;
+  const int min_decade = -20;
+  const int max_decade = 6;
+
+  const size_t number_of_points = (max_decade - min_decade)*points_per_decade + 1;
+
+  std::vector<double> table( number_of_points );
+
+  for( size_t i = 0; i < number_of_points; ++i )
+  {
+    const double log_eta = std::log( 10.0 )*
+      (min_decade + (double)i/points_per_decade);
+
+    if( log_mean_ratios )
+    {
+      const double mean =
+        ThisType::calculateMeanAngularDeflection( std::exp( log_eta ) );
+
+      table[i] = std::log( mean ) - std::log( 1.0 - mean );
+    }
+    else
+      table[i] = log_eta;
+  }
+
+  return table;
+}
+
+// Sample a multiple scattering angle cosine with the desired mean
+double CondensedHistoryElectronScatteringDistribution::sampleAngleCosine(
+                                               const double mean_angle_cosine )
+{
+  // Make sure the mean angle cosine is valid
+  testPrecondition( mean_angle_cosine >= -1.0 );
+  testPrecondition( mean_angle_cosine <= 1.0 );
+
+  // There is no deflection
+  if( mean_angle_cosine == 1.0 )
+    return 1.0;
+
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  const double eta =
+    CondensedHistoryElectronScatteringDistribution::calculateScreeningParameter( mean_angle_cosine );
+
+  // Isotropic scattering
+  if( eta == std::numeric_limits<double>::infinity() )
+    return 2.0*random_number - 1.0;
+  else
+  {
+    double angle_cosine =
+      1.0 - 2.0*eta*random_number/(1.0 - random_number + eta);
+
+    // Correct for roundoff
+    if( angle_cosine < -1.0 )
+      angle_cosine = -1.0;
+
+    return angle_cosine;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron scattering distribution class decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_HPP
+#define MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_HPP
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The condensed history electron scattering distribution class
+ * \details This distribution stores the data that is needed to group the soft
+ * collisions (elastic and atomic excitation) of an electron into a condensed
+ * history step. The elastic transport cross section
+ * (\f$\sigma_1 = \int(1-\mu)\frac{d\sigma_{el}}{d\mu}d\mu\f$) determines the
+ * mean angular deflection over a step and the stopping cross section
+ * (atomic excitation cross section times the atomic excitation energy loss)
+ * determines the energy lost over a step. The angular deflection over a step
+ * is sampled from a screened Rutherford distribution with a screening
+ * parameter that reproduces the mean angular deflection (the screening
+ * parameters are looked up in a precomputed table). The other soft
+ * collisions (e.g. electroionization with small energy transfers) are not
+ * condensed - they are still simulated individually as hard collisions.
+ */
+class CondensedHistoryElectronScatteringDistribution
+{
+
+public:
+
+  //! Typedef for this type
+  typedef CondensedHistoryElectronScatteringDistribution ThisType;
+
+  //! Constructor
+  CondensedHistoryElectronScatteringDistribution(
+                          const std::vector<double>& energy_grid,
+                          const std::vector<double>& transport_cross_section,
+                          const std::vector<double>& stopping_cross_section );
+
+  //! Destructor
+  ~CondensedHistoryElectronScatteringDistribution()
+  { /* ... */ }
+
+  //! Return the elastic transport cross section (b)
+  double getTransportCrossSection( const double energy ) const;
+
+  //! Return the stopping cross section (MeV-b)
+  double getStoppingCrossSection( const double energy ) const;
+
+  //! Calculate the screening parameter that reproduces the mean angle cosine
+  static double calculateScreeningParameter( const double mean_angle_cosine );
+
+  //! Calculate the mean value of 1-mu of the screened Rutherford distribution
+  static double calculateMeanAngularDeflection( const double eta );
+
+  //! Sample a multiple scattering angle cosine with the desired mean
+  static double sampleAngleCosine( const double mean_angle_cosine );
+
+private:
+
+  // Calculate the derivative of the mean value of 1-mu w.r.t. eta
+  static double calculateMeanAngularDeflectionDerivative( const double eta );
+
+  // Return the screening parameter table log mean ratios
+  static const std::vector<double>& getScreeningParameterTableLogMeanRatios();
+
+  // Return the screening parameter table log screening parameters
+  static const std::vector<double>&
+  getScreeningParameterTableLogScreeningParameters();
+
+  // Create the screening parameter table
+  static std::vector<double> createScreeningParameterTable(
+                                                  const bool log_mean_ratios );
+
+  // Interpolate the tabulated values at the desired energy
+  double interpolate( const std::vector<double>& values,
+                      const double energy ) const;
+
+  // The energy grid (MeV)
+  std::vector<double> d_energy_grid;
+
+  // The elastic transport cross section (b)
+  std::vector<double> d_transport_cross_section;
+
+  // The stopping cross section (MeV-b)
+  std::vector<double> d_stopping_cross_section;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp
+//---------------------------------------------------------------------------//
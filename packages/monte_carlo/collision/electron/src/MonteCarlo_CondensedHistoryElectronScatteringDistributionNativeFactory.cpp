@@ -0,0 +1,238 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronScatteringDistributionNativeFactory.cpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron scattering distribution native
+//!         factory definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_ElasticElectronTraits.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Create a condensed history distribution
+/*! \details The elastic transport cross section will only be calculated if
+ * elastic mode is on and the stopping cross section will only be calculated
+ * if atomic excitation mode is on. The tables are evaluated on the electron
+ * energy grid.
+ */
+void CondensedHistoryElectronScatteringDistributionNativeFactory::createCondensedHistoryDistribution(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            const SimulationElectronProperties& properties,
+            std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+            condensed_history_distribution )
+{
+  const std::vector<double>& energy_grid =
+    data_container.getElectronEnergyGrid();
+
+  std::vector<double> transport_cross_section( energy_grid.size(), 0.0 );
+  std::vector<double> stopping_cross_section( energy_grid.size(), 0.0 );
+
+  if( properties.isElasticModeOn() )
+  {
+    ThisType::calculateTransportCrossSection( data_container,
+                                              transport_cross_section );
+  }
+
+  if( properties.isAtomicExcitationModeOn() )
+  {
+    ThisType::calculateStoppingCrossSection( data_container,
+                                             stopping_cross_section );
+  }
+
+  condensed_history_distribution.reset(
+        new CondensedHistoryElectronScatteringDistribution(
+                                                    energy_grid,
+                                                    transport_cross_section,
+                                                    stopping_cross_section ) );
+}
+
+// Calculate the elastic transport cross section on the electron energy grid
+/*! \details The transport cross section is the sum of the cutoff elastic
+ * cross section weighted by the mean value of 1-mu of the cutoff elastic
+ * distribution and the screened Rutherford cross section weighted by the
+ * mean value of 1-mu of the screened Rutherford distribution (integrated
+ * analytically over the angle cosines above the peak angle cosine, which is
+ * where the screened Rutherford reaction samples its angles). The mean value
+ * of 1-mu of the cutoff elastic distribution is linearly interpolated between
+ * the elastic angular energy grid points.
+ */
+void CondensedHistoryElectronScatteringDistributionNativeFactory::calculateTransportCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& transport_cross_section )
+{
+  const std::vector<double>& energy_grid =
+    data_container.getElectronEnergyGrid();
+
+  // Calculate the mean angular deflection at each angular grid point
+  const std::map<double,std::vector<double> >& cutoff_elastic_angles =
+    data_container.getCutoffElasticAngles();
+
+  const std::map<double,std::vector<double> >& cutoff_elastic_pdf =
+    data_container.getCutoffElasticPDF();
+
+  std::vector<double> angular_energy_grid, mean_angular_deflection;
+  angular_energy_grid.reserve( cutoff_elastic_angles.size() );
+  mean_angular_deflection.reserve( cutoff_elastic_angles.size() );
+
+  for( auto&& energy_angles_pair : cutoff_elastic_angles )
+  {
+    angular_energy_grid.push_back( energy_angles_pair.first );
+
+    mean_angular_deflection.push_back(
+          ThisType::calculateMeanAngularDeflection(
+                       energy_angles_pair.second,
+                       cutoff_elastic_pdf.find( energy_angles_pair.first )->second ) );
+  }
+
+  const std::vector<double>& cutoff_cross_section =
+    data_container.getCutoffElasticCrossSection();
+
+  const size_t cutoff_threshold_index =
+    data_container.getCutoffElasticCrossSectionThresholdEnergyIndex();
+
+  const std::vector<double>& screened_rutherford_cross_section =
+    data_container.getScreenedRutherfordElasticCrossSection();
+
+  const size_t screened_rutherford_threshold_index =
+    data_container.getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex();
+
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    if( i >= cutoff_threshold_index && !angular_energy_grid.empty() )
+    {
+      double cutoff_mean_angular_deflection;
+
+      if( energy_grid[i] <= angular_energy_grid.front() )
+        cutoff_mean_angular_deflection = mean_angular_deflection.front();
+      else if( energy_grid[i] >= angular_energy_grid.back() )
+        cutoff_mean_angular_deflection = mean_angular_deflection.back();
+      else
+      {
+        const size_t bin_index =
+          Utility::Search::binaryLowerBoundIndex( angular_energy_grid.begin(),
+                                                  angular_energy_grid.end(),
+                                                  energy_grid[i] );
+
+        const double interp_fraction =
+          (energy_grid[i] - angular_energy_grid[bin_index])/
+          (angular_energy_grid[bin_index+1] - angular_energy_grid[bin_index]);
+
+        cutoff_mean_angular_deflection = mean_angular_deflection[bin_index] +
+          interp_fraction*(mean_angular_deflection[bin_index+1] -
+                           mean_angular_deflection[bin_index]);
+      }
+
+      transport_cross_section[i] +=
+        cutoff_cross_section[i-cutoff_threshold_index]*
+        cutoff_mean_angular_deflection;
+    }
+
+    if( i >= screened_rutherford_threshold_index )
+    {
+      transport_cross_section[i] +=
+        screened_rutherford_cross_section[i-screened_rutherford_threshold_index]*
+        ThisType::calculateScreenedRutherfordMeanAngularDeflection(
+                                          energy_grid[i],
+                                          data_container.getAtomicNumber() );
+    }
+  }
+}
+
+// Calculate the stopping cross section on the electron energy grid
+/*! \details The stopping cross section is the atomic excitation cross section
+ * multiplied by the atomic excitation energy loss.
+ */
+void CondensedHistoryElectronScatteringDistributionNativeFactory::calculateStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section )
+{
+  const std::vector<double>& energy_grid =
+    data_container.getElectronEnergyGrid();
+
+  Utility::TabularDistribution<Utility::LogLog> energy_loss_function(
+                         data_container.getAtomicExcitationEnergyGrid(),
+                         data_container.getAtomicExcitationEnergyLoss() );
+
+  const std::vector<double>& excitation_cross_section =
+    data_container.getAtomicExcitationCrossSection();
+
+  const size_t threshold_index =
+    data_container.getAtomicExcitationCrossSectionThresholdEnergyIndex();
+
+  for( size_t i = threshold_index; i < energy_grid.size(); ++i )
+  {
+    stopping_cross_section[i] =
+      excitation_cross_section[i-threshold_index]*
+      energy_loss_function.evaluate( energy_grid[i] );
+  }
+}
+
+// Calculate the mean value of 1-mu of the screened Rutherford distribution
+/*! \details The screened Rutherford distribution,
+ * \f$p(\mu) \propto (\eta+1-\mu)^{-2}\f$, is only used above the peak
+ * angle cosine (\f$0 \leq 1-\mu \leq \Delta\mu_p\f$). Integrating the
+ * distribution over this range gives a mean value of 1-mu of
+ * \f$\frac{\eta(\eta+\Delta\mu_p)}{\Delta\mu_p}\left[\ln(1+\Delta\mu_p/\eta) -
+ * \frac{\Delta\mu_p}{\eta+\Delta\mu_p}\right]\f$, where \f$\eta\f$ is
+ * Moliere's screening constant.
+ */
+double CondensedHistoryElectronScatteringDistributionNativeFactory::calculateScreenedRutherfordMeanAngularDeflection(
+                                                const double energy,
+                                                const unsigned atomic_number )
+{
+  const double eta =
+    ElasticElectronTraits::evaluateMoliereScreeningConstant( energy,
+                                                             atomic_number );
+
+  const double delta_mu_peak = ElasticElectronTraits::delta_mu_peak;
+
+  return eta*(eta + delta_mu_peak)/delta_mu_peak*
+    (std::log1p( delta_mu_peak/eta ) - delta_mu_peak/(eta + delta_mu_peak));
+}
+
+// Calculate the mean value of 1-mu of a cutoff elastic distribution
+/*! \details The pdf is assumed to be linear between the tabulated angle
+ * cosines, which allows the moments to be integrated exactly.
+ */
+double CondensedHistoryElectronScatteringDistributionNativeFactory::calculateMeanAngularDeflection(
+                                           const std::vector<double>& angles,
+                                           const std::vector<double>& pdf )
+{
+  // Make sure the distribution is valid
+  testPrecondition( angles.size() == pdf.size() );
+  testPrecondition( angles.size() > 1 );
+
+  double norm = 0.0;
+  double first_moment = 0.0;
+
+  for( size_t i = 0; i < angles.size()-1; ++i )
+  {
+    const double bin_width = angles[i+1] - angles[i];
+
+    norm += 0.5*bin_width*(pdf[i] + pdf[i+1]);
+
+    first_moment += bin_width*((1.0 - angles[i])*(2.0*pdf[i] + pdf[i+1]) +
+                               (1.0 - angles[i+1])*(pdf[i] + 2.0*pdf[i+1]))/6.0;
+  }
+
+  if( norm > 0.0 )
+    return first_moment/norm;
+  else
+    return 0.0;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronScatteringDistributionNativeFactory.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,67 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronScatteringDistributionNativeFactory.hpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron scattering distribution native
+//!         factory declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_NATIVE_FACTORY_HPP
+#define MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_NATIVE_FACTORY_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
+#include "MonteCarlo_SimulationElectronProperties.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+
+namespace MonteCarlo{
+
+//! The condensed history scattering distribution factory class that uses Native data
+class CondensedHistoryElectronScatteringDistributionNativeFactory
+{
+
+public:
+
+  using ThisType = CondensedHistoryElectronScatteringDistributionNativeFactory;
+
+  //! Create a condensed history distribution
+  static void createCondensedHistoryDistribution(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            const SimulationElectronProperties& properties,
+            std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+            condensed_history_distribution );
+
+protected:
+
+  //! Calculate the elastic transport cross section on the electron energy grid
+  static void calculateTransportCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& transport_cross_section );
+
+  //! Calculate the stopping cross section on the electron energy grid
+  static void calculateStoppingCrossSection(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::vector<double>& stopping_cross_section );
+
+  //! Calculate the mean value of 1-mu of the screened Rutherford distribution
+  static double calculateScreenedRutherfordMeanAngularDeflection(
+                                               const double energy,
+                                               const unsigned atomic_number );
+
+  //! Calculate the mean value of 1-mu of a cutoff elastic distribution
+  static double calculateMeanAngularDeflection(
+                                           const std::vector<double>& angles,
+                                           const std::vector<double>& pdf );
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_SCATTERING_DISTRIBUTION_NATIVE_FACTORY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronScatteringDistributionNativeFactory.hpp
+//---------------------------------------------------------------------------//
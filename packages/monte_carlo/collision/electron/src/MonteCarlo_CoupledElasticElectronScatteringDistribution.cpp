@@ -66,6 +66,28 @@ void CoupledElasticElectronScatteringDistribution::setSamplingMethod(
   }
 }
 
+// Set the inverse cdf sampling table of the tabular distribution
+/*! \details When a sampling table is set it will be used instead of the
+ * tabular distribution when sampling (the tabular distribution will still be
+ * used for all evaluations). The sampling table must have been constructed
+ * from the tabular distribution. A null sampling table can be used to
+ * remove the current sampling table.
+ */
+void CoupledElasticElectronScatteringDistribution::setInverseCDFSamplingTable(
+     const std::shared_ptr<const ElasticInverseCDFSamplingTable>& sampling_table )
+{
+  d_sampling_table = sampling_table;
+}
+
+// Return the memory used by the inverse cdf sampling table (bytes)
+size_t CoupledElasticElectronScatteringDistribution::getInverseCDFSamplingTableMemoryUsage() const
+{
+  if( d_sampling_table )
+    return d_sampling_table->getMemoryUsage();
+  else
+    return 0;
+}
+
 // Evaluate the distribution at the given energy and scattering angle cosine
 //! \details When the scattering angle cosine is very close to one, precision will be lost.
 double CoupledElasticElectronScatteringDistribution::evaluate(
@@ -431,8 +453,7 @@ double CoupledElasticElectronScatteringDistribution::sampleOneDUnion(
   double random_number =
             Utility::RandomNumberGenerator::getRandomNumber<double>();
 
-  return d_coupled_dist->sampleSecondaryConditionalWithRandomNumber(
-     incoming_energy, random_number );
+  return this->sampleTabularWithRandomNumber( incoming_energy, random_number );
 }
 
 // Sample using the 2-D Union method
@@ -461,8 +482,8 @@ double CoupledElasticElectronScatteringDistribution::sampleTwoDUnion(
     return ElasticTraits::mu_peak;
   else if ( random_number < cutoff_ratio ) // Sample tabular Cutoff
   {
-    return d_coupled_dist->sampleSecondaryConditionalWithRandomNumber(
-                               incoming_energy, random_number );
+    return this->sampleTabularWithRandomNumber( incoming_energy,
+                                                random_number );
   }
   else
   {
@@ -502,15 +523,11 @@ double CoupledElasticElectronScatteringDistribution::sampleModifiedTwoDUnion(
   {
     // Sample the scattering angle cosine from the tabular part of the distribution
     double raw_angle_cosine =
-      d_coupled_dist->sampleSecondaryConditionalWithRandomNumber(
-                                                 incoming_energy,
-                                                 random_number );
+      this->sampleTabularWithRandomNumber( incoming_energy, random_number );
 
     // Normalized the scattering angle cosine to the cosine at cutoff ratio
     double max_angle_cosine =
-      d_coupled_dist->sampleSecondaryConditionalWithRandomNumber(
-                                                 incoming_energy,
-                                                 cutoff_ratio );
+      this->sampleTabularWithRandomNumber( incoming_energy, cutoff_ratio );
 
     /* Normalize the sampled value to range of ( -1 <= mu <= mu_peak )
      * ( mu_raw + 1 )*( mu_peak + 1 )/( mu_max + 1 ) -1 */
@@ -526,6 +543,23 @@ double CoupledElasticElectronScatteringDistribution::sampleModifiedTwoDUnion(
   }
 }
 
+// Sample the tabular distribution using the desired random number
+double CoupledElasticElectronScatteringDistribution::sampleTabularWithRandomNumber(
+                                            const double incoming_energy,
+                                            const double random_number ) const
+{
+  if( d_sampling_table )
+  {
+    return d_sampling_table->sampleWithRandomNumber( incoming_energy,
+                                                     random_number );
+  }
+  else
+  {
+    return d_coupled_dist->sampleSecondaryConditionalWithRandomNumber(
+                                             incoming_energy, random_number );
+  }
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
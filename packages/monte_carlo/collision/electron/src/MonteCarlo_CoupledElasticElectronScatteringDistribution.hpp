@@ -18,6 +18,7 @@
 #include "MonteCarlo_ElasticElectronDistributionType.hpp"
 #include "MonteCarlo_CoupledElasticDistribution.hpp"
 #include "MonteCarlo_ElasticElectronTraits.hpp"
+#include "MonteCarlo_ElasticInverseCDFSamplingTable.hpp"
 #include "Utility_InterpolationPolicy.hpp"
 #include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
 
@@ -60,6 +61,13 @@ public:
   //! Set the sampling method ( 2-D Union - Default )
   void setSamplingMethod( const MonteCarlo::CoupledElasticSamplingMethod& method );
 
+  //! Set the inverse cdf sampling table of the tabular distribution
+  void setInverseCDFSamplingTable(
+     const std::shared_ptr<const ElasticInverseCDFSamplingTable>& sampling_table );
+
+  //! Return the memory used by the inverse cdf sampling table (bytes)
+  size_t getInverseCDFSamplingTableMemoryUsage() const;
+
   //! Evaluate the distribution
   double evaluate( const double incoming_energy,
                    const double scattering_angle_cosine ) const override;
@@ -166,9 +174,16 @@ protected:
 
 private:
 
+  // Sample the tabular distribution using the desired random number
+  double sampleTabularWithRandomNumber( const double incoming_energy,
+                                        const double random_number ) const;
+
   // Cutoff elastic scattering distribution
   std::shared_ptr<const BasicBivariateDist> d_coupled_dist;
 
+  // The inverse cdf sampling table of the tabular distribution (optional)
+  std::shared_ptr<const ElasticInverseCDFSamplingTable> d_sampling_table;
+
   // Cutoff elastic scattering distribution
   std::shared_ptr<const UnivariateDist> d_cutoff_ratios;
 
@@ -19,6 +19,7 @@
 #include "MonteCarlo_HybridElasticElectronScatteringDistribution.hpp"
 #include "MonteCarlo_CutoffElasticElectronScatteringDistribution.hpp"
 #include "MonteCarlo_ElasticElectronTraits.hpp"
+#include "MonteCarlo_ElasticInverseCDFSamplingTable.hpp"
 #include "Data_AdjointElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
@@ -50,7 +51,9 @@ public:
         coupled_elastic_distribution,
     const Data::ElectronPhotonRelaxationDataContainer& data_container,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table = false,
+    const double inverse_cdf_table_tol = 1e-4 );
 
   //! Create the coupled elastic distribution ( combined Cutoff and Screened Rutherford )
   template<typename TwoDInterpPolicy = Utility::LogNudgedLogCosLog,
@@ -63,7 +66,9 @@ public:
     const std::shared_ptr<const std::vector<double> > total_cross_section,
     const Data::ElectronPhotonRelaxationDataContainer& data_container,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table = false,
+    const double inverse_cdf_table_tol = 1e-4 );
 
   //! Create the hybrid elastic distribution ( combined Cutoff and Moment Preserving )
   template<typename TwoDInterpPolicy = Utility::LogNudgedLogCosLog,
@@ -76,7 +81,9 @@ public:
     const std::shared_ptr<const std::vector<double> > moment_preserving_cross_section,
     const Data::ElectronPhotonRelaxationDataContainer& data_container,
     const double cutoff_angle_cosine,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table = false,
+    const double inverse_cdf_table_tol = 1e-4 );
 
   //! Create a cutoff elastic distribution
   template<typename TwoDInterpPolicy = Utility::LogLogCosLog,
@@ -123,7 +130,9 @@ public:
     const std::shared_ptr<const std::vector<double> > total_cross_section,
     const Data::AdjointElectronPhotonRelaxationDataContainer& data_container,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table = false,
+    const double inverse_cdf_table_tol = 1e-4 );
 
   //! Create the hybrid elastic distribution ( combined Cutoff and Moment Preserving )
   template<typename TwoDInterpPolicy = Utility::LogNudgedLogCosLog,
@@ -136,7 +145,9 @@ public:
     const std::shared_ptr<const std::vector<double> > moment_preserving_cross_section,
     const Data::AdjointElectronPhotonRelaxationDataContainer& data_container,
     const double cutoff_angle_cosine,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table = false,
+    const double inverse_cdf_table_tol = 1e-4 );
 
   //! Create a cutoff elastic distribution
   template<typename TwoDInterpPolicy = Utility::LogLogCosLog,
@@ -186,7 +197,9 @@ public:
     const std::vector<double>& angular_energy_grid,
     const unsigned atomic_number,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table = false,
+    const double inverse_cdf_table_tol = 1e-4 );
 
   //! Create the hybrid elastic distribution ( combined Cutoff and Moment Preserving )
   template<typename TwoDInterpPolicy = Utility::LogNudgedLogCosLog,
@@ -203,7 +216,9 @@ public:
     const std::map<double,std::vector<double> >& moment_preserving_weights,
     const std::vector<double>& angular_energy_grid,
     const double cutoff_angle_cosine,
-    const double evaluation_tol );
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table = false,
+    const double inverse_cdf_table_tol = 1e-4 );
 
   //! Create a cutoff elastic distribution
   template<typename TwoDInterpPolicy = Utility::LogLogCosLog,
@@ -217,6 +232,16 @@ public:
     const double cutoff_angle_cosine,
     const double evaluation_tol );
 
+  //! Create an inverse cdf sampling table for an elastic scattering function
+  template<typename TwoDInterpPolicy = Utility::LogNudgedLogCosLog,
+           template<typename> class TwoDGridPolicy = Utility::Correlated>
+  static void createInverseCDFSamplingTable(
+    std::shared_ptr<const ElasticInverseCDFSamplingTable>& sampling_table,
+    const BasicBivariateDist& scattering_function,
+    const std::vector<double>& angular_energy_grid,
+    const double table_tol,
+    const size_t max_number_of_bins = 16384u );
+
   //! Create a screened Rutherford elastic distribution
   static void createScreenedRutherfordElasticDistribution(
     std::shared_ptr<const ScreenedRutherfordElasticElectronScatteringDistribution>&
@@ -13,6 +13,7 @@
 #include "MonteCarlo_CoupledElasticDistribution.hpp"
 #include "MonteCarlo_HybridElasticDistribution.hpp"
 #include "MonteCarlo_ElasticBasicBivariateDistribution.hpp"
+#include "MonteCarlo_StandardElasticInverseCDFSamplingTable.hpp"
 #include "Utility_GridGenerator.hpp"
 
 namespace MonteCarlo{
@@ -28,7 +29,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
         coupled_elastic_distribution,
     const Data::ElectronPhotonRelaxationDataContainer& data_container,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table,
+    const double inverse_cdf_table_tol )
 {
   ThisType::createCoupledElasticDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
     coupled_elastic_distribution,
@@ -40,7 +43,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
     data_container.getElasticAngularEnergyGrid(),
     data_container.getAtomicNumber(),
     sampling_method,
-    evaluation_tol );
+    evaluation_tol,
+    use_inverse_cdf_table,
+    inverse_cdf_table_tol );
 }
 
 // Create the coupled elastic distribution ( combined Cutoff and Screened Rutherford )
@@ -53,7 +58,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
     const std::shared_ptr<const std::vector<double> > total_cross_section,
     const Data::ElectronPhotonRelaxationDataContainer& data_container,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table,
+    const double inverse_cdf_table_tol )
 {
   ThisType::createCoupledElasticDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
     coupled_elastic_distribution,
@@ -65,7 +72,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
     data_container.getElasticAngularEnergyGrid(),
     data_container.getAtomicNumber(),
     sampling_method,
-    evaluation_tol );
+    evaluation_tol,
+    use_inverse_cdf_table,
+    inverse_cdf_table_tol );
 }
 
 // Create the hybrid elastic distribution ( combined Cutoff and Moment Preserving )
@@ -78,7 +87,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDist
     const std::shared_ptr<const std::vector<double> > moment_preserving_cross_section,
     const Data::ElectronPhotonRelaxationDataContainer& data_container,
     const double cutoff_angle_cosine,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table,
+    const double inverse_cdf_table_tol )
 {
   testPostcondition( data_container.hasMomentPreservingData() );
 
@@ -93,7 +104,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDist
     data_container.getMomentPreservingElasticWeights(),
     data_container.getElasticAngularEnergyGrid(),
     cutoff_angle_cosine,
-    evaluation_tol );
+    evaluation_tol,
+    use_inverse_cdf_table,
+    inverse_cdf_table_tol );
 }
 
 // Create a cutoff elastic distribution
@@ -202,7 +215,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
     const std::shared_ptr<const std::vector<double> > total_cross_section,
     const Data::AdjointElectronPhotonRelaxationDataContainer& data_container,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table,
+    const double inverse_cdf_table_tol )
 {
   ThisType::createCoupledElasticDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
     coupled_elastic_distribution,
@@ -214,7 +229,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
     data_container.getAdjointElasticAngularEnergyGrid(),
     data_container.getAtomicNumber(),
     sampling_method,
-    evaluation_tol );
+    evaluation_tol,
+    use_inverse_cdf_table,
+    inverse_cdf_table_tol );
 }
 
 // Create the hybrid elastic distribution ( combined Cutoff and Moment Preserving )
@@ -227,7 +244,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDist
     const std::shared_ptr<const std::vector<double> > moment_preserving_cross_section,
     const Data::AdjointElectronPhotonRelaxationDataContainer& data_container,
     const double cutoff_angle_cosine,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table,
+    const double inverse_cdf_table_tol )
 {
   testPostcondition( data_container.hasAdjointMomentPreservingData() );
 
@@ -242,7 +261,9 @@ ThisType::createHybridElasticDistribution<TwoDInterpPolicy,TwoDGridPolicy>(
     data_container.getAdjointMomentPreservingElasticWeights(),
     data_container.getAdjointElasticAngularEnergyGrid(),
     cutoff_angle_cosine,
-    evaluation_tol );
+    evaluation_tol,
+    use_inverse_cdf_table,
+    inverse_cdf_table_tol );
 }
 
 // Create a cutoff elastic distribution
@@ -345,6 +366,8 @@ void ElasticElectronScatteringDistributionNativeFactory::calculateMomentPreservi
 /*! \details This function has been overloaded so it can be called without using
  *  the native data container. This functionality is necessary for generating
  *  native moment preserving data without first creating native data files.
+ *  If an inverse cdf table is requested it will be used to sample the tabular
+ *  part of the distribution (see createInverseCDFSamplingTable).
  */
 template<typename TwoDInterpPolicy, template<typename> class TwoDGridPolicy>
 void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDistribution(
@@ -358,7 +381,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
     const std::vector<double>& angular_energy_grid,
     const unsigned atomic_number,
     const CoupledElasticSamplingMethod& sampling_method,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the cross sections are valid
   testPrecondition( Data::valuesGreaterThanOrEqualToZero( *cutoff_cross_section ) );
@@ -420,15 +445,33 @@ void ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDis
         evaluation_tol );
 
   // Create coupled distribution
-  coupled_elastic_distribution.reset(
+  std::shared_ptr<CoupledElasticElectronScatteringDistribution> distribution(
       new CoupledElasticElectronScatteringDistribution(
                 scattering_function,
                 cross_section_ratios,
                 elastic_traits,
                 sampling_method ) );
+
+  // Create the inverse cdf sampling table
+  if( use_inverse_cdf_table )
+  {
+    std::shared_ptr<const ElasticInverseCDFSamplingTable> sampling_table;
+    ThisType::createInverseCDFSamplingTable<TwoDInterpPolicy,TwoDGridPolicy>(
+                                                       sampling_table,
+                                                       *scattering_function,
+                                                       angular_energy_grid,
+                                                       inverse_cdf_table_tol );
+
+    distribution->setInverseCDFSamplingTable( sampling_table );
+  }
+
+  coupled_elastic_distribution = distribution;
 }
 
 // Create the hybrid elastic distribution ( combined Cutoff and Moment Preserving )
+/*! \details If an inverse cdf table is requested it will be used to sample
+ *  the hybrid distribution (see createInverseCDFSamplingTable).
+ */
 template<typename TwoDInterpPolicy, template<typename> class TwoDGridPolicy>
 void ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDistribution(
     std::shared_ptr<const HybridElasticElectronScatteringDistribution>&
@@ -442,7 +485,9 @@ void ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDist
     const std::map<double,std::vector<double> >& moment_preserving_weights,
     const std::vector<double>& angular_energy_grid,
     const double cutoff_angle_cosine,
-    const double evaluation_tol )
+    const double evaluation_tol,
+    const bool use_inverse_cdf_table,
+    const double inverse_cdf_table_tol )
 {
   // Make sure the angular energy grid is valid
   testPrecondition( angular_energy_grid.back() > 0 );
@@ -493,11 +538,70 @@ void ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDist
                 evaluation_tol );
 
   // Create hybrid distribution
-  hybrid_elastic_distribution.reset(
+  std::shared_ptr<HybridElasticElectronScatteringDistribution> distribution(
         new HybridElasticElectronScatteringDistribution(
                 hybrid_function,
                 cutoff_angle_cosine,
                 evaluation_tol ) );
+
+  // Create the inverse cdf sampling table
+  if( use_inverse_cdf_table )
+  {
+    std::shared_ptr<const ElasticInverseCDFSamplingTable> sampling_table;
+    ThisType::createInverseCDFSamplingTable<TwoDInterpPolicy,TwoDGridPolicy>(
+                                                       sampling_table,
+                                                       *hybrid_function,
+                                                       angular_energy_grid,
+                                                       inverse_cdf_table_tol );
+
+    distribution->setInverseCDFSamplingTable( sampling_table );
+  }
+
+  hybrid_elastic_distribution = distribution;
+}
+
+// Create an inverse cdf sampling table for an elastic scattering function
+/*! \details The inverse cdfs of the scattering function will be tabulated on
+ *  a uniform random number grid at every angular energy grid point. The
+ *  number of random number bins will be doubled until the estimated relative
+ *  error of the tabulated change in the angle cosine (1 - mu) is below the
+ *  table tolerance or the max number of bins is reached. Because the table reproduces the correlated
+ *  sampling procedure, only the Correlated and UnitBaseCorrelated grid
+ *  policies are supported. The memory used by the table can be retrieved
+ *  with the ElasticInverseCDFSamplingTable::getMemoryUsage method.
+ */
+template<typename TwoDInterpPolicy, template<typename> class TwoDGridPolicy>
+void ElasticElectronScatteringDistributionNativeFactory::createInverseCDFSamplingTable(
+    std::shared_ptr<const ElasticInverseCDFSamplingTable>& sampling_table,
+    const BasicBivariateDist& scattering_function,
+    const std::vector<double>& angular_energy_grid,
+    const double table_tol,
+    const size_t max_number_of_bins )
+{
+  // Make sure the angular energy grid is valid
+  testPrecondition( angular_energy_grid.size() > 1 );
+  testPrecondition(
+        Utility::Sort::isSortedAscending( angular_energy_grid.begin(),
+                                          angular_energy_grid.end() ) );
+  // Make sure the table tolerance is valid
+  testPrecondition( table_tol > 0.0 );
+  testPrecondition( table_tol < 1.0 );
+
+  if( TwoDGridPolicy<TwoDInterpPolicy>::name() != "Correlated" &&
+      TwoDGridPolicy<TwoDInterpPolicy>::name() != "Unit-base Correlated" )
+  {
+    THROW_EXCEPTION( std::runtime_error, "the bivariate grid policy "
+                     << TwoDGridPolicy<TwoDInterpPolicy>::name() <<
+                     " is not currently supported by the inverse cdf "
+                     "sampling table!" );
+  }
+
+  sampling_table.reset(
+       new StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>(
+                                                     angular_energy_grid,
+                                                     scattering_function,
+                                                     table_tol,
+                                                     max_number_of_bins ) );
 }
 
 // Create a cutoff elastic distribution
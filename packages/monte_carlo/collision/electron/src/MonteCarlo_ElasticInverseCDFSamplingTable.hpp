@@ -0,0 +1,62 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ElasticInverseCDFSamplingTable.hpp
+//! \author Alex Robinson
+//! \brief  The elastic inverse cdf sampling table base class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_HPP
+#define MONTE_CARLO_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_HPP
+
+// Std Lib Includes
+#include <cstddef>
+
+namespace MonteCarlo{
+
+/*! The elastic inverse cdf sampling table base class
+ * \details An inverse cdf sampling table stores the scattering angle cosines
+ * that correspond to a fixed, uniform grid of random numbers at every
+ * incoming energy grid point of an elastic scattering function. Sampling
+ * from the table only requires two table lookups and an interpolation
+ * instead of the inversion of the secondary cdfs at the bounding incoming
+ * energies. The table is only used for sampling - all evaluations must still
+ * be done with the scattering function that was used to construct the table.
+ */
+class ElasticInverseCDFSamplingTable
+{
+
+public:
+
+  //! Constructor
+  ElasticInverseCDFSamplingTable()
+  { /* ... */ }
+
+  //! Destructor
+  virtual ~ElasticInverseCDFSamplingTable()
+  { /* ... */ }
+
+  //! Return a sample from the table using the desired random number
+  virtual double sampleWithRandomNumber( const double incoming_energy,
+                                         const double random_number ) const = 0;
+
+  //! Return the number of incoming energy grid points
+  virtual size_t getNumberOfEnergyGridPoints() const = 0;
+
+  //! Return the number of random number bins at each incoming energy
+  virtual size_t getNumberOfRandomNumberBins() const = 0;
+
+  //! Return the max estimated relative error of the tabulated (1 - mu) values
+  virtual double getMaxEstimatedError() const = 0;
+
+  //! Return the memory used by the table (bytes)
+  virtual size_t getMemoryUsage() const = 0;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ElasticInverseCDFSamplingTable.hpp
+//---------------------------------------------------------------------------//
@@ -82,6 +82,14 @@ public:
                     const double energy,
                     const ElectroatomicReactionType reaction ) const;
 
+  //! Return the elastic transport cross section (condensed history)
+  double getTransportCrossSection( const double energy ) const;
+
+  //! Return the stopping cross section (condensed history)
+  double getStoppingCrossSection( const double energy ) const;
+
+  //! Return the total stopping cross section (MeV-b)
+  double getTotalStoppingCrossSection( const double energy ) const;
 };
 
 // Relax the atom
@@ -95,6 +103,46 @@ inline void Electroatom::relaxAtom( const Data::SubshellType vacancy_shell,
                                                         bank );
 }
 
+// Return the elastic transport cross section (condensed history)
+/*! \details If the atom does not have a condensed history distribution the
+ * soft collisions are simulated individually and 0.0 will be returned.
+ */
+inline double Electroatom::getTransportCrossSection( const double energy ) const
+{
+  if( this->getCore().hasCondensedHistoryDistribution() )
+  {
+    return this->getCore().getCondensedHistoryDistribution().getTransportCrossSection( energy );
+  }
+  else
+    return 0.0;
+}
+
+// Return the stopping cross section (condensed history)
+/*! \details If the atom does not have a condensed history distribution the
+ * soft collisions are simulated individually and 0.0 will be returned.
+ */
+inline double Electroatom::getStoppingCrossSection( const double energy ) const
+{
+  if( this->getCore().hasCondensedHistoryDistribution() )
+  {
+    return this->getCore().getCondensedHistoryDistribution().getStoppingCrossSection( energy );
+  }
+  else
+    return 0.0;
+}
+
+// Return the total stopping cross section (MeV-b)
+/*! \details If the atom does not have a total stopping cross section 0.0
+ * will be returned.
+ */
+inline double Electroatom::getTotalStoppingCrossSection( const double energy ) const
+{
+  if( this->getCore().hasTotalStoppingCrossSection() )
+    return this->getCore().getTotalStoppingCrossSection().evaluate( energy );
+  else
+    return 0.0;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
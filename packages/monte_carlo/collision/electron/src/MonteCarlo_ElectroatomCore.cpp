@@ -58,7 +58,9 @@ ElectroatomCore::ElectroatomCore(
 
 // Copy constructor
 ElectroatomCore::ElectroatomCore( const ElectroatomCore& instance )
-  : BaseType( instance )
+  : BaseType( instance ),
+    d_condensed_history_distribution( instance.d_condensed_history_distribution ),
+    d_total_stopping_cross_section( instance.d_total_stopping_cross_section )
 { /* ... */ }
 
 // Assignment Operator
@@ -66,11 +68,81 @@ ElectroatomCore& ElectroatomCore::operator=( const ElectroatomCore& instance )
 {
   // Avoid self-assignment
   if( this != &instance )
+  {
     BaseType::operator=( instance );
 
+    d_condensed_history_distribution =
+      instance.d_condensed_history_distribution;
+
+    d_total_stopping_cross_section = instance.d_total_stopping_cross_section;
+  }
+
   return *this;
 }
 
+// Set the condensed history distribution
+/*! \details The condensed history distribution is used to group the soft
+ * collisions of an electron into condensed history steps. The soft
+ * collision reactions should not be stored in the core when this
+ * distribution is set.
+ */
+void ElectroatomCore::setCondensedHistoryDistribution(
+                    const std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+                    condensed_history_distribution )
+{
+  // Make sure the distribution is valid
+  testPrecondition( condensed_history_distribution.get() );
+
+  d_condensed_history_distribution = condensed_history_distribution;
+}
+
+// Check if the core has a condensed history distribution
+bool ElectroatomCore::hasCondensedHistoryDistribution() const
+{
+  return d_condensed_history_distribution.get() != NULL;
+}
+
+// Return the condensed history distribution
+const CondensedHistoryElectronScatteringDistribution&
+ElectroatomCore::getCondensedHistoryDistribution() const
+{
+  // Make sure the core has a condensed history distribution
+  testPrecondition( this->hasCondensedHistoryDistribution() );
+
+  return *d_condensed_history_distribution;
+}
+
+// Set the total stopping cross section (MeV-b)
+/*! \details The total stopping cross section is used to calculate the CSDA
+ * range of an electron (e.g. for range rejection). It is independent of the
+ * reactions that are stored in the core.
+ */
+void ElectroatomCore::setTotalStoppingCrossSection(
+                    const std::shared_ptr<const Utility::UnivariateDistribution>&
+                    total_stopping_cross_section )
+{
+  // Make sure the stopping cross section is valid
+  testPrecondition( total_stopping_cross_section.get() );
+
+  d_total_stopping_cross_section = total_stopping_cross_section;
+}
+
+// Check if the core has a total stopping cross section
+bool ElectroatomCore::hasTotalStoppingCrossSection() const
+{
+  return d_total_stopping_cross_section.get() != NULL;
+}
+
+// Return the total stopping cross section (MeV-b)
+const Utility::UnivariateDistribution&
+ElectroatomCore::getTotalStoppingCrossSection() const
+{
+  // Make sure the core has a total stopping cross section
+  testPrecondition( this->hasTotalStoppingCrossSection() );
+
+  return *d_total_stopping_cross_section;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -16,7 +16,9 @@
 #include "MonteCarlo_ElectroatomicReactionType.hpp"
 #include "MonteCarlo_ElectroatomicReaction.hpp"
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
 #include "MonteCarlo_AtomCore.hpp"
+#include "Utility_UnivariateDistribution.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 
@@ -92,6 +94,29 @@ public:
   ~ElectroatomCore()
   { /* ... */ }
 
+  //! Set the condensed history distribution
+  void setCondensedHistoryDistribution(
+                    const std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>&
+                    condensed_history_distribution );
+
+  //! Check if the core has a condensed history distribution
+  bool hasCondensedHistoryDistribution() const;
+
+  //! Return the condensed history distribution
+  const CondensedHistoryElectronScatteringDistribution&
+  getCondensedHistoryDistribution() const;
+
+  //! Set the total stopping cross section (MeV-b)
+  void setTotalStoppingCrossSection(
+                    const std::shared_ptr<const Utility::UnivariateDistribution>&
+                    total_stopping_cross_section );
+
+  //! Check if the core has a total stopping cross section
+  bool hasTotalStoppingCrossSection() const;
+
+  //! Return the total stopping cross section (MeV-b)
+  const Utility::UnivariateDistribution& getTotalStoppingCrossSection() const;
+
 private:
 
   // Set the default absorption reaction types
@@ -99,6 +124,14 @@ private:
 
   // Used to set the default absorption reaction types
   static const bool s_default_absorption_reaction_types_set;
+
+  // The condensed history distribution (soft collisions)
+  std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>
+  d_condensed_history_distribution;
+
+  // The total stopping cross section (MeV-b)
+  std::shared_ptr<const Utility::UnivariateDistribution>
+  d_total_stopping_cross_section;
 };
 
 } // end MonteCarlo namespace
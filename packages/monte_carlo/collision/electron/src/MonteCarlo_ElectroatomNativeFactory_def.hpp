@@ -12,6 +12,8 @@
 // FRENSIE Includes
 #include "MonteCarlo_ElectroatomNativeFactory.hpp"
 #include "MonteCarlo_ElectroatomicReactionNativeFactory.hpp"
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_ElectronStoppingCrossSectionNativeFactory.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_TwoDInterpolationPolicy.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -23,7 +25,10 @@ namespace MonteCarlo{
  * core. Special care must be taken to assure that the model corresponds to
  * the atom of interest. If the use of atomic relaxation data has been
  * requested, a electroionization reaction for each subshell will be created.
- * Otherwise a single total electroionization reaction will be created.
+ * Otherwise a single total electroionization reaction will be created. If
+ * condensed history mode has been requested, the elastic and atomic
+ * excitation reactions (soft collisions) will not be created. Instead, a
+ * condensed history distribution will be created and set in the core.
  */
 template <typename TwoDInterpPolicy,template<typename> class TwoDGridPolicy>
 void ElectroatomNativeFactory::createElectroatomCore(
@@ -51,7 +56,8 @@ void ElectroatomNativeFactory::createElectroatomCore(
                               properties.getNumberOfElectronHashGridBins() ) );
 
 // Create the elastic scattering reaction
-  if ( properties.isElasticModeOn() )
+  if ( properties.isElasticModeOn() &&
+       !properties.isCondensedHistoryModeOn() )
   {
     if( TwoDGridPolicy<TwoDInterpPolicy>::name() == "Unit-base" || TwoDGridPolicy<TwoDInterpPolicy>::name() == "Direct" )
     {
@@ -157,7 +163,8 @@ void ElectroatomNativeFactory::createElectroatomCore(
   }
 
   // Create the atomic excitation scattering reaction
-  if ( properties.isAtomicExcitationModeOn() )
+  if ( properties.isAtomicExcitationModeOn() &&
+       !properties.isCondensedHistoryModeOn() )
   {
     Electroatom::ConstReactionMap::mapped_type& reaction_pointer =
       scattering_reactions[ATOMIC_EXCITATION_ELECTROATOMIC_REACTION];
@@ -190,13 +197,45 @@ void ElectroatomNativeFactory::createElectroatomCore(
   }
 
   // Create the electroatom core
-  electroatom_core.reset( new ElectroatomCore( energy_grid,
-                                               grid_searcher,
-                                               scattering_reactions,
-                                               absorption_reactions,
-                                               atomic_relaxation_model,
-                                               false,
-                                               Utility::LogLog() ) );
+  std::shared_ptr<ElectroatomCore> new_electroatom_core(
+                           new ElectroatomCore( energy_grid,
+                                                grid_searcher,
+                                                scattering_reactions,
+                                                absorption_reactions,
+                                                atomic_relaxation_model,
+                                                false,
+                                                Utility::LogLog() ) );
+
+  // Create the condensed history distribution (soft collisions)
+  if( properties.isCondensedHistoryModeOn() )
+  {
+    std::shared_ptr<const CondensedHistoryElectronScatteringDistribution>
+      condensed_history_distribution;
+
+    CondensedHistoryElectronScatteringDistributionNativeFactory::createCondensedHistoryDistribution(
+                                              raw_electroatom_data,
+                                              properties,
+                                              condensed_history_distribution );
+
+    new_electroatom_core->setCondensedHistoryDistribution(
+                                              condensed_history_distribution );
+  }
+
+  // Create the total stopping cross section (range rejection)
+  if( properties.isElectronRangeRejectionModeOn() )
+  {
+    std::shared_ptr<const Utility::UnivariateDistribution>
+      total_stopping_cross_section;
+
+    ElectronStoppingCrossSectionNativeFactory::createTotalStoppingCrossSection(
+                                                raw_electroatom_data,
+                                                total_stopping_cross_section );
+
+    new_electroatom_core->setTotalStoppingCrossSection(
+                                                total_stopping_cross_section );
+  }
+
+  electroatom_core = new_electroatom_core;
 }
 
 // Create the elastic reaction for a electroatom core
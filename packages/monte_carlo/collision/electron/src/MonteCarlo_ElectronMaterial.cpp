@@ -8,17 +8,26 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <limits>
+#include <algorithm>
+#include <cmath>
 
 // FRENSIE Includes
 #include "MonteCarlo_ElectronMaterial.hpp"
 #include "MonteCarlo_MaterialHelpers.hpp"
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
+#include "Utility_PhysicalConstants.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const size_t ElectronMaterial::s_csda_range_points_per_decade = 50;
+
 // Constructor
 ElectronMaterial::ElectronMaterial(
                             const MaterialId id,
@@ -31,7 +40,290 @@ ElectronMaterial::ElectronMaterial(
               electroatom_name_map,
               electroatom_fractions,
               electroatom_names )
-{ /* ... */ }
+{
+  this->calculateCSDARangeTable();
+}
+
+// Return the macroscopic elastic transport cross section (1/cm)
+/*! \details Only electroatoms with a condensed history distribution will
+ * contribute to the transport cross section.
+ */
+double ElectronMaterial::getMacroscopicTransportCrossSection(
+                                                    const double energy ) const
+{
+  return this->getMacroscopicCrossSection(
+             energy,
+             []( const Electroatom& electroatom, const double energy ){
+               return electroatom.getTransportCrossSection( energy ); } );
+}
+
+// Return the restricted stopping power (MeV/cm)
+/*! \details Only electroatoms with a condensed history distribution will
+ * contribute to the stopping power. Only the atomic excitation energy losses
+ * are condensed - the electroionization and bremsstrahlung energy losses are
+ * still simulated individually, so they do not contribute.
+ */
+double ElectronMaterial::getRestrictedStoppingPower( const double energy ) const
+{
+  return this->getMacroscopicCrossSection(
+             energy,
+             []( const Electroatom& electroatom, const double energy ){
+               return electroatom.getStoppingCrossSection( energy ); } );
+}
+
+// Return the condensed history step length (cm)
+/*! \details The step length is the distance over which the electron will
+ * lose the desired fraction of its energy to soft collisions. If the
+ * restricted stopping power is zero the step length will be infinite.
+ */
+double ElectronMaterial::getCondensedHistoryStepLength(
+                              const double energy,
+                              const double max_energy_loss_fraction ) const
+{
+  // Make sure the energy loss fraction is valid
+  testPrecondition( max_energy_loss_fraction > 0.0 );
+  testPrecondition( max_energy_loss_fraction < 1.0 );
+
+  const double stopping_power = this->getRestrictedStoppingPower( energy );
+
+  if( stopping_power > 0.0 )
+    return max_energy_loss_fraction*energy/stopping_power;
+  else
+    return std::numeric_limits<double>::infinity();
+}
+
+// Return the energy lost to soft collisions over a step (MeV)
+/*! \details The continuous energy loss over the step is calculated with the
+ * restricted stopping power evaluated at the midpoint energy of the step. The
+ * returned energy loss can be greater than the energy, which indicates that
+ * the electron stops before the end of the step.
+ */
+double ElectronMaterial::getCondensedHistoryEnergyLoss(
+                                               const double energy,
+                                               const double step_length ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the step length is valid
+  testPrecondition( step_length >= 0.0 );
+
+  // Estimate the energy loss using the initial energy
+  const double energy_loss =
+    this->getRestrictedStoppingPower( energy )*step_length;
+
+  const double midpoint_energy = energy - 0.5*energy_loss;
+
+  if( midpoint_energy > 0.0 )
+    return this->getRestrictedStoppingPower( midpoint_energy )*step_length;
+  else
+    return energy_loss;
+}
+
+// Apply a condensed history step to the electron
+/*! \details The energy lost to soft collisions over the step will be
+ * subtracted from the electron energy. If the electron loses all of its
+ * energy it will be set as gone without leaving its cell, so its remaining
+ * energy is deposited in the cell where the step ends. Otherwise the
+ * electron will be deflected (see
+ * ElectronMaterial::applyCondensedHistoryDeflection).
+ */
+void ElectronMaterial::applyCondensedHistoryStep( ElectronState& electron,
+                                                  const double step_length ) const
+{
+  // Make sure the step length is valid
+  testPrecondition( step_length >= 0.0 );
+
+  const double energy = electron.getEnergy();
+
+  const double energy_loss =
+    this->getCondensedHistoryEnergyLoss( energy, step_length );
+
+  if( energy_loss >= energy )
+  {
+    electron.setAsGone();
+
+    return;
+  }
+
+  electron.setEnergy( energy - energy_loss );
+
+  this->applyCondensedHistoryDeflection( electron,
+                                         energy - 0.5*energy_loss,
+                                         step_length );
+}
+
+// Apply the multiple scattering deflection of a condensed history step
+/*! \details The electron direction will be rotated by an angle sampled from
+ * a multiple scattering distribution with a mean angle cosine of
+ * \f$\exp(-\Sigma_1 s)\f$, where \f$\Sigma_1\f$ is the macroscopic
+ * transport cross section at the mean energy of the step and \f$s\f$ is the
+ * step length (Goudsmit-Saunderson). The energy of the electron will not be
+ * changed.
+ */
+void ElectronMaterial::applyCondensedHistoryDeflection(
+                                               ElectronState& electron,
+                                               const double mean_energy,
+                                               const double step_length ) const
+{
+  // Make sure the mean energy is valid
+  testPrecondition( mean_energy > 0.0 );
+  // Make sure the step length is valid
+  testPrecondition( step_length >= 0.0 );
+
+  const double mean_angle_cosine =
+    std::exp( -this->getMacroscopicTransportCrossSection( mean_energy )*
+              step_length );
+
+  const double angle_cosine =
+    CondensedHistoryElectronScatteringDistribution::sampleAngleCosine(
+                                                           mean_angle_cosine );
+
+  const double azimuthal_angle = 2*Utility::PhysicalConstants::pi*
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  electron.rotateDirection( angle_cosine, azimuthal_angle );
+}
+
+// Return the total (unrestricted) stopping power (MeV/cm)
+/*! \details Only electroatoms with a total stopping cross section will
+ * contribute to the stopping power.
+ */
+double ElectronMaterial::getTotalStoppingPower( const double energy ) const
+{
+  return this->getMacroscopicCrossSection(
+             energy,
+             []( const Electroatom& electroatom, const double energy ){
+               return electroatom.getTotalStoppingCrossSection( energy ); } );
+}
+
+// Check if the CSDA range can be calculated
+/*! \details The CSDA range can only be calculated if at least one of the
+ * electroatoms has a total stopping cross section.
+ */
+bool ElectronMaterial::hasCSDARange() const
+{
+  return !d_csda_range_energy_grid.empty();
+}
+
+// Return the CSDA range (cm)
+/*! \details The range is linearly interpolated on the CSDA range table.
+ * Below the lowest table energy the stopping power is assumed to be constant.
+ * Above the highest table energy, or if the range cannot be calculated, an
+ * infinite range will be returned (which is conservative when the range is
+ * used for range rejection).
+ */
+double ElectronMaterial::getCSDARange( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy >= 0.0 );
+
+  if( d_csda_range_energy_grid.empty() )
+    return std::numeric_limits<double>::infinity();
+
+  if( energy <= d_csda_range_energy_grid.front() )
+  {
+    return d_csda_range.front()*energy/d_csda_range_energy_grid.front();
+  }
+  else if( energy >= d_csda_range_energy_grid.back() )
+  {
+    if( energy == d_csda_range_energy_grid.back() )
+      return d_csda_range.back();
+    else
+      return std::numeric_limits<double>::infinity();
+  }
+  else
+  {
+    const size_t bin_index =
+      Utility::Search::binaryLowerBoundIndex( d_csda_range_energy_grid.begin(),
+                                              d_csda_range_energy_grid.end(),
+                                              energy );
+
+    const double interp_fraction =
+      (energy - d_csda_range_energy_grid[bin_index])/
+      (d_csda_range_energy_grid[bin_index+1] -
+       d_csda_range_energy_grid[bin_index]);
+
+    return d_csda_range[bin_index] +
+      interp_fraction*(d_csda_range[bin_index+1] - d_csda_range[bin_index]);
+  }
+}
+
+// Calculate the CSDA range table
+/*! \details The CSDA range (\f$R(E) = \int_0^E dE'/S(E')\f$) is
+ * integrated with the trapezoidal rule on a logarithmic energy grid that
+ * spans the energy range of the electroatom total stopping cross sections.
+ * The stopping power is assumed to be constant below the lowest table
+ * energy. If the stopping power is not positive at a table energy, the range
+ * will be infinite at that energy and above it.
+ */
+void ElectronMaterial::calculateCSDARangeTable()
+{
+  double min_energy = std::numeric_limits<double>::infinity();
+  double max_energy = 0.0;
+
+  for( size_t i = 0; i < this->getNumberOfScatteringCenters(); ++i )
+  {
+    const ElectroatomCore& core = this->getScatteringCenter( i ).getCore();
+
+    if( core.hasTotalStoppingCrossSection() )
+    {
+      const Utility::UnivariateDistribution& total_stopping_cross_section =
+        core.getTotalStoppingCrossSection();
+
+      min_energy = std::min( min_energy,
+                             total_stopping_cross_section.getLowerBoundOfIndepVar() );
+
+      max_energy = std::max( max_energy,
+                             total_stopping_cross_section.getUpperBoundOfIndepVar() );
+    }
+  }
+
+  // No electroatoms have a total stopping cross section
+  if( !(min_energy < max_energy) || min_energy <= 0.0 )
+    return;
+
+  const size_t number_of_points = 1 +
+    (size_t)std::ceil( std::log10( max_energy/min_energy )*
+                       s_csda_range_points_per_decade );
+
+  d_csda_range_energy_grid.resize( number_of_points );
+  d_csda_range.resize( number_of_points );
+
+  const double log_energy_spacing =
+    std::log( max_energy/min_energy )/(number_of_points - 1);
+
+  for( size_t i = 0; i < number_of_points; ++i )
+  {
+    d_csda_range_energy_grid[i] = min_energy*std::exp( i*log_energy_spacing );
+  }
+
+  d_csda_range_energy_grid.back() = max_energy;
+
+  double stopping_power =
+    this->getTotalStoppingPower( d_csda_range_energy_grid.front() );
+
+  if( stopping_power > 0.0 )
+    d_csda_range.front() = d_csda_range_energy_grid.front()/stopping_power;
+  else
+    d_csda_range.front() = std::numeric_limits<double>::infinity();
+
+  for( size_t i = 1; i < number_of_points; ++i )
+  {
+    const double next_stopping_power =
+      this->getTotalStoppingPower( d_csda_range_energy_grid[i] );
+
+    if( stopping_power > 0.0 && next_stopping_power > 0.0 )
+    {
+      d_csda_range[i] = d_csda_range[i-1] +
+        0.5*(d_csda_range_energy_grid[i] - d_csda_range_energy_grid[i-1])*
+        (1.0/stopping_power + 1.0/next_stopping_power);
+    }
+    else
+      d_csda_range[i] = std::numeric_limits<double>::infinity();
+
+    stopping_power = next_stopping_power;
+  }
+}
 
 } // end MonteCarlo namespace
 
@@ -61,6 +61,53 @@ public:
   //! Destructor
   ~ElectronMaterial()
   { /* ... */ }
+
+  //! Return the macroscopic elastic transport cross section (1/cm)
+  double getMacroscopicTransportCrossSection( const double energy ) const;
+
+  //! Return the restricted stopping power (MeV/cm)
+  double getRestrictedStoppingPower( const double energy ) const;
+
+  //! Return the condensed history step length (cm)
+  double getCondensedHistoryStepLength(
+                             const double energy,
+                             const double max_energy_loss_fraction ) const;
+
+  //! Return the energy lost to soft collisions over a step (MeV)
+  double getCondensedHistoryEnergyLoss( const double energy,
+                                        const double step_length ) const;
+
+  //! Apply a condensed history step to the electron
+  void applyCondensedHistoryStep( ElectronState& electron,
+                                  const double step_length ) const;
+
+  //! Apply the multiple scattering deflection of a condensed history step
+  void applyCondensedHistoryDeflection( ElectronState& electron,
+                                        const double mean_energy,
+                                        const double step_length ) const;
+
+  //! Return the total (unrestricted) stopping power (MeV/cm)
+  double getTotalStoppingPower( const double energy ) const;
+
+  //! Check if the CSDA range can be calculated
+  bool hasCSDARange() const;
+
+  //! Return the CSDA range (cm)
+  double getCSDARange( const double energy ) const;
+
+private:
+
+  // Calculate the CSDA range table
+  void calculateCSDARangeTable();
+
+  // The number of CSDA range table points per energy decade
+  static const size_t s_csda_range_points_per_decade;
+
+  // The CSDA range table energy grid (MeV)
+  std::vector<double> d_csda_range_energy_grid;
+
+  // The CSDA range table (cm)
+  std::vector<double> d_csda_range;
 };
 
 } // end MonteCarlo namespace
@@ -35,6 +35,28 @@ HybridElasticElectronScatteringDistribution::HybridElasticElectronScatteringDist
   testPrecondition( d_evaluation_tol < 1.0 );
 }
 
+// Set the inverse cdf sampling table of the hybrid distribution
+/*! \details When a sampling table is set it will be used instead of the
+ * hybrid distribution when sampling (the hybrid distribution will still be
+ * used for all evaluations). The sampling table must have been constructed
+ * from the hybrid distribution. A null sampling table can be used to remove
+ * the current sampling table.
+ */
+void HybridElasticElectronScatteringDistribution::setInverseCDFSamplingTable(
+     const std::shared_ptr<const ElasticInverseCDFSamplingTable>& sampling_table )
+{
+  d_sampling_table = sampling_table;
+}
+
+// Return the memory used by the inverse cdf sampling table (bytes)
+size_t HybridElasticElectronScatteringDistribution::getInverseCDFSamplingTableMemoryUsage() const
+{
+  if( d_sampling_table )
+    return d_sampling_table->getMemoryUsage();
+  else
+    return 0;
+}
+
 // Evaluate the distribution at the given energy and scattering angle cosine
 /*! \details Only scattering angle cosines below the cutoff angle cosine are
  *  evaluated. If it is above the cutoff angle a value of zero is returned.
@@ -225,9 +247,18 @@ void HybridElasticElectronScatteringDistribution::sampleAndRecordTrialsImpl(
   double random_number =
     Utility::RandomNumberGenerator::getRandomNumber<double>();
 
-  scattering_angle_cosine =
-    d_hybrid_distribution->sampleSecondaryConditionalWithRandomNumber(
-      incoming_energy, random_number );
+  if( d_sampling_table )
+  {
+    scattering_angle_cosine =
+      d_sampling_table->sampleWithRandomNumber( incoming_energy,
+                                                random_number );
+  }
+  else
+  {
+    scattering_angle_cosine =
+      d_hybrid_distribution->sampleSecondaryConditionalWithRandomNumber(
+        incoming_energy, random_number );
+  }
 
   // Make sure the scattering angle cosine is valid
   testPostcondition( scattering_angle_cosine >= -1.0 );
@@ -16,6 +16,7 @@
 #include "MonteCarlo_ElectronScatteringDistribution.hpp"
 #include "MonteCarlo_PositronScatteringDistribution.hpp"
 #include "MonteCarlo_AdjointElectronScatteringDistribution.hpp"
+#include "MonteCarlo_ElasticInverseCDFSamplingTable.hpp"
 #include "Utility_FullyTabularBasicBivariateDistribution.hpp"
 
 namespace MonteCarlo{
@@ -46,6 +47,13 @@ public:
   virtual ~HybridElasticElectronScatteringDistribution()
   { /* ... */ }
 
+  //! Set the inverse cdf sampling table of the hybrid distribution
+  void setInverseCDFSamplingTable(
+     const std::shared_ptr<const ElasticInverseCDFSamplingTable>& sampling_table );
+
+  //! Return the memory used by the inverse cdf sampling table (bytes)
+  size_t getInverseCDFSamplingTableMemoryUsage() const;
+
   //! Evaluate the PDF
   double evaluate( const double incoming_energy,
                    const double scattering_angle_cosine ) const override;
@@ -101,6 +109,9 @@ private:
 
   // The hybrid elastic distribution
   std::shared_ptr<const BasicBivariateDist> d_hybrid_distribution;
+
+  // The inverse cdf sampling table of the hybrid distribution (optional)
+  std::shared_ptr<const ElasticInverseCDFSamplingTable> d_sampling_table;
 };
 
 } // end MonteCarlo namespace
@@ -29,11 +29,17 @@ PositronatomFactory::PositronatomFactory(
             const std::shared_ptr<AtomicRelaxationModelFactory>&
             atomic_relaxation_model_factory,
             const SimulationProperties& properties,
-            const bool verbose )
+            const bool verbose,
+            const std::shared_ptr<ScatteringCenterDataCache>& data_cache )
   : d_positronatom_name_map(),
     d_positronatomic_table_name_map(),
-    d_verbose( verbose )
+    d_verbose( verbose ),
+    d_data_cache( data_cache )
 {
+  // Create a private data table cache if one was not provided
+  if( !d_data_cache )
+    d_data_cache.reset( new ScatteringCenterDataCache );
+
   FRENSIE_LOG_NOTIFICATION( "Starting to load positronatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
@@ -146,17 +152,17 @@ void PositronatomFactory::createPositronatomFromACETable(
       FRENSIE_FLUSH_ALL_LOGS();
     }
 
-    // Create the ACEFileHandler
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
+    // Get the ACEFileHandler
+    std::shared_ptr<const Data::ACEFileHandler> ace_file_handler =
+      d_data_cache->getACETable( ace_file_path,
+                                 data_properties.tableName(),
+                                 data_properties.fileStartLine() );
 
     // Create the XSS data extractor
     Data::XSSEPRDataExtractor xss_data_extractor(
-                                         ace_file_handler.getTableNXSArray(),
-                                         ace_file_handler.getTableJXSArray(),
-                                         ace_file_handler.getTableXSSArray() );
+                                         ace_file_handler->getTableNXSArray(),
+                                         ace_file_handler->getTableJXSArray(),
+                                         ace_file_handler->getTableXSSArray() );
 
     // Create the atomic relaxation model
     std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
@@ -228,9 +234,9 @@ void PositronatomFactory::createPositronatomFromNativeTable(
       FRENSIE_FLUSH_ALL_LOGS();
     }
 
-    // Create the epr data container
-    Data::ElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+    // Get the epr data container
+    const Data::ElectronPhotonRelaxationDataContainer& data_container =
+      *d_data_cache->getElectronPhotonRelaxationTable( native_file_path );
 
     // Create the atomic relaxation model
     std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
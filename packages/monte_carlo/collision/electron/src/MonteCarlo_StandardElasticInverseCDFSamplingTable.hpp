@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_StandardElasticInverseCDFSamplingTable.hpp
+//! \author Alex Robinson
+//! \brief  The standard elastic inverse cdf sampling table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_STANDARD_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_HPP
+#define MONTE_CARLO_STANDARD_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_ElasticInverseCDFSamplingTable.hpp"
+#include "Utility_FullyTabularBasicBivariateDistribution.hpp"
+
+namespace MonteCarlo{
+
+/*! The standard elastic inverse cdf sampling table class
+ * \details The table reproduces the correlated sampling procedure (used by
+ * the Utility::Correlated and Utility::UnitBaseCorrelated grid policies):
+ * the same random number is used to look up a cosine at the incoming energy
+ * grid points that bound the incoming energy and the two cosines are then
+ * interpolated using the TwoDInterpPolicy::YXInterpPolicy. The number of
+ * random number bins is doubled (starting from the initial number of bins)
+ * until the relative error of the linearly interpolated change in the angle
+ * cosine (1 - mu) at the center of every bin is below the desired tolerance
+ * or the max number of bins is reached. Bins that contain a jump in the inverse cdf (e.g. the
+ * discrete angles of a hybrid scattering function) are stored as steps so
+ * that the discrete cosines are not smeared by the interpolation.
+ */
+template<typename TwoDInterpPolicy>
+class StandardElasticInverseCDFSamplingTable : public ElasticInverseCDFSamplingTable
+{
+  // The typedef for this type
+  typedef StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy> ThisType;
+
+public:
+
+  //! Typedef for the two d distributions
+  typedef Utility::FullyTabularBasicBivariateDistribution BasicBivariateDist;
+
+  //! Constructor
+  StandardElasticInverseCDFSamplingTable(
+                            const std::vector<double>& energy_grid,
+                            const BasicBivariateDist& scattering_function,
+                            const double tolerance,
+                            const size_t max_number_of_bins,
+                            const size_t initial_number_of_bins = 64u );
+
+  //! Destructor
+  ~StandardElasticInverseCDFSamplingTable()
+  { /* ... */ }
+
+  //! Return a sample from the table using the desired random number
+  double sampleWithRandomNumber( const double incoming_energy,
+                                 const double random_number ) const override;
+
+  //! Return the number of incoming energy grid points
+  size_t getNumberOfEnergyGridPoints() const override;
+
+  //! Return the number of random number bins at each incoming energy
+  size_t getNumberOfRandomNumberBins() const override;
+
+  //! Return the max estimated relative error of the tabulated (1 - mu) values
+  double getMaxEstimatedError() const override;
+
+  //! Return the memory used by the table (bytes)
+  size_t getMemoryUsage() const override;
+
+private:
+
+  // Tabulate the inverse cdfs using the current number of bins
+  void tabulate( const BasicBivariateDist& scattering_function );
+
+  // Find the location of the jump in a step bin
+  static double findStepLocation( const BasicBivariateDist& scattering_function,
+                                  const double energy,
+                                  const double lower_random_number,
+                                  const double upper_random_number,
+                                  const double cosine );
+
+  // Return the cosine at an energy grid point using the desired random number
+  double lookUpCosine( const size_t energy_index,
+                       const double random_number ) const;
+
+  // The incoming energy grid
+  std::vector<double> d_energy_grid;
+
+  // The number of random number bins
+  size_t d_number_of_bins;
+
+  // The tabulated cosines (energy grid point major)
+  std::vector<double> d_cosines;
+
+  // The step bin flags (energy grid point major)
+  std::vector<unsigned char> d_step_bins;
+
+  // The location of the jump in each step bin (fraction of the bin width)
+  std::unordered_map<size_t,double> d_step_locations;
+
+  // The max estimated relative error of the tabulated (1 - mu) values
+  double d_max_estimated_error;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_StandardElasticInverseCDFSamplingTable_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_STANDARD_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_StandardElasticInverseCDFSamplingTable.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,318 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_StandardElasticInverseCDFSamplingTable_def.hpp
+//! \author Alex Robinson
+//! \brief  The standard elastic inverse cdf sampling table class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_STANDARD_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_DEF_HPP
+#define MONTE_CARLO_STANDARD_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_DEF_HPP
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_SortAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The scattering function will be sampled at every point of the
+ * energy grid, which must be the primary grid of the scattering function.
+ * The number of bins will only be doubled while the doubled number of bins
+ * does not exceed the max number of bins. If the tolerance cannot be met
+ * the estimated error that was achieved can be retrieved with the
+ * getMaxEstimatedError method.
+ */
+template<typename TwoDInterpPolicy>
+StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::StandardElasticInverseCDFSamplingTable(
+                            const std::vector<double>& energy_grid,
+                            const BasicBivariateDist& scattering_function,
+                            const double tolerance,
+                            const size_t max_number_of_bins,
+                            const size_t initial_number_of_bins )
+  : d_energy_grid( energy_grid ),
+    d_number_of_bins( initial_number_of_bins ),
+    d_cosines(),
+    d_step_bins(),
+    d_step_locations(),
+    d_max_estimated_error( 0.0 )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( Utility::Sort::isSortedAscending( energy_grid.begin(),
+                                                      energy_grid.end() ) );
+  // Make sure the tolerance is valid
+  testPrecondition( tolerance > 0.0 );
+  // Make sure the number of bins is valid
+  testPrecondition( initial_number_of_bins > 0 );
+  testPrecondition( max_number_of_bins >= initial_number_of_bins );
+
+  while( true )
+  {
+    this->tabulate( scattering_function );
+
+    if( d_max_estimated_error <= tolerance ||
+        2*d_number_of_bins > max_number_of_bins )
+      break;
+
+    d_number_of_bins *= 2;
+  }
+}
+
+// Tabulate the inverse cdfs using the current number of bins
+/*! \details The cosine at the center of each bin is used to estimate the
+ * interpolation error of the bin. The error is measured relative to the
+ * change in the angle cosine (1 - mu) at the center of the bin. Elastic
+ * scattering is strongly forward peaked, so an absolute cosine error would
+ * allow large relative errors in the peak where (1 - mu) is tiny. If the
+ * center cosine is equal to one of the bin boundary cosines (but the bin
+ * boundary cosines differ) the inverse cdf has a jump in the bin and the bin
+ * will be stored as a step.
+ */
+template<typename TwoDInterpPolicy>
+void StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::tabulate(
+                                const BasicBivariateDist& scattering_function )
+{
+  const size_t number_of_bins = d_number_of_bins;
+  const double bin_width = 1.0/number_of_bins;
+
+  d_cosines.resize( d_energy_grid.size()*(number_of_bins+1) );
+  d_step_bins.assign( d_energy_grid.size()*number_of_bins, 0 );
+  d_step_locations.clear();
+  d_max_estimated_error = 0.0;
+
+  for( size_t i = 0; i < d_energy_grid.size(); ++i )
+  {
+    const double energy = d_energy_grid[i];
+
+    double* cosines = &d_cosines[i*(number_of_bins+1)];
+
+    for( size_t j = 0; j < number_of_bins; ++j )
+    {
+      cosines[j] = scattering_function.sampleSecondaryConditionalWithRandomNumber(
+                                                         energy, j*bin_width );
+    }
+
+    cosines[number_of_bins] =
+      scattering_function.sampleSecondaryConditionalWithRandomNumber( energy,
+                                                                      1.0 );
+
+    for( size_t j = 0; j < number_of_bins; ++j )
+    {
+      if( cosines[j] == cosines[j+1] )
+        continue;
+
+      const double lower_random_number = j*bin_width;
+      const double mid_random_number = (j + 0.5)*bin_width;
+
+      const double mid_cosine =
+        scattering_function.sampleSecondaryConditionalWithRandomNumber(
+                                                  energy, mid_random_number );
+
+      // Check for a jump in the inverse cdf
+      if( mid_cosine == cosines[j] || mid_cosine == cosines[j+1] )
+      {
+        double step_location;
+
+        if( mid_cosine == cosines[j] )
+        {
+          step_location =
+            ThisType::findStepLocation( scattering_function,
+                                        energy,
+                                        mid_random_number,
+                                        lower_random_number + bin_width,
+                                        mid_cosine );
+        }
+        else
+        {
+          step_location =
+            ThisType::findStepLocation( scattering_function,
+                                        energy,
+                                        lower_random_number,
+                                        mid_random_number,
+                                        mid_cosine );
+        }
+
+        d_step_bins[i*number_of_bins+j] = 1;
+        d_step_locations[i*number_of_bins+j] =
+          (step_location - lower_random_number)*number_of_bins;
+      }
+      else
+      {
+        // The center cosine is below the upper bin boundary cosine so
+        // (1 - mu) is always positive
+        const double error =
+          std::fabs( mid_cosine - 0.5*(cosines[j] + cosines[j+1]) )/
+          (1.0 - mid_cosine);
+
+        if( error > d_max_estimated_error )
+          d_max_estimated_error = error;
+      }
+    }
+  }
+}
+
+// Find the location of the jump in a step bin
+/*! \details The scattering function is only equal to the desired cosine on
+ * one side of the jump. Bisection is used to find the random number at
+ * which the jump occurs.
+ */
+template<typename TwoDInterpPolicy>
+double StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::findStepLocation(
+                                const BasicBivariateDist& scattering_function,
+                                const double energy,
+                                const double lower_random_number,
+                                const double upper_random_number,
+                                const double cosine )
+{
+  const bool lower_cosine_match =
+    (scattering_function.sampleSecondaryConditionalWithRandomNumber(
+                                     energy, lower_random_number ) == cosine);
+
+  double lower_bound = lower_random_number;
+  double upper_bound = upper_random_number;
+
+  for( size_t i = 0; i < 64; ++i )
+  {
+    const double mid_random_number = 0.5*(lower_bound + upper_bound);
+
+    if( mid_random_number <= lower_bound || mid_random_number >= upper_bound )
+      break;
+
+    const bool mid_cosine_match =
+      (scattering_function.sampleSecondaryConditionalWithRandomNumber(
+                                       energy, mid_random_number ) == cosine);
+
+    if( mid_cosine_match == lower_cosine_match )
+      lower_bound = mid_random_number;
+    else
+      upper_bound = mid_random_number;
+  }
+
+  return 0.5*(lower_bound + upper_bound);
+}
+
+// Return the cosine at an energy grid point using the desired random number
+template<typename TwoDInterpPolicy>
+inline double StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::lookUpCosine(
+                                            const size_t energy_index,
+                                            const double random_number ) const
+{
+  const double bin_location = random_number*d_number_of_bins;
+
+  size_t bin_index = (size_t)bin_location;
+
+  // A random number of one is in the last bin
+  if( bin_index >= d_number_of_bins )
+    bin_index = d_number_of_bins - 1;
+
+  const double bin_fraction = bin_location - bin_index;
+
+  const double* cosines = &d_cosines[energy_index*(d_number_of_bins+1)];
+
+  const size_t global_bin_index = energy_index*d_number_of_bins + bin_index;
+
+  if( d_step_bins[global_bin_index] )
+  {
+    if( bin_fraction < d_step_locations.find( global_bin_index )->second )
+      return cosines[bin_index];
+    else
+      return cosines[bin_index+1];
+  }
+  else
+  {
+    return cosines[bin_index] +
+      bin_fraction*(cosines[bin_index+1] - cosines[bin_index]);
+  }
+}
+
+// Return a sample from the table using the desired random number
+/*! \details Incoming energies outside of the energy grid will be sampled
+ * using the table at the nearest energy grid point.
+ */
+template<typename TwoDInterpPolicy>
+double StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::sampleWithRandomNumber(
+                                            const double incoming_energy,
+                                            const double random_number ) const
+{
+  // Make sure the incoming energy is valid
+  testPrecondition( incoming_energy > 0.0 );
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+
+  if( incoming_energy <= d_energy_grid.front() )
+    return this->lookUpCosine( 0, random_number );
+  else if( incoming_energy >= d_energy_grid.back() )
+    return this->lookUpCosine( d_energy_grid.size()-1, random_number );
+
+  const size_t lower_index =
+    Utility::Search::binaryLowerBoundIndex( d_energy_grid.begin(),
+                                            d_energy_grid.end(),
+                                            incoming_energy );
+
+  const double lower_cosine = this->lookUpCosine( lower_index, random_number );
+
+  if( incoming_energy == d_energy_grid[lower_index] )
+    return lower_cosine;
+
+  const double upper_cosine =
+    this->lookUpCosine( lower_index+1, random_number );
+
+  // Avoid log interpolation errors when the cosines are equal
+  if( lower_cosine == upper_cosine )
+    return lower_cosine;
+  else
+  {
+    return TwoDInterpPolicy::YXInterpPolicy::interpolate(
+                                              d_energy_grid[lower_index],
+                                              d_energy_grid[lower_index+1],
+                                              incoming_energy,
+                                              lower_cosine,
+                                              upper_cosine );
+  }
+}
+
+// Return the number of incoming energy grid points
+template<typename TwoDInterpPolicy>
+size_t StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::getNumberOfEnergyGridPoints() const
+{
+  return d_energy_grid.size();
+}
+
+// Return the number of random number bins at each incoming energy
+template<typename TwoDInterpPolicy>
+size_t StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::getNumberOfRandomNumberBins() const
+{
+  return d_number_of_bins;
+}
+
+// Return the max estimated relative error of the tabulated (1 - mu) values
+template<typename TwoDInterpPolicy>
+double StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::getMaxEstimatedError() const
+{
+  return d_max_estimated_error;
+}
+
+// Return the memory used by the table (bytes)
+template<typename TwoDInterpPolicy>
+size_t StandardElasticInverseCDFSamplingTable<TwoDInterpPolicy>::getMemoryUsage() const
+{
+  return sizeof(*this) +
+    d_energy_grid.size()*sizeof(double) +
+    d_cosines.size()*sizeof(double) +
+    d_step_bins.size()*sizeof(unsigned char) +
+    d_step_locations.size()*(sizeof(size_t) + sizeof(double));
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_STANDARD_ELASTIC_INVERSE_CDF_SAMPLING_TABLE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_StandardElasticInverseCDFSamplingTable_def.hpp
+//---------------------------------------------------------------------------//
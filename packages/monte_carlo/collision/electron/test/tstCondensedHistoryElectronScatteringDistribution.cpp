@@ -0,0 +1,165 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCondensedHistoryElectronScatteringDistribution.cpp
+//! \author Alex Robinson
+//! \brief  Condensed history electron scattering distribution unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <limits>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables.
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::CondensedHistoryElectronScatteringDistribution>
+  distribution;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the transport cross section can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   getTransportCrossSection )
+{
+  FRENSIE_CHECK_EQUAL( distribution->getTransportCrossSection( 1e-6 ), 1e6 );
+  FRENSIE_CHECK_EQUAL( distribution->getTransportCrossSection( 1e-5 ), 1e6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->getTransportCrossSection( 0.5 ),
+                                   500504.99504995055,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( distribution->getTransportCrossSection( 1.0 ), 1e3 );
+  FRENSIE_CHECK_EQUAL( distribution->getTransportCrossSection( 20.0 ), 1e1 );
+  FRENSIE_CHECK_EQUAL( distribution->getTransportCrossSection( 30.0 ), 1e1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the stopping cross section can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   getStoppingCrossSection )
+{
+  FRENSIE_CHECK_EQUAL( distribution->getStoppingCrossSection( 1e-6 ), 1e2 );
+  FRENSIE_CHECK_EQUAL( distribution->getStoppingCrossSection( 1e-5 ), 1e2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distribution->getStoppingCrossSection( 0.5 ),
+                                   75.00025000250002,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( distribution->getStoppingCrossSection( 1.0 ), 50.0 );
+  FRENSIE_CHECK_EQUAL( distribution->getStoppingCrossSection( 20.0 ), 10.0 );
+  FRENSIE_CHECK_EQUAL( distribution->getStoppingCrossSection( 30.0 ), 10.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the screening parameter can be calculated
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   calculateScreeningParameter )
+{
+  double eta = MonteCarlo::CondensedHistoryElectronScatteringDistribution::calculateScreeningParameter( 0.9 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( eta, 0.01535734671483362, 1e-9 );
+
+  // The mean angle cosine of the screened Rutherford distribution must match
+  double mean_angle_cosine =
+    1.0 - 2.0*eta*((1.0 + eta)*std::log1p( 1.0/eta ) - 1.0);
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( mean_angle_cosine, 0.9, 1e-10 );
+
+  // The tabulated screening parameters must be accurate over the entire range
+  std::vector<double> mean_angle_cosines( {1e-3, 0.1, 0.5, 0.99, 1.0-1e-6, 1.0-1e-12} );
+
+  for( size_t i = 0; i < mean_angle_cosines.size(); ++i )
+  {
+    eta = MonteCarlo::CondensedHistoryElectronScatteringDistribution::calculateScreeningParameter( mean_angle_cosines[i] );
+
+    mean_angle_cosine = 1.0 -
+      MonteCarlo::CondensedHistoryElectronScatteringDistribution::calculateMeanAngularDeflection( eta );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( mean_angle_cosine,
+                                     mean_angle_cosines[i],
+                                     1e-6 );
+  }
+
+  eta = MonteCarlo::CondensedHistoryElectronScatteringDistribution::calculateScreeningParameter( 0.0 );
+
+  FRENSIE_CHECK_EQUAL( eta, std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a multiple scattering angle cosine can be sampled
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistribution,
+                   sampleAngleCosine )
+{
+  std::vector<double> fake_stream( 3 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 1.0-1e-15;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double angle_cosine = MonteCarlo::CondensedHistoryElectronScatteringDistribution::sampleAngleCosine( 0.9 );
+
+  FRENSIE_CHECK_EQUAL( angle_cosine, 1.0 );
+
+  angle_cosine = MonteCarlo::CondensedHistoryElectronScatteringDistribution::sampleAngleCosine( 0.9 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( angle_cosine, 0.9702005864227421, 1e-9 );
+
+  angle_cosine = MonteCarlo::CondensedHistoryElectronScatteringDistribution::sampleAngleCosine( 0.9 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( angle_cosine, -1.0, 1e-6 );
+
+  // There is no deflection (no random number is used)
+  angle_cosine = MonteCarlo::CondensedHistoryElectronScatteringDistribution::sampleAngleCosine( 1.0 );
+
+  FRENSIE_CHECK_EQUAL( angle_cosine, 1.0 );
+
+  // Isotropic scattering
+  fake_stream.resize( 2 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.75;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  angle_cosine = MonteCarlo::CondensedHistoryElectronScatteringDistribution::sampleAngleCosine( -0.5 );
+
+  FRENSIE_CHECK_EQUAL( angle_cosine, -1.0 );
+
+  angle_cosine = MonteCarlo::CondensedHistoryElectronScatteringDistribution::sampleAngleCosine( 0.0 );
+
+  FRENSIE_CHECK_EQUAL( angle_cosine, 0.5 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> energy_grid( {1e-5, 1.0, 20.0} );
+  std::vector<double> transport_cross_section( {1e6, 1e3, 1e1} );
+  std::vector<double> stopping_cross_section( {1e2, 50.0, 10.0} );
+
+  distribution.reset(
+       new MonteCarlo::CondensedHistoryElectronScatteringDistribution(
+                                                   energy_grid,
+                                                   transport_cross_section,
+                                                   stopping_cross_section ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCondensedHistoryElectronScatteringDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,311 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCondensedHistoryElectronScatteringDistributionNativeFactory.cpp
+//! \author Alex Robinson
+//! \brief  Condensed history electron scattering distribution native factory
+//!         unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_ElasticElectronScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_AtomicExcitationElectronScatteringDistributionNativeFactory.hpp"
+#include "MonteCarlo_ElasticElectronTraits.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Structs.
+//---------------------------------------------------------------------------//
+class TestCondensedHistoryElectronScatteringDistributionNativeFactory : public MonteCarlo::CondensedHistoryElectronScatteringDistributionNativeFactory
+{
+public:
+
+  // Allow public access to the protected member functions
+  using MonteCarlo::CondensedHistoryElectronScatteringDistributionNativeFactory::calculateScreenedRutherfordMeanAngularDeflection;
+};
+
+//---------------------------------------------------------------------------//
+// Testing Variables.
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<Data::ElectronPhotonRelaxationDataContainer> data_container;
+
+std::shared_ptr<const MonteCarlo::CondensedHistoryElectronScatteringDistribution>
+  distribution;
+
+// The index of an electron energy grid point that is also an elastic angular
+// energy grid point
+size_t energy_index;
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the screened Rutherford mean angular deflection agrees with the
+// mean angular deflection of the analog screened Rutherford distribution
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistributionNativeFactory,
+                   calculateScreenedRutherfordMeanAngularDeflection )
+{
+  std::shared_ptr<const MonteCarlo::ScreenedRutherfordElasticElectronScatteringDistribution>
+    sr_distribution;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createScreenedRutherfordElasticDistribution(
+                                          sr_distribution,
+                                          data_container->getAtomicNumber() );
+
+  std::vector<double> energies( {1e-3, 1e-1, 1e1} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    const double mean_angular_deflection =
+      TestCondensedHistoryElectronScatteringDistributionNativeFactory::calculateScreenedRutherfordMeanAngularDeflection(
+                                          energies[i],
+                                          data_container->getAtomicNumber() );
+
+    FRENSIE_CHECK( mean_angular_deflection > 0.0 );
+    FRENSIE_CHECK( mean_angular_deflection <
+                   MonteCarlo::ElasticElectronTraits::delta_mu_peak );
+
+    const size_t number_of_samples = 100000;
+
+    double analog_mean_angular_deflection = 0.0;
+
+    for( size_t j = 0; j < number_of_samples; ++j )
+    {
+      double outgoing_energy, scattering_angle_cosine;
+
+      sr_distribution->sample( energies[i],
+                               outgoing_energy,
+                               scattering_angle_cosine );
+
+      analog_mean_angular_deflection += 1.0 - scattering_angle_cosine;
+    }
+
+    analog_mean_angular_deflection /= number_of_samples;
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( mean_angular_deflection,
+                                     analog_mean_angular_deflection,
+                                     1e-2 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the transport cross section agrees with the transport cross
+// section of the analog (cutoff + screened Rutherford) elastic reactions
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistributionNativeFactory,
+                   createCondensedHistoryDistribution_transport_cross_section )
+{
+  const double energy = data_container->getElectronEnergyGrid()[energy_index];
+
+  std::shared_ptr<const MonteCarlo::CutoffElasticElectronScatteringDistribution>
+    cutoff_distribution;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createCutoffElasticDistribution<Utility::LogLogCosLog,Utility::Correlated>(
+                                                           cutoff_distribution,
+                                                           *data_container,
+                                                           1.0,
+                                                           1e-7 );
+
+  std::shared_ptr<const MonteCarlo::ScreenedRutherfordElasticElectronScatteringDistribution>
+    sr_distribution;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createScreenedRutherfordElasticDistribution(
+                                          sr_distribution,
+                                          data_container->getAtomicNumber() );
+
+  // Estimate the mean angular deflection of each analog reaction
+  const size_t number_of_samples = 1000000;
+
+  double cutoff_mean_angular_deflection = 0.0;
+  double sr_mean_angular_deflection = 0.0;
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+  {
+    double outgoing_energy, scattering_angle_cosine;
+
+    cutoff_distribution->sample( energy,
+                                 outgoing_energy,
+                                 scattering_angle_cosine );
+
+    cutoff_mean_angular_deflection += 1.0 - scattering_angle_cosine;
+
+    sr_distribution->sample( energy,
+                             outgoing_energy,
+                             scattering_angle_cosine );
+
+    sr_mean_angular_deflection += 1.0 - scattering_angle_cosine;
+  }
+
+  cutoff_mean_angular_deflection /= number_of_samples;
+  sr_mean_angular_deflection /= number_of_samples;
+
+  double analog_transport_cross_section = 0.0;
+
+  const size_t cutoff_threshold_index =
+    data_container->getCutoffElasticCrossSectionThresholdEnergyIndex();
+
+  if( energy_index >= cutoff_threshold_index )
+  {
+    analog_transport_cross_section +=
+      data_container->getCutoffElasticCrossSection()[energy_index-cutoff_threshold_index]*
+      cutoff_mean_angular_deflection;
+  }
+
+  const size_t sr_threshold_index =
+    data_container->getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex();
+
+  if( energy_index >= sr_threshold_index )
+  {
+    analog_transport_cross_section +=
+      data_container->getScreenedRutherfordElasticCrossSection()[energy_index-sr_threshold_index]*
+      sr_mean_angular_deflection;
+  }
+
+  FRENSIE_CHECK( analog_transport_cross_section > 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                             distribution->getTransportCrossSection( energy ),
+                             analog_transport_cross_section,
+                             2e-2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the stopping cross section agrees with the stopping cross
+// section of the analog atomic excitation reaction
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistributionNativeFactory,
+                   createCondensedHistoryDistribution_stopping_cross_section )
+{
+  const double energy = data_container->getElectronEnergyGrid()[energy_index];
+
+  std::shared_ptr<const MonteCarlo::AtomicExcitationElectronScatteringDistribution>
+    excitation_distribution;
+
+  MonteCarlo::AtomicExcitationElectronScatteringDistributionNativeFactory::createAtomicExcitationDistribution(
+                                                     *data_container,
+                                                     excitation_distribution );
+
+  double outgoing_energy, scattering_angle_cosine;
+
+  excitation_distribution->sample( energy,
+                                   outgoing_energy,
+                                   scattering_angle_cosine );
+
+  const size_t threshold_index =
+    data_container->getAtomicExcitationCrossSectionThresholdEnergyIndex();
+
+  FRENSIE_REQUIRE( energy_index >= threshold_index );
+
+  const double analog_stopping_cross_section =
+    data_container->getAtomicExcitationCrossSection()[energy_index-threshold_index]*
+    (energy - outgoing_energy);
+
+  FRENSIE_CHECK( analog_stopping_cross_section > 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                              distribution->getStoppingCrossSection( energy ),
+                              analog_stopping_cross_section,
+                              1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the tables are empty when the soft collision modes are off
+FRENSIE_UNIT_TEST( CondensedHistoryElectronScatteringDistributionNativeFactory,
+                   createCondensedHistoryDistribution_modes_off )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+  properties.setCondensedHistoryModeOn();
+  properties.setElasticModeOff();
+  properties.setAtomicExcitationModeOff();
+
+  std::shared_ptr<const MonteCarlo::CondensedHistoryElectronScatteringDistribution>
+    empty_distribution;
+
+  MonteCarlo::CondensedHistoryElectronScatteringDistributionNativeFactory::createCondensedHistoryDistribution(
+                                                        *data_container,
+                                                        properties,
+                                                        empty_distribution );
+
+  const double energy = data_container->getElectronEnergyGrid()[energy_index];
+
+  FRENSIE_CHECK_EQUAL( empty_distribution->getTransportCrossSection( energy ),
+                       0.0 );
+  FRENSIE_CHECK_EQUAL( empty_distribution->getStoppingCrossSection( energy ),
+                       0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_native_file_name;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_native_file",
+                                        test_native_file_name, "",
+                                        "Test Native file name" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Create the native data file container
+  data_container.reset( new Data::ElectronPhotonRelaxationDataContainer(
+                                                     test_native_file_name ) );
+
+  // Create the condensed history distribution
+  MonteCarlo::SimulationElectronProperties properties;
+  properties.setCondensedHistoryModeOn();
+
+  MonteCarlo::CondensedHistoryElectronScatteringDistributionNativeFactory::createCondensedHistoryDistribution(
+                                                              *data_container,
+                                                              properties,
+                                                              distribution );
+
+  // Find an elastic angular energy grid point above 0.1 MeV that is also an
+  // electron energy grid point
+  const std::vector<double>& energy_grid =
+    data_container->getElectronEnergyGrid();
+
+  const std::vector<double>& angular_energy_grid =
+    data_container->getElasticAngularEnergyGrid();
+
+  energy_index = energy_grid.size();
+
+  for( size_t i = 0; i < angular_energy_grid.size(); ++i )
+  {
+    if( angular_energy_grid[i] < 0.1 )
+      continue;
+
+    std::vector<double>::const_iterator energy_grid_point =
+      std::lower_bound( energy_grid.begin(),
+                        energy_grid.end(),
+                        angular_energy_grid[i] );
+
+    if( energy_grid_point != energy_grid.end() &&
+        *energy_grid_point == angular_energy_grid[i] )
+    {
+      energy_index = energy_grid_point - energy_grid.begin();
+
+      break;
+    }
+  }
+
+  TEST_FOR_EXCEPTION( energy_index == energy_grid.size(),
+                      std::runtime_error,
+                      "The electron energy grid and the elastic angular "
+                      "energy grid do not share a grid point above 0.1 MeV!" );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCondensedHistoryElectronScatteringDistributionNativeFactory.cpp
+//---------------------------------------------------------------------------//
@@ -2251,6 +2251,239 @@ FRENSIE_UNIT_TEST( ElasticElectronScatteringDistributionNativeFactory,
                           1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the inverse cdf sampling table can be created
+FRENSIE_UNIT_TEST( ElasticElectronScatteringDistributionNativeFactory,
+                   createInverseCDFSamplingTable )
+{
+  double evaluation_tol = 1e-7;
+
+  std::shared_ptr<TwoDDist> scattering_function;
+  TestElasticElectronScatteringDistributionNativeFactory::createScatteringFunction<Utility::LogNudgedLogCosLog,Utility::Correlated >(
+    data_container->getCutoffElasticAngles(),
+    data_container->getCutoffElasticPDF(),
+    data_container->getElasticAngularEnergyGrid(),
+    scattering_function,
+    1.0,
+    evaluation_tol,
+    false );
+
+  std::shared_ptr<const MonteCarlo::ElasticInverseCDFSamplingTable>
+    sampling_table;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createInverseCDFSamplingTable<Utility::LogNudgedLogCosLog,Utility::Correlated>(
+    sampling_table,
+    *scattering_function,
+    data_container->getElasticAngularEnergyGrid(),
+    1e-4 );
+
+  FRENSIE_REQUIRE( sampling_table.get() != NULL );
+  FRENSIE_CHECK_EQUAL( sampling_table->getNumberOfEnergyGridPoints(),
+                       data_container->getElasticAngularEnergyGrid().size() );
+  FRENSIE_CHECK( sampling_table->getNumberOfRandomNumberBins() <= 16384 );
+  FRENSIE_CHECK( sampling_table->getMaxEstimatedError() <= 1e-4 );
+  FRENSIE_CHECK( sampling_table->getMemoryUsage() >
+                 sampling_table->getNumberOfEnergyGridPoints()*
+                 sampling_table->getNumberOfRandomNumberBins()*sizeof(double) );
+
+  // The (1 - mu) values of the table samples must agree with the
+  // (1 - mu) values of the scattering function samples (the forward peak
+  // must be resolved)
+  std::vector<double> energies( {1e-5, 1e-3, 0.1, 1.0, 15.7, 1e5} );
+  std::vector<double> random_numbers( {0.0, 0.1, 0.5, 0.9, 0.999, 0.99999, 1.0} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    for( size_t j = 0; j < random_numbers.size(); ++j )
+    {
+      double exact_sample =
+        scattering_function->sampleSecondaryConditionalWithRandomNumber(
+                                           energies[i], random_numbers[j] );
+
+      double table_sample =
+        sampling_table->sampleWithRandomNumber( energies[i],
+                                                random_numbers[j] );
+
+      FRENSIE_CHECK_FLOATING_EQUALITY( 1.0 - table_sample,
+                                       1.0 - exact_sample,
+                                       1e-3 );
+    }
+  }
+
+  // Only the correlated grid policies are supported
+  FRENSIE_CHECK_THROW( (MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createInverseCDFSamplingTable<Utility::LogNudgedLogCosLog,Utility::Direct>(
+                         sampling_table,
+                         *scattering_function,
+                         data_container->getElasticAngularEnergyGrid(),
+                         1e-4 )),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the coupled distribution can be created with a sampling table
+FRENSIE_UNIT_TEST( ElasticElectronScatteringDistributionNativeFactory,
+                   createCoupledElasticDistribution_inverse_cdf_table )
+{
+  std::shared_ptr<const MonteCarlo::CoupledElasticElectronScatteringDistribution>
+    tabulated_distribution;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDistribution<Utility::LogNudgedLogCosLog,Utility::Correlated>(
+    tabulated_distribution,
+    *data_container,
+    MonteCarlo::TWO_D_UNION,
+    1e-15,
+    true,
+    1e-4 );
+
+  FRENSIE_CHECK( tabulated_distribution->getInverseCDFSamplingTableMemoryUsage() > 0 );
+
+  std::shared_ptr<const MonteCarlo::CoupledElasticElectronScatteringDistribution>
+    distribution;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createCoupledElasticDistribution<Utility::LogNudgedLogCosLog,Utility::Correlated>(
+    distribution,
+    *data_container,
+    MonteCarlo::TWO_D_UNION,
+    1e-15 );
+
+  FRENSIE_CHECK_EQUAL( distribution->getInverseCDFSamplingTableMemoryUsage(), 0 );
+
+  // Set fake random number stream
+  std::vector<double> fake_stream( {0.2, 0.2, 0.7, 0.7} );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double outgoing_energy, scattering_angle_cosine;
+  double tabulated_outgoing_energy, tabulated_scattering_angle_cosine;
+
+  distribution->sample( 1e-3, outgoing_energy, scattering_angle_cosine );
+  tabulated_distribution->sample( 1e-3,
+                                  tabulated_outgoing_energy,
+                                  tabulated_scattering_angle_cosine );
+
+  FRENSIE_CHECK_EQUAL( tabulated_outgoing_energy, outgoing_energy );
+  FRENSIE_CHECK_FLOATING_EQUALITY( 1.0 - tabulated_scattering_angle_cosine,
+                                   1.0 - scattering_angle_cosine,
+                                   1e-3 );
+
+  distribution->sample( 1e-3, outgoing_energy, scattering_angle_cosine );
+  tabulated_distribution->sample( 1e-3,
+                                  tabulated_outgoing_energy,
+                                  tabulated_scattering_angle_cosine );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( 1.0 - tabulated_scattering_angle_cosine,
+                                   1.0 - scattering_angle_cosine,
+                                   1e-3 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hybrid distribution can be created with a sampling table
+FRENSIE_UNIT_TEST( ElasticElectronScatteringDistributionNativeFactory,
+                   createHybridElasticDistribution_inverse_cdf_table )
+{
+  double cutoff_angle_cosine = 0.9;
+  double evaluation_tol = 1e-14;
+
+  std::shared_ptr<const std::vector<double> > energy_grid(
+          new std::vector<double>( data_container->getElectronEnergyGrid() ) );
+
+  std::shared_ptr<const std::vector<double> > cutoff_cross_section(
+   new std::vector<double>( data_container->getCutoffElasticCrossSection() ) );
+
+  // Moment preserving elastic cross section
+  std::vector<double> moment_preserving_cross_sections;
+  size_t mp_threshold_energy_index;
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::calculateMomentPreservingCrossSections<Utility::LinLinLog,Utility::Correlated>(
+                               moment_preserving_cross_sections,
+                               mp_threshold_energy_index,
+                               *data_container,
+                               energy_grid,
+                               evaluation_tol );
+
+  std::shared_ptr<const std::vector<double> > mp_cross_section(
+                 new std::vector<double>( moment_preserving_cross_sections ) );
+
+  std::shared_ptr<const MonteCarlo::HybridElasticElectronScatteringDistribution>
+    tabulated_distribution;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDistribution<Utility::LinLinLog,Utility::Correlated>(
+        tabulated_distribution,
+        energy_grid,
+        cutoff_cross_section,
+        mp_cross_section,
+        *data_container,
+        cutoff_angle_cosine,
+        evaluation_tol,
+        true,
+        1e-4 );
+
+  FRENSIE_CHECK( tabulated_distribution->getInverseCDFSamplingTableMemoryUsage() > 0 );
+
+  std::shared_ptr<const MonteCarlo::HybridElasticElectronScatteringDistribution>
+    distribution;
+
+  MonteCarlo::ElasticElectronScatteringDistributionNativeFactory::createHybridElasticDistribution<Utility::LinLinLog,Utility::Correlated>(
+        distribution,
+        energy_grid,
+        cutoff_cross_section,
+        mp_cross_section,
+        *data_container,
+        cutoff_angle_cosine,
+        evaluation_tol );
+
+  FRENSIE_CHECK_EQUAL( distribution->getInverseCDFSamplingTableMemoryUsage(), 0 );
+
+  // Sample the cutoff (continuous) and the moment preserving (discrete)
+  // parts of the distribution at an angular energy grid point (1e-3) and
+  // between angular energy grid points (1e-4)
+  std::vector<double> energies( {1e-3, 1e-4} );
+  std::vector<double> fake_stream( {0.1, 0.2, 0.3, 0.4, 0.7, 0.95} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    for( size_t j = 0; j < fake_stream.size(); ++j )
+    {
+      double outgoing_energy, scattering_angle_cosine;
+      double tabulated_outgoing_energy, tabulated_scattering_angle_cosine;
+
+      Utility::RandomNumberGenerator::setFakeStream(
+                                  std::vector<double>( 1, fake_stream[j] ) );
+
+      distribution->sample( energies[i],
+                            outgoing_energy,
+                            scattering_angle_cosine );
+
+      Utility::RandomNumberGenerator::setFakeStream(
+                                  std::vector<double>( 1, fake_stream[j] ) );
+
+      tabulated_distribution->sample( energies[i],
+                                      tabulated_outgoing_energy,
+                                      tabulated_scattering_angle_cosine );
+
+      FRENSIE_CHECK_EQUAL( tabulated_outgoing_energy, outgoing_energy );
+
+      // The discrete angles must not be smeared by the table
+      if( scattering_angle_cosine > cutoff_angle_cosine &&
+          energies[i] == 1e-3 )
+      {
+        FRENSIE_CHECK_FLOATING_EQUALITY( tabulated_scattering_angle_cosine,
+                                         scattering_angle_cosine,
+                                         1e-12 );
+      }
+      else
+      {
+        FRENSIE_CHECK_FLOATING_EQUALITY( 1.0 - tabulated_scattering_angle_cosine,
+                                         1.0 - scattering_angle_cosine,
+                                         1e-3 );
+      }
+    }
+  }
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
 //---------------------------------------------------------------------------//
 // Check that the moment preserving cross sections can be calculated
 FRENSIE_UNIT_TEST( ElasticElectronScatteringDistributionNativeFactory,
@@ -1430,6 +1430,53 @@ FRENSIE_UNIT_TEST( ElectroatomNativeFactory, createElectroatom_no_atomic_excitat
   FRENSIE_CHECK_FLOATING_EQUALITY( cross_section, 1.82234e5, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a electroatom with a total stopping cross section can be created
+FRENSIE_UNIT_TEST( ElectroatomNativeFactory, createElectroatom_range_rejection )
+{
+  MonteCarlo::SimulationProperties properties;
+  properties.setElasticCutoffAngleCosine( 1.0 );
+  properties.setNumberOfElectronHashGridBins( 100 );
+
+  std::shared_ptr<const MonteCarlo::Electroatom> atom;
+
+  MonteCarlo::ElectroatomNativeFactory::createElectroatom( *data_container,
+                                                           electroatom_name,
+                                                           atomic_weight,
+                                                           relaxation_model,
+                                                           properties,
+                                                           atom );
+
+  FRENSIE_CHECK( !atom->getCore().hasTotalStoppingCrossSection() );
+  FRENSIE_CHECK_EQUAL( atom->getTotalStoppingCrossSection( 1.0 ), 0.0 );
+
+  properties.setElectronRangeRejectionModeOn();
+
+  MonteCarlo::ElectroatomNativeFactory::createElectroatom( *data_container,
+                                                           electroatom_name,
+                                                           atomic_weight,
+                                                           relaxation_model,
+                                                           properties,
+                                                           atom );
+
+  FRENSIE_REQUIRE( atom->getCore().hasTotalStoppingCrossSection() );
+
+  // The collision stopping power decreases with energy at low energies
+  const double low_energy_stopping_cross_section =
+    atom->getTotalStoppingCrossSection( 1.0e-2 );
+
+  const double high_energy_stopping_cross_section =
+    atom->getTotalStoppingCrossSection( 1.0 );
+
+  FRENSIE_CHECK_GREATER( high_energy_stopping_cross_section, 0.0 );
+  FRENSIE_CHECK_GREATER( low_energy_stopping_cross_section,
+                         high_energy_stopping_cross_section );
+
+  // The radiative stopping power dominates at high energies
+  FRENSIE_CHECK_GREATER( atom->getTotalStoppingCrossSection( 1.0e3 ),
+                         high_energy_stopping_cross_section );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
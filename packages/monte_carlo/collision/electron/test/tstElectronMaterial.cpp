@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <limits>
 
 // FRENSIE Includes
 #include "MonteCarlo_ElectroatomFactory.hpp"
@@ -24,6 +25,8 @@
 
 std::shared_ptr<MonteCarlo::ElectronMaterial> material;
 
+std::shared_ptr<MonteCarlo::ElectronMaterial> native_material;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -275,6 +278,37 @@ FRENSIE_UNIT_TEST( ElectronMaterial, collideSurvivalBias )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the CSDA range is infinite without total stopping cross sections
+FRENSIE_UNIT_TEST( ElectronMaterial, getCSDARange )
+{
+  FRENSIE_CHECK( !material->hasCSDARange() );
+  FRENSIE_CHECK_EQUAL( material->getTotalStoppingPower( 1.0 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( material->getCSDARange( 1.0 ),
+                       std::numeric_limits<double>::infinity() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the CSDA range can be returned
+FRENSIE_UNIT_TEST( ElectronMaterial, getCSDARange_native )
+{
+  FRENSIE_REQUIRE( native_material->hasCSDARange() );
+
+  // The range increases with energy
+  FRENSIE_CHECK( native_material->getCSDARange( 1e-2 ) > 0.0 );
+  FRENSIE_CHECK( native_material->getCSDARange( 1e-1 ) >
+                 native_material->getCSDARange( 1e-2 ) );
+  FRENSIE_CHECK( native_material->getCSDARange( 1.0 ) >
+                 native_material->getCSDARange( 1e-1 ) );
+
+  // ESTAR (NIST) CSDA range of a 1 MeV electron in lead: 0.78 g/cm^2. The
+  // EEDL stopping powers (no density effect correction) and the mean
+  // energy loss approximations agree with ESTAR to within 10%.
+  FRENSIE_CHECK_FLOATING_EQUALITY( native_material->getCSDARange( 1.0 ),
+                                   0.78,
+                                   0.1 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
@@ -356,6 +390,70 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                       atom_names ) );
   }
 
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    boost::filesystem::path data_directory = database_path.parent_path();
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::AtomProperties& pb_properties =
+      database.getAtomProperties( Data::Pb_ATOM );
+
+    // Set the scattering center definitions
+    MonteCarlo::ScatteringCenterDefinitionDatabase electroatom_definitions;
+
+    MonteCarlo::ScatteringCenterDefinition& pb_definition =
+      electroatom_definitions.createDefinition( "Pb-Native", Data::Pb_ATOM );
+
+    pb_definition.setElectroatomicDataProperties(
+           pb_properties.getSharedElectroatomicDataProperties(
+                     Data::ElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    MonteCarlo::ElectroatomFactory::ScatteringCenterNameSet electroatom_aliases;
+    electroatom_aliases.insert( "Pb-Native" );
+
+    // Create the factories
+    std::shared_ptr<MonteCarlo::AtomicRelaxationModelFactory>
+      atomic_relaxation_model_factory(
+                new MonteCarlo::AtomicRelaxationModelFactory );
+
+    // The total stopping cross sections are only created in range rejection
+    // mode
+    MonteCarlo::SimulationProperties properties;
+    properties.setNumberOfElectronHashGridBins( 100 );
+    properties.setElasticCutoffAngleCosine( 1.0 );
+    properties.setElectronRangeRejectionModeOn();
+
+    MonteCarlo::ElectroatomFactory factory( data_directory,
+                                            electroatom_aliases,
+                                            electroatom_definitions,
+                                            atomic_relaxation_model_factory,
+                                            properties,
+                                            true );
+
+    MonteCarlo::ElectroatomFactory::ElectroatomNameMap atom_map;
+
+    factory.createElectroatomMap( atom_map );
+
+    // Assign the atom fractions and names
+    std::vector<double> atom_fractions( 1 );
+    std::vector<std::string> atom_names( 1 );
+
+    atom_fractions[0] = -1.0; // weight fraction
+    atom_names[0] = "Pb-Native";
+
+    // Create the test material (1 g/cm^3)
+    native_material.reset( new MonteCarlo::ElectronMaterial( 1,
+                                                             -1.0,
+                                                             atom_map,
+                                                             atom_fractions,
+                                                             atom_names ) );
+  }
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
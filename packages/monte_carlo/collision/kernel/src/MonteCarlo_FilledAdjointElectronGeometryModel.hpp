@@ -51,6 +51,7 @@ protected:
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache,
        const SimulationProperties& properties,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const final override;
@@ -19,6 +19,7 @@ void FilledAdjointPhotonGeometryModel::loadScatteringCenters(
        unique_scattering_center_names,
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache,
        const SimulationProperties& properties,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const
@@ -27,7 +28,8 @@ void FilledAdjointPhotonGeometryModel::loadScatteringCenters(
                                                      unique_scattering_center_names,
                                                      scattering_center_definitions,
                                                      properties,
-                                                     verbose );
+                                                     verbose,
+                                                     data_cache );
 
   adjoint_photoatom_factory.createAdjointPhotoatomMap( scattering_center_name_map );
 }
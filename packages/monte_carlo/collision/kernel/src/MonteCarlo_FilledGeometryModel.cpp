@@ -13,6 +13,7 @@
 #include "FRENSIE_Archives.hpp" // Must included first
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
+#include "MonteCarlo_ScatteringCenterDataCache.hpp"
 #include "MonteCarlo_ParticleModeTypeTraits.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -254,6 +255,22 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
   std::shared_ptr<AtomicRelaxationModelFactory>
     atomic_relaxation_model_factory( new AtomicRelaxationModelFactory );
 
+  // Load every data table required by the simulation once (the tables will
+  // be released when the model has been filled)
+  std::shared_ptr<ScatteringCenterDataCache>
+    data_cache( new ScatteringCenterDataCache );
+
+  try{
+    data_cache->addRequiredDataTables( d_database_path,
+                                       unique_scattering_center_names,
+                                       *d_scattering_center_definitions,
+                                       *d_properties );
+
+    data_cache->loadRequiredDataTables( verbose );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Could not load the required data tables!" );
+
   // Only load the particle materials required by the simulation mode
   ParticleModeType mode = d_properties->getParticleMode();
 
@@ -266,6 +283,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
+                                              data_cache,
                                               *d_properties,
                                               verbose,
                                               *d_material_definitions,
@@ -286,6 +304,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
+                                              data_cache,
                                               *d_properties,
                                               verbose,
                                               *d_material_definitions,
@@ -306,6 +325,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
+                                              data_cache,
                                               *d_properties,
                                               verbose,
                                               *d_material_definitions,
@@ -326,6 +346,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
+                                              data_cache,
                                               *d_properties,
                                               verbose,
                                               *d_material_definitions,
@@ -342,6 +363,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
+                                              data_cache,
                                               *d_properties,
                                               verbose,
                                               *d_material_definitions,
@@ -362,6 +384,7 @@ void FilledGeometryModel::fillGeometry( const bool verbose )
                                               unique_scattering_center_names,
                                               *d_scattering_center_definitions,
                                               atomic_relaxation_model_factory,
+                                              data_cache,
                                               *d_properties,
                                               verbose,
                                               *d_material_definitions,
@@ -20,6 +20,7 @@ void FilledPositronGeometryModel::loadScatteringCenters(
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache,
        const SimulationProperties& properties,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const
@@ -29,7 +30,8 @@ void FilledPositronGeometryModel::loadScatteringCenters(
                                             scattering_center_definitions,
                                             atomic_relaxation_model_factory,
                                             properties,
-                                            verbose );
+                                            verbose,
+                                            data_cache );
 
   positronatom_factory.createPositronatomMap( scattering_center_name_map );
 }
@@ -0,0 +1,36 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_MacroscopicCrossSectionCache.cpp
+//! \author Alex Robinson
+//! \brief  Macroscopic cross section cache class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstddef>
+
+// FRENSIE Includes
+#include "MonteCarlo_MacroscopicCrossSectionCache.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+MacroscopicCrossSectionCache::MacroscopicCrossSectionCache()
+  : d_material( NULL ),
+    d_energy( 0.0 ),
+    d_cross_section( 0.0 )
+{ /* ... */ }
+
+// Invalidate the cache
+void MacroscopicCrossSectionCache::invalidate()
+{
+  d_material = NULL;
+  d_energy = 0.0;
+  d_cross_section = 0.0;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_MacroscopicCrossSectionCache.cpp
+//---------------------------------------------------------------------------//
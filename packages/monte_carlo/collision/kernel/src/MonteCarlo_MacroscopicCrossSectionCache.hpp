@@ -0,0 +1,93 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_MacroscopicCrossSectionCache.hpp
+//! \author Alex Robinson
+//! \brief  Macroscopic cross section cache class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_MACROSCOPIC_CROSS_SECTION_CACHE_HPP
+#define MONTE_CARLO_MACROSCOPIC_CROSS_SECTION_CACHE_HPP
+
+namespace MonteCarlo{
+
+/*! The macroscopic cross section cache class
+ * \details This class stores the last macroscopic cross section that was
+ * evaluated for a particle along with the material and the energy that it
+ * was evaluated at. A particle that passes through many cells that are
+ * filled with the same material (e.g. a lattice or a voxel model) can reuse
+ * the cached value instead of evaluating the material cross section again.
+ * The cached value is only used when both the material and the energy match,
+ * so the cache is invalidated automatically when the particle energy changes.
+ * A cache should only be used by a single thread.
+ */
+class MacroscopicCrossSectionCache
+{
+
+public:
+
+  //! Constructor
+  MacroscopicCrossSectionCache();
+
+  //! Destructor
+  ~MacroscopicCrossSectionCache()
+  { /* ... */ }
+
+  //! Check if the cross section is cached for the material and energy
+  bool isCrossSectionCached( const void* material, const double energy ) const;
+
+  //! Return the cached cross section
+  double getCachedCrossSection() const;
+
+  //! Cache the cross section evaluated for the material and energy
+  void cacheCrossSection( const void* material,
+                          const double energy,
+                          const double cross_section );
+
+  //! Invalidate the cache
+  void invalidate();
+
+private:
+
+  // The material that the cross section was evaluated for
+  const void* d_material;
+
+  // The energy that the cross section was evaluated at
+  double d_energy;
+
+  // The cached cross section
+  double d_cross_section;
+};
+
+// Check if the cross section is cached for the material and energy
+inline bool MacroscopicCrossSectionCache::isCrossSectionCached(
+                                                   const void* material,
+                                                   const double energy ) const
+{
+  return d_material == material && d_energy == energy;
+}
+
+// Return the cached cross section
+inline double MacroscopicCrossSectionCache::getCachedCrossSection() const
+{
+  return d_cross_section;
+}
+
+// Cache the cross section evaluated for the material and energy
+inline void MacroscopicCrossSectionCache::cacheCrossSection(
+                                                  const void* material,
+                                                  const double energy,
+                                                  const double cross_section )
+{
+  d_material = material;
+  d_energy = energy;
+  d_cross_section = cross_section;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_MACROSCOPIC_CROSS_SECTION_CACHE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_MacroscopicCrossSectionCache.hpp
+//---------------------------------------------------------------------------//
@@ -17,8 +17,10 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
+#include "MonteCarlo_ScatteringCenterDataCache.hpp"
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
+#include "MonteCarlo_MacroscopicCrossSectionCache.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "Geometry_Model.hpp"
 #include "Utility_Map.hpp"
@@ -101,6 +103,11 @@ public:
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total forward macroscopic cross section of a material (cached)
+  double getMacroscopicTotalForwardCrossSectionQuick(
+                                     const ParticleStateType& particle,
+                                     MacroscopicCrossSectionCache& cache ) const;
+
   //! Get the macroscopic reaction cross section for a specific reaction
   double getMacroscopicReactionCrossSection(
                                        const ParticleStateType& particle,
@@ -146,6 +153,7 @@ protected:
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache,
        const SimulationProperties& properties,
        const bool verbose_material_construction,
        const MaterialDefinitionDatabase& material_definitions,
@@ -160,6 +168,7 @@ protected:
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache,
        const SimulationProperties& properties,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const = 0;
@@ -55,6 +55,7 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
        const ScatteringCenterDefinitionDatabase& scattering_center_definitions,
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache,
        const SimulationProperties& properties,
        const bool verbose_material_construction,
        const MaterialDefinitionDatabase& material_definitions,
@@ -66,6 +67,7 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
                                  unique_scattering_center_names,
                                  scattering_center_definitions,
                                  atomic_relaxation_model_factory,
+                                 data_cache,
                                  properties,
                                  verbose_material_construction,
                                  d_scattering_center_name_map );
@@ -107,9 +109,6 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
     if( d_material_name_map.find( material_name ) ==
         d_material_name_map.end() )
     {
-      std::shared_ptr<const MaterialType>& new_material =
-        d_material_name_map[material_name];
-
       const MaterialDefinitionDatabase::MaterialDefinitionArray&
         material_definition = material_definitions.getDefinition( material_id );
 
@@ -125,11 +124,23 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
           Utility::get<1>( material_definition[i] );
       }
 
-      new_material.reset( new MaterialType( material_id,
-                                            density,
-                                            d_scattering_center_name_map,
-                                            scattering_center_fractions,
-                                            scattering_center_names ) );
+      std::shared_ptr<MaterialType> new_material(
+                               new MaterialType( material_id,
+                                                 density,
+                                                 d_scattering_center_name_map,
+                                                 scattering_center_fractions,
+                                                 scattering_center_names ) );
+
+      // Trade memory for faster cross section lookups if requested
+      if( properties.isUnionizedEnergyGridModeOn() )
+      {
+        new_material->unionizeEnergyGrid(
+            properties.getMinParticleEnergy<ParticleStateType>(),
+            properties.getMaxParticleEnergy<ParticleStateType>(),
+            properties.getUnionizedEnergyGridThinningTolerance() );
+      }
+
+      d_material_name_map[material_name] = new_material;
     }
 
     material_name_cell_ids_map[material_name].push_back( cell_id );
@@ -321,6 +332,37 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
   return this->getMaterial( cell )->getMacroscopicTotalCrossSection( energy );
 }
 
+// Get the total forward macroscopic cross section of a material (cached)
+/*! \details The cached cross section will be returned if the material in the
+ * particle's cell and the particle's energy match the cache. Otherwise the
+ * cross section will be evaluated and cached. Before calling this method you
+ * must first check if the cell is void. Calling this method with a void cell
+ * is not allowed.
+ */
+template<typename Material>
+double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuick(
+                                     const ParticleStateType& particle,
+                                     MacroscopicCrossSectionCache& cache ) const
+{
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoid( particle.getCell() ) );
+
+  const MaterialType* material =
+    d_cell_id_material_map.find( particle.getCell() )->second.get();
+
+  if( !cache.isCrossSectionCached( material, particle.getEnergy() ) )
+  {
+    cache.cacheCrossSection(
+                  material,
+                  particle.getEnergy(),
+                  this->getMacroscopicTotalForwardCrossSectionQuick(
+                                                       particle.getCell(),
+                                                       particle.getEnergy() ) );
+  }
+
+  return cache.getCachedCrossSection();
+}
+
 // Get the macroscopic reaction cross section for a specific reaction
 template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCrossSection(
@@ -125,6 +125,53 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, constructor_electron_mode )
                  unfilled_model );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a filled geometry model with unionized electron and positron
+// material energy grids can be constructed
+FRENSIE_UNIT_TEST( FilledGeometryModel, constructor_electron_mode_unionized )
+{
+  std::shared_ptr<const Geometry::Model> unfilled_model(
+            new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) );
+
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties( new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::ELECTRON_MODE );
+  properties->setMinElectronEnergy( 1e-3 );
+  properties->setUnionizedEnergyGridModeOn();
+
+  std::unique_ptr<const MonteCarlo::FilledGeometryModel> filled_model;
+
+  FRENSIE_CHECK_NO_THROW( filled_model.reset(
+                                  new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        true ) ) );
+
+  FRENSIE_REQUIRE( filled_model.get() != NULL );
+
+  // The electron material grid uses the electron energy limits
+  const MonteCarlo::ElectronMaterial& electron_material =
+    *filled_model->MonteCarlo::FilledElectronGeometryModel::getMaterial( 1 );
+
+  FRENSIE_REQUIRE( electron_material.isEnergyGridUnionized() );
+  FRENSIE_CHECK_EQUAL( electron_material.getUnionizedEnergyGrid().front(),
+                       1e-3 );
+  FRENSIE_CHECK_EQUAL( electron_material.getUnionizedEnergyGrid().back(),
+                       properties->getMaxElectronEnergy() );
+
+  // The positron material grid also uses the electron energy limits
+  const MonteCarlo::PositronMaterial& positron_material =
+    *filled_model->MonteCarlo::FilledPositronGeometryModel::getMaterial( 1 );
+
+  FRENSIE_REQUIRE( positron_material.isEnergyGridUnionized() );
+  FRENSIE_CHECK_EQUAL( positron_material.getUnionizedEnergyGrid().front(),
+                       1e-3 );
+  FRENSIE_CHECK_EQUAL( positron_material.getUnionizedEnergyGrid().back(),
+                       properties->getMaxElectronEnergy() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a filled geometry model can be constructed
 FRENSIE_UNIT_TEST( FilledGeometryModel, constructor_neutron_photon_mode )
@@ -1131,6 +1178,59 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_photon_mode )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cached macroscopic total cross section can be returned
+FRENSIE_UNIT_TEST( FilledGeometryModel, get_cached_cross_section_photon_mode )
+{
+  std::shared_ptr<const Geometry::Model> unfilled_model(
+            new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) );
+
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties( new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+
+  MonteCarlo::FilledGeometryModel filled_model( test_scattering_center_database_name,
+                                                scattering_center_definition_database,
+                                                material_definition_database,
+                                                properties,
+                                                unfilled_model,
+                                                true );
+
+  MonteCarlo::PhotonState photon( 1ull );
+  photon.embedInModel( filled_model );
+  photon.setEnergy( 1.0 );
+
+  const MonteCarlo::PhotonMaterial* material =
+    static_cast<const MonteCarlo::FilledPhotonGeometryModel&>( filled_model ).getMaterial( photon.getCell() ).get();
+
+  MonteCarlo::MacroscopicCrossSectionCache cache;
+
+  FRENSIE_CHECK( !cache.isCrossSectionCached( material, photon.getEnergy() ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+    filled_model.getMacroscopicTotalForwardCrossSectionQuick( photon, cache ),
+    7.063503858378371303e-02,
+    1e-15 );
+
+  FRENSIE_CHECK( cache.isCrossSectionCached( material, photon.getEnergy() ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+    filled_model.getMacroscopicTotalForwardCrossSectionQuick( photon, cache ),
+    7.063503858378371303e-02,
+    1e-15 );
+
+  // The cache must be updated when the energy changes
+  photon.setEnergy( 10.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+    filled_model.getMacroscopicTotalForwardCrossSectionQuick( photon, cache ),
+    2.213467312742279508e-02,
+    1e-15 );
+
+  cache.invalidate();
+
+  FRENSIE_CHECK( !cache.isCrossSectionCached( material, photon.getEnergy() ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the macroscopic total cross section can be returned
 FRENSIE_UNIT_TEST( FilledGeometryModel, get_cross_section_electron_mode )
@@ -71,6 +71,39 @@ DetailedNeutronFissionReaction::DetailedNeutronFissionReaction(
   testPrecondition( delayed_neutron_emission_distribution.get() );
 }
 
+// Constructor (cross section values stored in external memory)
+DetailedNeutronFissionReaction::DetailedNeutronFissionReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature,
+       const std::shared_ptr<const FissionNeutronMultiplicityDistribution>&
+       fission_neutron_multiplicity_distribution,
+       const std::shared_ptr<const ScatteringDistribution>&
+       prompt_neutron_emission_distribution,
+       const std::shared_ptr<const ScatteringDistribution>&
+       delayed_neutron_emission_distribution )
+  : NeutronFissionReaction( incoming_energy_grid,
+                            cross_section,
+                            cross_section_storage,
+                            threshold_energy_index,
+                            grid_searcher,
+                            reaction_type,
+                            q_value,
+                            temperature,
+                            fission_neutron_multiplicity_distribution,
+                            prompt_neutron_emission_distribution ),
+    d_delayed_neutron_emission_distribution( delayed_neutron_emission_distribution )
+{
+  // Make sure the distribution is valid
+  testPrecondition( delayed_neutron_emission_distribution.get() );
+}
+
 // Simulate the reaction
 void DetailedNeutronFissionReaction::react( NeutronState& neutron,
 					    ParticleBank& bank ) const
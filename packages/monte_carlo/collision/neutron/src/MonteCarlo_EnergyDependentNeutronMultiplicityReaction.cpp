@@ -78,6 +78,40 @@ EnergyDependentNeutronMultiplicityReaction::EnergyDependentNeutronMultiplicityRe
   testPrecondition( scattering_distribution.get() != NULL );
 }
 
+// Constructor (cross section values stored in external memory)
+EnergyDependentNeutronMultiplicityReaction::EnergyDependentNeutronMultiplicityReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature,
+       const std::shared_ptr<const ScatteringDistribution>&
+       scattering_distribution,
+       const Utility::ArrayView<const double>& multiplicity_energy_grid,
+       const Utility::ArrayView<const double>& multiplicity )
+: StandardNeutronNuclearReaction( incoming_energy_grid,
+                                  cross_section,
+                                  cross_section_storage,
+                                  threshold_energy_index,
+                                  grid_searcher,
+                                  reaction_type,
+                                  q_value,
+                                  temperature ),
+    d_multiplicity_energy_grid( multiplicity_energy_grid ),
+    d_multiplicity( multiplicity ),
+    d_scattering_distribution( scattering_distribution )
+{
+  // Make sure the multiplicity is valid
+  testPrecondition( multiplicity_energy_grid.size() >= 2 );
+  testPrecondition( multiplicity_energy_grid.size() == multiplicity.size()  );
+  // Make sure the scattering distribution is valid
+  testPrecondition( scattering_distribution.get() != NULL );
+}
+
 // Return the number of neutrons emitted from the rxn at the given energy
 unsigned EnergyDependentNeutronMultiplicityReaction::getNumberOfEmittedParticles(
 						    const double energy ) const
@@ -61,6 +61,22 @@ public:
        const Utility::ArrayView<const double>& multiplicity_energy_grid,
        const Utility::ArrayView<const double>& multiplicity );
 
+  //! Constructor (cross section values stored in external memory)
+  EnergyDependentNeutronMultiplicityReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature,
+       const std::shared_ptr<const ScatteringDistribution>&
+       scattering_distribution,
+       const Utility::ArrayView<const double>& multiplicity_energy_grid,
+       const Utility::ArrayView<const double>& multiplicity );
+
   //! Destructor
   ~EnergyDependentNeutronMultiplicityReaction()
   { /* ... */ }
@@ -73,6 +73,37 @@ NeutronFissionReaction::NeutronFissionReaction(
   testPrecondition( prompt_neutron_emission_distribution.get() )
 }
 
+// Constructor (cross section values stored in external memory)
+NeutronFissionReaction::NeutronFissionReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature,
+       const std::shared_ptr<const FissionNeutronMultiplicityDistribution>&
+       fission_neutron_multiplicity_distribution,
+       const std::shared_ptr<const ScatteringDistribution>&
+       prompt_neutron_emission_distribution )
+  : StandardNeutronNuclearReaction( incoming_energy_grid,
+                                    cross_section,
+                                    cross_section_storage,
+                                    threshold_energy_index,
+                                    grid_searcher,
+                                    reaction_type,
+                                    q_value,
+                                    temperature ),
+    d_fission_neutron_multiplicity_distribution( fission_neutron_multiplicity_distribution ),
+    d_prompt_neutron_emission_distribution( prompt_neutron_emission_distribution )
+{
+  // Make sure the distributions are valid
+  testPrecondition( fission_neutron_multiplicity_distribution.get() );
+  testPrecondition( prompt_neutron_emission_distribution.get() )
+}
+
 // Return the number of neutrons emitted from the rxn at the given energy
 unsigned NeutronFissionReaction::getNumberOfEmittedParticles(
 						    const double energy ) const
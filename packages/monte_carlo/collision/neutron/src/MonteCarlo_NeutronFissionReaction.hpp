@@ -56,6 +56,22 @@ public:
        const std::shared_ptr<const ScatteringDistribution>&
        prompt_neutron_emission_distribution );
 
+  //! Constructor (cross section values stored in external memory)
+  NeutronFissionReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature,
+       const std::shared_ptr<const FissionNeutronMultiplicityDistribution>&
+       fission_neutron_multiplicity_distribution,
+       const std::shared_ptr<const ScatteringDistribution>&
+       prompt_neutron_emission_distribution );
+
   //! Destructor
   ~NeutronFissionReaction()
   { /* ... */ }
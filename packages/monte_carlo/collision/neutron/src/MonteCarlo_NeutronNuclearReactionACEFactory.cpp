@@ -110,13 +110,21 @@ NeutronNuclearReactionACEFactory::NeutronNuclearReactionACEFactory(
 						    reaction_ordering,
 						    reaction_threshold_index );
 
-  // Create a map of the reaction types and the corresponding cross section
-  std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >
+  // Create a map of the reaction types and the corresponding cross section.
+  // In node shared memory data mode the reactions will view the cross
+  // sections stored in the (shared) XSS array instead of copying them.
+  std::shared_ptr<const void> xss_storage;
+
+  if( properties.isNodeSharedMemoryDataModeOn() )
+    xss_storage = raw_nuclide_data.getXSSArrayData();
+
+  std::unordered_map<NuclearReactionType,CrossSectionData>
     reaction_cross_section;
   NeutronNuclearReactionACEFactory::createReactionCrossSectionMap(
 						      lsig_block,
 						      sig_block,
 						      elastic_cross_section,
+                                                      xss_storage,
 						      reaction_ordering,
 						      reaction_cross_section );
 
@@ -361,14 +369,19 @@ void NeutronNuclearReactionACEFactory::createReactionThresholdMap(
 }
 
 // Create the reaction type threshold and cross section map
+/*! \details If the XSS array storage is provided, the cross sections will be
+ * views of the XSS array and the storage will be shared by every cross
+ * section. Otherwise, a copy of each cross section will be made.
+ */
 // NOTE: All LSIG block indices correspond to FORTRAN arrays. Subtract 1 from
 // the value to get the index in a C/C++ array.
 void NeutronNuclearReactionACEFactory::createReactionCrossSectionMap(
    const Utility::ArrayView<const double>& lsig_block,
    const Utility::ArrayView<const double>& sig_block,
    const Utility::ArrayView<const double>& elastic_cross_section,
+   const std::shared_ptr<const void>& xss_storage,
    const std::unordered_map<NuclearReactionType,unsigned>& reaction_ordering,
-   std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+   std::unordered_map<NuclearReactionType,CrossSectionData>&
    reaction_cross_section )
 {
   std::unordered_map<NuclearReactionType,unsigned>::const_iterator
@@ -381,25 +394,34 @@ void NeutronNuclearReactionACEFactory::createReactionCrossSectionMap(
 
   while( reaction != end_reaction )
   {
+    Utility::ArrayView<const double> raw_cross_section;
+
     if( reaction->first != N__N_ELASTIC_REACTION )
     {
       cs_index = static_cast<unsigned>( lsig_block[reaction->second] ) - 1u;
 
       cs_array_size = static_cast<unsigned>( sig_block[cs_index+1u] );
 
-      std::shared_ptr<std::vector<double> >& cross_section =
-	reaction_cross_section[reaction->first];
-
-      cross_section.reset(
-          new std::vector<double>( sig_block( cs_index+2u, cs_array_size ) ) );
+      raw_cross_section = sig_block( cs_index+2u, cs_array_size );
     }
     // Elastic scattering must be handled separately: it never appears in block
+    else
+      raw_cross_section = elastic_cross_section;
+
+    CrossSectionData& cross_section = reaction_cross_section[reaction->first];
+
+    if( xss_storage )
+    {
+      cross_section.first = raw_cross_section;
+      cross_section.second = xss_storage;
+    }
     else
     {
-      std::shared_ptr<std::vector<double> >& cross_section =
-	reaction_cross_section[reaction->first];
+      std::shared_ptr<const std::vector<double> > cross_section_copy(
+                              new std::vector<double>( raw_cross_section ) );
 
-      cross_section.reset( new std::vector<double>( elastic_cross_section ) );
+      cross_section.first = Utility::arrayViewOfConst( *cross_section_copy );
+      cross_section.second = cross_section_copy;
     }
 
     ++reaction;
@@ -447,7 +469,7 @@ void NeutronNuclearReactionACEFactory::initializeScatteringReactions(
     reaction_energy_dependent_multiplicity,
     const std::unordered_map<NuclearReactionType,unsigned>&
     reaction_threshold_index,
-    const std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+    const std::unordered_map<NuclearReactionType,CrossSectionData>&
     reaction_cross_section,
     const NeutronNuclearScatteringDistributionACEFactory& scattering_dist_factory )
 
@@ -487,7 +509,8 @@ void NeutronNuclearReactionACEFactory::initializeScatteringReactions(
 
       reaction.reset( new NeutronScatteringReaction(
                           energy_grid,
-                          reaction_cross_section.find(reaction_type)->second,
+                          reaction_cross_section.find(reaction_type)->second.first,
+                          reaction_cross_section.find(reaction_type)->second.second,
                           reaction_threshold_index.find(reaction_type)->second,
                           grid_searcher,
                           reaction_type,
@@ -517,7 +540,8 @@ void NeutronNuclearReactionACEFactory::initializeScatteringReactions(
 
       reaction.reset( new EnergyDependentNeutronMultiplicityReaction(
         energy_grid,
-        reaction_cross_section.find(reaction_type)->second,
+        reaction_cross_section.find(reaction_type)->second.first,
+        reaction_cross_section.find(reaction_type)->second.second,
         reaction_threshold_index.find(reaction_type)->second,
         grid_searcher,
         reaction_type,
@@ -545,7 +569,7 @@ void NeutronNuclearReactionACEFactory::initializeAbsorptionReactions(
     reaction_energy_dependent_multiplicity,
     const std::unordered_map<NuclearReactionType,unsigned>&
     reaction_threshold_index,
-    const std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+    const std::unordered_map<NuclearReactionType,CrossSectionData>&
     reaction_cross_section )
 {
   // Make sure the maps have the correct number of elements
@@ -572,7 +596,8 @@ void NeutronNuclearReactionACEFactory::initializeAbsorptionReactions(
 
       reaction.reset( new NeutronAbsorptionReaction(
                         energy_grid,
-                        reaction_cross_section.find(reaction_type)->second,
+                        reaction_cross_section.find(reaction_type)->second.first,
+                        reaction_cross_section.find(reaction_type)->second.second,
                         reaction_threshold_index.find(reaction_type)->second,
                         grid_searcher,
                         reaction_type,
@@ -596,7 +621,7 @@ void NeutronNuclearReactionACEFactory::initializeFissionReactions(
     reaction_multiplicity,
     const std::unordered_map<NuclearReactionType,unsigned>&
     reaction_threshold_index,
-    const std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+    const std::unordered_map<NuclearReactionType,CrossSectionData>&
     reaction_cross_section,
     const NeutronNuclearScatteringDistributionACEFactory& scattering_dist_factory,
     const std::shared_ptr<const FissionNeutronMultiplicityDistribution>&
@@ -643,7 +668,8 @@ void NeutronNuclearReactionACEFactory::initializeFissionReactions(
       {
 	reaction.reset( new NeutronFissionReaction(
                           energy_grid,
-                          reaction_cross_section.find(reaction_type)->second,
+                          reaction_cross_section.find(reaction_type)->second.first,
+                          reaction_cross_section.find(reaction_type)->second.second,
                           reaction_threshold_index.find(reaction_type)->second,
                           grid_searcher,
                           reaction_type,
@@ -657,7 +683,8 @@ void NeutronNuclearReactionACEFactory::initializeFissionReactions(
       {
 	reaction.reset( new DetailedNeutronFissionReaction(
                           energy_grid,
-                          reaction_cross_section.find(reaction_type)->second,
+                          reaction_cross_section.find(reaction_type)->second.first,
+                          reaction_cross_section.find(reaction_type)->second.second,
                           reaction_threshold_index.find(reaction_type)->second,
                           grid_searcher,
                           reaction_type,
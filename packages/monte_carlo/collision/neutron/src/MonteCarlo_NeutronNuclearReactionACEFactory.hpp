@@ -70,6 +70,10 @@ public:
 
 protected:
 
+  //! The reaction cross section values and the storage that they are in
+  typedef std::pair<Utility::ArrayView<const double>,std::shared_ptr<const void> >
+  CrossSectionData;
+
   //! Create the reaction type ordering map
   static void createReactionOrderingMap(
        const Utility::ArrayView<const double>& mtr_block,
@@ -105,8 +109,9 @@ protected:
    const Utility::ArrayView<const double>& lsig_block,
    const Utility::ArrayView<const double>& sig_block,
    const Utility::ArrayView<const double>& elastic_cross_section,
+   const std::shared_ptr<const void>& xss_storage,
    const std::unordered_map<NuclearReactionType,unsigned>& reaction_ordering,
-   std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+   std::unordered_map<NuclearReactionType,CrossSectionData>&
    reaction_cross_section );
 
   //! Get the reaction associated with an Reaction Type
@@ -130,7 +135,7 @@ private:
     reaction_energy_dependent_multiplicity,
     const std::unordered_map<NuclearReactionType,unsigned>&
     reaction_threshold_index,
-    const std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+    const std::unordered_map<NuclearReactionType,CrossSectionData>&
     reaction_cross_section,
     const NeutronNuclearScatteringDistributionACEFactory& scattering_dist_factory );
 
@@ -147,7 +152,7 @@ private:
     reaction_energy_dependent_multiplicity,
     const std::unordered_map<NuclearReactionType,unsigned>&
     reaction_threshold_index,
-    const std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+    const std::unordered_map<NuclearReactionType,CrossSectionData>&
     reaction_cross_section );
 
   // Initialize the fission reactions
@@ -162,7 +167,7 @@ private:
     reaction_multiplicity,
     const std::unordered_map<NuclearReactionType,unsigned>&
     reaction_threshold_index,
-    const std::unordered_map<NuclearReactionType,std::shared_ptr<std::vector<double> > >&
+    const std::unordered_map<NuclearReactionType,CrossSectionData>&
     reaction_cross_section,
     const NeutronNuclearScatteringDistributionACEFactory& scattering_dist_factory,
     const std::shared_ptr<const FissionNeutronMultiplicityDistribution>&
@@ -69,6 +69,37 @@ NeutronScatteringReaction::NeutronScatteringReaction(
   testPrecondition( scattering_distribution.get() != NULL );
 }
 
+// Constructor (cross section values stored in external memory)
+NeutronScatteringReaction::NeutronScatteringReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature,
+       const unsigned multiplicity,
+       const std::shared_ptr<const ScatteringDistribution>&
+       scattering_distribution )
+  : StandardNeutronNuclearReaction( incoming_energy_grid,
+                                    cross_section,
+                                    cross_section_storage,
+                                    threshold_energy_index,
+                                    grid_searcher,
+                                    reaction_type,
+                                    q_value,
+                                    temperature ),
+    d_multiplicity( multiplicity ),
+    d_scattering_distribution( scattering_distribution )
+{
+  // Make sure the multiplicity is valid
+  testPrecondition( multiplicity > 0 );
+  // Make sure the scattering distribution is valid
+  testPrecondition( scattering_distribution.get() != NULL );
+}
+
 // Return the number of neutrons emitted from the rxn at the given energy
 unsigned NeutronScatteringReaction::getNumberOfEmittedParticles(
 						    const double energy ) const
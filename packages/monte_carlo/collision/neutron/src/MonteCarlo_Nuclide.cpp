@@ -232,6 +232,17 @@ double Nuclide::getAbsorptionCrossSection( const double energy ) const
   return d_total_absorption_reaction->getCrossSection( energy );
 }
 
+// Add the energy grid points of the total reactions to the vector
+/*! \details The points will be added in reaction order (they are not sorted
+ * and duplicate points are not removed).
+ */
+void Nuclide::getEnergyGridPoints(
+                             std::vector<double>& energy_grid_points ) const
+{
+  d_total_reaction->getEnergyGridPoints( energy_grid_points );
+  d_total_absorption_reaction->getEnergyGridPoints( energy_grid_points );
+}
+
 // Return the survival probability at the desired energy
 double Nuclide::getSurvivalProbability( const double energy ) const
 {
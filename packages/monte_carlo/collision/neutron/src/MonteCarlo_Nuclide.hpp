@@ -109,6 +109,9 @@ public:
   //! Return the total absorption cross section at the desired energy
   double getAbsorptionCrossSection( const double energy ) const;
 
+  //! Add the energy grid points of the total reactions to the vector
+  void getEnergyGridPoints( std::vector<double>& energy_grid_points ) const;
+
   //! Return the survival probability at the desired energy
   double getSurvivalProbability( const double energy ) const;
 
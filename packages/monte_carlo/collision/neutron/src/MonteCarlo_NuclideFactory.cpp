@@ -23,10 +23,25 @@ NuclideFactory::NuclideFactory(
                  const ScatteringCenterNameSet& nuclide_names,
                  const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                  const SimulationProperties& properties,
-                 const bool verbose )
+                 const bool verbose,
+                 const std::shared_ptr<ScatteringCenterDataCache>& data_cache )
+  : d_nuclide_name_map(),
+    d_nuclear_table_name_map(),
+    d_node_comm(),
+    d_verbose( verbose ),
+    d_data_cache( data_cache )
 {
+  // Create a private data table cache if one was not provided
+  if( !d_data_cache )
+    d_data_cache.reset( new ScatteringCenterDataCache );
+
   FRENSIE_LOG_NOTIFICATION( "Starting to load nuclide data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
+
+  // The processes on each node will share the raw data tables - every
+  // process must load the same nuclides in this mode
+  if( properties.isNodeSharedMemoryDataModeOn() )
+    d_node_comm = Utility::Communicator::getDefault()->splitShared();
   
   // Create each nuclide in the set
   ScatteringCenterNameSet::const_iterator nuclide_name =
@@ -123,16 +138,31 @@ void NuclideFactory::createNuclideFromACETable(
     }
 
     // The ACE table reader
-    Data::ACEFileHandler ace_file_handler( ace_file_path,
-                                           data_properties.tableName(),
-                                           data_properties.fileStartLine(),
-                                           true );
+    std::shared_ptr<const Data::ACEFileHandler> ace_file_handler;
+
+    if( d_node_comm )
+    {
+      ace_file_handler.reset(
+                  new Data::ACEFileHandler( ace_file_path,
+                                            data_properties.tableName(),
+                                            data_properties.fileStartLine(),
+                                            *d_node_comm,
+                                            true ) );
+    }
+    else
+    {
+      ace_file_handler =
+        d_data_cache->getACETable( ace_file_path,
+                                   data_properties.tableName(),
+                                   data_properties.fileStartLine() );
+    }
     
     // The XSS neutron data extractor
     Data::XSSNeutronDataExtractor xss_data_extractor(
-					 ace_file_handler.getTableNXSArray(),
-					 ace_file_handler.getTableJXSArray(),
-				         ace_file_handler.getTableXSSArray() );
+				   ace_file_handler->getTableNXSArray(),
+				   ace_file_handler->getTableJXSArray(),
+				   ace_file_handler->getTableXSSArrayData(),
+                                   ace_file_handler->getTableXSSArraySize() );
 
     // Initialize the new nuclide
     NuclideNameMap::mapped_type& nuclide = d_nuclide_name_map[nuclide_name];
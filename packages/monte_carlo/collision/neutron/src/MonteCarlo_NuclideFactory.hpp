@@ -19,10 +19,12 @@
 #include "MonteCarlo_Nuclide.hpp"
 #include "MonteCarlo_NeutronMaterial.hpp"
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
+#include "MonteCarlo_ScatteringCenterDataCache.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
+#include "Utility_Communicator.hpp"
 
 namespace MonteCarlo{
 
@@ -43,7 +45,9 @@ public:
                   const ScatteringCenterNameSet& nuclide_names,
                   const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                   const SimulationProperties& properties,
-                  const bool verbose = false );
+                  const bool verbose = false,
+                  const std::shared_ptr<ScatteringCenterDataCache>& data_cache =
+                  std::shared_ptr<ScatteringCenterDataCache>() );
 
   //! Destructor
   ~NuclideFactory()
@@ -69,8 +73,14 @@ private:
   std::map<Data::NuclearDataProperties::FileType,NuclideNameMap>
   d_nuclear_table_name_map;
 
+  // The node communicator (only used in node shared memory data mode)
+  std::shared_ptr<const Utility::Communicator> d_node_comm;
+
   // Verbose nuclide construction
   bool d_verbose;
+
+  // The data table cache (not used in node shared memory data mode)
+  std::shared_ptr<ScatteringCenterDataCache> d_data_cache;
 };
 
 } // end MonteCarlo namespace
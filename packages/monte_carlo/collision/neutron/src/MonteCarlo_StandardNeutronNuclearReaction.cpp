@@ -57,6 +57,36 @@ StandardNeutronNuclearReaction::StandardNeutronNuclearReaction(
   testPrecondition( temperature >= 0.0 );
 }
 
+// Constructor (cross section values stored in external memory)
+/*! \details The cross section storage must own (or share ownership of) the
+ * memory that the cross section values are stored in.
+ */
+StandardNeutronNuclearReaction::StandardNeutronNuclearReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature )
+  : BaseType( incoming_energy_grid,
+              cross_section,
+              cross_section_storage,
+              threshold_energy_index,
+              grid_searcher ),
+    d_reaction_type( reaction_type ),
+    d_q_value( q_value ),
+    d_temperature( temperature )
+{
+  // Make sure that the Q value is valid
+  testPrecondition( !QT::isnaninf( q_value ) );
+  // Make sure that the temperature is valid
+  testPrecondition( !QT::isnaninf( temperature ) );
+  testPrecondition( temperature >= 0.0 );
+}
+
 // Return the reaction type
 NuclearReactionType StandardNeutronNuclearReaction::getReactionType() const
 {
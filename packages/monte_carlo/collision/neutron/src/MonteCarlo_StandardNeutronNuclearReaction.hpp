@@ -47,6 +47,18 @@ public:
        const double q_value,
        const double temperature );
 
+  //! Constructor (cross section values stored in external memory)
+  StandardNeutronNuclearReaction(
+       const std::shared_ptr<const std::vector<double> >& incoming_energy_grid,
+       const Utility::ArrayView<const double>& cross_section,
+       const std::shared_ptr<const void>& cross_section_storage,
+       const size_t threshold_energy_index,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const NuclearReactionType reaction_type,
+       const double q_value,
+       const double temperature );
+
   //! Destructor
   ~StandardNeutronNuclearReaction()
   { /* ... */ }
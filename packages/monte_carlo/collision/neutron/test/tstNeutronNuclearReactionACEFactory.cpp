@@ -101,6 +101,92 @@ FRENSIE_UNIT_TEST( NeutronNuclearReactionACEFactory_h1, createScatteringReaction
 		       4.827462e-1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the scattering reactions can view the XSS array instead of
+// copying it in node shared memory data mode
+FRENSIE_UNIT_TEST( NeutronNuclearReactionACEFactory_h1,
+                   createScatteringReactions_node_shared_memory )
+{
+  std::shared_ptr<const std::vector<double> > xss =
+    h1_ace_file_handler->getTableXSSArray();
+
+  const long initial_xss_use_count = xss.use_count();
+
+  std::unordered_map<MonteCarlo::NuclearReactionType,std::shared_ptr<const MonteCarlo::NeutronNuclearReaction> > copied_reactions, viewing_reactions;
+
+  // The reactions will copy the cross sections by default
+  {
+    Data::XSSNeutronDataExtractor xss_data_extractor(
+                                      h1_ace_file_handler->getTableNXSArray(),
+                                      h1_ace_file_handler->getTableJXSArray(),
+                                      xss );
+
+    MonteCarlo::NeutronNuclearReactionACEFactory factory(
+                            "h1_test_table",
+                            h1_ace_file_handler->getTableAtomicWeightRatio(),
+			    h1_ace_file_handler->getTableTemperature().value(),
+                            h1_energy_grid,
+                            h1_energy_grid_searcher,
+                            *properties,
+                            xss_data_extractor );
+
+    factory.createScatteringReactions( copied_reactions );
+  }
+
+  FRENSIE_CHECK_EQUAL( xss.use_count(), initial_xss_use_count );
+
+  // The reactions will view the cross sections in node shared memory data
+  // mode
+  {
+    MonteCarlo::SimulationProperties shared_properties;
+    shared_properties.setNodeSharedMemoryDataModeOn();
+
+    Data::XSSNeutronDataExtractor xss_data_extractor(
+                                      h1_ace_file_handler->getTableNXSArray(),
+                                      h1_ace_file_handler->getTableJXSArray(),
+                                      xss );
+
+    MonteCarlo::NeutronNuclearReactionACEFactory factory(
+                            "h1_test_table",
+                            h1_ace_file_handler->getTableAtomicWeightRatio(),
+			    h1_ace_file_handler->getTableTemperature().value(),
+                            h1_energy_grid,
+                            h1_energy_grid_searcher,
+                            shared_properties,
+                            xss_data_extractor );
+
+    factory.createScatteringReactions( viewing_reactions );
+  }
+
+  FRENSIE_REQUIRE_EQUAL( viewing_reactions.size(), 1 );
+
+  // Every reaction keeps the XSS array alive
+  FRENSIE_CHECK_EQUAL( xss.use_count(),
+                       initial_xss_use_count +
+                       (long)viewing_reactions.size() );
+
+  std::shared_ptr<const MonteCarlo::NeutronNuclearReaction>& copied_reaction =
+    copied_reactions.find( MonteCarlo::N__N_ELASTIC_REACTION )->second;
+
+  std::shared_ptr<const MonteCarlo::NeutronNuclearReaction>& viewing_reaction =
+    viewing_reactions.find( MonteCarlo::N__N_ELASTIC_REACTION )->second;
+
+  FRENSIE_CHECK_EQUAL( viewing_reaction->getThresholdEnergy(),
+                       copied_reaction->getThresholdEnergy() );
+  FRENSIE_CHECK_EQUAL( viewing_reaction->getMaxEnergy(),
+                       copied_reaction->getMaxEnergy() );
+  FRENSIE_CHECK_EQUAL( viewing_reaction->getCrossSection( 1.0e-11 ),
+		       1.1605460e3 );
+  FRENSIE_CHECK_EQUAL( viewing_reaction->getCrossSection( 1.0 ),
+                       copied_reaction->getCrossSection( 1.0 ) );
+  FRENSIE_CHECK_EQUAL( viewing_reaction->getCrossSection( 2.0e1 ),
+		       4.827462e-1 );
+
+  viewing_reactions.clear();
+
+  FRENSIE_CHECK_EQUAL( xss.use_count(), initial_xss_use_count );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the scattering reaction can be created
 FRENSIE_UNIT_TEST( NeutronNuclearReactionACEFactory_o16, createScatteringReactions )
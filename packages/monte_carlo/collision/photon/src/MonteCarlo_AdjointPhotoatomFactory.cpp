@@ -24,11 +24,17 @@ AdjointPhotoatomFactory::AdjointPhotoatomFactory(
        const ScatteringCenterNameSet& adjoint_photoatom_names,
        const ScatteringCenterDefinitionDatabase& adjoint_photoatom_definitions,
        const SimulationAdjointPhotonProperties& properties,
-       const bool verbose )
+       const bool verbose,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache )
   : d_adjoint_photoatom_name_map(),
     d_adjoint_photoatomic_table_name_map(),
-    d_verbose( verbose )
+    d_verbose( verbose ),
+    d_data_cache( data_cache )
 {
+  // Create a private data table cache if one was not provided
+  if( !d_data_cache )
+    d_data_cache.reset( new ScatteringCenterDataCache );
+
   FRENSIE_LOG_NOTIFICATION( "Starting to load adjoint photoatom data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
 
@@ -139,9 +145,9 @@ void AdjointPhotoatomFactory::createAdjointPhotoatomFromNativeTable(
       FRENSIE_FLUSH_ALL_LOGS();
     }
 
-    // Create the aepr data container
-    Data::AdjointElectronPhotonRelaxationDataContainer
-      data_container( native_file_path );
+    // Get the aepr data container
+    const Data::AdjointElectronPhotonRelaxationDataContainer& data_container =
+      *d_data_cache->getAdjointElectronPhotonRelaxationTable( native_file_path );
 
     // Initialize the new adjoint photoatom
     AdjointPhotoatomNameMap::mapped_type& adjoint_photoatom =
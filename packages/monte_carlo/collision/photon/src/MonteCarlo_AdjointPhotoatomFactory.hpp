@@ -19,6 +19,7 @@
 #include "MonteCarlo_AdjointPhotoatom.hpp"
 #include "MonteCarlo_AdjointPhotonMaterial.hpp"
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
+#include "MonteCarlo_ScatteringCenterDataCache.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationAdjointPhotonProperties.hpp"
 #include "Utility_Map.hpp"
@@ -44,7 +45,9 @@ public:
        const ScatteringCenterNameSet& adjoint_photoatom_names,
        const ScatteringCenterDefinitionDatabase& adjoint_photoatom_definitions,
        const SimulationAdjointPhotonProperties& properties,
-       const bool verbose = false );
+       const bool verbose = false,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache =
+       std::shared_ptr<ScatteringCenterDataCache>() );
 
   //! Destructor
   ~AdjointPhotoatomFactory()
@@ -73,6 +76,9 @@ private:
 
   // Verbose adjoint photoatom construction
   bool d_verbose;
+
+  // The data table cache (used to prevent multiple reads of the same file)
+  std::shared_ptr<ScatteringCenterDataCache> d_data_cache;
 };
 
 } // end MonteCarlo namespace
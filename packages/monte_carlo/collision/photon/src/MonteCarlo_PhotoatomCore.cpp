@@ -138,7 +138,8 @@ PhotoatomCore::PhotoatomCore(
 
 // Copy constructor
 PhotoatomCore::PhotoatomCore( const PhotoatomCore& instance )
-  : BaseType( instance )
+  : BaseType( instance ),
+    d_thick_target_bremsstrahlung_data( instance.d_thick_target_bremsstrahlung_data )
 { /* ... */ }
 
 // Assignment Operator
@@ -146,11 +147,46 @@ PhotoatomCore& PhotoatomCore::operator=( const PhotoatomCore& instance )
 {
   // Avoid self-assignment
   if( this != &instance )
+  {
     BaseType::operator=( instance );
 
+    d_thick_target_bremsstrahlung_data =
+      instance.d_thick_target_bremsstrahlung_data;
+  }
+
   return *this;
 }
 
+// Set the thick-target bremsstrahlung data
+/*! \details The thick-target bremsstrahlung data is used to sample the
+ * bremsstrahlung photons of the secondary electrons that are not transported.
+ */
+void PhotoatomCore::setThickTargetBremsstrahlungData(
+                  const std::shared_ptr<const ThickTargetBremsstrahlungData>&
+                  thick_target_bremsstrahlung_data )
+{
+  // Make sure the data is valid
+  testPrecondition( thick_target_bremsstrahlung_data.get() );
+
+  d_thick_target_bremsstrahlung_data = thick_target_bremsstrahlung_data;
+}
+
+// Check if the core has thick-target bremsstrahlung data
+bool PhotoatomCore::hasThickTargetBremsstrahlungData() const
+{
+  return d_thick_target_bremsstrahlung_data.get() != NULL;
+}
+
+// Return the thick-target bremsstrahlung data
+const ThickTargetBremsstrahlungData&
+PhotoatomCore::getThickTargetBremsstrahlungData() const
+{
+  // Make sure the core has thick-target bremsstrahlung data
+  testPrecondition( this->hasThickTargetBremsstrahlungData() );
+
+  return *d_thick_target_bremsstrahlung_data;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -13,6 +13,7 @@
 #include "MonteCarlo_PhotoatomicReactionType.hpp"
 #include "MonteCarlo_PhotoatomicReaction.hpp"
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
+#include "MonteCarlo_ThickTargetBremsstrahlungData.hpp"
 #include "MonteCarlo_AtomCore.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
@@ -91,6 +92,18 @@ public:
   ~PhotoatomCore()
   { /* ... */ }
 
+  //! Set the thick-target bremsstrahlung data
+  void setThickTargetBremsstrahlungData(
+                  const std::shared_ptr<const ThickTargetBremsstrahlungData>&
+                  thick_target_bremsstrahlung_data );
+
+  //! Check if the core has thick-target bremsstrahlung data
+  bool hasThickTargetBremsstrahlungData() const;
+
+  //! Return the thick-target bremsstrahlung data
+  const ThickTargetBremsstrahlungData&
+  getThickTargetBremsstrahlungData() const;
+
 private:
 
   // Set the default absorption reaction types
@@ -98,6 +111,10 @@ private:
 
   // Used to set the default absorption reaction types
   static const bool s_default_absorption_reaction_types_set;
+
+  // The thick-target bremsstrahlung data (secondary electrons)
+  std::shared_ptr<const ThickTargetBremsstrahlungData>
+  d_thick_target_bremsstrahlung_data;
 };
 
 } // end MonteCarlo namespace
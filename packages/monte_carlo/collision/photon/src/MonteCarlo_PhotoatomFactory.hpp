@@ -21,6 +21,7 @@
 #include "MonteCarlo_PhotonMaterial.hpp"
 #include "MonteCarlo_AtomicRelaxationModelFactory.hpp"
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
+#include "MonteCarlo_ScatteringCenterDataCache.hpp"
 #include "MonteCarlo_MaterialDefinitionDatabase.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "Utility_Map.hpp"
@@ -48,7 +49,9 @@ public:
        const std::shared_ptr<AtomicRelaxationModelFactory>&
        atomic_relaxation_model_factory,
        const SimulationProperties& properties,
-       const bool verbose = false );
+       const bool verbose = false,
+       const std::shared_ptr<ScatteringCenterDataCache>& data_cache =
+       std::shared_ptr<ScatteringCenterDataCache>() );
 
   //! Destructor
   ~PhotoatomFactory()
@@ -88,6 +91,9 @@ private:
 
   // Verbose photoatom construction
   bool d_verbose;
+
+  // The data table cache (used to prevent multiple reads of the same file)
+  std::shared_ptr<ScatteringCenterDataCache> d_data_cache;
 };
 
 } // end MonteCarlo namespace
@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomNativeFactory.hpp"
 #include "MonteCarlo_PhotoatomicReactionNativeFactory.hpp"
+#include "MonteCarlo_ThickTargetBremsstrahlungDataNativeFactory.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -137,13 +138,30 @@ void PhotoatomNativeFactory::createPhotoatomCore(
 							   reaction_pointer );
 
   // Create the photoatom core
-  photoatom_core.reset( new PhotoatomCore( energy_grid,
-					   grid_searcher,
-					   scattering_reactions,
-					   absorption_reactions,
-					   atomic_relaxation_model,
-					   false,
-					   Utility::LinLin() ) );
+  std::shared_ptr<PhotoatomCore> new_photoatom_core(
+                           new PhotoatomCore( energy_grid,
+                                              grid_searcher,
+                                              scattering_reactions,
+                                              absorption_reactions,
+                                              atomic_relaxation_model,
+                                              false,
+                                              Utility::LinLin() ) );
+
+  // Create the thick-target bremsstrahlung data (secondary electrons)
+  if( properties.isThickTargetBremsstrahlungModeOn() )
+  {
+    std::shared_ptr<const ThickTargetBremsstrahlungData>
+      thick_target_bremsstrahlung_data;
+
+    ThickTargetBremsstrahlungDataNativeFactory::createThickTargetBremsstrahlungData(
+                                            raw_photoatom_data,
+                                            thick_target_bremsstrahlung_data );
+
+    new_photoatom_core->setThickTargetBremsstrahlungData(
+                                            thick_target_bremsstrahlung_data );
+  }
+
+  photoatom_core = new_photoatom_core;
 }
 
 // Create the photoatom (using the provided atomic relaxation model)
@@ -6,11 +6,24 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
 // FRENSIE Includes
 #include "MonteCarlo_PhotonMaterial.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const size_t PhotonMaterial::s_ttb_yield_points_per_decade = 50;
+
 // Constructor (without photonuclear data)
 PhotonMaterial::PhotonMaterial(
 		           const MaterialId id,
@@ -23,7 +36,9 @@ PhotonMaterial::PhotonMaterial(
               photoatom_name_map,
               photoatom_fractions,
               photoatom_names )
-{ /* ... */ }
+{
+  this->calculateThickTargetBremsstrahlungYieldTable();
+}
 
 // Return the macroscopic cross section (1/cm) for a specific reaction
 double PhotonMaterial::getMacroscopicReactionCrossSection(
@@ -70,6 +85,347 @@ void PhotonMaterial::getReactionTypes(
     this->getScatteringCenter( i ).getReactionTypes(reaction_types);
 }
 
+// Check if the thick-target bremsstrahlung yield can be calculated
+/*! \details The yield can only be calculated if at least one of the
+ * photoatoms has thick-target bremsstrahlung data.
+ */
+bool PhotonMaterial::hasThickTargetBremsstrahlungYield() const
+{
+  return !d_ttb_energy_grid.empty();
+}
+
+// Return the thick-target bremsstrahlung photon yield
+/*! \details The photon yield is the mean number of bremsstrahlung photons
+ * that an electron emits while slowing down in the material (continuous
+ * slowing down approximation). It is linearly interpolated on the yield
+ * table. Below the lowest table energy the yield is zero and above the
+ * highest table energy the yield at the highest energy is returned.
+ */
+double PhotonMaterial::getThickTargetBremsstrahlungPhotonYield(
+                                           const double electron_energy ) const
+{
+  if( d_ttb_energy_grid.empty() )
+    return 0.0;
+
+  if( electron_energy <= d_ttb_energy_grid.front() )
+    return 0.0;
+  else if( electron_energy >= d_ttb_energy_grid.back() )
+    return d_ttb_photon_yield.back();
+  else
+  {
+    const size_t bin_index =
+      Utility::Search::binaryLowerBoundIndex( d_ttb_energy_grid.begin(),
+                                              d_ttb_energy_grid.end(),
+                                              electron_energy );
+
+    const double interp_fraction =
+      (electron_energy - d_ttb_energy_grid[bin_index])/
+      (d_ttb_energy_grid[bin_index+1] - d_ttb_energy_grid[bin_index]);
+
+    return d_ttb_photon_yield[bin_index] +
+      interp_fraction*(d_ttb_photon_yield[bin_index+1] -
+                       d_ttb_photon_yield[bin_index]);
+  }
+}
+
+// Sample the thick-target bremsstrahlung photons of an electron
+/*! \details The number of photons is sampled so that its mean is the photon
+ * yield at the electron energy. The electron energy at which each photon is
+ * emitted is sampled from the yield table, the emitting photoatom is sampled
+ * using the bremsstrahlung cross sections at that energy and the photon
+ * energy is sampled from the photoatom's bremsstrahlung photon energy
+ * distribution. The photons are emitted isotropically (the electron
+ * direction is randomized by multiple scattering in a thick target). Photon
+ * sampling stops once the next photon would carry away more than the
+ * remaining electron energy. Photons below the min photon energy are not
+ * banked. The electron state is not modified - the energy that is not
+ * carried away by the photons is deposited locally when the electron is
+ * killed.
+ */
+void PhotonMaterial::sampleThickTargetBremsstrahlungPhotons(
+                                       const ParticleState& electron,
+                                       const double min_photon_energy,
+                                       ParticleBank& bank ) const
+{
+  const double electron_energy = electron.getEnergy();
+
+  const double photon_yield =
+    this->getThickTargetBremsstrahlungPhotonYield( electron_energy );
+
+  if( photon_yield <= 0.0 )
+    return;
+
+  // Sample the number of photons
+  size_t number_of_photons = (size_t)photon_yield;
+
+  if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
+      photon_yield - number_of_photons )
+    ++number_of_photons;
+
+  double remaining_energy = electron_energy;
+
+  for( size_t i = 0; i < number_of_photons; ++i )
+  {
+    // Sample the electron energy at which the photon is emitted
+    const double emission_energy =
+      this->sampleThickTargetBremsstrahlungEmissionEnergy(
+        Utility::RandomNumberGenerator::getRandomNumber<double>()*
+        photon_yield );
+
+    // The yield is interpolated - no photoatom may emit at this energy
+    if( this->getMacroscopicThickTargetBremsstrahlungCrossSection( emission_energy ) <= 0.0 )
+      continue;
+
+    // Sample the photoatom that emits the photon
+    const size_t photoatom_index = this->sampleCollisionScatteringCenterImpl(
+      emission_energy,
+      [this]( const double energy ){
+        return this->getMacroscopicThickTargetBremsstrahlungCrossSection( energy ); },
+      []( const Photoatom& photoatom, const double energy ){
+        if( photoatom.getCore().hasThickTargetBremsstrahlungData() )
+          return photoatom.getCore().getThickTargetBremsstrahlungData().getBremsstrahlungCrossSection( energy );
+        else
+          return 0.0; } );
+
+    const double photon_energy =
+      std::min( this->getScatteringCenter( photoatom_index ).getCore().getThickTargetBremsstrahlungData().samplePhotonEnergy( emission_energy ),
+                emission_energy );
+
+    if( photon_energy > remaining_energy )
+      break;
+
+    remaining_energy -= photon_energy;
+
+    if( photon_energy < min_photon_energy )
+      continue;
+
+    std::shared_ptr<ParticleState> photon(
+                                     new PhotonState( electron, true, true ) );
+
+    photon->setEnergy( photon_energy );
+
+    // Sample an isotropic emission direction
+    const double angle_cosine = 2.0*
+      Utility::RandomNumberGenerator::getRandomNumber<double>() - 1.0;
+
+    const double azimuthal_angle = 2.0*Utility::PhysicalConstants::pi*
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+    photon->rotateDirection( angle_cosine, azimuthal_angle );
+
+    bank.push( photon );
+  }
+}
+
+// Evaluate the next-event scattering densities (1/sr)
+/*! \details The probability density per unit solid angle that a photon that
+ * collides in the material will scatter into the scattering angle cosine is
+ * evaluated for every scattering reaction and stored with the corresponding
+ * outgoing photon energy (reactions that result in the same outgoing energy
+ * are combined). The densities are normalized by the macroscopic total cross
+ * section so that absorption is accounted for (the integral of the densities
+ * over all directions is the scattering probability). Only reactions that
+ * scatter the incoming photon are considered - secondary photons (e.g.
+ * fluorescence and annihilation photons) do not contribute.
+ */
+void PhotonMaterial::evaluateNextEventScatteringDensities(
+                                 const double energy,
+                                 const double scattering_angle_cosine,
+                                 std::vector<std::pair<double,double> >&
+                                 outgoing_energies_and_densities ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  outgoing_energies_and_densities.clear();
+
+  const double total_cross_section =
+    this->getMacroscopicTotalCrossSection( energy );
+
+  if( total_cross_section <= 0.0 )
+    return;
+
+  const double norm_constant =
+    1.0/(2.0*Utility::PhysicalConstants::pi*total_cross_section);
+
+  for( size_t i = 0; i < this->getNumberOfScatteringCenters(); ++i )
+  {
+    const double number_density = this->getScatteringCenterNumberDensity( i );
+
+    const Photoatom::ConstReactionMap& scattering_reactions =
+      this->getScatteringCenter( i ).getCore().getScatteringReactions();
+
+    for( auto&& reaction : scattering_reactions )
+    {
+      double outgoing_energy;
+
+      const double differential_cross_section =
+        reaction.second->evaluateDifferentialCrossSection(
+                                                       energy,
+                                                       scattering_angle_cosine,
+                                                       outgoing_energy );
+
+      if( differential_cross_section <= 0.0 )
+        continue;
+
+      const double density =
+        number_density*differential_cross_section*norm_constant;
+
+      // Combine the densities with the same outgoing energy
+      bool combined = false;
+
+      for( auto&& outgoing_energy_and_density :
+             outgoing_energies_and_densities )
+      {
+        if( outgoing_energy_and_density.first == outgoing_energy )
+        {
+          outgoing_energy_and_density.second += density;
+
+          combined = true;
+
+          break;
+        }
+      }
+
+      if( !combined )
+      {
+        outgoing_energies_and_densities.push_back(
+                                  std::make_pair( outgoing_energy, density ) );
+      }
+    }
+  }
+}
+
+// Calculate the thick-target bremsstrahlung photon yield table
+/*! \details The photon yield
+ * (\f$Y(E) = \int_{E_{min}}^E \Sigma_{b}(E')/S(E') dE'\f$) is integrated
+ * with the trapezoidal rule on a logarithmic energy grid that spans the
+ * energy range of the photoatom thick-target bremsstrahlung data, where
+ * \f$\Sigma_{b}\f$ is the macroscopic bremsstrahlung cross section and
+ * \f$S\f$ is the total stopping power. Energies where the stopping power is
+ * not positive do not contribute to the yield.
+ */
+void PhotonMaterial::calculateThickTargetBremsstrahlungYieldTable()
+{
+  double min_energy = std::numeric_limits<double>::infinity();
+  double max_energy = 0.0;
+
+  for( size_t i = 0; i < this->getNumberOfScatteringCenters(); ++i )
+  {
+    const PhotoatomCore& core = this->getScatteringCenter( i ).getCore();
+
+    if( core.hasThickTargetBremsstrahlungData() )
+    {
+      min_energy = std::min( min_energy,
+                             core.getThickTargetBremsstrahlungData().getMinElectronEnergy() );
+
+      max_energy = std::max( max_energy,
+                             core.getThickTargetBremsstrahlungData().getMaxElectronEnergy() );
+    }
+  }
+
+  // No photoatoms have thick-target bremsstrahlung data
+  if( !(min_energy < max_energy) || min_energy <= 0.0 )
+    return;
+
+  const size_t number_of_points = 1 +
+    (size_t)std::ceil( std::log10( max_energy/min_energy )*
+                       s_ttb_yield_points_per_decade );
+
+  d_ttb_energy_grid.resize( number_of_points );
+  d_ttb_photon_yield.resize( number_of_points );
+
+  const double log_energy_spacing =
+    std::log( max_energy/min_energy )/(number_of_points - 1);
+
+  for( size_t i = 0; i < number_of_points; ++i )
+    d_ttb_energy_grid[i] = min_energy*std::exp( i*log_energy_spacing );
+
+  d_ttb_energy_grid.back() = max_energy;
+
+  // Calculate the ratio of the bremsstrahlung cross section and the
+  // stopping power at each table energy
+  std::vector<double> yield_integrand( number_of_points, 0.0 );
+
+  for( size_t i = 0; i < number_of_points; ++i )
+  {
+    const double stopping_power = this->getMacroscopicCrossSection(
+      d_ttb_energy_grid[i],
+      []( const Photoatom& photoatom, const double energy ){
+        if( photoatom.getCore().hasThickTargetBremsstrahlungData() )
+          return photoatom.getCore().getThickTargetBremsstrahlungData().getTotalStoppingCrossSection( energy );
+        else
+          return 0.0; } );
+
+    if( stopping_power > 0.0 )
+    {
+      yield_integrand[i] =
+        this->getMacroscopicThickTargetBremsstrahlungCrossSection(
+                                                     d_ttb_energy_grid[i] )/
+        stopping_power;
+    }
+  }
+
+  d_ttb_photon_yield.front() = 0.0;
+
+  for( size_t i = 1; i < number_of_points; ++i )
+  {
+    d_ttb_photon_yield[i] = d_ttb_photon_yield[i-1] +
+      0.5*(d_ttb_energy_grid[i] - d_ttb_energy_grid[i-1])*
+      (yield_integrand[i-1] + yield_integrand[i]);
+  }
+}
+
+// Sample the electron energy at which a bremsstrahlung photon is emitted
+/*! \details The yield table is inverted (the yield is linear between the
+ * table energies).
+ */
+double PhotonMaterial::sampleThickTargetBremsstrahlungEmissionEnergy(
+                                     const double electron_photon_yield ) const
+{
+  // Make sure the yield is valid
+  testPrecondition( electron_photon_yield >= 0.0 );
+  testPrecondition( electron_photon_yield <= d_ttb_photon_yield.back() );
+
+  if( electron_photon_yield <= d_ttb_photon_yield.front() )
+    return d_ttb_energy_grid.front();
+  else if( electron_photon_yield >= d_ttb_photon_yield.back() )
+    return d_ttb_energy_grid.back();
+
+  const size_t bin_index =
+    Utility::Search::binaryLowerBoundIndex( d_ttb_photon_yield.begin(),
+                                            d_ttb_photon_yield.end(),
+                                            electron_photon_yield );
+
+  const double yield_width =
+    d_ttb_photon_yield[bin_index+1] - d_ttb_photon_yield[bin_index];
+
+  if( yield_width > 0.0 )
+  {
+    return d_ttb_energy_grid[bin_index] +
+      (electron_photon_yield - d_ttb_photon_yield[bin_index])/yield_width*
+      (d_ttb_energy_grid[bin_index+1] - d_ttb_energy_grid[bin_index]);
+  }
+  else
+    return d_ttb_energy_grid[bin_index];
+}
+
+// Return the macroscopic bremsstrahlung cross section (1/cm)
+double PhotonMaterial::getMacroscopicThickTargetBremsstrahlungCrossSection(
+                                           const double electron_energy ) const
+{
+  return this->getMacroscopicCrossSection(
+    electron_energy,
+    []( const Photoatom& photoatom, const double energy ){
+      if( photoatom.getCore().hasThickTargetBremsstrahlungData() )
+        return photoatom.getCore().getThickTargetBremsstrahlungData().getBremsstrahlungCrossSection( energy );
+      else
+        return 0.0; } );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
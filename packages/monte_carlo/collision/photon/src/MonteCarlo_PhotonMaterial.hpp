@@ -12,6 +12,8 @@
 // FRENSIE Includes
 #include "MonteCarlo_Material.hpp"
 #include "MonteCarlo_Photoatom.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
 
@@ -90,6 +92,50 @@ public:
 
   //! Get the photonuclear reaction types
   void getReactionTypes( PhotonuclearReactionEnumTypeSet& reaction_types ) const;
+
+  //! Check if the thick-target bremsstrahlung yield can be calculated
+  bool hasThickTargetBremsstrahlungYield() const;
+
+  //! Return the thick-target bremsstrahlung photon yield
+  double getThickTargetBremsstrahlungPhotonYield(
+                                          const double electron_energy ) const;
+
+  //! Sample the thick-target bremsstrahlung photons of an electron
+  void sampleThickTargetBremsstrahlungPhotons(
+                                       const ParticleState& electron,
+                                       const double min_photon_energy,
+                                       ParticleBank& bank ) const;
+
+  //! Evaluate the next-event scattering densities (1/sr)
+  void evaluateNextEventScatteringDensities(
+                                 const double energy,
+                                 const double scattering_angle_cosine,
+                                 std::vector<std::pair<double,double> >&
+                                 outgoing_energies_and_densities ) const;
+
+protected:
+
+  //! Calculate the thick-target bremsstrahlung photon yield table
+  void calculateThickTargetBremsstrahlungYieldTable();
+
+  //! Sample the electron energy at which a bremsstrahlung photon is emitted
+  double sampleThickTargetBremsstrahlungEmissionEnergy(
+                                     const double electron_photon_yield ) const;
+
+  //! Return the macroscopic bremsstrahlung cross section (1/cm)
+  double getMacroscopicThickTargetBremsstrahlungCrossSection(
+                                          const double electron_energy ) const;
+
+private:
+
+  // The number of yield table points per energy decade
+  static const size_t s_ttb_yield_points_per_decade;
+
+  // The thick-target bremsstrahlung yield table energy grid (MeV)
+  std::vector<double> d_ttb_energy_grid;
+
+  // The thick-target bremsstrahlung photon yield table
+  std::vector<double> d_ttb_photon_yield;
 };
 
 } // end MonteCarlo namespace
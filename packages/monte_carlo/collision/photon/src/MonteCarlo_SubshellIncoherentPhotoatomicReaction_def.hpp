@@ -10,6 +10,7 @@
 #define MONTE_CARLO_SUBSHELL_INCOHERENT_PHOTOATOMIC_REACTION_DEF_HPP
 
 // FRENSIE Includes
+#include "MonteCarlo_PhotonKinematicsHelpers.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -110,6 +111,34 @@ void SubshellIncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>
   photon.incrementCollisionNumber();
 }
 
+// Evaluate the differential cross section (b) w.r.t. the angle cosine
+/*! \details The outgoing energy is the Compton line energy (Doppler broadening
+ * is ignored).
+ */
+template<typename InterpPolicy, bool processed_cross_section>
+double SubshellIncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::evaluateDifferentialCrossSection(
+                                        const double incoming_energy,
+                                        const double scattering_angle_cosine,
+                                        double& outgoing_energy ) const
+{
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  if( incoming_energy < this->getThresholdEnergy() )
+  {
+    outgoing_energy = incoming_energy;
+
+    return 0.0;
+  }
+
+  outgoing_energy = calculateComptonLineEnergy( incoming_energy,
+                                                scattering_angle_cosine );
+
+  return d_scattering_distribution->evaluate( incoming_energy,
+                                              scattering_angle_cosine );
+}
+
 // Get the interaction subshell (non-standard interface)
 template<typename InterpPolicy, bool processed_cross_section>
 inline Data::SubshellType SubshellIncoherentPhotoatomicReaction<InterpPolicy,processed_cross_section>::getSubshell() const
@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ThickTargetBremsstrahlungData.cpp
+//! \author Alex Robinson
+//! \brief  The thick-target bremsstrahlung data class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_ThickTargetBremsstrahlungData.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ThickTargetBremsstrahlungData::ThickTargetBremsstrahlungData(
+     const std::shared_ptr<const Utility::UnivariateDistribution>&
+     bremsstrahlung_cross_section,
+     const std::shared_ptr<const Utility::UnivariateDistribution>&
+     total_stopping_cross_section,
+     const std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>&
+     photon_energy_distribution )
+  : d_bremsstrahlung_cross_section( bremsstrahlung_cross_section ),
+    d_total_stopping_cross_section( total_stopping_cross_section ),
+    d_photon_energy_distribution( photon_energy_distribution )
+{
+  // Make sure the data is valid
+  testPrecondition( bremsstrahlung_cross_section.get() );
+  testPrecondition( total_stopping_cross_section.get() );
+  testPrecondition( photon_energy_distribution.get() );
+}
+
+// Return the min electron energy (MeV)
+double ThickTargetBremsstrahlungData::getMinElectronEnergy() const
+{
+  return d_total_stopping_cross_section->getLowerBoundOfIndepVar();
+}
+
+// Return the max electron energy (MeV)
+double ThickTargetBremsstrahlungData::getMaxElectronEnergy() const
+{
+  return d_total_stopping_cross_section->getUpperBoundOfIndepVar();
+}
+
+// Return the bremsstrahlung cross section (b)
+double ThickTargetBremsstrahlungData::getBremsstrahlungCrossSection(
+                                           const double electron_energy ) const
+{
+  return d_bremsstrahlung_cross_section->evaluate( electron_energy );
+}
+
+// Return the total stopping cross section (MeV-b)
+double ThickTargetBremsstrahlungData::getTotalStoppingCrossSection(
+                                           const double electron_energy ) const
+{
+  return d_total_stopping_cross_section->evaluate( electron_energy );
+}
+
+// Sample a bremsstrahlung photon energy (MeV)
+/*! \details Electron energies outside of the tabulated range of the photon
+ * energy distribution will be moved to the closest tabulated energy.
+ */
+double ThickTargetBremsstrahlungData::samplePhotonEnergy(
+                                           const double electron_energy ) const
+{
+  const double bounded_electron_energy =
+    std::max( std::min( electron_energy,
+                        d_photon_energy_distribution->getUpperBoundOfPrimaryIndepVar() ),
+              d_photon_energy_distribution->getLowerBoundOfPrimaryIndepVar() );
+
+  return d_photon_energy_distribution->sampleSecondaryConditional(
+                                                     bounded_electron_energy );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ThickTargetBremsstrahlungData.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ThickTargetBremsstrahlungData.hpp
+//! \author Alex Robinson
+//! \brief  The thick-target bremsstrahlung data class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_THICK_TARGET_BREMSSTRAHLUNG_DATA_HPP
+#define MONTE_CARLO_THICK_TARGET_BREMSSTRAHLUNG_DATA_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_UnivariateDistribution.hpp"
+#include "Utility_FullyTabularBasicBivariateDistribution.hpp"
+
+namespace MonteCarlo{
+
+/*! The thick-target bremsstrahlung data class
+ * \details This class stores the atomic electron data that is needed to
+ * calculate the thick-target bremsstrahlung yield of a material: the
+ * bremsstrahlung cross section, the total (unrestricted) stopping cross
+ * section and the bremsstrahlung photon energy distribution. It allows the
+ * bremsstrahlung photons of a secondary electron to be sampled in photon
+ * transport without transporting the electron.
+ */
+class ThickTargetBremsstrahlungData
+{
+
+public:
+
+  //! Constructor
+  ThickTargetBremsstrahlungData(
+     const std::shared_ptr<const Utility::UnivariateDistribution>&
+     bremsstrahlung_cross_section,
+     const std::shared_ptr<const Utility::UnivariateDistribution>&
+     total_stopping_cross_section,
+     const std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>&
+     photon_energy_distribution );
+
+  //! Destructor
+  ~ThickTargetBremsstrahlungData()
+  { /* ... */ }
+
+  //! Return the min electron energy (MeV)
+  double getMinElectronEnergy() const;
+
+  //! Return the max electron energy (MeV)
+  double getMaxElectronEnergy() const;
+
+  //! Return the bremsstrahlung cross section (b)
+  double getBremsstrahlungCrossSection( const double electron_energy ) const;
+
+  //! Return the total stopping cross section (MeV-b)
+  double getTotalStoppingCrossSection( const double electron_energy ) const;
+
+  //! Sample a bremsstrahlung photon energy (MeV)
+  double samplePhotonEnergy( const double electron_energy ) const;
+
+private:
+
+  // The bremsstrahlung cross section (b)
+  std::shared_ptr<const Utility::UnivariateDistribution>
+  d_bremsstrahlung_cross_section;
+
+  // The total stopping cross section (MeV-b)
+  std::shared_ptr<const Utility::UnivariateDistribution>
+  d_total_stopping_cross_section;
+
+  // The bremsstrahlung photon energy distribution
+  std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>
+  d_photon_energy_distribution;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_THICK_TARGET_BREMSSTRAHLUNG_DATA_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ThickTargetBremsstrahlungData.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,89 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ThickTargetBremsstrahlungDataNativeFactory.cpp
+//! \author Alex Robinson
+//! \brief  The thick-target bremsstrahlung data native factory definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ThickTargetBremsstrahlungDataNativeFactory.hpp"
+#include "MonteCarlo_ElectronStoppingCrossSectionNativeFactory.hpp"
+#include "Utility_InterpolatedFullyTabularBasicBivariateDistribution.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Create the thick-target bremsstrahlung data
+/*! \details The bremsstrahlung cross section and the total stopping cross
+ * section are linearly interpolated on the electron energy grid. The
+ * bremsstrahlung photon energy distribution uses the same unit-base
+ * correlated log-log-log interpolation as the bremsstrahlung electron
+ * scattering distribution.
+ */
+void ThickTargetBremsstrahlungDataNativeFactory::createThickTargetBremsstrahlungData(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::shared_ptr<const ThickTargetBremsstrahlungData>&
+            thick_target_bremsstrahlung_data,
+            const double evaluation_tol )
+{
+  // Make sure the evaluation tol is valid
+  testPrecondition( evaluation_tol > 0.0 );
+
+  // Create the bremsstrahlung cross section
+  const std::vector<double>& energy_grid =
+    data_container.getElectronEnergyGrid();
+
+  const size_t threshold_index =
+    data_container.getBremsstrahlungCrossSectionThresholdEnergyIndex();
+
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    bremsstrahlung_cross_section(
+         new Utility::TabularDistribution<Utility::LinLin>(
+               std::vector<double>( energy_grid.begin() + threshold_index,
+                                    energy_grid.end() ),
+               data_container.getBremsstrahlungCrossSection() ) );
+
+  // Create the total stopping cross section
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    total_stopping_cross_section;
+
+  ElectronStoppingCrossSectionNativeFactory::createTotalStoppingCrossSection(
+                                                data_container,
+                                                total_stopping_cross_section );
+
+  // Create the bremsstrahlung photon energy distribution
+  const std::vector<double>& bremsstrahlung_energy_grid =
+    data_container.getBremsstrahlungEnergyGrid();
+
+  std::vector<std::shared_ptr<const Utility::TabularUnivariateDistribution> >
+    secondary_dists( bremsstrahlung_energy_grid.size() );
+
+  for( size_t n = 0; n < bremsstrahlung_energy_grid.size(); ++n )
+  {
+    secondary_dists[n] =
+      std::make_shared<const Utility::TabularDistribution<Utility::LinLin> >(
+           data_container.getBremsstrahlungPhotonEnergy( bremsstrahlung_energy_grid[n] ),
+           data_container.getBremsstrahlungPhotonPDF( bremsstrahlung_energy_grid[n] ) );
+  }
+
+  std::shared_ptr<const Utility::FullyTabularBasicBivariateDistribution>
+    photon_energy_distribution(
+      new Utility::InterpolatedFullyTabularBasicBivariateDistribution<Utility::UnitBaseCorrelated<Utility::LogLogLog> >(
+                                                  bremsstrahlung_energy_grid,
+                                                  secondary_dists,
+                                                  1e-6,
+                                                  evaluation_tol ) );
+
+  thick_target_bremsstrahlung_data.reset(
+               new ThickTargetBremsstrahlungData( bremsstrahlung_cross_section,
+                                                  total_stopping_cross_section,
+                                                  photon_energy_distribution ) );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ThickTargetBremsstrahlungDataNativeFactory.cpp
+//---------------------------------------------------------------------------//
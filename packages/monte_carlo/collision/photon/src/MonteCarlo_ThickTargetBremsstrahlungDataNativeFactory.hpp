@@ -0,0 +1,46 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ThickTargetBremsstrahlungDataNativeFactory.hpp
+//! \author Alex Robinson
+//! \brief  The thick-target bremsstrahlung data native factory declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_THICK_TARGET_BREMSSTRAHLUNG_DATA_NATIVE_FACTORY_HPP
+#define MONTE_CARLO_THICK_TARGET_BREMSSTRAHLUNG_DATA_NATIVE_FACTORY_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ThickTargetBremsstrahlungData.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+
+namespace MonteCarlo{
+
+//! The thick-target bremsstrahlung data factory class that uses Native data
+class ThickTargetBremsstrahlungDataNativeFactory
+{
+
+public:
+
+  //! Create the thick-target bremsstrahlung data
+  static void createThickTargetBremsstrahlungData(
+            const Data::ElectronPhotonRelaxationDataContainer& data_container,
+            std::shared_ptr<const ThickTargetBremsstrahlungData>&
+            thick_target_bremsstrahlung_data,
+            const double evaluation_tol = 1e-7 );
+
+private:
+
+  // Constructor
+  ThickTargetBremsstrahlungDataNativeFactory();
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_THICK_TARGET_BREMSSTRAHLUNG_DATA_NATIVE_FACTORY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ThickTargetBremsstrahlungDataNativeFactory.hpp
+//---------------------------------------------------------------------------//
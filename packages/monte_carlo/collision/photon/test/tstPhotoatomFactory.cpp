@@ -409,6 +409,78 @@ FRENSIE_UNIT_TEST( PhotoatomFactory, createPhotoatomMap_native_basic )
   photoatom_factory.reset();
 }
 
+//---------------------------------------------------------------------------//
+// Check that a photoatom map can be created (thick-target bremsstrahlung data)
+FRENSIE_UNIT_TEST( PhotoatomFactory, createPhotoatomMap_native_ttb )
+{
+  // Create the set of photoatom aliases
+  MonteCarlo::PhotoatomFactory::ScatteringCenterNameSet photoatom_aliases;
+  photoatom_aliases.insert( "Pb-Native" );
+
+  MonteCarlo::SimulationProperties properties;
+  properties.setNumberOfPhotonHashGridBins( 100 );
+  properties.setIncoherentModelType( MonteCarlo::WH_INCOHERENT_MODEL );
+  properties.setKahnSamplingCutoffEnergy( 3.0 );
+  properties.setAtomicRelaxationModeOff( MonteCarlo::PHOTON );
+  properties.setDetailedPairProductionModeOff();
+  properties.setThickTargetBremsstrahlungModeOn();
+
+  std::unique_ptr<MonteCarlo::PhotoatomFactory> photoatom_factory(
+                                       new MonteCarlo::PhotoatomFactory(
+					       *data_directory,
+                                               photoatom_aliases,
+					       *photoatom_definitions,
+					       atomic_relaxation_model_factory,
+                                               properties,
+                                               true ) );
+
+  MonteCarlo::PhotoatomFactory::PhotoatomNameMap photoatom_map;
+
+  photoatom_factory->createPhotoatomMap( photoatom_map );
+
+  FRENSIE_CHECK_EQUAL( photoatom_map.size(), 1 );
+  FRENSIE_CHECK( photoatom_map.count( "Pb-Native" ) );
+  FRENSIE_REQUIRE( photoatom_map["Pb-Native"].get() != NULL );
+
+  std::shared_ptr<const MonteCarlo::Photoatom>& atom =
+    photoatom_map["Pb-Native"];
+
+  FRENSIE_REQUIRE( atom->getCore().hasThickTargetBremsstrahlungData() );
+
+  const MonteCarlo::ThickTargetBremsstrahlungData& ttb_data =
+    atom->getCore().getThickTargetBremsstrahlungData();
+
+  FRENSIE_CHECK( ttb_data.getMinElectronEnergy() < 1.0 );
+  FRENSIE_CHECK( ttb_data.getMaxElectronEnergy() > 1.0 );
+  FRENSIE_CHECK( ttb_data.getBremsstrahlungCrossSection( 1.0 ) > 0.0 );
+  FRENSIE_CHECK( ttb_data.getTotalStoppingCrossSection( 1.0 ) > 0.0 );
+
+  // The sampled photon energy can never exceed the electron energy
+  for( size_t i = 0; i < 10; ++i )
+  {
+    double photon_energy = ttb_data.samplePhotonEnergy( 1.0 );
+
+    FRENSIE_CHECK( photon_energy > 0.0 );
+    FRENSIE_CHECK( photon_energy <= 1.0 );
+  }
+
+  // Thick-target bremsstrahlung data is only created when requested
+  properties.setThickTargetBremsstrahlungModeOff();
+
+  photoatom_factory.reset( new MonteCarlo::PhotoatomFactory(
+					       *data_directory,
+                                               photoatom_aliases,
+					       *photoatom_definitions,
+					       atomic_relaxation_model_factory,
+                                               properties,
+                                               true ) );
+
+  photoatom_map.clear();
+
+  photoatom_factory->createPhotoatomMap( photoatom_map );
+
+  FRENSIE_CHECK( !photoatom_map["Pb-Native"]->getCore().hasThickTargetBremsstrahlungData() );
+}
 
 //---------------------------------------------------------------------------//
 // Check that a photoatom map can be created (Doppler data)
@@ -8,20 +8,59 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
+#include <cmath>
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomFactory.hpp"
 #include "MonteCarlo_PhotonMaterial.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_PhotonKinematicsHelpers.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
+//---------------------------------------------------------------------------//
+// Testing Structs.
+//---------------------------------------------------------------------------//
+class TestPhotonMaterial : public MonteCarlo::PhotonMaterial
+{
+public:
+
+  // Constructor
+  TestPhotonMaterial( const MaterialId id,
+                      const double density,
+                      const PhotoatomNameMap& photoatom_name_map,
+                      const std::vector<double>& photoatom_fractions,
+                      const std::vector<std::string>& photoatom_names )
+    : MonteCarlo::PhotonMaterial( id,
+                                  density,
+                                  photoatom_name_map,
+                                  photoatom_fractions,
+                                  photoatom_names )
+  { /* ... */ }
+
+  // Allow public access to the protected member functions
+  using MonteCarlo::PhotonMaterial::sampleThickTargetBremsstrahlungEmissionEnergy;
+  using MonteCarlo::PhotonMaterial::getMacroscopicThickTargetBremsstrahlungCrossSection;
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables.
 //---------------------------------------------------------------------------//
 
 std::shared_ptr<MonteCarlo::PhotonMaterial> material;
 
+std::shared_ptr<TestPhotonMaterial> ttb_material;
+
+std::shared_ptr<const MonteCarlo::Photoatom> ttb_atom;
+
+std::shared_ptr<MonteCarlo::PhotonMaterial> unionized_material;
+
+std::shared_ptr<MonteCarlo::PhotonMaterial> thinned_unionized_material;
+
+std::vector<double> atom_energy_grid_points;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -416,6 +455,362 @@ FRENSIE_UNIT_TEST( PhotonMaterial, collideSurvivalBias )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the thick-target bremsstrahlung yield is only available when
+// the photoatoms have thick-target bremsstrahlung data
+FRENSIE_UNIT_TEST( PhotonMaterial, getThickTargetBremsstrahlungPhotonYield )
+{
+  FRENSIE_CHECK( !material->hasThickTargetBremsstrahlungYield() );
+  FRENSIE_CHECK_EQUAL( material->getThickTargetBremsstrahlungPhotonYield( 1.0 ),
+                       0.0 );
+
+  // No photons will be created without a yield
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1.0 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+
+  material->sampleThickTargetBremsstrahlungPhotons( electron, 1e-3, bank );
+
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the thick-target bremsstrahlung photon yield can be returned
+FRENSIE_UNIT_TEST( PhotonMaterial, getThickTargetBremsstrahlungPhotonYield_ttb )
+{
+  FRENSIE_REQUIRE( ttb_material->hasThickTargetBremsstrahlungYield() );
+
+  const MonteCarlo::ThickTargetBremsstrahlungData& ttb_data =
+    ttb_atom->getCore().getThickTargetBremsstrahlungData();
+
+  // Integrate the yield (sigma_b/S) at 1 MeV on a fine log grid (the number
+  // density cancels out for a single element material)
+  const double min_energy = ttb_data.getMinElectronEnergy();
+  const double energy = 1.0;
+
+  const size_t number_of_points = 1 +
+    (size_t)std::ceil( std::log10( energy/min_energy )*1000 );
+
+  const double log_energy_spacing =
+    std::log( energy/min_energy )/(number_of_points - 1);
+
+  double expected_yield = 0.0;
+  double previous_energy = min_energy;
+  double previous_integrand =
+    ttb_data.getBremsstrahlungCrossSection( min_energy )/
+    ttb_data.getTotalStoppingCrossSection( min_energy );
+
+  for( size_t i = 1; i < number_of_points; ++i )
+  {
+    const double current_energy = min_energy*std::exp( i*log_energy_spacing );
+
+    const double current_integrand =
+      ttb_data.getBremsstrahlungCrossSection( current_energy )/
+      ttb_data.getTotalStoppingCrossSection( current_energy );
+
+    expected_yield += 0.5*(current_energy - previous_energy)*
+      (previous_integrand + current_integrand);
+
+    previous_energy = current_energy;
+    previous_integrand = current_integrand;
+  }
+
+  FRENSIE_CHECK( expected_yield > 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                ttb_material->getThickTargetBremsstrahlungPhotonYield( energy ),
+                expected_yield,
+                1e-3 );
+
+  // The yield increases with energy
+  FRENSIE_CHECK_EQUAL(
+        ttb_material->getThickTargetBremsstrahlungPhotonYield( min_energy ),
+        0.0 );
+  FRENSIE_CHECK( ttb_material->getThickTargetBremsstrahlungPhotonYield( 0.1 ) <
+                 ttb_material->getThickTargetBremsstrahlungPhotonYield( 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the electron energy at which a thick-target bremsstrahlung
+// photon is emitted can be sampled
+FRENSIE_UNIT_TEST( PhotonMaterial, sampleThickTargetBremsstrahlungEmissionEnergy )
+{
+  // The yield table is inverted
+  const std::vector<double> energies( {1e-2, 0.1, 0.5, 1.0} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    const double photon_yield =
+      ttb_material->getThickTargetBremsstrahlungPhotonYield( energies[i] );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+       ttb_material->sampleThickTargetBremsstrahlungEmissionEnergy( photon_yield ),
+       energies[i],
+       1e-9 );
+  }
+
+  // The emission energy never exceeds the electron energy
+  const double photon_yield =
+    ttb_material->getThickTargetBremsstrahlungPhotonYield( 1.0 );
+
+  for( size_t i = 0; i < 100; ++i )
+  {
+    const double emission_energy =
+      ttb_material->sampleThickTargetBremsstrahlungEmissionEnergy(
+                   Utility::RandomNumberGenerator::getRandomNumber<double>()*
+                   photon_yield );
+
+    FRENSIE_CHECK( emission_energy > 0.0 );
+    FRENSIE_CHECK( emission_energy <= 1.0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the thick-target bremsstrahlung photons of an electron can be
+// sampled
+FRENSIE_UNIT_TEST( PhotonMaterial, sampleThickTargetBremsstrahlungPhotons )
+{
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1.0 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+
+  const double photon_yield =
+    ttb_material->getThickTargetBremsstrahlungPhotonYield( 1.0 );
+
+  FRENSIE_REQUIRE( photon_yield > 0.0 );
+
+  const size_t number_of_electrons = 10000;
+
+  size_t number_of_photons = 0;
+
+  for( size_t i = 0; i < number_of_electrons; ++i )
+  {
+    MonteCarlo::ParticleBank bank;
+
+    ttb_material->sampleThickTargetBremsstrahlungPhotons( electron, 0.0, bank );
+
+    double total_photon_energy = 0.0;
+
+    while( !bank.isEmpty() )
+    {
+      FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+      FRENSIE_CHECK( bank.top().getEnergy() > 0.0 );
+
+      total_photon_energy += bank.top().getEnergy();
+
+      ++number_of_photons;
+
+      bank.pop();
+    }
+
+    // The photons never carry away more than the electron energy
+    FRENSIE_CHECK( total_photon_energy <= electron.getEnergy() );
+  }
+
+  // The mean number of photons is the photon yield (photons are only
+  // dropped in the rare case that they would exceed the electron energy)
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          (double)number_of_photons/number_of_electrons,
+                          photon_yield,
+                          1e-2 );
+
+  // No photons are banked below the min photon energy
+  {
+    MonteCarlo::ParticleBank bank;
+
+    ttb_material->sampleThickTargetBremsstrahlungPhotons( electron, 1.0, bank );
+
+    FRENSIE_CHECK( bank.isEmpty() );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the next-event scattering densities can be evaluated
+FRENSIE_UNIT_TEST( PhotonMaterial, evaluateNextEventScatteringDensities )
+{
+  std::vector<std::pair<double,double> > outgoing_energies_and_densities;
+
+  material->evaluateNextEventScatteringDensities(
+                                             0.1, 0.9,
+                                             outgoing_energies_and_densities );
+
+  // Incoherent scattering (Compton line) and coherent scattering
+  FRENSIE_REQUIRE_EQUAL( outgoing_energies_and_densities.size(), 2 );
+
+  std::sort( outgoing_energies_and_densities.begin(),
+             outgoing_energies_and_densities.end() );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                outgoing_energies_and_densities[0].first,
+                MonteCarlo::calculateComptonLineEnergy( 0.1, 0.9 ),
+                1e-15 );
+  FRENSIE_CHECK( outgoing_energies_and_densities[0].second > 0.0 );
+  FRENSIE_CHECK_EQUAL( outgoing_energies_and_densities[1].first, 0.1 );
+  FRENSIE_CHECK( outgoing_energies_and_densities[1].second > 0.0 );
+
+  // The incoherent and coherent outgoing energies are the same when there
+  // is no deflection
+  material->evaluateNextEventScatteringDensities(
+                                             0.1, 1.0,
+                                             outgoing_energies_and_densities );
+
+  FRENSIE_REQUIRE_EQUAL( outgoing_energies_and_densities.size(), 1 );
+  FRENSIE_CHECK_EQUAL( outgoing_energies_and_densities[0].first, 0.1 );
+  FRENSIE_CHECK( outgoing_energies_and_densities[0].second > 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the energy grid of the material can be unionized
+FRENSIE_UNIT_TEST( PhotonMaterial, unionizeEnergyGrid )
+{
+  FRENSIE_CHECK( !material->isEnergyGridUnionized() );
+  FRENSIE_CHECK_THROW( material->getUnionizedEnergyGrid(),
+                       std::runtime_error );
+
+  FRENSIE_CHECK( unionized_material->isEnergyGridUnionized() );
+
+  const std::vector<double>& unionized_energy_grid =
+    unionized_material->getUnionizedEnergyGrid();
+
+  FRENSIE_CHECK_EQUAL( unionized_energy_grid.front(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( unionized_energy_grid.back(), 20.0 );
+  FRENSIE_CHECK( std::is_sorted( unionized_energy_grid.begin(),
+                                 unionized_energy_grid.end() ) );
+  FRENSIE_CHECK( std::adjacent_find( unionized_energy_grid.begin(),
+                                     unionized_energy_grid.end() ) ==
+                 unionized_energy_grid.end() );
+
+  // Every atom grid point between the min and max energy must be present
+  size_t number_of_atom_grid_points = 0;
+  size_t number_of_missing_atom_grid_points = 0;
+
+  for( size_t i = 0; i < atom_energy_grid_points.size(); ++i )
+  {
+    const double energy = atom_energy_grid_points[i];
+
+    if( energy >= 1e-3 && energy <= 20.0 )
+    {
+      ++number_of_atom_grid_points;
+
+      if( !std::binary_search( unionized_energy_grid.begin(),
+                               unionized_energy_grid.end(),
+                               energy ) )
+        ++number_of_missing_atom_grid_points;
+    }
+  }
+
+  FRENSIE_CHECK( number_of_atom_grid_points > 0 );
+  FRENSIE_CHECK_EQUAL( number_of_missing_atom_grid_points, 0 );
+
+  // The tabulated cross sections are exact at the grid points
+  for( size_t i = 0; i < unionized_energy_grid.size(); i += 10 )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      unionized_material->getMacroscopicTotalCrossSection( unionized_energy_grid[i] ),
+      material->getMacroscopicTotalCrossSection( unionized_energy_grid[i] ),
+      1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      unionized_material->getMacroscopicAbsorptionCrossSection( unionized_energy_grid[i] ),
+      material->getMacroscopicAbsorptionCrossSection( unionized_energy_grid[i] ),
+      1e-12 );
+  }
+
+  // The grid is refined until linear interpolation reproduces the exact
+  // (log-log) cross sections to within 1e-6 between the grid points
+  std::vector<double> energies( {1.5e-3, 2e-3, 0.1, 0.5, 1.0, 10.0} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+              unionized_material->getMacroscopicTotalCrossSection( energies[i] ),
+              material->getMacroscopicTotalCrossSection( energies[i] ),
+              1e-6 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+         unionized_material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+         material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+         1e-6 );
+  }
+
+  // The refined grid has more points than the atom grid
+  FRENSIE_CHECK( unionized_energy_grid.size() > number_of_atom_grid_points );
+
+  // Energies outside of the unionized grid are evaluated directly
+  FRENSIE_CHECK_EQUAL(
+       unionized_material->getMacroscopicTotalCrossSection( 1e-4 ),
+       material->getMacroscopicTotalCrossSection( 1e-4 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unionized energy grid of the material can be thinned
+FRENSIE_UNIT_TEST( PhotonMaterial, unionizeEnergyGrid_thinned )
+{
+  FRENSIE_CHECK( thinned_unionized_material->isEnergyGridUnionized() );
+
+  const std::vector<double>& thinned_energy_grid =
+    thinned_unionized_material->getUnionizedEnergyGrid();
+
+  FRENSIE_CHECK_EQUAL( thinned_energy_grid.front(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( thinned_energy_grid.back(), 20.0 );
+  FRENSIE_CHECK( thinned_energy_grid.size() <
+                 unionized_material->getUnionizedEnergyGrid().size() );
+
+  // The thinned grid is a subset of the full unionized grid
+  FRENSIE_CHECK( std::includes(
+                        unionized_material->getUnionizedEnergyGrid().begin(),
+                        unionized_material->getUnionizedEnergyGrid().end(),
+                        thinned_energy_grid.begin(),
+                        thinned_energy_grid.end() ) );
+
+  // Removed grid points are reproduced to within the thinning tolerance
+  const std::vector<double>& unionized_energy_grid =
+    unionized_material->getUnionizedEnergyGrid();
+
+  for( size_t i = 0; i < unionized_energy_grid.size(); i += 10 )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      thinned_unionized_material->getMacroscopicTotalCrossSection( unionized_energy_grid[i] ),
+      unionized_material->getMacroscopicTotalCrossSection( unionized_energy_grid[i] ),
+      1e-3 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+      thinned_unionized_material->getMacroscopicAbsorptionCrossSection( unionized_energy_grid[i] ),
+      unionized_material->getMacroscopicAbsorptionCrossSection( unionized_energy_grid[i] ),
+      1e-3 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a photon can collide with the unionized material
+FRENSIE_UNIT_TEST( PhotonMaterial, collideAnalogue_unionized )
+{
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 20.0 );
+  photon.setDirection( 0.0, 0.0, 1.0 );
+
+  // Set up the random number stream
+  std::vector<double> fake_stream( 9 );
+  fake_stream[0] = 0.5; // select the pb atom
+  fake_stream[1] = 0.1; // select the incoherent reaction
+  fake_stream[2] = 0.001; // sample from first term of koblinger's method
+  fake_stream[3] = 0.5; // x = 40.13902672495315, mu = 0.0
+  fake_stream[4] = 0.5; // accept x in scattering function rejection loop
+  fake_stream[5] = 0.005; // select first shell for collision - old
+  fake_stream[6] = 0.005; // select first shell for collision - endf
+  fake_stream[7] = 6.427713151861e-01; // select pz = 40.0
+  fake_stream[8] = 0.25; // select energy loss
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  unionized_material->collideAnalogue( photon, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( photon.getEnergy(), 0.352804013048420073, 1e-12 );
+  FRENSIE_CHECK_SMALL( photon.getZDirection(), 1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -497,6 +892,98 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                     atom_map,
                                                     atom_fractions,
                                                     atom_names ) );
+
+    // Create the test material with a unionized energy grid
+    unionized_material.reset( new MonteCarlo::PhotonMaterial( 0,
+                                                              -1.0,
+                                                              atom_map,
+                                                              atom_fractions,
+                                                              atom_names ) );
+
+    unionized_material->unionizeEnergyGrid( 1e-3, 20.0 );
+
+    // Create the test material with a thinned unionized energy grid
+    thinned_unionized_material.reset(
+                                new MonteCarlo::PhotonMaterial( 0,
+                                                                -1.0,
+                                                                atom_map,
+                                                                atom_fractions,
+                                                                atom_names ) );
+
+    thinned_unionized_material->unionizeEnergyGrid( 1e-3, 20.0, 1e-3 );
+
+    // Cache the energy grid points of the atom
+    atom_map.find( "Pb" )->second->getEnergyGridPoints(
+                                                     atom_energy_grid_points );
+  }
+
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    boost::filesystem::path data_directory = database_path.parent_path();
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::AtomProperties& pb_properties =
+      database.getAtomProperties( Data::Pb_ATOM );
+
+    // Set the scattering center definitions
+    MonteCarlo::ScatteringCenterDefinitionDatabase photoatom_definitions;
+
+    MonteCarlo::ScatteringCenterDefinition& pb_definition =
+      photoatom_definitions.createDefinition( "Pb-Native", Data::Pb_ATOM );
+
+    pb_definition.setPhotoatomicDataProperties(
+           pb_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    MonteCarlo::PhotoatomFactory::ScatteringCenterNameSet photoatom_aliases;
+    photoatom_aliases.insert( "Pb-Native" );
+
+    // Set the simulation properties (thick-target bremsstrahlung data is
+    // only created when the mode is on)
+    MonteCarlo::SimulationProperties properties;
+    properties.setNumberOfPhotonHashGridBins( 100 );
+    properties.setIncoherentModelType( MonteCarlo::WH_INCOHERENT_MODEL );
+    properties.setKahnSamplingCutoffEnergy( 3.0 );
+    properties.setAtomicRelaxationModeOff( MonteCarlo::PHOTON );
+    properties.setDetailedPairProductionModeOff();
+    properties.setThickTargetBremsstrahlungModeOn();
+
+    // Create the factories
+    std::shared_ptr<MonteCarlo::AtomicRelaxationModelFactory>
+      atomic_relaxation_model_factory(
+				new MonteCarlo::AtomicRelaxationModelFactory );
+
+    MonteCarlo::PhotoatomFactory factory( data_directory,
+                                          photoatom_aliases,
+                                          photoatom_definitions,
+                                          atomic_relaxation_model_factory,
+                                          properties,
+                                          true );
+
+    MonteCarlo::PhotoatomFactory::PhotoatomNameMap atom_map;
+
+    factory.createPhotoatomMap( atom_map );
+
+    ttb_atom = atom_map.find( "Pb-Native" )->second;
+
+    // Assign the atom fractions and names
+    std::vector<double> atom_fractions( 1 );
+    std::vector<std::string> atom_names( 1 );
+
+    atom_fractions[0] = -1.0; // weight fraction
+    atom_names[0] = "Pb-Native";
+
+    // Create the test material
+    ttb_material.reset( new TestPhotonMaterial( 1,
+                                                -1.0,
+                                                atom_map,
+                                                atom_fractions,
+                                                atom_names ) );
   }
 
   // Initialize the random number generator
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <algorithm>
+#include <iterator>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
@@ -18,19 +19,20 @@ namespace MonteCarlo{
 
 // Default Constructor
 ParticleBank::ParticleBank()
-  : d_particle_states()
+  : d_particle_states(),
+    d_top_index( 0 )
 { /* ... */ }
 
 // Check if the bank is empty
 bool ParticleBank::isEmpty() const
 {
-  return d_particle_states.size() == 0;
+  return d_top_index == d_particle_states.size();
 }
 
 // The size of the bank
 unsigned long long ParticleBank::size() const
 {
-  return d_particle_states.size();
+  return d_particle_states.size() - d_top_index;
 }
 
 // Access the top element
@@ -39,7 +41,7 @@ ParticleState& ParticleBank::top()
   // Make sure there is at least one particle in the bank
   testPrecondition( this->size() > 0 );
 
-  return *d_particle_states.front();
+  return *d_particle_states[d_top_index];
 }
 
 // Access the top element
@@ -48,7 +50,7 @@ const ParticleState& ParticleBank::top() const
   // Make sure there is at least one particle in the bank
   testPrecondition( this->size() > 0 );
 
-  return *d_particle_states.front();
+  return *d_particle_states[d_top_index];
 }
 
 // Push a particle to the bank
@@ -85,18 +87,76 @@ void ParticleBank::push( const NeutronState& neutron,
 }
 
 // Pop a particle from the bank
+/*! \details The storage used by the bank is kept when the last particle is
+ * popped so that it can be reused.
+ */
 void ParticleBank::pop()
 {
   // Make sure the bank is not empty
   testPrecondition( !this->isEmpty() );
 
-  d_particle_states.pop_front();
+  d_particle_states[d_top_index].reset();
+
+  ++d_top_index;
+
+  // Reset the bank once the last particle has been popped
+  if( d_top_index == d_particle_states.size() )
+  {
+    d_particle_states.clear();
+    d_top_index = 0;
+  }
+  // Prevent the popped particle slots from accumulating in a bank that is
+  // never emptied
+  else if( d_top_index > 64 && 2*d_top_index > d_particle_states.size() )
+    this->erasePoppedParticles();
+}
+
+// Pop the top particle from the bank and store it in the smart pointer (Most Efficient/Recommended)
+/*! \details The bank has sole ownership of the particles that it stores so
+ * ownership of the top particle can be transferred to the smart pointer
+ * without creating a copy (clone) of the particle.
+ */
+void ParticleBank::pop( std::shared_ptr<ParticleState>& particle )
+{
+  // Make sure the bank is not empty
+  testPrecondition( !this->isEmpty() );
+
+  particle = std::move( d_particle_states[d_top_index] );
+
+  this->pop();
+}
+
+// Erase the popped particles from the front of the container
+void ParticleBank::erasePoppedParticles()
+{
+  d_particle_states.erase( d_particle_states.begin(), this->topIterator() );
+
+  d_top_index = 0;
+}
+
+// Move all of the particles in the bank to the end of the container
+/*! \details The particles will be moved in the order that they would be
+ * popped from the bank. Ownership of the particles is transferred to the
+ * container (no copies are made) and the bank will be empty.
+ */
+void ParticleBank::release(
+                     std::vector<std::shared_ptr<ParticleState> >& particles )
+{
+  particles.reserve( particles.size() + this->size() );
+
+  for( BankContainerType::iterator particle_it = this->topIterator();
+       particle_it != d_particle_states.end();
+       ++particle_it )
+    particles.push_back( std::move( *particle_it ) );
+
+  d_particle_states.clear();
+  d_top_index = 0;
 }
 
 // Check if the bank is sorted
 bool ParticleBank::isSorted( const CompareFunctionType& compare_function )
 {
-  return std::is_sorted( d_particle_states.begin(),
+  return std::is_sorted( this->topIterator(),
 			 d_particle_states.end(),
 			 std::bind<bool>(compare_function,
 					   std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
@@ -106,7 +166,9 @@ bool ParticleBank::isSorted( const CompareFunctionType& compare_function )
 // Sort the particle states
 bool ParticleBank::sort( const CompareFunctionType& compare_function )
 {
-  d_particle_states.sort( std::bind<bool>(compare_function,
+  std::stable_sort( this->topIterator(),
+                    d_particle_states.end(),
+                    std::bind<bool>(compare_function,
 					    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
 					    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
 }
@@ -122,10 +184,18 @@ void ParticleBank::merge( ParticleBank& other_bank,
   testPrecondition( this->isSorted( compare_function ) );
   testPrecondition( other_bank.isSorted( compare_function ) );
 
-  d_particle_states.merge( other_bank.d_particle_states,
-			   std::bind<bool>(compare_function,
-					     std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
-					     std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+  this->erasePoppedParticles();
+
+  const size_t middle_index = d_particle_states.size();
+
+  this->splice( other_bank );
+
+  std::inplace_merge( d_particle_states.begin(),
+                      d_particle_states.begin() + middle_index,
+                      d_particle_states.end(),
+                      std::bind<bool>(compare_function,
+                                      std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
+                                      std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
 }
 
 // Splice the bank with another bank
@@ -134,8 +204,13 @@ void ParticleBank::merge( ParticleBank& other_bank,
  */
 void ParticleBank::splice( ParticleBank& other_bank )
 {
-  d_particle_states.splice( d_particle_states.end(),
-			    other_bank.d_particle_states );
+  d_particle_states.insert(
+                   d_particle_states.end(),
+                   std::make_move_iterator( other_bank.topIterator() ),
+                   std::make_move_iterator( other_bank.d_particle_states.end() ) );
+
+  other_bank.d_particle_states.clear();
+  other_bank.d_top_index = 0;
 }
 
 EXPLICIT_CLASS_SERIALIZE_INST( ParticleBank );
@@ -24,10 +24,21 @@
 #include "MonteCarlo_NeutronState.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_List.hpp"
+#include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
 
-//! The particle bank base class (FIFO)
+/*! The particle bank base class (FIFO)
+ * \details The particles are stored in a vector. Popped particles are not
+ * erased from the front of the vector immediately. Instead, the index of the
+ * top particle is advanced and the vector is cleared (without releasing its
+ * storage) once the bank is empty. A bank that is reused (e.g. between
+ * collisions or histories) will therefore not allocate any memory once its
+ * storage has grown to the size required by the simulation. The particle
+ * states (and their navigators) are allocated from the thread local memory
+ * pool (see Utility::ThreadLocalMemoryPool), which reuses the memory of the
+ * most recently popped particles first (LIFO).
+ */
 class ParticleBank
 {
 
@@ -86,6 +97,12 @@ public:
   template<template<typename> class SmartPointer>
   void pop( SmartPointer<ParticleState>& particle );
 
+  //! Pop the top particle from the bank and store it in the smart pointer (Most Efficient/Recommended)
+  void pop( std::shared_ptr<ParticleState>& particle );
+
+  //! Move all of the particles in the bank to the end of the container
+  void release( std::vector<std::shared_ptr<ParticleState> >& particles );
+
   //! Check if the bank is sorted
   virtual bool isSorted( const CompareFunctionType& compare_function );
 
@@ -102,7 +119,7 @@ public:
 protected:
 
   //! The bank container type
-  typedef std::list<std::shared_ptr<ParticleState> > BankContainerType;
+  typedef std::vector<std::shared_ptr<ParticleState> > BankContainerType;
 
 private:
 
@@ -110,16 +127,33 @@ private:
   static const ParticleState& dereference(
                                const std::shared_ptr<ParticleState>& pointer );
 
+  // Return an iterator to the top particle
+  BankContainerType::iterator topIterator();
+
+  // Return an iterator to the top particle
+  BankContainerType::const_iterator topIterator() const;
+
+  // Erase the popped particles from the front of the container
+  void erasePoppedParticles();
+
   // Save the bank to an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version )
-  { ar & BOOST_SERIALIZATION_NVP(d_particle_states); }
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the bank from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
-  // A list of particle states
+  // The particle states (the particles before the top index have been popped)
   BankContainerType d_particle_states;
+
+  // The index of the top particle
+  size_t d_top_index;
 };
 
 // Dereference a smart pointer
@@ -129,6 +163,39 @@ inline const ParticleState& ParticleBank::dereference(
   return *pointer;
 }
 
+// Return an iterator to the top particle
+inline auto ParticleBank::topIterator() -> BankContainerType::iterator
+{
+  return d_particle_states.begin() + d_top_index;
+}
+
+// Return an iterator to the top particle
+inline auto ParticleBank::topIterator() const -> BankContainerType::const_iterator
+{
+  return d_particle_states.begin() + d_top_index;
+}
+
+// Save the bank to an archive
+/*! \details Only the particles that have not been popped will be saved.
+ */
+template<typename Archive>
+void ParticleBank::save( Archive& ar, const unsigned version ) const
+{
+  BankContainerType particle_states( this->topIterator(),
+                                     d_particle_states.end() );
+
+  ar & boost::serialization::make_nvp( "d_particle_states", particle_states );
+}
+
+// Load the bank from an archive
+template<typename Archive>
+void ParticleBank::load( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_NVP( d_particle_states );
+
+  d_top_index = 0;
+}
+
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_CLASS_VERSION( ParticleBank, MonteCarlo, 0 );
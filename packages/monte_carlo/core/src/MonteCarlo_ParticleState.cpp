@@ -14,6 +14,7 @@
 #include "Utility_3DCartesianVectorHelpers.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ThreadLocalMemoryPool.hpp"
 
 namespace MonteCarlo{
 
@@ -110,6 +111,24 @@ ParticleState::ParticleState( const ParticleState& existing_base_state,
     d_collision_number = 0u;
 }
 
+// Allocate the memory for a particle state (thread local memory pool)
+/*! \details Particle states are created and released at a high rate during
+ * a simulation (e.g. every secondary particle and every particle that is
+ * pushed into a bank by value). The memory of released states will be
+ * reused by the thread that released them, so once a thread has reached
+ * its working set of particles no further heap allocations are required.
+ */
+void* ParticleState::operator new( size_t size )
+{
+  return Utility::ThreadLocalMemoryPool::allocate( size );
+}
+
+// Deallocate the memory of a particle state (thread local memory pool)
+void ParticleState::operator delete( void* particle, size_t size )
+{
+  Utility::ThreadLocalMemoryPool::deallocate( particle, size );
+}
+
 // Clone the particle state but change the history number
 /*! \details This method returns a heap-allocated pointer. It is only safe
  * to call this method inside of a smart pointer constructor or reset method.
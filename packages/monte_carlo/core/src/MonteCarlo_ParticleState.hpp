@@ -90,6 +90,12 @@ public:
   virtual ~ParticleState()
   { /* ... */ }
 
+  //! Allocate the memory for a particle state (thread local memory pool)
+  static void* operator new( size_t size );
+
+  //! Deallocate the memory of a particle state (thread local memory pool)
+  static void operator delete( void* particle, size_t size );
+
   /*! Clone the particle state (do not use to generate new particles through reactions, VR is fine!)
    * \details This method returns a heap-allocated pointer. It is only safe
    * to call this method inside of a smart pointer constructor or reset
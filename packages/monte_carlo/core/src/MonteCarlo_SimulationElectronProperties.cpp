@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <limits>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_SimulationElectronProperties.hpp"
@@ -41,7 +44,11 @@ SimulationElectronProperties::SimulationElectronProperties()
     d_electroionization_sampling_mode( KNOCK_ON_SAMPLING ),
     d_atomic_excitation_mode_on( true ),
     d_threshold_weight( 0.0 ),
-    d_survival_weight()
+    d_survival_weight(),
+    d_condensed_history_mode_on( false ),
+    d_condensed_history_max_energy_loss_fraction( 0.05 ),
+    d_range_rejection_mode_on( false ),
+    d_range_rejection_bremsstrahlung_guard_energy( std::numeric_limits<double>::infinity() )
 { /* ... */ }
 
 // Set the minimum electron energy (MeV)
@@ -347,6 +354,105 @@ double SimulationElectronProperties::getElectronRouletteSurvivalWeight() const
   return d_survival_weight;
 }
 
+// Set condensed history mode to off (off by default)
+void SimulationElectronProperties::setCondensedHistoryModeOff()
+{
+  d_condensed_history_mode_on = false;
+}
+
+// Set condensed history mode to on (off by default)
+/*! \details In condensed history mode the elastic and atomic excitation
+ * collisions of an electron (soft collisions) are not simulated
+ * individually. Instead, they are grouped into condensed history steps. The
+ * energy lost in each step is calculated from the restricted (atomic
+ * excitation) stopping power and the direction change is sampled from a
+ * multiple scattering distribution derived from the elastic transport cross
+ * section. Bremsstrahlung and electroionization collisions are still
+ * simulated individually (including the electroionization collisions with
+ * small energy transfers), so a step will also end at the next one of these
+ * collisions. Native data is required.
+ */
+void SimulationElectronProperties::setCondensedHistoryModeOn()
+{
+  d_condensed_history_mode_on = true;
+}
+
+// Return if condensed history mode is on
+bool SimulationElectronProperties::isCondensedHistoryModeOn() const
+{
+  return d_condensed_history_mode_on;
+}
+
+// Set the max fractional energy loss of a condensed history step (default = 0.05)
+/*! \details The length of a condensed history step will be limited so that
+ * the electron will not lose more than this fraction of its energy in the
+ * step.
+ */
+void SimulationElectronProperties::setCondensedHistoryMaxEnergyLossFraction(
+                                                        const double fraction )
+{
+  // Make sure the fraction is valid
+  testPrecondition( fraction > 0.0 );
+  testPrecondition( fraction < 1.0 );
+
+  d_condensed_history_max_energy_loss_fraction = fraction;
+}
+
+// Return the max fractional energy loss of a condensed history step
+double SimulationElectronProperties::getCondensedHistoryMaxEnergyLossFraction() const
+{
+  return d_condensed_history_max_energy_loss_fraction;
+}
+
+// Set electron range rejection mode to off (off by default)
+void SimulationElectronProperties::setElectronRangeRejectionModeOff()
+{
+  d_range_rejection_mode_on = false;
+}
+
+// Set electron range rejection mode to on (off by default)
+/*! \details In range rejection mode an electron will be terminated (its
+ * energy will be deposited locally) when its continuous slowing down
+ * approximation (CSDA) range in the material of its cell is shorter than its
+ * ray safety distance (the distance to the closest boundary of the cell).
+ * The CSDA range tables are calculated from the total (collision and
+ * radiative) stopping powers of the materials. Native data is required.
+ * Note that the bremsstrahlung photons that would have been produced by a
+ * terminated electron are lost, which can be prevented by setting a
+ * bremsstrahlung guard energy.
+ */
+void SimulationElectronProperties::setElectronRangeRejectionModeOn()
+{
+  d_range_rejection_mode_on = true;
+}
+
+// Return if electron range rejection mode is on
+bool SimulationElectronProperties::isElectronRangeRejectionModeOn() const
+{
+  return d_range_rejection_mode_on;
+}
+
+// Set the electron range rejection bremsstrahlung guard energy (MeV)
+/*! \details Electrons with an energy at or above the guard energy will never
+ * be range rejected so that the electrons that can still produce relevant
+ * bremsstrahlung photons are kept alive. By default there is no guard energy
+ * (infinity).
+ */
+void SimulationElectronProperties::setElectronRangeRejectionBremsstrahlungGuardEnergy(
+                                                          const double energy )
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  d_range_rejection_bremsstrahlung_guard_energy = energy;
+}
+
+// Return the electron range rejection bremsstrahlung guard energy (MeV)
+double SimulationElectronProperties::getElectronRangeRejectionBremsstrahlungGuardEnergy() const
+{
+  return d_range_rejection_bremsstrahlung_guard_energy;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationElectronProperties );
 
 } // end MonteCarlo namespace
@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_SIMULATION_ELECTRON_PROPERTIES_HPP
 #define MONTE_CARLO_SIMULATION_ELECTRON_PROPERTIES_HPP
 
+// Std Lib Includes
+#include <limits>
+
 // Boost Includes
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/split_member.hpp>
@@ -182,11 +185,47 @@ public:
   //! Return the cutoff roulette survival weight
   double getElectronRouletteSurvivalWeight() const;
 
+  //! Set condensed history mode to off (off by default)
+  void setCondensedHistoryModeOff();
+
+  //! Set condensed history mode to on (off by default)
+  void setCondensedHistoryModeOn();
+
+  //! Return if condensed history mode is on
+  bool isCondensedHistoryModeOn() const;
+
+  //! Set the max fractional energy loss of a condensed history step
+  void setCondensedHistoryMaxEnergyLossFraction( const double fraction );
+
+  //! Return the max fractional energy loss of a condensed history step
+  double getCondensedHistoryMaxEnergyLossFraction() const;
+
+  //! Set electron range rejection mode to off (off by default)
+  void setElectronRangeRejectionModeOff();
+
+  //! Set electron range rejection mode to on (off by default)
+  void setElectronRangeRejectionModeOn();
+
+  //! Return if electron range rejection mode is on
+  bool isElectronRangeRejectionModeOn() const;
+
+  //! Set the electron range rejection bremsstrahlung guard energy (MeV)
+  void setElectronRangeRejectionBremsstrahlungGuardEnergy( const double energy );
+
+  //! Return the electron range rejection bremsstrahlung guard energy (MeV)
+  double getElectronRangeRejectionBremsstrahlungGuardEnergy() const;
+
 private:
 
   // Save the state to an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the state from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
@@ -260,12 +299,55 @@ private:
 
   // The roulette survival weight
   double d_survival_weight;
+
+  // The condensed history mode (true = on, false = off - default)
+  bool d_condensed_history_mode_on;
+
+  // The max fractional energy loss of a condensed history step
+  double d_condensed_history_max_energy_loss_fraction;
+
+  // The electron range rejection mode (true = on, false = off - default)
+  bool d_range_rejection_mode_on;
+
+  // The electron range rejection bremsstrahlung guard energy (MeV)
+  double d_range_rejection_bremsstrahlung_guard_energy;
 };
 
-// Save/load the state to an archive
+// Save the state to an archive
+template<typename Archive>
+void SimulationElectronProperties::save( Archive& ar,
+                                         const unsigned version ) const
+{
+  ar & BOOST_SERIALIZATION_NVP( d_min_electron_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_max_electron_energy );
+  ar & BOOST_SERIALIZATION_NVP( d_evaluation_tol );
+  ar & BOOST_SERIALIZATION_NVP( d_electron_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_electron_grid_type );
+  ar & BOOST_SERIALIZATION_NVP( d_num_electron_hash_grid_bins );
+  ar & BOOST_SERIALIZATION_NVP( d_atomic_relaxation_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_distribution_mode );
+  ar & BOOST_SERIALIZATION_NVP( d_coupled_elastic_sampling_method );
+  ar & BOOST_SERIALIZATION_NVP( d_elastic_cutoff_angle_cosine );
+  ar & BOOST_SERIALIZATION_NVP( d_electroionization_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_electroionization_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_electroionization_sampling_mode );
+  ar & BOOST_SERIALIZATION_NVP( d_bremsstrahlung_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_bremsstrahlung_interpolation_type );
+  ar & BOOST_SERIALIZATION_NVP( d_bremsstrahlung_angular_distribution_function );
+  ar & BOOST_SERIALIZATION_NVP( d_atomic_excitation_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
+  ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+  ar & BOOST_SERIALIZATION_NVP( d_condensed_history_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_energy_loss_fraction );
+  ar & BOOST_SERIALIZATION_NVP( d_range_rejection_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_range_rejection_bremsstrahlung_guard_energy );
+}
+
+// Load the state from an archive
 template<typename Archive>
-void SimulationElectronProperties::serialize( Archive& ar,
-                                              const unsigned version )
+void SimulationElectronProperties::load( Archive& ar, const unsigned version )
 {
   ar & BOOST_SERIALIZATION_NVP( d_min_electron_energy );
   ar & BOOST_SERIALIZATION_NVP( d_max_electron_energy );
@@ -288,13 +370,36 @@ void SimulationElectronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_atomic_excitation_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_energy_loss_fraction );
+  }
+  else
+  {
+    d_condensed_history_mode_on = false;
+    d_condensed_history_max_energy_loss_fraction = 0.05;
+  }
+
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_range_rejection_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_range_rejection_bremsstrahlung_guard_energy );
+  }
+  else
+  {
+    d_range_rejection_mode_on = false;
+    d_range_rejection_bremsstrahlung_guard_energy =
+      std::numeric_limits<double>::infinity();
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 2 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationElectronProperties, "SimulationElectronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationElectronProperties );
 
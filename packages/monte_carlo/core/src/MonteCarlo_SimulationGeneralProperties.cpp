@@ -26,7 +26,16 @@ SimulationGeneralProperties::SimulationGeneralProperties()
     d_number_of_batches_per_processor( 1 ),
     d_number_of_snapshots_per_batch( 1 ),
     d_wall_time( Utility::QuantityTraits<double>::inf() ),
-    d_implicit_capture_mode_on( false )
+    d_implicit_capture_mode_on( false ),
+    d_event_based_transport_mode_on( false ),
+    d_unionized_energy_grid_mode_on( false ),
+    d_unionized_energy_grid_thinning_tol( 0.0 ),
+    d_history_schedule_type( STATIC_HISTORY_SCHEDULE ),
+    d_history_schedule_chunk_size( 0 ),
+    d_root_process_transport_mode_on( false ),
+    d_node_shared_memory_data_mode_on( false ),
+    d_event_based_history_batch_size( 16 ),
+    d_thread_private_estimator_moments_mode_on( false )
 { /* ... */ }
 
 // Set the particle mode
@@ -201,6 +210,221 @@ bool SimulationGeneralProperties::isImplicitCaptureModeOn() const
   return d_implicit_capture_mode_on;
 }
 
+// Set event-based transport mode to on (off by default)
+/*! \details In event-based transport mode the particles of each history are
+ * transported one generation at a time. Each stage of the particle tracks
+ * (cross section lookup, distance to collision, surface crossing, collision)
+ * is processed for every particle in the generation before the next stage
+ * is started.
+ */
+void SimulationGeneralProperties::setEventBasedTransportModeOn()
+{
+  d_event_based_transport_mode_on = true;
+}
+
+// Set history-based transport mode to on (on by default)
+void SimulationGeneralProperties::setHistoryBasedTransportModeOn()
+{
+  d_event_based_transport_mode_on = false;
+}
+
+// Return if event-based transport mode has been set
+bool SimulationGeneralProperties::isEventBasedTransportModeOn() const
+{
+  return d_event_based_transport_mode_on;
+}
+
+// Set the number of histories in each event-based track batch
+/*! \details In event-based transport mode each thread will transport the
+ * particles of this many histories together. Larger batches keep more
+ * tracks in each stage but every observer will need a history buffer for
+ * each history in the batch. The random number stream used by a batch
+ * depends on the batch size.
+ */
+void SimulationGeneralProperties::setEventBasedHistoryBatchSize(
+                                                   const unsigned batch_size )
+{
+  TEST_FOR_EXCEPTION( batch_size == 0,
+                      std::runtime_error,
+                      "The event-based history batch size must be greater "
+                      "than 0!" );
+
+  d_event_based_history_batch_size = batch_size;
+}
+
+// Return the number of histories in each event-based track batch
+unsigned SimulationGeneralProperties::getEventBasedHistoryBatchSize() const
+{
+  return d_event_based_history_batch_size;
+}
+
+// Set unionized energy grid mode to on (off by default)
+/*! \details When unionized energy grid mode is on each material will
+ * tabulate its macroscopic total and absorption cross sections (and the
+ * cumulative scattering center cross sections used to sample a collision
+ * scattering center) on a single energy grid. This trades memory for fewer
+ * grid searches and cross section evaluations per lookup.
+ */
+void SimulationGeneralProperties::setUnionizedEnergyGridModeOn()
+{
+  d_unionized_energy_grid_mode_on = true;
+}
+
+// Set unionized energy grid mode to off (off by default)
+void SimulationGeneralProperties::setUnionizedEnergyGridModeOff()
+{
+  d_unionized_energy_grid_mode_on = false;
+}
+
+// Return if unionized energy grid mode has been set
+bool SimulationGeneralProperties::isUnionizedEnergyGridModeOn() const
+{
+  return d_unionized_energy_grid_mode_on;
+}
+
+// Set the unionized energy grid thinning tolerance (0.0 by default)
+/*! \details The unionized energy grid is the union of the scattering center
+ * energy grids, refined until linear interpolation reproduces the scattering
+ * center cross sections. When the tolerance is greater than 0.0, grid points
+ * at which the macroscopic total and absorption cross sections can be
+ * linearly interpolated from the neighboring points to within the tolerance
+ * will be removed. A tolerance of 0.0 keeps every grid point.
+ */
+void SimulationGeneralProperties::setUnionizedEnergyGridThinningTolerance(
+                                                       const double tolerance )
+{
+  // Make sure that the tolerance is valid
+  TEST_FOR_EXCEPTION( tolerance < 0.0,
+                      std::runtime_error,
+                      "The unionized energy grid thinning tolerance must "
+                      "be greater than or equal to 0.0!" );
+  TEST_FOR_EXCEPTION( tolerance >= 1.0,
+                      std::runtime_error,
+                      "The unionized energy grid thinning tolerance must "
+                      "be less than 1.0!" );
+
+  d_unionized_energy_grid_thinning_tol = tolerance;
+}
+
+// Return the unionized energy grid thinning tolerance
+double SimulationGeneralProperties::getUnionizedEnergyGridThinningTolerance() const
+{
+  return d_unionized_energy_grid_thinning_tol;
+}
+
+// Set the history schedule type (static by default)
+/*! \details The history schedule type determines how the histories of a
+ * batch are distributed between the threads. Static scheduling has the lowest
+ * overhead but threads can sit idle at the end of a batch when the cost of
+ * the histories varies. Dynamic and guided scheduling hand out histories on
+ * demand. The random number stream of each history is independent of the
+ * schedule.
+ */
+void SimulationGeneralProperties::setHistoryScheduleType(
+                                              const HistoryScheduleType type )
+{
+  d_history_schedule_type = type;
+}
+
+// Return the history schedule type
+HistoryScheduleType SimulationGeneralProperties::getHistoryScheduleType() const
+{
+  return d_history_schedule_type;
+}
+
+// Set the history schedule chunk size (0 = implementation default)
+/*! \details The chunk size is the number of consecutive histories that will
+ * be handed out to a thread at a time (the minimum number for guided
+ * scheduling).
+ */
+void SimulationGeneralProperties::setHistoryScheduleChunkSize(
+                                                   const unsigned chunk_size )
+{
+  d_history_schedule_chunk_size = chunk_size;
+}
+
+// Return the history schedule chunk size
+unsigned SimulationGeneralProperties::getHistoryScheduleChunkSize() const
+{
+  return d_history_schedule_chunk_size;
+}
+
+// Set root process transport mode to on (off by default)
+/*! \details When root process transport mode is on the root process of a
+ * batched distributed simulation will simulate batches of histories in
+ * addition to handing out batches to the worker processes. The work requests
+ * from the worker processes will be serviced by the master thread of the
+ * root process after each of its histories. Because these MPI calls are made
+ * inside of the parallel region, MPI must provide at least funneled thread
+ * support when more than one thread is used.
+ */
+void SimulationGeneralProperties::setRootProcessTransportModeOn()
+{
+  d_root_process_transport_mode_on = true;
+}
+
+// Set root process transport mode to off (off by default)
+void SimulationGeneralProperties::setRootProcessTransportModeOff()
+{
+  d_root_process_transport_mode_on = false;
+}
+
+// Return if root process transport mode has been set
+bool SimulationGeneralProperties::isRootProcessTransportModeOn() const
+{
+  return d_root_process_transport_mode_on;
+}
+
+// Set node shared memory data mode to on (off by default)
+/*! \details When this mode is on, the processes on a node will share a
+ * single copy of the raw nuclear data tables (e.g. the ACE XSS arrays). The
+ * tables will only be read by one process on each node and the neutron
+ * reaction cross sections will be views of the shared tables instead of
+ * copies. The shared tables are released by
+ * Utility::Communicator::freeSharedMemory (or when MPI is finalized).
+ */
+void SimulationGeneralProperties::setNodeSharedMemoryDataModeOn()
+{
+  d_node_shared_memory_data_mode_on = true;
+}
+
+// Set node shared memory data mode to off (off by default)
+void SimulationGeneralProperties::setNodeSharedMemoryDataModeOff()
+{
+  d_node_shared_memory_data_mode_on = false;
+}
+
+// Return if node shared memory data mode has been set
+bool SimulationGeneralProperties::isNodeSharedMemoryDataModeOn() const
+{
+  return d_node_shared_memory_data_mode_on;
+}
+
+// Set thread private estimator moments mode to on (off by default)
+/*! \details When thread private estimator moments mode is on each worker
+ * thread will commit its history contributions to its own copy of the
+ * estimator moments. The thread private moments are merged into the shared
+ * moments (without locking) whenever the estimator data is needed (e.g.
+ * snapshots, reductions, archiving). This trades memory for less contention
+ * on the shared moments when running with many threads.
+ */
+void SimulationGeneralProperties::setThreadPrivateEstimatorMomentsModeOn()
+{
+  d_thread_private_estimator_moments_mode_on = true;
+}
+
+// Set thread private estimator moments mode to off (off by default)
+void SimulationGeneralProperties::setThreadPrivateEstimatorMomentsModeOff()
+{
+  d_thread_private_estimator_moments_mode_on = false;
+}
+
+// Return if thread private estimator moments mode has been set
+bool SimulationGeneralProperties::isThreadPrivateEstimatorMomentsModeOn() const
+{
+  return d_thread_private_estimator_moments_mode_on;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationGeneralProperties );
 
 } // end MonteCarlo namespace
@@ -17,6 +17,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleModeType.hpp"
+#include "MonteCarlo_HistoryScheduleType.hpp"
 #include "Utility_QuantityTraits.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 
@@ -101,6 +102,75 @@ public:
   //! Return if implicit capture mode has been set
   bool isImplicitCaptureModeOn() const;
 
+  //! Set event-based transport mode to on (off by default)
+  void setEventBasedTransportModeOn();
+
+  //! Set history-based transport mode to on (on by default)
+  void setHistoryBasedTransportModeOn();
+
+  //! Return if event-based transport mode has been set
+  bool isEventBasedTransportModeOn() const;
+
+  //! Set the number of histories in each event-based track batch
+  void setEventBasedHistoryBatchSize( const unsigned batch_size );
+
+  //! Return the number of histories in each event-based track batch
+  unsigned getEventBasedHistoryBatchSize() const;
+
+  //! Set unionized energy grid mode to on (off by default)
+  void setUnionizedEnergyGridModeOn();
+
+  //! Set unionized energy grid mode to off (off by default)
+  void setUnionizedEnergyGridModeOff();
+
+  //! Return if unionized energy grid mode has been set
+  bool isUnionizedEnergyGridModeOn() const;
+
+  //! Set the unionized energy grid thinning tolerance (0.0 by default)
+  void setUnionizedEnergyGridThinningTolerance( const double tolerance );
+
+  //! Return the unionized energy grid thinning tolerance
+  double getUnionizedEnergyGridThinningTolerance() const;
+
+  //! Set the history schedule type (static by default)
+  void setHistoryScheduleType( const HistoryScheduleType type );
+
+  //! Return the history schedule type
+  HistoryScheduleType getHistoryScheduleType() const;
+
+  //! Set the history schedule chunk size (0 = implementation default)
+  void setHistoryScheduleChunkSize( const unsigned chunk_size );
+
+  //! Return the history schedule chunk size
+  unsigned getHistoryScheduleChunkSize() const;
+
+  //! Set root process transport mode to on (off by default)
+  void setRootProcessTransportModeOn();
+
+  //! Set root process transport mode to off (off by default)
+  void setRootProcessTransportModeOff();
+
+  //! Return if root process transport mode has been set
+  bool isRootProcessTransportModeOn() const;
+
+  //! Set node shared memory data mode to on (off by default)
+  void setNodeSharedMemoryDataModeOn();
+
+  //! Set node shared memory data mode to off (off by default)
+  void setNodeSharedMemoryDataModeOff();
+
+  //! Return if node shared memory data mode has been set
+  bool isNodeSharedMemoryDataModeOn() const;
+
+  //! Set thread private estimator moments mode to on (off by default)
+  void setThreadPrivateEstimatorMomentsModeOn();
+
+  //! Set thread private estimator moments mode to off (off by default)
+  void setThreadPrivateEstimatorMomentsModeOff();
+
+  //! Return if thread private estimator moments mode has been set
+  bool isThreadPrivateEstimatorMomentsModeOn() const;
+
 private:
 
   // Save the state to an archive
@@ -145,6 +215,33 @@ private:
 
   // The capture mode (true = implicit, false = analogue - default)
   bool d_implicit_capture_mode_on;
+
+  // The transport mode (true = event-based, false = history-based - default)
+  bool d_event_based_transport_mode_on;
+
+  // The unionized energy grid mode (true = on, false = off - default)
+  bool d_unionized_energy_grid_mode_on;
+
+  // The unionized energy grid thinning tolerance
+  double d_unionized_energy_grid_thinning_tol;
+
+  // The history schedule type
+  HistoryScheduleType d_history_schedule_type;
+
+  // The history schedule chunk size
+  unsigned d_history_schedule_chunk_size;
+
+  // The root process transport mode
+  bool d_root_process_transport_mode_on;
+
+  // The node shared memory data mode
+  bool d_node_shared_memory_data_mode_on;
+
+  // The number of histories in each event-based track batch
+  unsigned d_event_based_history_batch_size;
+
+  // The thread private estimator moments mode
+  bool d_thread_private_estimator_moments_mode_on;
 };
 
 // Save the state to an archive
@@ -179,6 +276,15 @@ void SimulationGeneralProperties::save( Archive& ar, const unsigned version ) co
   }
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_thinning_tol );
+  ar & BOOST_SERIALIZATION_NVP( d_history_schedule_type );
+  ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+  ar & BOOST_SERIALIZATION_NVP( d_root_process_transport_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_node_shared_memory_data_mode_on );
+  ar & BOOST_SERIALIZATION_NVP( d_event_based_history_batch_size );
+  ar & BOOST_SERIALIZATION_NVP( d_thread_private_estimator_moments_mode_on );
 }
 
 // Load the state to an archive
@@ -203,13 +309,60 @@ void SimulationGeneralProperties::load( Archive& ar, const unsigned version )
     d_wall_time = Utility::QuantityTraits<double>::inf();
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+  else
+    d_event_based_transport_mode_on = false;
+
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_thinning_tol );
+  }
+  else
+  {
+    d_unionized_energy_grid_mode_on = false;
+    d_unionized_energy_grid_thinning_tol = 0.0;
+  }
+
+  if( version > 2 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_type );
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+  }
+  else
+  {
+    d_history_schedule_type = STATIC_HISTORY_SCHEDULE;
+    d_history_schedule_chunk_size = 0;
+  }
+
+  if( version > 3 )
+    ar & BOOST_SERIALIZATION_NVP( d_root_process_transport_mode_on );
+  else
+    d_root_process_transport_mode_on = false;
+
+  if( version > 4 )
+    ar & BOOST_SERIALIZATION_NVP( d_node_shared_memory_data_mode_on );
+  else
+    d_node_shared_memory_data_mode_on = false;
+
+  if( version > 5 )
+    ar & BOOST_SERIALIZATION_NVP( d_event_based_history_batch_size );
+  else
+    d_event_based_history_batch_size = 16;
+
+  if( version > 6 )
+    ar & BOOST_SERIALIZATION_NVP( d_thread_private_estimator_moments_mode_on );
+  else
+    d_thread_private_estimator_moments_mode_on = false;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 7 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationGeneralProperties, "SimulationGeneralProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationGeneralProperties );
 
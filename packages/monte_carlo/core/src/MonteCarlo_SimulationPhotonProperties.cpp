@@ -35,6 +35,7 @@ SimulationPhotonProperties::SimulationPhotonProperties()
     d_atomic_relaxation_mode_on( true ),
     d_detailed_pair_production_mode_on( false ),
     d_photonuclear_interaction_mode_on( false ),
+    d_thick_target_bremsstrahlung_mode_on( false ),
     d_threshold_weight( 0.0 ),
     d_survival_weight()
 { /* ... */ }
@@ -210,6 +211,33 @@ bool SimulationPhotonProperties::isPhotonuclearInteractionModeOn() const
   return d_photonuclear_interaction_mode_on;
 }
 
+// Set thick-target bremsstrahlung mode to off (off by default)
+void SimulationPhotonProperties::setThickTargetBremsstrahlungModeOff()
+{
+  d_thick_target_bremsstrahlung_mode_on = false;
+}
+
+// Set thick-target bremsstrahlung mode to on (off by default)
+/*! \details When thick-target bremsstrahlung (TTB) mode is on, the secondary
+ * electrons created by photon interactions will not be transported in
+ * particle modes that do not include electrons (e.g. PHOTON_MODE). Instead,
+ * the bremsstrahlung photons that the electron would emit while slowing down
+ * will be sampled immediately from the thick-target yield of the material
+ * that the electron was created in and the remaining electron energy will
+ * be deposited locally. This mode is ignored in particle modes that include
+ * electrons.
+ */
+void SimulationPhotonProperties::setThickTargetBremsstrahlungModeOn()
+{
+  d_thick_target_bremsstrahlung_mode_on = true;
+}
+
+// Return if thick-target bremsstrahlung mode is on
+bool SimulationPhotonProperties::isThickTargetBremsstrahlungModeOn() const
+{
+  return d_thick_target_bremsstrahlung_mode_on;
+}
+
 // Set the cutoff roulette threshold weight
 void SimulationPhotonProperties::setPhotonRouletteThresholdWeight(
       const double threshold_weight )
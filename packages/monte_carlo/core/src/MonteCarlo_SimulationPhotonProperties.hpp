@@ -104,6 +104,15 @@ public:
   //! Return if photonuclear interaction mode is on
   bool isPhotonuclearInteractionModeOn() const;
 
+  //! Set thick-target bremsstrahlung mode to off (off by default)
+  void setThickTargetBremsstrahlungModeOff();
+
+  //! Set thick-target bremsstrahlung mode to on (off by default)
+  void setThickTargetBremsstrahlungModeOn();
+
+  //! Return if thick-target bremsstrahlung mode is on
+  bool isThickTargetBremsstrahlungModeOn() const;
+
   //! Set the cutoff roulette threshold weight
   void setPhotonRouletteThresholdWeight( const double threshold_weight );
 
@@ -158,6 +167,9 @@ private:
   // The photonuclear interaction mode (true = on, false = off - default)
   bool d_photonuclear_interaction_mode_on;
 
+  // The thick-target bremsstrahlung mode (true = on, false = off - default)
+  bool d_thick_target_bremsstrahlung_mode_on;
+
   // The roulette threshold weight
   double d_threshold_weight;
 
@@ -180,13 +192,18 @@ void SimulationPhotonProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_photonuclear_interaction_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_thick_target_bremsstrahlung_mode_on );
+  else
+    d_thick_target_bremsstrahlung_mode_on = false;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationPhotonProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationPhotonProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationPhotonProperties, "SimulationPhotonProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationPhotonProperties );
 
@@ -15,6 +15,7 @@
 #include "MonteCarlo_AdjointPhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
 #include "MonteCarlo_AdjointElectronState.hpp"
+#include "MonteCarlo_PositronState.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
@@ -62,6 +63,13 @@ inline double SimulationProperties::getMinParticleEnergy<AdjointElectronState>()
   return this->getMinAdjointElectronEnergy();
 }
 
+//! Return the min positron energy (same as the min electron energy)
+template<>
+inline double SimulationProperties::getMinParticleEnergy<PositronState>() const
+{
+  return this->getMinElectronEnergy();
+}
+
 // Return the max particle energy
 template<typename ParticleType>
 double SimulationProperties::getMaxParticleEnergy() const
@@ -105,6 +113,13 @@ inline double SimulationProperties::getMaxParticleEnergy<AdjointElectronState>()
   return this->getMaxAdjointElectronEnergy();
 }
 
+//! Return the max positron energy (same as the max electron energy)
+template<>
+inline double SimulationProperties::getMaxParticleEnergy<PositronState>() const
+{
+  return this->getMaxElectronEnergy();
+}
+
 // Return the cutoff roulette threshold weight
 template<typename ParticleType>
 double SimulationProperties::getRouletteThresholdWeight() const
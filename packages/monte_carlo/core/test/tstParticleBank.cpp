@@ -248,6 +248,144 @@ FRENSIE_UNIT_TEST( ParticleBank, pop_store )
   FRENSIE_CHECK_EQUAL( bank.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the top particle can be moved out of the bank without a copy
+FRENSIE_UNIT_TEST( ParticleBank, pop_store_no_copy )
+{
+  MonteCarlo::ParticleBank bank;
+
+  std::shared_ptr<MonteCarlo::ParticleState>
+    particle( new MonteCarlo::PhotonState( 0ull ) );
+
+  const MonteCarlo::ParticleState* raw_particle = particle.get();
+
+  bank.push( particle );
+
+  FRENSIE_CHECK( !particle );
+  FRENSIE_CHECK_EQUAL( &bank.top(), raw_particle );
+
+  bank.pop( particle );
+
+  FRENSIE_CHECK_EQUAL( particle.get(), raw_particle );
+  FRENSIE_CHECK_EQUAL( particle.use_count(), 1 );
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the bank can be reused after particles have been popped
+FRENSIE_UNIT_TEST( ParticleBank, pop_reuse )
+{
+  MonteCarlo::ParticleBank bank;
+
+  for( uint64_t i = 0; i < 100; ++i )
+  {
+    MonteCarlo::PhotonState particle( i );
+
+    bank.push( particle );
+  }
+
+  for( uint64_t i = 0; i < 70; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), i );
+
+    bank.pop();
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 30 );
+
+  for( uint64_t i = 100; i < 110; ++i )
+  {
+    MonteCarlo::PhotonState particle( i );
+
+    bank.push( particle );
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 40 );
+
+  for( uint64_t i = 70; i < 110; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), i );
+
+    bank.pop();
+  }
+
+  FRENSIE_CHECK( bank.isEmpty() );
+
+  {
+    MonteCarlo::PhotonState particle( 110ull );
+
+    bank.push( particle );
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 110ull );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the memory of popped particles (and their navigators) is reused
+FRENSIE_UNIT_TEST( ParticleBank, pop_recycle )
+{
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::ElectronState particle( 0ull );
+
+  bank.push( particle );
+
+  const MonteCarlo::ParticleState* first_particle = &bank.top();
+  const Geometry::Navigator* first_navigator = &bank.top().navigator();
+
+  bank.pop();
+
+  // The most recently released memory is reused first
+  bank.push( particle );
+
+  FRENSIE_CHECK_EQUAL( &bank.top(), first_particle );
+  FRENSIE_CHECK_EQUAL( &bank.top().navigator(), first_navigator );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0 );
+
+  bank.pop();
+
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the particles in the bank can be released
+FRENSIE_UNIT_TEST( ParticleBank, release )
+{
+  MonteCarlo::ParticleBank bank;
+
+  std::vector<std::shared_ptr<MonteCarlo::ParticleState> > particles;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleState> particle;
+
+    particle.reset( new MonteCarlo::PhotonState( 0ull ) );
+
+    particles.push_back( particle );
+
+    particle.reset( new MonteCarlo::NeutronState( 1ull ) );
+
+    bank.push( particle );
+
+    particle.reset( new MonteCarlo::ElectronState( 2ull ) );
+
+    bank.push( particle );
+  }
+
+  const MonteCarlo::ParticleState* top_particle = &bank.top();
+
+  bank.release( particles );
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_REQUIRE_EQUAL( particles.size(), 3 );
+  FRENSIE_CHECK_EQUAL( particles[0]->getHistoryNumber(), 0ull );
+  FRENSIE_CHECK_EQUAL( particles[1]->getHistoryNumber(), 1ull );
+  FRENSIE_CHECK_EQUAL( particles[1]->getParticleType(), MonteCarlo::NEUTRON );
+  FRENSIE_CHECK( particles[1].get() == top_particle );
+  FRENSIE_CHECK_EQUAL( particles[2]->getHistoryNumber(), 2ull );
+  FRENSIE_CHECK_EQUAL( particles[2]->getParticleType(), MonteCarlo::ELECTRON );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the bank can be sorted
 FRENSIE_UNIT_TEST( ParticleBank, sort )
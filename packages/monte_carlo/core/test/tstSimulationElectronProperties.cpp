@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <limits>
 
 // FRENSIE Includes
 #include "MonteCarlo_SimulationElectronProperties.hpp"
@@ -53,6 +54,12 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(),
+                       0.05 );
+  FRENSIE_CHECK( !properties.isElectronRangeRejectionModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getElectronRangeRejectionBremsstrahlungGuardEnergy(),
+                       std::numeric_limits<double>::infinity() );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteSurvivalWeight(), 1e-30 );
 }
@@ -352,6 +359,64 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, setAtomicExcitationModeOffOn )
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that condensed history mode can be turned on
+FRENSIE_UNIT_TEST( SimulationElectronProperties, setCondensedHistoryModeOnOff )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryModeOn();
+
+  FRENSIE_CHECK( properties.isCondensedHistoryModeOn() );
+
+  properties.setCondensedHistoryModeOff();
+
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the condensed history max energy loss fraction can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setCondensedHistoryMaxEnergyLossFraction )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryMaxEnergyLossFraction( 0.1 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(),
+                       0.1 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that electron range rejection mode can be turned on
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setElectronRangeRejectionModeOnOff )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setElectronRangeRejectionModeOn();
+
+  FRENSIE_CHECK( properties.isElectronRangeRejectionModeOn() );
+
+  properties.setElectronRangeRejectionModeOff();
+
+  FRENSIE_CHECK( !properties.isElectronRangeRejectionModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the electron range rejection bremsstrahlung guard energy can be
+// set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setElectronRangeRejectionBremsstrahlungGuardEnergy )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setElectronRangeRejectionBremsstrahlungGuardEnergy( 1.0 );
+
+  FRENSIE_CHECK_EQUAL( properties.getElectronRangeRejectionBremsstrahlungGuardEnergy(),
+                       1.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the critical line energies can be set
 FRENSIE_UNIT_TEST( SimulationElectronProperties,
@@ -420,6 +485,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
     custom_properties.setBremsstrahlungModeOff();
     custom_properties.setBremsstrahlungAngularDistributionFunction( MonteCarlo::DIPOLE_DISTRIBUTION );
     custom_properties.setAtomicExcitationModeOff();
+    custom_properties.setCondensedHistoryModeOn();
+    custom_properties.setCondensedHistoryMaxEnergyLossFraction( 0.1 );
+    custom_properties.setElectronRangeRejectionModeOn();
+    custom_properties.setElectronRangeRejectionBremsstrahlungGuardEnergy( 1.0 );
     custom_properties.setElectronRouletteThresholdWeight( 1e-15 );
     custom_properties.setElectronRouletteSurvivalWeight( 1e-13 );
 
@@ -460,6 +529,12 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
   FRENSIE_CHECK( default_properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( !default_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryMaxEnergyLossFraction(),
+                       0.05 );
+  FRENSIE_CHECK( !default_properties.isElectronRangeRejectionModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getElectronRangeRejectionBremsstrahlungGuardEnergy(),
+                       std::numeric_limits<double>::infinity() );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteSurvivalWeight(), 1e-30  );
 
@@ -488,6 +563,12 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::DIPOLE_DISTRIBUTION );
   FRENSIE_CHECK( !custom_properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( custom_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryMaxEnergyLossFraction(),
+                       0.1 );
+  FRENSIE_CHECK( custom_properties.isElectronRangeRejectionModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getElectronRangeRejectionBremsstrahlungGuardEnergy(),
+                       1.0 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteSurvivalWeight(), 1e-13 );
 }
@@ -41,6 +41,17 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getEventBasedHistoryBatchSize(), 16 );
+  FRENSIE_CHECK( !properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridThinningTolerance(),
+                       0.0 );
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 0 );
+  FRENSIE_CHECK( !properties.isRootProcessTransportModeOn() );
+  FRENSIE_CHECK( !properties.isNodeSharedMemoryDataModeOn() );
+  FRENSIE_CHECK( !properties.isThreadPrivateEstimatorMomentsModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -193,6 +204,149 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that event-based transport mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setEventBasedTransportModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setEventBasedTransportModeOn();
+
+  FRENSIE_CHECK( properties.isEventBasedTransportModeOn() );
+
+  properties.setHistoryBasedTransportModeOn();
+
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the event-based history batch size can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setEventBasedHistoryBatchSize )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setEventBasedHistoryBatchSize( 100 );
+
+  FRENSIE_CHECK_EQUAL( properties.getEventBasedHistoryBatchSize(), 100 );
+
+  FRENSIE_CHECK_THROW( properties.setEventBasedHistoryBatchSize( 0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that unionized energy grid mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setUnionizedEnergyGridModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setUnionizedEnergyGridModeOn();
+
+  FRENSIE_CHECK( properties.isUnionizedEnergyGridModeOn() );
+
+  properties.setUnionizedEnergyGridModeOff();
+
+  FRENSIE_CHECK( !properties.isUnionizedEnergyGridModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the unionized energy grid thinning tolerance can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setUnionizedEnergyGridThinningTolerance )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setUnionizedEnergyGridThinningTolerance( 1e-4 );
+
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridThinningTolerance(),
+                       1e-4 );
+
+  properties.setUnionizedEnergyGridThinningTolerance( 0.0 );
+
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridThinningTolerance(),
+                       0.0 );
+
+  FRENSIE_CHECK_THROW( properties.setUnionizedEnergyGridThinningTolerance( -1e-4 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( properties.setUnionizedEnergyGridThinningTolerance( 1.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule type can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistoryScheduleType )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryScheduleType( MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  properties.setHistoryScheduleType( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule chunk size can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistoryScheduleChunkSize )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryScheduleChunkSize( 10 );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 10 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that root process transport mode can be turned on and off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setRootProcessTransportModeOn )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setRootProcessTransportModeOn();
+
+  FRENSIE_CHECK( properties.isRootProcessTransportModeOn() );
+
+  properties.setRootProcessTransportModeOff();
+
+  FRENSIE_CHECK( !properties.isRootProcessTransportModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that node shared memory data mode can be turned on and off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setNodeSharedMemoryDataModeOn )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setNodeSharedMemoryDataModeOn();
+
+  FRENSIE_CHECK( properties.isNodeSharedMemoryDataModeOn() );
+
+  properties.setNodeSharedMemoryDataModeOff();
+
+  FRENSIE_CHECK( !properties.isNodeSharedMemoryDataModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that thread private estimator moments mode can be turned on and off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setThreadPrivateEstimatorMomentsModeOn )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setThreadPrivateEstimatorMomentsModeOn();
+
+  FRENSIE_CHECK( properties.isThreadPrivateEstimatorMomentsModeOn() );
+
+  properties.setThreadPrivateEstimatorMomentsModeOff();
+
+  FRENSIE_CHECK( !properties.isThreadPrivateEstimatorMomentsModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
@@ -226,6 +380,15 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
     custom_properties.setNumberOfBatchesPerProcessor( 25 );
     custom_properties.setNumberOfSnapshotsPerBatch( 3 );
     custom_properties.setImplicitCaptureModeOn();
+    custom_properties.setEventBasedTransportModeOn();
+    custom_properties.setEventBasedHistoryBatchSize( 100 );
+    custom_properties.setUnionizedEnergyGridModeOn();
+    custom_properties.setUnionizedEnergyGridThinningTolerance( 1e-4 );
+    custom_properties.setHistoryScheduleType( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+    custom_properties.setHistoryScheduleChunkSize( 10 );
+    custom_properties.setRootProcessTransportModeOn();
+    custom_properties.setNodeSharedMemoryDataModeOn();
+    custom_properties.setThreadPrivateEstimatorMomentsModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -257,6 +420,18 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !default_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !default_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getEventBasedHistoryBatchSize(),
+                       16 );
+  FRENSIE_CHECK( !default_properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getUnionizedEnergyGridThinningTolerance(),
+                       0.0 );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistoryScheduleType(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistoryScheduleChunkSize(), 0 );
+  FRENSIE_CHECK( !default_properties.isRootProcessTransportModeOn() );
+  FRENSIE_CHECK( !default_properties.isNodeSharedMemoryDataModeOn() );
+  FRENSIE_CHECK( !default_properties.isThreadPrivateEstimatorMomentsModeOn() );
 
   MonteCarlo::SimulationGeneralProperties custom_properties;
 
@@ -275,6 +450,18 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfBatchesPerProcessor(), 25 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfSnapshotsPerBatch(), 3 );
   FRENSIE_CHECK( custom_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( custom_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getEventBasedHistoryBatchSize(),
+                       100 );
+  FRENSIE_CHECK( custom_properties.isUnionizedEnergyGridModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getUnionizedEnergyGridThinningTolerance(),
+                       1e-4 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistoryScheduleType(),
+                       MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistoryScheduleChunkSize(), 10 );
+  FRENSIE_CHECK( custom_properties.isRootProcessTransportModeOn() );
+  FRENSIE_CHECK( custom_properties.isNodeSharedMemoryDataModeOn() );
+  FRENSIE_CHECK( custom_properties.isThreadPrivateEstimatorMomentsModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -39,6 +39,7 @@ FRENSIE_UNIT_TEST( SimulationPhotonProperties, defaults )
   FRENSIE_CHECK( properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( !properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( !properties.isThickTargetBremsstrahlungModeOn() );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getPhotonRouletteSurvivalWeight(), 1e-30 );
 }
@@ -144,6 +145,21 @@ FRENSIE_UNIT_TEST( SimulationPhotonProperties, setPhotonuclearInteractionModeOnO
   FRENSIE_CHECK( !properties.isPhotonuclearInteractionModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the thick-target bremsstrahlung mode can be turned on
+FRENSIE_UNIT_TEST( SimulationPhotonProperties, setThickTargetBremsstrahlungModeOnOff )
+{
+  MonteCarlo::SimulationPhotonProperties properties;
+
+  properties.setThickTargetBremsstrahlungModeOn();
+
+  FRENSIE_CHECK( properties.isThickTargetBremsstrahlungModeOn() );
+
+  properties.setThickTargetBremsstrahlungModeOff();
+
+  FRENSIE_CHECK( !properties.isThickTargetBremsstrahlungModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the critical line energies can be set
 FRENSIE_UNIT_TEST( SimulationPhotonProperties,
@@ -205,6 +221,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
     custom_properties.setAtomicRelaxationModeOff();
     custom_properties.setDetailedPairProductionModeOn();
     custom_properties.setPhotonuclearInteractionModeOn();
+    custom_properties.setThickTargetBremsstrahlungModeOn();
     custom_properties.setPhotonRouletteThresholdWeight( 1e-15 );
     custom_properties.setPhotonRouletteSurvivalWeight( 1e-13 );
 
@@ -235,6 +252,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
   FRENSIE_CHECK( default_properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( !default_properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( !default_properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( !default_properties.isThickTargetBremsstrahlungModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getPhotonRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getPhotonRouletteSurvivalWeight(), 1e-30  );
 
@@ -253,6 +271,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationPhotonProperties,
   FRENSIE_CHECK( !custom_properties.isAtomicRelaxationModeOn() );
   FRENSIE_CHECK( custom_properties.isDetailedPairProductionModeOn() );
   FRENSIE_CHECK( custom_properties.isPhotonuclearInteractionModeOn() );
+  FRENSIE_CHECK( custom_properties.isThickTargetBremsstrahlungModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getPhotonRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getPhotonRouletteSurvivalWeight(), 1e-13 );
 }
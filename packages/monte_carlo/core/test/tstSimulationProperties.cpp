@@ -136,6 +136,16 @@ FRENSIE_UNIT_TEST( SimulationProperties, getMinParticleEnergy )
                        1e-4 );
   FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergy<MonteCarlo::AdjointElectronState>(),
                        1e-4 );
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergy<MonteCarlo::PositronState>(),
+                       1e-4 );
+
+  // The min positron energy follows the min electron energy
+  properties.setMinElectronEnergy( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergy<MonteCarlo::ElectronState>(),
+                       1e-3 );
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergy<MonteCarlo::PositronState>(),
+                       1e-3 );
 }
 
 //---------------------------------------------------------------------------//
@@ -154,6 +164,16 @@ FRENSIE_UNIT_TEST( SimulationProperties, getMaxParticleEnergy )
                        20.0 );
   FRENSIE_CHECK_EQUAL( properties.getMaxParticleEnergy<MonteCarlo::AdjointElectronState>(),
                        20.0 );
+  FRENSIE_CHECK_EQUAL( properties.getMaxParticleEnergy<MonteCarlo::PositronState>(),
+                       20.0 );
+
+  // The max positron energy follows the max electron energy
+  properties.setMaxElectronEnergy( 10.0 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMaxParticleEnergy<MonteCarlo::ElectronState>(),
+                       10.0 );
+  FRENSIE_CHECK_EQUAL( properties.getMaxParticleEnergy<MonteCarlo::PositronState>(),
+                       10.0 );
 }
 
 //---------------------------------------------------------------------------//
@@ -12,12 +12,23 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_DetailedObserverPhaseSpaceDiscretizationImpl.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
 
+// Constructor
+DetailedObserverPhaseSpaceDiscretizationImpl::DetailedObserverPhaseSpaceDiscretizationImpl()
+  : d_dimension_discretization_map(),
+    d_dimension_use_range_map(),
+    d_dimension_index_step_size_map(),
+    d_dimension_ordering(),
+    d_dimension_kernels(),
+    d_thread_work_buffers( 1 )
+{ /* ... */ }
+
 // Assign a discretization to a dimension
 void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimension(
         const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>&
@@ -38,19 +49,9 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
     // Add the dimension discretization
     d_dimension_discretization_map[dimension] = discretization;
 
-    // Set the dimension range method
+    // Set the dimension range flag
     d_dimension_use_range_map[dimension] = range_dimension;
 
-    d_dimension_range_method_map[dimension].first =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-                                                             *discretization,
-                                                             range_dimension );
-    
-    d_dimension_range_method_map[dimension].second =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-                                                             *discretization,
-                                                             range_dimension );
-
     // Calculate the index step size for the new dimension
     size_t dimension_index_step_size = 1;
 
@@ -64,6 +65,8 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
 
     // Add the dimension of the discretization to the dimension ordering array
     d_dimension_ordering.push_back( dimension );
+
+    this->compileDimensionKernels();
   }
   else
   {
@@ -74,6 +77,57 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
   }
 }
 
+// Enable support for multiple threads
+/*! \details Each thread gets its own work buffers, which will grow to the
+ * largest number of local bin indices encountered and then be reused for
+ * every subsequent bin index calculation.
+ */
+void DetailedObserverPhaseSpaceDiscretizationImpl::enableThreadSupport(
+                                                   const unsigned num_threads )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  
+  d_thread_work_buffers.resize( num_threads );
+}
+
+// Compile the dimension kernels
+/*! \details The dimension kernels store everything that is needed to
+ * calculate the local bin indices of a dimension and the contribution of
+ * those indices to the discretization bin index so that no map lookups need
+ * to be done during a bin index calculation.
+ */
+void DetailedObserverPhaseSpaceDiscretizationImpl::compileDimensionKernels()
+{
+  d_dimension_kernels.resize( d_dimension_ordering.size() );
+
+  for( size_t i = 0; i < d_dimension_ordering.size(); ++i )
+  {
+    const ObserverPhaseSpaceDimension dimension = d_dimension_ordering[i];
+    
+    DimensionKernel& dimension_kernel = d_dimension_kernels[i];
+
+    dimension_kernel.discretization =
+      d_dimension_discretization_map.find( dimension )->second.get();
+
+    dimension_kernel.index_step_size =
+      d_dimension_index_step_size_map.find( dimension )->second;
+
+    dimension_kernel.range_dimension =
+      d_dimension_use_range_map.find( dimension )->second;
+  }
+}
+
+// Get the work buffers of the calling thread
+auto DetailedObserverPhaseSpaceDiscretizationImpl::getThreadWorkBuffers() const -> ThreadWorkBuffers&
+{
+  // Make sure that thread support has been enabled for the calling thread
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_work_buffers.size() );
+
+  return d_thread_work_buffers[Utility::OpenMPProperties::getThreadId()];
+}
+
 // Get a dimension discretization
 const ObserverPhaseSpaceDimensionDiscretization&
 DetailedObserverPhaseSpaceDiscretizationImpl::getDimensionDiscretization(
@@ -260,15 +314,33 @@ bool DetailedObserverPhaseSpaceDiscretizationImpl::isValueInDimensionDiscretizat
 bool DetailedObserverPhaseSpaceDiscretizationImpl::doesRangeIntersectDiscretization(
              const ObserverParticleStateWrapper& particle_state_wrapper ) const
 {
-  for( auto dimension_range_method : d_dimension_range_method_map )
+  for( size_t i = 0; i < d_dimension_kernels.size(); ++i )
   {
-    if( !dimension_range_method.second.first( particle_state_wrapper ) )
+    if( !DetailedObserverPhaseSpaceDiscretizationImpl::doesRangeIntersectDimensionDiscretization(
+                           d_dimension_kernels[i], particle_state_wrapper ) )
       return false;
   }
 
   return true;
 }
 
+// Check if the range intersects the dimension discretization
+bool DetailedObserverPhaseSpaceDiscretizationImpl::doesRangeIntersectDimensionDiscretization(
+                    const DimensionKernel& dimension_kernel,
+                    const ObserverParticleStateWrapper& particle_state_wrapper )
+{
+  if( dimension_kernel.range_dimension )
+  {
+    return dimension_kernel.discretization->doesRangeIntersectDiscretization(
+                                                      particle_state_wrapper );
+  }
+  else
+  {
+    return dimension_kernel.discretization->isValueInDiscretization(
+                                                      particle_state_wrapper );
+  }
+}
+
 // Calculate the bin indices of a point
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPoint(
                                      const DimensionValueMap& dimension_values,
@@ -279,18 +351,15 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPoint(
 
 // Calculate the local bin indices of the value
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesOfValue(
-                                  const ObserverPhaseSpaceDimension dimension,
-                                  const DimensionValueMap& dimension_values,
-                                  BinIndexArray& local_bin_indices ) const
+     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
+     const DimensionValueMap& dimension_values,
+     BinIndexArray& local_bin_indices ) const
 {
   // Clear the local bin indices
   local_bin_indices.clear();
 
-  const ObserverPhaseSpaceDimensionDiscretization&
-    dimension_discretization = *d_dimension_discretization_map.find( dimension )->second;
-
   const DimensionValueMap::mapped_type& dimension_value =
-    dimension_values.find( dimension )->second;
+    dimension_values.find( dimension_discretization.getDimension() )->second;
 
   dimension_discretization.calculateBinIndicesOfValue( dimension_value,
                                                        local_bin_indices );
@@ -306,80 +375,99 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPoint(
 
 // Calculate the local bin indices of the value
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesOfValue(
-                   const ObserverPhaseSpaceDimension dimension,
-                   const ObserverParticleStateWrapper& particle_state_wrapper,
-                   BinIndexArray& local_bin_indices ) const
+     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
+     const ObserverParticleStateWrapper& particle_state_wrapper,
+     BinIndexArray& local_bin_indices ) const
 {
   // Clear the local bin indices
   local_bin_indices.clear();
 
-  d_dimension_discretization_map.find( dimension )->second->calculateBinIndicesOfValue( particle_state_wrapper, local_bin_indices );
+  dimension_discretization.calculateBinIndicesOfValue( particle_state_wrapper,
+                                                       local_bin_indices );
 }
 
 // Calculate the bin indices and weights of a range
+/*! \details The bin indices and weights of each dimension are combined with
+ * the bin indices and weights of the previous dimensions in place. No
+ * memory will be allocated once the bin indices and weights array and the
+ * thread work buffers have grown to the required size.
+ */
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesAndWeightsOfRange(
              const ObserverParticleStateWrapper& particle_state_wrapper,
              BinIndexWeightPairArray& bin_indices_and_weights ) const
 {
-  // Clear the bin indices array
+  BinIndexWeightPairArray& local_bin_indices_and_weights =
+    this->getThreadWorkBuffers().local_bin_indices_and_weights;
+  
+  // Initialize the bin indices array
   bin_indices_and_weights.resize( 1 );
   bin_indices_and_weights[0].first = 0;
   bin_indices_and_weights[0].second = 1.0;
 
-  BinIndexWeightPairArray previous_bin_indices_and_weights,
-    local_bin_indices_and_weights;
-
-  for( size_t i = 0; i < d_dimension_ordering.size(); ++i )
+  for( size_t k = 0; k < d_dimension_kernels.size(); ++k )
   {
-    const ObserverPhaseSpaceDimension dimension = d_dimension_ordering[i];
+    const DimensionKernel& dimension_kernel = d_dimension_kernels[k];
 
-    decltype(d_dimension_range_method_map)::const_iterator
-      dimension_range_method_it = d_dimension_range_method_map.find( dimension );
-    if( i != 0 )
-    {
-      dimension_range_method_it->second.second( particle_state_wrapper,
-                                                local_bin_indices_and_weights );
+    DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesAndWeightsOfRange(
+                                               dimension_kernel,
+                                               particle_state_wrapper,
+                                               local_bin_indices_and_weights );
 
-      const size_t dimension_index_step_size =
-        d_dimension_index_step_size_map.find( dimension )->second;
+    const size_t num_previous_bins = bin_indices_and_weights.size();
 
-      // Cache the current bin indices
-      previous_bin_indices_and_weights = bin_indices_and_weights;
+    // Calculate the number of bins that have been intersected
+    bin_indices_and_weights.resize( num_previous_bins*
+                                    local_bin_indices_and_weights.size() );
 
-      // Calculate the number of bins that have been intersected
-      bin_indices_and_weights.resize( previous_bin_indices_and_weights.size()*
-                                      local_bin_indices_and_weights.size() );
+    // Calculate the bin indices that have been intersected - the array is
+    // filled from the back so that the previous bin indices and weights
+    // (stored at the front) are not overwritten before they are used
+    for( size_t i = local_bin_indices_and_weights.size(); i-- > 0; )
+    {
+      const size_t local_bin_index_offset =
+        local_bin_indices_and_weights[i].first*
+        dimension_kernel.index_step_size;
+
+      const double local_weight = local_bin_indices_and_weights[i].second;
 
-      // Calculate the bin indices that have been intersected
-      for( size_t i = 0; i < local_bin_indices_and_weights.size(); ++i )
+      for( size_t j = num_previous_bins; j-- > 0; )
       {
-        for( size_t j = 0; j < previous_bin_indices_and_weights.size(); ++j )
-        {
-          BinIndexWeightPairArray::value_type& bin_index_and_weight =
-            bin_indices_and_weights[i*previous_bin_indices_and_weights.size()+j];
-          
-          bin_index_and_weight.first =
-            previous_bin_indices_and_weights[j].first +
-            local_bin_indices_and_weights[i].first*dimension_index_step_size;
-
-          bin_index_and_weight.second =
-            previous_bin_indices_and_weights[j].second*
-            local_bin_indices_and_weights[i].second;
-        }
+        BinIndexWeightPairArray::value_type& bin_index_and_weight =
+          bin_indices_and_weights[i*num_previous_bins+j];
+
+        bin_index_and_weight.first =
+          bin_indices_and_weights[j].first + local_bin_index_offset;
+
+        bin_index_and_weight.second =
+          bin_indices_and_weights[j].second*local_weight;
       }
     }
-    // Initialize the bin indices and weights array
-    else
-    {
-      dimension_range_method_it->second.second( particle_state_wrapper,
-                                                bin_indices_and_weights );
-    }
   }
 
   // Make sure that the bin indices are valid
   testPostcondition( this->isBinIndexWeightPairArrayValid( bin_indices_and_weights ) );
 }
 
+// Calculate the local bin indices and weights of the range
+void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesAndWeightsOfRange(
+                    const DimensionKernel& dimension_kernel,
+                    const ObserverParticleStateWrapper& particle_state_wrapper,
+                    BinIndexWeightPairArray& local_bin_indices_and_weights )
+{
+  if( dimension_kernel.range_dimension )
+  {
+    dimension_kernel.discretization->calculateBinIndicesOfRange(
+                                             particle_state_wrapper,
+                                             local_bin_indices_and_weights );
+  }
+  else
+  {
+    dimension_kernel.discretization->calculateBinIndicesOfValue(
+                                             particle_state_wrapper,
+                                             local_bin_indices_and_weights );
+  }
+}
+
 // Use this function for post processing to determine bin indices
 size_t DetailedObserverPhaseSpaceDiscretizationImpl::calculateDiscretizationIndex( const std::unordered_map<ObserverPhaseSpaceDimension, size_t>& dimension_bin_indices ) const
 {
@@ -422,46 +510,6 @@ size_t DetailedObserverPhaseSpaceDiscretizationImpl::calculateDiscretizationInde
   return discretization_index;
 }
 
-// Create a range intersection method
-auto DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension ) -> RangeIntersectionMethod
-{
-  if( is_range_dimension )
-  {
-    return std::bind<bool>( &ObserverPhaseSpaceDimensionDiscretization::doesRangeIntersectDiscretization,
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1 );
-  }
-  else
-  {
-    return std::bind<bool>( static_cast<bool(ObserverPhaseSpaceDimensionDiscretization::*)(const ObserverParticleStateWrapper&)const>(&ObserverPhaseSpaceDimensionDiscretization::isValueInDiscretization),
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1 );
-  }
-}
-
-// Create a calculate range method object
-auto DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension ) -> CalculateLocalBinIndicesOfRangeMethod
-{
-  if( is_range_dimension )
-  {
-    return std::bind<void>( &ObserverPhaseSpaceDimensionDiscretization::calculateBinIndicesOfRange,
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1,
-                            std::placeholders::_2 );
-  }
-  else
-  {
-    return std::bind<void>( static_cast<void(ObserverPhaseSpaceDimensionDiscretization::*)(const ObserverParticleStateWrapper&,BinIndexWeightPairArray&)const>(&ObserverPhaseSpaceDimensionDiscretization::calculateBinIndicesOfValue),
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1,
-                            std::placeholders::_2 );
-  }
-}
-
 // Check if the dimension value map is valid
 bool DetailedObserverPhaseSpaceDiscretizationImpl::isDimensionValueMapValid(
                               const DimensionValueMap& dimension_values ) const
@@ -9,16 +9,21 @@
 #ifndef MONTE_CARLO_DETAILED_OBSERVER_PHASE_SPACE_DISCRETIZATION_IMPL_HPP
 #define MONTE_CARLO_DETAILED_OBSERVER_PHASE_SPACE_DISCRETIZATION_IMPL_HPP
 
-// Std Lib Includes
-#include <functional>
-
 // FRENSIE Includes
 #include "MonteCarlo_ObserverPhaseSpaceDiscretizationImpl.hpp"
 #include "MonteCarlo_ObserverPhaseSpaceDimensionDiscretization.hpp"
 
 namespace MonteCarlo{
 
-//! The detailed observer phase space discretization implementation
+/*! The detailed observer phase space discretization implementation
+ * \details The dimension discretizations are compiled into a flat array of
+ * dimension kernels (discretization and index step size) in the order that
+ * they were assigned. The bin indices of a point or range are calculated by
+ * iterating over the kernels and combining the local bin indices of each
+ * dimension in place. The local bin indices are stored in thread work
+ * buffers, which must be set up by calling enableThreadSupport before the
+ * discretization is used by multiple threads.
+ */
 class DetailedObserverPhaseSpaceDiscretizationImpl : public ObserverPhaseSpaceDiscretizationImpl
 {
   
@@ -34,8 +39,7 @@ public:
   typedef ObserverPhaseSpaceDiscretizationImpl::BinIndexWeightPairArray BinIndexWeightPairArray;
 
   //! Constructor
-  DetailedObserverPhaseSpaceDiscretizationImpl()
-  { /* ... */ }
+  DetailedObserverPhaseSpaceDiscretizationImpl();
 
   //! Destructor
   ~DetailedObserverPhaseSpaceDiscretizationImpl()
@@ -47,6 +51,9 @@ public:
         discretization,
         const bool range_dimension ) override;
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) override;
+
   //! Get a dimension discretization
   const ObserverPhaseSpaceDimensionDiscretization& getDimensionDiscretization(
                   const ObserverPhaseSpaceDimension dimension ) const override;
@@ -118,23 +125,47 @@ public:
 
 private:
 
-  // The range intersects discretization method
-  typedef std::function<bool(const ObserverParticleStateWrapper&)> RangeIntersectionMethod;
+  // The compiled dimension kernel
+  struct DimensionKernel
+  {
+    // The dimension discretization
+    const ObserverPhaseSpaceDimensionDiscretization* discretization;
+
+    // The index step size (stride) of the dimension
+    size_t index_step_size;
+
+    // The range dimension flag
+    bool range_dimension;
+  };
 
-  // The calculate indices of range method type
-  typedef std::function<void(const ObserverParticleStateWrapper&,BinIndexWeightPairArray&)> CalculateLocalBinIndicesOfRangeMethod;
+  // The thread work buffers
+  struct ThreadWorkBuffers
+  {
+    // The local bin indices of a dimension
+    BinIndexArray local_bin_indices;
+
+    // The local bin indices and weights of a dimension
+    BinIndexWeightPairArray local_bin_indices_and_weights;
+  };
 
   size_t calculateDiscretizationIndex( const std::vector<std::pair<ObserverPhaseSpaceDimension, size_t>>& dimension_bin_indices) const;
 
-  // Create a range intersection method
-  static RangeIntersectionMethod createRangeIntersectionMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension );
-  
-  // Create a calculate range method object
-  static CalculateLocalBinIndicesOfRangeMethod createCalculateRangeMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension );
+  // Compile the dimension kernels
+  void compileDimensionKernels();
+
+  // Check if the range intersects the dimension discretization
+  static bool doesRangeIntersectDimensionDiscretization(
+                    const DimensionKernel& dimension_kernel,
+                    const ObserverParticleStateWrapper& particle_state_wrapper );
+
+  // Calculate the local bin indices and weights of the range
+  static void calculateLocalBinIndicesAndWeightsOfRange(
+                    const DimensionKernel& dimension_kernel,
+                    const ObserverParticleStateWrapper& particle_state_wrapper,
+                    BinIndexWeightPairArray& local_bin_indices_and_weights );
+
+  // Get the work buffers of the calling thread
+  ThreadWorkBuffers& getThreadWorkBuffers() const;
 
   // Check if the dimension value map is valid
   bool isDimensionValueMapValid(
@@ -170,15 +201,15 @@ private:
 
   // Calculate the local bin indices of the value
   void calculateLocalBinIndicesOfValue(
-                                  const ObserverPhaseSpaceDimension dimension,
-                                  const DimensionValueMap& dimension_values,
-                                  BinIndexArray& local_bin_indices ) const;
+     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
+     const DimensionValueMap& dimension_values,
+     BinIndexArray& local_bin_indices ) const;
 
   // Calculate the local bin indices of the value
   void calculateLocalBinIndicesOfValue(
-                   const ObserverPhaseSpaceDimension dimension,
-                   const ObserverParticleStateWrapper& particle_state_wrapper,
-                   BinIndexArray& local_bin_indices ) const;
+     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
+     const ObserverParticleStateWrapper& particle_state_wrapper,
+     BinIndexArray& local_bin_indices ) const;
   
   // Save the data to an archive
   template<typename Archive>
@@ -201,16 +232,18 @@ private:
   std::map<ObserverPhaseSpaceDimension,bool>
   d_dimension_use_range_map;
 
-  // The observer phase space dimension range method map
-  std::map<ObserverPhaseSpaceDimension,std::pair<RangeIntersectionMethod,CalculateLocalBinIndicesOfRangeMethod> >
-  d_dimension_range_method_map;
-
   // The observer phase space dimension index step size map
   std::map<ObserverPhaseSpaceDimension,size_t>
   d_dimension_index_step_size_map;
 
   // The observer phase space dimension ordering
   std::vector<ObserverPhaseSpaceDimension> d_dimension_ordering;
+
+  // The compiled dimension kernels (in dimension order)
+  std::vector<DimensionKernel> d_dimension_kernels;
+
+  // The thread work buffers
+  mutable std::vector<ThreadWorkBuffers> d_thread_work_buffers;
 };
 
 } // end MonteCarlo namespace
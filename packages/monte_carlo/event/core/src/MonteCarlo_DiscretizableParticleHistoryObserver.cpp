@@ -80,6 +80,20 @@ size_t DiscretizableParticleHistoryObserver::getNumberOfBins() const
   return d_phase_space_discretization.getNumberOfBins();
 }
 
+// Enable support for multiple threads in the phase space discretization
+/*! \details This must be called after all of the dimension discretizations
+ * have been set and before the bin indices are calculated by more than one
+ * thread.
+ */
+void DiscretizableParticleHistoryObserver::enableDiscretizationThreadSupport(
+                                                   const unsigned num_threads )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_phase_space_discretization.enableThreadSupport( num_threads );
+}
+
 std::string DiscretizableParticleHistoryObserver::getBinName( const size_t bin_index ) const
 {
   return d_phase_space_discretization.getBinName(bin_index);
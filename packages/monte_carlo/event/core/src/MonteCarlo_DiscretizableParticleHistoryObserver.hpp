@@ -72,7 +72,7 @@ public:
 
   //! Return the discretization for a dimension of the phase space
   template<ObserverPhaseSpaceDimension dimension, typename InputDataType>
-  void getDiscretization( InputDataType& bin_data );
+  void getDiscretization( InputDataType& bin_data ) const;
 
   //! Return the dimensions that have been discretized
   void getDiscretizedDimensions(
@@ -80,6 +80,9 @@ public:
 
   size_t calculateDiscretizationIndex(const std::unordered_map<ObserverPhaseSpaceDimension, size_t> dimension_bin_indices) const;
 
+  //! Enable support for multiple threads in the phase space discretization
+  void enableDiscretizationThreadSupport( const unsigned num_threads );
+
 private:
 
   // The observer phase space discretization
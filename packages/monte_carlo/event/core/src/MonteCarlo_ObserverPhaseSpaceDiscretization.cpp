@@ -76,6 +76,16 @@ void ObserverPhaseSpaceDiscretization::assignDiscretizationToDimension(
     d_impl->assignDiscretizationToDimension( discretization, range_dimension );
 }
 
+// Enable support for multiple threads
+/*! \details This should be called after all of the dimension
+ * discretizations have been assigned.
+ */
+void ObserverPhaseSpaceDiscretization::enableThreadSupport(
+                                                   const unsigned num_threads )
+{
+  d_impl->enableThreadSupport( num_threads );
+}
+
 // Get a dimension discretization
 const ObserverPhaseSpaceDimensionDiscretization&
 ObserverPhaseSpaceDiscretization::getDimensionDiscretization(
@@ -55,6 +55,9 @@ public:
         discretization,
         const bool range_dimension = false );
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads );
+
   //! Check if a dimension has a discretization
   bool doesDimensionHaveDiscretization(
                            const ObserverPhaseSpaceDimension dimension ) const;
@@ -63,6 +63,10 @@ public:
         discretization,
         const bool range_dimension ) = 0;
 
+  //! Enable support for multiple threads
+  virtual void enableThreadSupport( const unsigned num_threads )
+  { /* ... */ }
+
   //! Get a dimension discretization
   virtual const ObserverPhaseSpaceDimensionDiscretization& getDimensionDiscretization( const ObserverPhaseSpaceDimension dimension ) const = 0;
 
@@ -0,0 +1,105 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleCollidingGlobalEventObserver.hpp
+//! \author Alex Robinson
+//! \brief  Particle colliding global event observer base class declaration.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_OBSERVER_HPP
+#define MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_OBSERVER_HPP
+
+// Std Lib Includes
+#include <functional>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/assume_abstract.hpp>
+#include <boost/serialization/export.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleEventTags.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle colliding global event observer
+ * \details The event occurs when a particle is about to collide (or when a
+ * particle is emitted from the source). Observers are given the means to
+ * evaluate the emission densities of the particles that leave the event
+ * and the optical depth along a line of sight from the event position so
+ * that deterministic (next-event) contributions can be made.
+ * \ingroup particle_colliding_global_event
+ */
+class ParticleCollidingGlobalEventObserver
+{
+
+public:
+
+  //! Typedef for the observer event tag
+  typedef ParticleCollidingGlobalEvent EventTag;
+
+  //! Typedef for the outgoing energy and emission density (1/sr) array
+  typedef std::vector<std::pair<double,double> > EmissionDensityArray;
+
+  /*! Typedef for the emission density evaluator
+   *
+   * The outgoing energies and the emission densities (per unit solid angle)
+   * of the particles that leave the event in the desired direction
+   * (a unit vector) will be stored in the array (the array will be cleared
+   * first).
+   */
+  typedef std::function<void(const double[3],EmissionDensityArray&)>
+  EmissionDensityEvaluator;
+
+  /*! Typedef for the optical depth evaluator
+   *
+   * The arguments are the particle energy, the direction (a unit vector),
+   * the distance (cm) from the event position and the max optical depth
+   * (evaluation can stop once this depth has been reached). Infinity
+   * will be returned if the line of sight is blocked.
+   */
+  typedef std::function<double(const double,const double[3],const double,const double)>
+  OpticalDepthEvaluator;
+
+  //! Constructor
+  ParticleCollidingGlobalEventObserver()
+  { /* ... */ }
+
+  //! Destructor
+  virtual ~ParticleCollidingGlobalEventObserver()
+  { /* ... */ }
+
+  //! Update the observer
+  virtual void updateFromGlobalParticleCollidingEvent(
+                 const ParticleState& particle,
+                 const EmissionDensityEvaluator& emission_density_evaluator,
+                 const OpticalDepthEvaluator& optical_depth_evaluator ) = 0;
+
+private:
+
+  // Serialize the observer
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  { /* ... */ }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::ParticleCollidingGlobalEventObserver, 0 );
+BOOST_SERIALIZATION_ASSUME_ABSTRACT( MonteCarlo::ParticleCollidingGlobalEventObserver );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleCollidingGlobalEventObserver );
+
+#endif // end MONTE_CARLO_PARTICLE_COLLIDING_GLOBAL_EVENT_OBSERVER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleCollidingGlobalEventObserver.hpp
+//---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -23,6 +24,12 @@ uint64_t ParticleHistoryObserver::s_num_histories = 0;
 // Initialize the elapsed time
 double ParticleHistoryObserver::s_elapsed_time = 0.0;
 
+// Initialize the number of histories that each thread can have in flight
+unsigned ParticleHistoryObserver::s_num_histories_in_flight_per_thread = 1;
+
+// Initialize the in flight history that each thread is observing
+std::vector<unsigned> ParticleHistoryObserver::s_observed_histories_in_flight( 1, 0 );
+
 // Set the number of particle histories that have been observed
 void ParticleHistoryObserver::setNumberOfHistories(
                                                  const uint64_t num_histories )
@@ -49,6 +56,82 @@ double ParticleHistoryObserver::getElapsedTime()
   return s_elapsed_time;
 }
 
+// Set the number of histories that each thread can have in flight
+/*! \details Each thread normally transports a single history at a time so
+ * observers only need one history buffer per thread. When the particles of
+ * several histories are transported together (event-based transport) each
+ * in flight history needs its own buffer so that the contribution from every
+ * history can be committed separately. This must be called before the
+ * observers are given thread support.
+ */
+void ParticleHistoryObserver::setNumberOfHistoriesInFlightPerThread(
+                                     const unsigned num_threads,
+                                     const unsigned num_histories_per_thread )
+{
+  // Make sure only the root thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0 );
+  // Make sure the number of histories is valid
+  testPrecondition( num_histories_per_thread > 0 );
+
+  s_num_histories_in_flight_per_thread = num_histories_per_thread;
+
+  s_observed_histories_in_flight.clear();
+  s_observed_histories_in_flight.resize( num_threads, 0 );
+}
+
+// Get the number of histories that each thread can have in flight
+unsigned ParticleHistoryObserver::getNumberOfHistoriesInFlightPerThread()
+{
+  return s_num_histories_in_flight_per_thread;
+}
+
+// Set the in flight history that the calling thread is observing
+/*! \details All events that are dispatched by the calling thread will be
+ * recorded in the history buffer of the in flight history until this is
+ * called again.
+ */
+void ParticleHistoryObserver::setObservedHistoryInFlight(
+                                            const unsigned history_in_flight )
+{
+  // Make sure the history is valid
+  testPrecondition( history_in_flight < s_num_histories_in_flight_per_thread );
+  // Make sure the thread is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    s_observed_histories_in_flight.size() );
+
+  s_observed_histories_in_flight[Utility::OpenMPProperties::getThreadId()] =
+    history_in_flight;
+}
+
+// Get the number of history buffers that are needed by the threads
+unsigned ParticleHistoryObserver::getNumberOfHistoryBuffers(
+                                                   const unsigned num_threads )
+{
+  return num_threads*s_num_histories_in_flight_per_thread;
+}
+
+// Get the history buffer that the calling thread is observing
+/*! \details When only one history can be in flight on each thread the
+ * history buffer is the thread id.
+ */
+unsigned ParticleHistoryObserver::getObservedHistoryBuffer()
+{
+  const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+  if( s_num_histories_in_flight_per_thread == 1 )
+    return thread_id;
+  else
+  {
+    // Make sure the thread is valid
+    testPrecondition( thread_id < s_observed_histories_in_flight.size() );
+
+    return thread_id*s_num_histories_in_flight_per_thread +
+      s_observed_histories_in_flight[thread_id];
+  }
+}
+
 // Log a summary of the data
 void ParticleHistoryObserver::logSummary() const
 {
@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -47,6 +48,17 @@ public:
   //! Set the elapsed time (for analysis of observer data)
   static void setElapsedTime( const double elapsed_time );
 
+  //! Set the number of histories that each thread can have in flight
+  static void setNumberOfHistoriesInFlightPerThread(
+                                 const unsigned num_threads,
+                                 const unsigned num_histories_per_thread );
+
+  //! Get the number of histories that each thread can have in flight
+  static unsigned getNumberOfHistoriesInFlightPerThread();
+
+  //! Set the in flight history that the calling thread is observing
+  static void setObservedHistoryInFlight( const unsigned history_in_flight );
+
   //! Enable support for multiple threads
   virtual void enableThreadSupport( const unsigned num_threads ) = 0;
 
@@ -81,6 +93,12 @@ protected:
   //! Get the elapsed time (for analysis of observer data)
   static double getElapsedTime();
 
+  //! Get the number of history buffers that are needed by the threads
+  static unsigned getNumberOfHistoryBuffers( const unsigned num_threads );
+
+  //! Get the history buffer that the calling thread is observing
+  static unsigned getObservedHistoryBuffer();
+
 private:
 
   // Serialize the observer
@@ -96,6 +114,12 @@ private:
 
   // The elapsed time (used for the figure of merit calculation)
   static double s_elapsed_time;
+
+  // The number of histories that each thread can have in flight
+  static unsigned s_num_histories_in_flight_per_thread;
+
+  // The in flight history that each thread is observing
+  static std::vector<unsigned> s_observed_histories_in_flight;
 };
 
 } // end MonteCarlo namespace
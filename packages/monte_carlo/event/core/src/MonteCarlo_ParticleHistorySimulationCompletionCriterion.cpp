@@ -400,6 +400,14 @@ public:
     d_rhs->enableThreadSupport( num_threads );
   }
 
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t histories,
+                     const double time ) final override
+  {
+    d_lhs->takeSnapshot( histories, time );
+    d_rhs->takeSnapshot( histories, time );
+  }
+
   //! Check if the observer has uncommitted history contributions
   bool hasUncommittedHistoryContribution() const final override
   {
@@ -565,7 +573,9 @@ ParticleHistorySimulationCompletionCriterion::createMixedCriterion(
 }
 
 // Take a snapshot
-/*! \details The state should never need to be cached.
+/*! \details By default the state does not need to be cached. Criteria that
+ * depend on observer data (e.g. estimator precision) can override this to
+ * invalidate any cached evaluations.
  */
 void ParticleHistorySimulationCompletionCriterion::takeSnapshot(
                                                  const uint64_t, const double )
@@ -2045,6 +2045,57 @@ FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the bin indices of a point can be calculated with thread
+// support enabled and a reused bin indices array
+FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization,
+                   calculateBinIndicesOfPoint_thread_support )
+{
+  MonteCarlo::ObserverPhaseSpaceDiscretization phase_space_discretization;
+
+  // Cosine bins, energy bins, time bins, source id bins
+  phase_space_discretization.assignDiscretizationToDimension( cosine_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( energy_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( time_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( source_id_dimension_discretization );
+
+  phase_space_discretization.enableThreadSupport( 2 );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 5e-5 );
+  photon.setTime( 5e-4 );
+  photon.setSourceId( 1 );
+
+  MonteCarlo::ObserverParticleStateWrapper photon_wrapper( photon );
+  photon_wrapper.setAngleCosine( 0.0 );
+
+  // The previous contents of the bin indices array must be ignored
+  MonteCarlo::ObserverPhaseSpaceDiscretization::BinIndexArray
+    bin_indices( 5, 100 );
+
+  phase_space_discretization.calculateBinIndicesOfPoint( photon_wrapper, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 49 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 76 );
+
+  photon.setSourceId( 0 );
+  photon_wrapper.setAngleCosine( 1.0 );
+
+  phase_space_discretization.calculateBinIndicesOfPoint( photon_wrapper, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 23 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 50 );
+
+  photon.setSourceId( 2 );
+
+  phase_space_discretization.calculateBinIndicesOfPoint( photon_wrapper, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 77 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the bin indices of a range can be calculated
 FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization,
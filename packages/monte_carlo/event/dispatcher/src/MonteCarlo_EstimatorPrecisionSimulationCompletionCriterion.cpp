@@ -0,0 +1,379 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EstimatorPrecisionSimulationCompletionCriterion.cpp
+//! \author Alex Robinson
+//! \brief  The estimator precision simulation completion criterion def.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <functional>
+#include <numeric>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_EstimatorPrecisionSimulationCompletionCriterion.hpp"
+#include "Utility_SampleMoment.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+EstimatorPrecisionSimulationCompletionCriterion::EstimatorPrecisionSimulationCompletionCriterion()
+  : d_targets(),
+    d_num_completed_histories( 1, 0 ),
+    d_count_histories( false ),
+    d_timer( Utility::GlobalMPISession::createTimer() ),
+    d_previous_sampling_time( 0.0 ),
+    d_cache_valid( false ),
+    d_num_targets_met( 0 )
+{ /* ... */ }
+
+// Add an entity bin precision target
+/*! \details The bin index is the index into the entity bin data arrays
+ * (e.g. MonteCarlo::Estimator::getEntityBinDataFirstMoments), which includes
+ * the response function dimension. A figure of merit target of 0.0 will be
+ * ignored.
+ */
+void EstimatorPrecisionSimulationCompletionCriterion::addEntityBinTarget(
+                              const std::shared_ptr<const Estimator>& estimator,
+                              const Estimator::EntityId entity_id,
+                              const size_t bin_index,
+                              const double relative_error,
+                              const double figure_of_merit )
+{
+  // Make sure that the estimator is valid
+  testPrecondition( estimator.get() );
+
+  TEST_FOR_EXCEPTION( !estimator->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << estimator->getId() << "!" );
+
+  Target target = {estimator, false, entity_id, bin_index,
+                   relative_error, figure_of_merit};
+
+  this->addTarget( target,
+                   estimator->getEntityBinDataFirstMoments( entity_id ).size() );
+}
+
+// Add a total bin precision target
+/*! \details The bin index is the index into the total bin data arrays
+ * (e.g. MonteCarlo::Estimator::getTotalBinDataFirstMoments), which includes
+ * the response function dimension. A figure of merit target of 0.0 will be
+ * ignored.
+ */
+void EstimatorPrecisionSimulationCompletionCriterion::addTotalBinTarget(
+                              const std::shared_ptr<const Estimator>& estimator,
+                              const size_t bin_index,
+                              const double relative_error,
+                              const double figure_of_merit )
+{
+  // Make sure that the estimator is valid
+  testPrecondition( estimator.get() );
+
+  Target target = {estimator, true, 0, bin_index,
+                   relative_error, figure_of_merit};
+
+  this->addTarget( target,
+                   estimator->getTotalBinDataFirstMoments().size() );
+}
+
+// Add a precision target
+void EstimatorPrecisionSimulationCompletionCriterion::addTarget(
+                                                   const Target& target,
+                                                   const size_t number_of_bins )
+{
+  TEST_FOR_EXCEPTION( target.bin_index >= number_of_bins,
+                      std::runtime_error,
+                      "Bin " << target.bin_index << " of estimator "
+                      << target.estimator->getId() << " does not exist "
+                      "(there are only " << number_of_bins << " bins)!" );
+
+  TEST_FOR_EXCEPTION( target.relative_error <= 0.0,
+                      std::runtime_error,
+                      "The relative error target must be greater than 0.0!" );
+
+  TEST_FOR_EXCEPTION( target.figure_of_merit < 0.0,
+                      std::runtime_error,
+                      "The figure of merit target must not be negative!" );
+
+  d_targets.push_back( target );
+
+  this->invalidateCache();
+}
+
+// Return the number of precision targets
+size_t EstimatorPrecisionSimulationCompletionCriterion::getNumberOfTargets() const
+{
+  return d_targets.size();
+}
+
+// Return the number of precision targets that have been met
+size_t EstimatorPrecisionSimulationCompletionCriterion::getNumberOfTargetsMet() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( !d_cache_valid )
+    this->evaluateTargets();
+
+  return d_num_targets_met;
+}
+
+// Get the number of completed histories
+uint64_t EstimatorPrecisionSimulationCompletionCriterion::getNumberOfCompletedHistories() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  return std::accumulate( d_num_completed_histories.begin(),
+                          d_num_completed_histories.end(),
+                          0ull );
+}
+
+// Check if the simulation is complete
+/*! \details A criterion without any targets will never be complete.
+ */
+bool EstimatorPrecisionSimulationCompletionCriterion::isSimulationComplete() const
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_targets.empty() )
+    return false;
+  else
+    return this->getNumberOfTargetsMet() == d_targets.size();
+}
+
+// Start the criterion
+void EstimatorPrecisionSimulationCompletionCriterion::start()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_count_histories = true;
+
+  d_timer->start();
+}
+
+// Stop the criterion
+void EstimatorPrecisionSimulationCompletionCriterion::stop()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_count_histories = false;
+
+  d_timer->stop();
+}
+
+// Clear cached criterion data
+void EstimatorPrecisionSimulationCompletionCriterion::clearCache()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( size_t i = 0; i < d_num_completed_histories.size(); ++i )
+    d_num_completed_histories[i] = 0;
+
+  d_timer = Utility::GlobalMPISession::createTimer();
+  d_previous_sampling_time = 0.0;
+
+  this->invalidateCache();
+}
+
+// Enable support for multiple threads
+void EstimatorPrecisionSimulationCompletionCriterion::enableThreadSupport(
+                                                  const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_num_completed_histories.resize( num_threads, 0 );
+}
+
+// Check if the observer has uncommitted history contributions
+bool EstimatorPrecisionSimulationCompletionCriterion::hasUncommittedHistoryContribution() const
+{
+  return true;
+}
+
+// Commit the contribution from the current history to the observer
+void EstimatorPrecisionSimulationCompletionCriterion::commitHistoryContribution()
+{
+  // Make sure that the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_num_completed_histories.size() );
+
+  if( d_count_histories )
+    ++d_num_completed_histories[Utility::OpenMPProperties::getThreadId()];
+}
+
+// Take a snapshot
+/*! \details The watched estimators merge their thread private moments when
+ * they take a snapshot. The cached evaluation must be invalidated so that
+ * the targets will be evaluated with the new estimator moments the next
+ * time that they are queried.
+ */
+void EstimatorPrecisionSimulationCompletionCriterion::takeSnapshot(
+                                                 const uint64_t, const double )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->invalidateCache();
+}
+
+// Reset the observer data
+void EstimatorPrecisionSimulationCompletionCriterion::resetData()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( size_t i = 0; i < d_num_completed_histories.size(); ++i )
+    d_num_completed_histories[i] = 0;
+
+  this->invalidateCache();
+}
+
+// Reduce the object data on all processes in comm and collect on root
+/*! \details The estimators that are watched by this criterion will be reduced
+ * by the event handler. The cached evaluation will be invalidated so that
+ * the root process will evaluate the targets with the reduced data.
+ */
+void EstimatorPrecisionSimulationCompletionCriterion::reduceData(
+                                            const Utility::Communicator& comm,
+                                            const int root_process )
+{
+  if( comm.size() > 1 )
+  {
+    comm.barrier();
+
+    try{
+      if( comm.rank() == root_process )
+      {
+        uint64_t reduced_num_completed_histories;
+
+        Utility::reduce( comm,
+                         this->getNumberOfCompletedHistories(),
+                         reduced_num_completed_histories,
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        this->resetData();
+
+        d_num_completed_histories.front() = reduced_num_completed_histories;
+      }
+      else
+      {
+        Utility::reduce( comm,
+                         this->getNumberOfCompletedHistories(),
+                         std::plus<uint64_t>(),
+                         root_process );
+
+        this->resetData();
+      }
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in "
+                             "estimator precision simulation completion "
+                             "criterion!" );
+
+    comm.barrier();
+  }
+}
+
+// Get a description of the criterion
+std::string EstimatorPrecisionSimulationCompletionCriterion::description() const
+{
+  return std::string( "estimator precision targets met (" ) +
+    Utility::toString( this->getNumberOfTargetsMet() ) + ") == " +
+    Utility::toString( d_targets.size() );
+}
+
+// Check if a precision target has been met
+bool EstimatorPrecisionSimulationCompletionCriterion::isTargetMet(
+                                                const Target& target,
+                                                const uint64_t num_histories,
+                                                const double time ) const
+{
+  Utility::ArrayView<const double> first_moments, second_moments;
+
+  if( target.total_bin )
+  {
+    first_moments = target.estimator->getTotalBinDataFirstMoments();
+    second_moments = target.estimator->getTotalBinDataSecondMoments();
+  }
+  else
+  {
+    first_moments =
+      target.estimator->getEntityBinDataFirstMoments( target.entity_id );
+    second_moments =
+      target.estimator->getEntityBinDataSecondMoments( target.entity_id );
+  }
+
+  // The relative error is not defined until the bin has been scored in
+  if( first_moments[target.bin_index] <= 0.0 )
+    return false;
+
+  const double relative_error =
+    Utility::calculateRelativeError(
+             Utility::SampleMoment<1,double>( first_moments[target.bin_index] ),
+             Utility::SampleMoment<2,double>( second_moments[target.bin_index] ),
+             num_histories );
+
+  if( relative_error > target.relative_error )
+    return false;
+
+  if( target.figure_of_merit > 0.0 )
+  {
+    if( time <= 0.0 )
+      return false;
+
+    return Utility::calculateFOM( relative_error, time ) >=
+      target.figure_of_merit;
+  }
+
+  return true;
+}
+
+// Evaluate the precision targets
+void EstimatorPrecisionSimulationCompletionCriterion::evaluateTargets() const
+{
+  d_num_targets_met = 0;
+
+  const uint64_t num_histories = this->getNumberOfCompletedHistories();
+
+  if( num_histories > 0 )
+  {
+    const double time =
+      d_previous_sampling_time + d_timer->elapsed().count();
+
+    for( auto&& target : d_targets )
+    {
+      if( this->isTargetMet( target, num_histories, time ) )
+        ++d_num_targets_met;
+    }
+  }
+
+  d_cache_valid = true;
+}
+
+// Invalidate the cached target evaluation
+void EstimatorPrecisionSimulationCompletionCriterion::invalidateCache()
+{
+  d_cache_valid = false;
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( EstimatorPrecisionSimulationCompletionCriterion, MonteCarlo );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::EstimatorPrecisionSimulationCompletionCriterion );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EstimatorPrecisionSimulationCompletionCriterion.cpp
+//---------------------------------------------------------------------------//
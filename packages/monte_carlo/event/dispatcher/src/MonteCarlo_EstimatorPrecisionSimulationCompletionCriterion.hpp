@@ -0,0 +1,249 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EstimatorPrecisionSimulationCompletionCriterion.hpp
+//! \author Alex Robinson
+//! \brief  The estimator precision simulation completion criterion decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ESTIMATOR_PRECISION_SIMULATION_COMPLETION_CRITERION_HPP
+#define MONTE_CARLO_ESTIMATOR_PRECISION_SIMULATION_COMPLETION_CRITERION_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The estimator precision simulation completion criterion
+ * \details This criterion watches a set of estimator bins and will indicate
+ * that the simulation is complete once the relative error of every bin is
+ * at or below its target (and the figure of merit of every bin is at or above
+ * its target, if one was requested). Bins that have not been scored in yet
+ * never meet their target. The estimator moments are only guaranteed to be
+ * up-to-date after a snapshot or a reduction, so the criterion is only
+ * re-evaluated (lazily) after one of these events has occurred - calling
+ * isSimulationComplete between snapshots is cheap. After a reduction, the
+ * root process will evaluate the criterion with the reduced estimator data
+ * and the reduced history count, which is what allows the batched
+ * distributed simulation manager to use this criterion.
+ */
+class EstimatorPrecisionSimulationCompletionCriterion : public ParticleHistorySimulationCompletionCriterion
+{
+
+public:
+
+  //! Constructor
+  EstimatorPrecisionSimulationCompletionCriterion();
+
+  //! Destructor
+  ~EstimatorPrecisionSimulationCompletionCriterion()
+  { /* ... */ }
+
+  //! Add an entity bin precision target
+  void addEntityBinTarget( const std::shared_ptr<const Estimator>& estimator,
+                           const Estimator::EntityId entity_id,
+                           const size_t bin_index,
+                           const double relative_error,
+                           const double figure_of_merit = 0.0 );
+
+  //! Add a total bin precision target
+  void addTotalBinTarget( const std::shared_ptr<const Estimator>& estimator,
+                          const size_t bin_index,
+                          const double relative_error,
+                          const double figure_of_merit = 0.0 );
+
+  //! Return the number of precision targets
+  size_t getNumberOfTargets() const;
+
+  //! Return the number of precision targets that have been met
+  size_t getNumberOfTargetsMet() const;
+
+  //! Get the number of completed histories
+  uint64_t getNumberOfCompletedHistories() const;
+
+  //! Check if the simulation is complete
+  bool isSimulationComplete() const final override;
+
+  //! Start the criterion
+  void start() final override;
+
+  //! Stop the criterion
+  void stop() final override;
+
+  //! Clear cached criterion data
+  void clearCache() final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+  //! Check if the observer has uncommitted history contributions
+  bool hasUncommittedHistoryContribution() const final override;
+
+  //! Commit the contribution from the current history to the observer
+  void commitHistoryContribution() final override;
+
+  //! Take a snapshot
+  void takeSnapshot( const uint64_t histories,
+                     const double time ) final override;
+
+  //! Reset the observer data
+  void resetData() final override;
+
+  //! Reduce the object data on all processes in comm and collect on root
+  void reduceData( const Utility::Communicator& comm,
+                   const int root_process ) final override;
+
+  //! Get a description of the criterion
+  std::string description() const final override;
+
+private:
+
+  // The precision target
+  struct Target
+  {
+    // The estimator
+    std::shared_ptr<const Estimator> estimator;
+
+    // Use the total bin data (instead of entity bin data)
+    bool total_bin;
+
+    // The entity id (ignored when the total bin data is used)
+    Estimator::EntityId entity_id;
+
+    // The bin index
+    size_t bin_index;
+
+    // The relative error target
+    double relative_error;
+
+    // The figure of merit target
+    double figure_of_merit;
+
+    // Serialize the target
+    template<typename Archive>
+    void serialize( Archive& ar, const unsigned version )
+    {
+      ar & BOOST_SERIALIZATION_NVP( estimator );
+      ar & BOOST_SERIALIZATION_NVP( total_bin );
+      ar & BOOST_SERIALIZATION_NVP( entity_id );
+      ar & BOOST_SERIALIZATION_NVP( bin_index );
+      ar & BOOST_SERIALIZATION_NVP( relative_error );
+      ar & BOOST_SERIALIZATION_NVP( figure_of_merit );
+    }
+  };
+
+  // Add a precision target
+  void addTarget( const Target& target, const size_t number_of_bins );
+
+  // Check if a precision target has been met
+  bool isTargetMet( const Target& target,
+                    const uint64_t num_histories,
+                    const double time ) const;
+
+  // Evaluate the precision targets
+  void evaluateTargets() const;
+
+  // Invalidate the cached target evaluation
+  void invalidateCache();
+
+  // Save the completion criterion
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the completion criterion
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The precision targets
+  std::vector<Target> d_targets;
+
+  // The number of completed histories
+  std::vector<uint64_t> d_num_completed_histories;
+
+  // Active flag
+  bool d_count_histories;
+
+  // The timer
+  std::shared_ptr<Utility::Timer> d_timer;
+
+  // The sampling time from previous runs (s)
+  double d_previous_sampling_time;
+
+  // Cached target evaluation flag
+  mutable bool d_cache_valid;
+
+  // The cached number of targets met
+  mutable size_t d_num_targets_met;
+};
+
+// Save the completion criterion
+template<typename Archive>
+void EstimatorPrecisionSimulationCompletionCriterion::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Save the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_targets );
+
+  uint64_t num_completed_histories = this->getNumberOfCompletedHistories();
+
+  ar & BOOST_SERIALIZATION_NVP( num_completed_histories );
+
+  double previous_sampling_time =
+    d_previous_sampling_time + d_timer->elapsed().count();
+
+  ar & BOOST_SERIALIZATION_NVP( previous_sampling_time );
+
+  // Don't save the count histories flag - this must be reactivated
+  // manually by calling start
+}
+
+// Load the completion criterion
+template<typename Archive>
+void EstimatorPrecisionSimulationCompletionCriterion::load( Archive& ar, const unsigned version )
+{
+  // Load the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
+
+  // Load the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_targets );
+
+  uint64_t num_completed_histories;
+
+  ar & BOOST_SERIALIZATION_NVP( num_completed_histories );
+
+  d_num_completed_histories.resize( 1 );
+  d_num_completed_histories.front() = num_completed_histories;
+
+  ar & boost::serialization::make_nvp( "previous_sampling_time",
+                                       d_previous_sampling_time );
+
+  d_count_histories = false;
+  d_timer = Utility::GlobalMPISession::createTimer();
+
+  this->invalidateCache();
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( EstimatorPrecisionSimulationCompletionCriterion, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( EstimatorPrecisionSimulationCompletionCriterion, MonteCarlo );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, EstimatorPrecisionSimulationCompletionCriterion );
+
+#endif // end MONTE_CARLO_ESTIMATOR_PRECISION_SIMULATION_COMPLETION_CRITERION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EstimatorPrecisionSimulationCompletionCriterion.hpp
+//---------------------------------------------------------------------------//
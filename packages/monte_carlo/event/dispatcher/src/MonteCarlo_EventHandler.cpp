@@ -35,6 +35,7 @@ EventHandler::EventHandler()
     d_simulation_timer( Utility::GlobalMPISession::createTimer() ),
     d_snapshot_timer( Utility::GlobalMPISession::createTimer() ),
     d_elapsed_simulation_time( 0.0 ),
+    d_thread_private_estimator_moments_mode_on( false ),
     d_estimators(),
     d_particle_trackers(),
     d_particle_history_observers( {d_simulation_completion_criterion} )
@@ -68,6 +69,7 @@ EventHandler::EventHandler(
     d_simulation_timer( Utility::GlobalMPISession::createTimer() ),
     d_snapshot_timer( Utility::GlobalMPISession::createTimer() ),
     d_elapsed_simulation_time( 0.0 ),
+    d_thread_private_estimator_moments_mode_on( properties.isThreadPrivateEstimatorMomentsModeOn() ),
     d_estimators(),
     d_particle_trackers(),
     d_particle_history_observers( {d_simulation_completion_criterion} )
@@ -397,6 +399,65 @@ void EventHandler::updateSimulationCompletionCriterionObserver( const std::share
   d_particle_history_observers.front() = observer;
 }
 
+// Create an estimator entity bin precision completion criterion
+/*! \details The returned criterion must still be set with
+ * setSimulationCompletionCriterion. It can be combined with other criteria
+ * using the || and && operators (e.g. to also limit the number of histories).
+ * Additional targets can be added to the returned criterion.
+ */
+std::shared_ptr<EstimatorPrecisionSimulationCompletionCriterion>
+EventHandler::createEntityBinPrecisionCriterion(
+                                        const Estimator::Id estimator_id,
+                                        const Estimator::EntityId entity_id,
+                                        const size_t bin_index,
+                                        const double relative_error,
+                                        const double figure_of_merit ) const
+{
+  TEST_FOR_EXCEPTION( !this->doesEstimatorExist( estimator_id ),
+                      std::runtime_error,
+                      "Estimator " << estimator_id << " has not been "
+                      "registered with the event handler!" );
+
+  std::shared_ptr<EstimatorPrecisionSimulationCompletionCriterion>
+    criterion( new EstimatorPrecisionSimulationCompletionCriterion );
+
+  criterion->addEntityBinTarget( d_estimators.find( estimator_id )->second,
+                                 entity_id,
+                                 bin_index,
+                                 relative_error,
+                                 figure_of_merit );
+
+  return criterion;
+}
+
+// Create an estimator total bin precision completion criterion
+/*! \details The returned criterion must still be set with
+ * setSimulationCompletionCriterion. Additional targets can be added to the
+ * returned criterion.
+ */
+std::shared_ptr<EstimatorPrecisionSimulationCompletionCriterion>
+EventHandler::createTotalBinPrecisionCriterion(
+                                        const Estimator::Id estimator_id,
+                                        const size_t bin_index,
+                                        const double relative_error,
+                                        const double figure_of_merit ) const
+{
+  TEST_FOR_EXCEPTION( !this->doesEstimatorExist( estimator_id ),
+                      std::runtime_error,
+                      "Estimator " << estimator_id << " has not been "
+                      "registered with the event handler!" );
+
+  std::shared_ptr<EstimatorPrecisionSimulationCompletionCriterion>
+    criterion( new EstimatorPrecisionSimulationCompletionCriterion );
+
+  criterion->addTotalBinTarget( d_estimators.find( estimator_id )->second,
+                                bin_index,
+                                relative_error,
+                                figure_of_merit );
+
+  return criterion;
+}
+
 // Check if the simulation is complete
 bool EventHandler::isSimulationComplete() const
 {
@@ -498,13 +559,27 @@ const ParticleTracker& EventHandler::getParticleTracker( const uint32_t particle
 
 // Enable support for multiple threads
 /*! \details This should only be called after all of the estimators have been
- * added.
+ * added. If thread private estimator moments mode was requested (see
+ * MonteCarlo::SimulationGeneralProperties) thread private moment accumulation
+ * will also be enabled on every estimator.
  */
 void EventHandler::enableThreadSupport( const unsigned num_threads )
 {
   // Make sure only the master thread calls this function
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
+  if( d_thread_private_estimator_moments_mode_on )
+  {
+    EstimatorIdMap::iterator estimator_it = d_estimators.begin();
+
+    while( estimator_it != d_estimators.end() )
+    {
+      estimator_it->second->enableThreadPrivateMomentAccumulation();
+
+      ++estimator_it;
+    }
+  }
+
   ParticleHistoryObservers::iterator it =
     d_particle_history_observers.begin();
 
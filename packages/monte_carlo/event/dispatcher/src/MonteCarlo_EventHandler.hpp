@@ -22,9 +22,12 @@
 #include "MonteCarlo_ParticleSubtrackEndingInCellEventHandler.hpp"
 #include "MonteCarlo_ParticleSubtrackEndingGlobalEventHandler.hpp"
 #include "MonteCarlo_ParticleGoneGlobalEventHandler.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventHandler.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
 #include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
+#include "MonteCarlo_EstimatorPrecisionSimulationCompletionCriterion.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_ParticleState.hpp"
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
@@ -45,7 +48,8 @@ class EventHandler : public ParticleCollidingInCellEventHandler,
                      public ParticleLeavingCellEventHandler,
                      public ParticleSubtrackEndingInCellEventHandler,
                      public ParticleSubtrackEndingGlobalEventHandler,
-                     public ParticleGoneGlobalEventHandler
+                     public ParticleGoneGlobalEventHandler,
+                     public ParticleCollidingGlobalEventHandler
 {
 
 public:
@@ -84,6 +88,21 @@ public:
   //! Set a simulation completion criterion
   void setSimulationCompletionCriterion( const MonteCarlo::SimulationGeneralProperties& properties );
 
+  //! Create an estimator entity bin precision completion criterion
+  std::shared_ptr<EstimatorPrecisionSimulationCompletionCriterion>
+  createEntityBinPrecisionCriterion( const Estimator::Id estimator_id,
+                                     const Estimator::EntityId entity_id,
+                                     const size_t bin_index,
+                                     const double relative_error,
+                                     const double figure_of_merit = 0.0 ) const;
+
+  //! Create an estimator total bin precision completion criterion
+  std::shared_ptr<EstimatorPrecisionSimulationCompletionCriterion>
+  createTotalBinPrecisionCriterion( const Estimator::Id estimator_id,
+                                    const size_t bin_index,
+                                    const double relative_error,
+                                    const double figure_of_merit = 0.0 ) const;
+
   //! Check if the simulation is complete
   bool isSimulationComplete() const;
 
@@ -190,6 +209,15 @@ private:
           const std::shared_ptr<MeshTrackLengthFluxEstimator<T> >& estimator );
   };
 
+  // Struct for registering estimator
+  template<typename T>
+  struct EstimatorRegistrationHelper<PointDetectorFluxEstimator<T> >
+  {
+    static void registerEstimator(
+          EventHandler& event_handler,
+          const std::shared_ptr<PointDetectorFluxEstimator<T> >& estimator );
+  };
+
   // Add the estimator registration helper as a friend class
   template<typename T>
   friend class EstimatorRegistrationHelper;
@@ -298,6 +326,7 @@ private:
   using ParticleSubtrackEndingInCellEventHandler::registerObserverWithTag;
   using ParticleSubtrackEndingGlobalEventHandler::registerGlobalObserverWithTag;
   using ParticleGoneGlobalEventHandler::registerGlobalObserverWithTag;
+  using ParticleCollidingGlobalEventHandler::registerGlobalObserverWithTag;
 
   // Create and register cell estimator
   void createAndRegisterCellEstimator(
@@ -370,6 +399,9 @@ private:
   // The simulation time
   double d_elapsed_simulation_time;
 
+  // The thread private estimator moments mode
+  bool d_thread_private_estimator_moments_mode_on;
+
   // The estimators
   EstimatorIdMap d_estimators;
 
@@ -382,7 +414,7 @@ private:
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes
@@ -91,6 +91,16 @@ void EventHandler::EstimatorRegistrationHelper<MeshTrackLengthFluxEstimator<T> >
   event_handler.registerGlobalObserver( estimator, particle_types );
 }
 
+template<typename T>
+void EventHandler::EstimatorRegistrationHelper<PointDetectorFluxEstimator<T> >::registerEstimator(
+           EventHandler& event_handler,
+           const std::shared_ptr<PointDetectorFluxEstimator<T> >& estimator )
+{
+  std::set<ParticleType> particle_types = estimator->getParticleTypes();
+  
+  event_handler.registerGlobalObserver( estimator, particle_types );
+}
+
 // Register an observer with the appropriate dispatcher
 template<typename Observer, typename InputEntityId>
 void EventHandler::registerObserver( const std::shared_ptr<Observer>& observer,
@@ -282,6 +292,7 @@ void EventHandler::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingInCellEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingGlobalEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleGoneGlobalEventHandler );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingGlobalEventHandler );
 
   // Save the local data (ignore the model, snapshot counters)
   ar & BOOST_SERIALIZATION_NVP( d_simulation_completion_criterion );
@@ -294,6 +305,7 @@ void EventHandler::save( Archive& ar, const unsigned version ) const
   double elapsed_time = this->getElapsedTime();
   
   ar & BOOST_SERIALIZATION_NVP( elapsed_time );
+  ar & BOOST_SERIALIZATION_NVP( d_thread_private_estimator_moments_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_estimators );
   ar & BOOST_SERIALIZATION_NVP( d_particle_trackers );
   ar & BOOST_SERIALIZATION_NVP( d_particle_history_observers );
@@ -311,6 +323,7 @@ void EventHandler::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingInCellEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingGlobalEventHandler );
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleGoneGlobalEventHandler );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingGlobalEventHandler );
 
   // Load the local data (ignore the model)
   ar & BOOST_SERIALIZATION_NVP( d_simulation_completion_criterion );
@@ -337,6 +350,11 @@ void EventHandler::load( Archive& ar, const unsigned version )
 
   d_simulation_timer = Utility::GlobalMPISession::createTimer();
   d_snapshot_timer = Utility::GlobalMPISession::createTimer();
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_thread_private_estimator_moments_mode_on );
+  else
+    d_thread_private_estimator_moments_mode_on = false;
   
   ar & BOOST_SERIALIZATION_NVP( d_estimators );
   ar & BOOST_SERIALIZATION_NVP( d_particle_trackers );
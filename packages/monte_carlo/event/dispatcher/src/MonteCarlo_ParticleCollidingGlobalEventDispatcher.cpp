@@ -0,0 +1,48 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleCollidingGlobalEventDispatcher.cpp
+//! \author Alex Robinson
+//! \brief  Particle colliding global event dispatcher definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventDispatcher.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Dispatch the new event to the observers
+void ParticleCollidingGlobalEventDispatcher::dispatchParticleCollidingGlobalEvent(
+                     const ParticleState& particle,
+                     const ParticleCollidingGlobalEventObserver::EmissionDensityEvaluator&
+                     emission_density_evaluator,
+                     const ParticleCollidingGlobalEventObserver::OpticalDepthEvaluator&
+                     optical_depth_evaluator )
+{
+  if( this->hasObserverSet( particle.getParticleType() ) )
+  {
+    ObserverSet& observer_set =
+      this->getObserverSet( particle.getParticleType() );
+    
+    ObserverSet::iterator it = observer_set.begin();
+    
+    while( it != observer_set.end() )
+    {
+      (*it)->updateFromGlobalParticleCollidingEvent( particle,
+                                                     emission_density_evaluator,
+                                                     optical_depth_evaluator );
+      
+      ++it;
+    }
+  }
+}
+  
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleCollidingGlobalEventDispatcher );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleCollidingGlobalEventDispatcher.cpp
+//---------------------------------------------------------------------------//
@@ -246,6 +246,98 @@ FRENSIE_UNIT_TEST( EventHandler, setSimulationCompletionCriterion_props )
   FRENSIE_CHECK( event_handler->isSimulationComplete() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that an estimator precision completion criterion can be set
+FRENSIE_UNIT_TEST( EventHandler, setSimulationCompletionCriterion_precision )
+{
+  MonteCarlo::EventHandler event_handler;
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      200, 1.0, {1}, {1.0} ) );
+
+  local_estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler.addEstimator( local_estimator );
+
+  FRENSIE_CHECK_THROW( event_handler.createEntityBinPrecisionCriterion( 201, 1, 0, 0.1 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( event_handler.createEntityBinPrecisionCriterion( 200, 2, 0, 0.1 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( event_handler.createEntityBinPrecisionCriterion( 200, 1, 1, 0.1 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( event_handler.createTotalBinPrecisionCriterion( 200, 0, 0.0 ),
+                       std::runtime_error );
+
+  std::shared_ptr<MonteCarlo::EstimatorPrecisionSimulationCompletionCriterion>
+    criterion = event_handler.createEntityBinPrecisionCriterion( 200, 1, 0, 0.1 );
+
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfTargets(), 1 );
+
+  event_handler.setSimulationCompletionCriterion( criterion );
+
+  std::shared_ptr<const Geometry::Model>
+    local_model( new Geometry::InfiniteMediumModel( 1 ) );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 1.0 );
+  photon.embedInModel( local_model );
+
+  event_handler.updateObserversFromParticleSimulationStartedEvent();
+
+  // Every other history scores: re = sqrt(1/(n-1))
+  for( size_t i = 0; i < 96; ++i )
+  {
+    if( i % 2 == 0 )
+      event_handler.updateObserversFromParticleCollidingInCellEvent( photon, 1.0 );
+
+    event_handler.commitObserverHistoryContributions();
+  }
+
+  event_handler.takeSnapshotOfObserverStates();
+
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfCompletedHistories(), 96 );
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfTargetsMet(), 0 );
+  FRENSIE_CHECK( !event_handler.isSimulationComplete() );
+
+  for( size_t i = 96; i < 104; ++i )
+  {
+    if( i % 2 == 0 )
+      event_handler.updateObserversFromParticleCollidingInCellEvent( photon, 1.0 );
+
+    event_handler.commitObserverHistoryContributions();
+  }
+
+  // The criterion is only evaluated after a snapshot has been taken
+  FRENSIE_CHECK( !event_handler.isSimulationComplete() );
+
+  event_handler.takeSnapshotOfObserverStates();
+
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfTargetsMet(), 1 );
+  FRENSIE_CHECK( event_handler.isSimulationComplete() );
+
+  // An unreachable figure of merit target will prevent completion
+  criterion->addTotalBinTarget( local_estimator, 0, 0.1, 1e300 );
+
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfTargets(), 2 );
+  FRENSIE_CHECK_EQUAL( criterion->getNumberOfTargetsMet(), 1 );
+  FRENSIE_CHECK( !event_handler.isSimulationComplete() );
+
+  // The precision criterion can be combined with other criteria
+  event_handler.setSimulationCompletionCriterion( criterion ||
+             MonteCarlo::ParticleHistorySimulationCompletionCriterion::createHistoryCountCriterion( 10 ) );
+
+  event_handler.updateObserversFromParticleSimulationStartedEvent();
+
+  for( size_t i = 0; i < 10; ++i )
+    event_handler.commitObserverHistoryContributions();
+
+  FRENSIE_CHECK( event_handler.isSimulationComplete() );
+
+  event_handler.updateObserversFromParticleSimulationStoppedEvent();
+}
+
 //---------------------------------------------------------------------------//
 // Check that estimators can be added
 FRENSIE_UNIT_TEST( EventHandler, addEstimator )
@@ -2907,6 +2999,70 @@ FRENSIE_UNIT_TEST( EventHandler, update_parallel )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that thread private estimator moments can be requested
+FRENSIE_UNIT_TEST( EventHandler,
+                   enableThreadSupport_thread_private_estimator_moments )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                              100, 1.0, {1, 2}, {1.0, 1.0} ) );
+
+  local_estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  // Thread private estimator moments mode off
+  {
+    MonteCarlo::SimulationGeneralProperties properties;
+    properties.setNumberOfHistories( threads );
+
+    MonteCarlo::EventHandler event_handler( properties );
+    event_handler.addEstimator( local_estimator );
+    event_handler.enableThreadSupport( threads );
+
+    FRENSIE_CHECK( !local_estimator->isThreadPrivateMomentAccumulationEnabled() );
+  }
+
+  // Thread private estimator moments mode on
+  MonteCarlo::SimulationGeneralProperties properties;
+  properties.setNumberOfHistories( threads );
+  properties.setThreadPrivateEstimatorMomentsModeOn();
+
+  MonteCarlo::EventHandler event_handler( properties );
+  event_handler.addEstimator( local_estimator );
+  event_handler.enableThreadSupport( threads );
+
+  FRENSIE_CHECK( local_estimator->isThreadPrivateMomentAccumulationEnabled() );
+
+  std::shared_ptr<const Geometry::Model>
+    model( new Geometry::InfiniteMediumModel( 1 ) );
+
+  #pragma omp parallel num_threads( threads )
+  {
+    MonteCarlo::PhotonState photon( Utility::OpenMPProperties::getThreadId() );
+    photon.setWeight( 1.0 );
+    photon.setEnergy( 1.0 );
+    photon.setDirection( 1.0, 0.0, 0.0 );
+    photon.embedInModel( model );
+
+    event_handler.updateObserversFromParticleCollidingInCellEvent( photon, 1.0 );
+
+    event_handler.commitObserverHistoryContributions();
+  }
+
+  // The thread private moments are merged when the snapshot is taken
+  event_handler.takeSnapshotOfObserverStates();
+
+  Utility::ArrayView<const double> first_moments, second_moments;
+  first_moments = local_estimator->getEntityBinDataFirstMoments( 1 );
+  second_moments = local_estimator->getEntityBinDataSecondMoments( 1 );
+
+  FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {1.0*threads} ) );
+  FRENSIE_CHECK_EQUAL( second_moments, std::vector<double>( {1.0*threads} ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the observer summaries can be printed
 FRENSIE_UNIT_TEST( EventHandler, printObserverSummaries )
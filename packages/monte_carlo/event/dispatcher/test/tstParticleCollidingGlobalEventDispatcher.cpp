@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstParticleCollidingGlobalEventDispatcher.cpp
+//! \author Alex Robinson
+//! \brief  Particle colliding global event dispatcher unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventDispatcher.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+estimator;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Isotropic emission at 1 MeV
+void evaluateIsotropicEmissionDensity(
+    const double[3],
+    MonteCarlo::ParticleCollidingGlobalEventObserver::EmissionDensityArray&
+    densities )
+{
+  densities.assign( 1, std::make_pair( 1.0, 0.25/Utility::PhysicalConstants::pi ) );
+}
+
+// A void
+double evaluateOpticalDepth( const double,
+                             const double[3],
+                             const double,
+                             const double )
+{
+  return 0.0;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that an observer can be managed
+FRENSIE_UNIT_TEST( ParticleCollidingGlobalEventDispatcher, manage_observers )
+{
+  std::shared_ptr<MonteCarlo::ParticleCollidingGlobalEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleCollidingGlobalEventDispatcher );
+
+  dispatcher->attachObserver( {MonteCarlo::PHOTON}, estimator );
+
+  FRENSIE_CHECK( estimator.use_count() > 1 );
+  FRENSIE_CHECK_EQUAL( dispatcher->getNumberOfObservers( MonteCarlo::PHOTON ), 1 );
+  FRENSIE_CHECK_EQUAL( dispatcher->getNumberOfObservers( MonteCarlo::ELECTRON ), 0 );
+  FRENSIE_CHECK_EQUAL( dispatcher->getNumberOfObservers( MonteCarlo::POSITRON ), 0 );
+  FRENSIE_CHECK_EQUAL( dispatcher->getNumberOfObservers( MonteCarlo::NEUTRON ), 0 );
+
+  dispatcher->detachObserver( estimator );
+
+  FRENSIE_CHECK_EQUAL( estimator.use_count(), 1 );
+  FRENSIE_CHECK_EQUAL( dispatcher->getNumberOfObservers( MonteCarlo::PHOTON ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the dispatcher can update from the global colliding event
+FRENSIE_UNIT_TEST( ParticleCollidingGlobalEventDispatcher,
+                   dispatchParticleCollidingGlobalEvent )
+{
+  std::shared_ptr<MonteCarlo::ParticleCollidingGlobalEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleCollidingGlobalEventDispatcher );
+
+  dispatcher->attachObserver( {MonteCarlo::PHOTON}, estimator );
+
+  MonteCarlo::PhotonState particle( 0 );
+  particle.setPosition( 0.0, 0.0, 0.0 );
+  particle.setDirection( 1.0, 0.0, 0.0 );
+  particle.setEnergy( 2.5 );
+  particle.setWeight( 1.0 );
+
+  dispatcher->dispatchParticleCollidingGlobalEvent(
+                                            particle,
+                                            &evaluateIsotropicEmissionDensity,
+                                            &evaluateOpticalDepth );
+
+  FRENSIE_CHECK( estimator->hasUncommittedHistoryContribution() );
+
+  estimator->commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 1.0 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+            estimator->getEntityBinDataFirstMoments( 0 ),
+            std::vector<double>( 1, 0.25/Utility::PhysicalConstants::pi/4.0 ),
+            1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  estimator.reset( new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                                        0u,
+                                                        1.0,
+                                                        {{2.0, 0.0, 0.0}} ) );
+
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstParticleCollidingGlobalEventDispatcher.cpp
+//---------------------------------------------------------------------------//
@@ -136,7 +136,7 @@ private:
                                               WeightAndChargeMultiplier );
 
   // Add info to update tracker
-  void addInfoToUpdateTracker( const unsigned thread_id,
+  void addInfoToUpdateTracker( const unsigned history_buffer,
                                const CellIdType cell_id,
                                const double source_weight,
                                const double energy_contribution,
@@ -144,12 +144,12 @@ private:
 
   // Get the entity iterators from the update tracker
   void getCellIteratorFromUpdateTracker(
-                const unsigned thread_id,
+                const unsigned history_buffer,
                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& start_cell,
                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& end_cell ) const;
 
   // Reset the update tracker
-  void resetUpdateTracker( const unsigned thread_id );
+  void resetUpdateTracker( const unsigned history_buffer );
 
   // Save the data to an archive
   template<typename Archive>
@@ -104,7 +104,7 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
 
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  const unsigned history_buffer = this->getObservedHistoryBuffer();
 
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
@@ -112,14 +112,14 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 
   double charge_contribution = particle.getWeight()*particle.getCharge();
 
-  this->addInfoToUpdateTracker( thread_id,
+  this->addInfoToUpdateTracker( history_buffer,
                                 cell_entering,
                                 particle.getSourceWeight(),
                                 energy_contribution,
                                 charge_contribution );
 
   // Indicate that there is an uncommitted history contribution
-  this->setHasUncommittedHistoryContribution( thread_id );
+  this->setHasUncommittedHistoryContribution( history_buffer );
 }
 
 // Add current history estimator contribution
@@ -135,7 +135,7 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 {
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  const unsigned history_buffer = this->getObservedHistoryBuffer();
 
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
@@ -145,14 +145,14 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 
   double charge_contribution = -particle.getWeight()*particle.getCharge();
 
-  this->addInfoToUpdateTracker( thread_id,
+  this->addInfoToUpdateTracker( history_buffer,
                                 cell_leaving,
                                 particle.getSourceWeight(),
                                 energy_contribution,
                                 charge_contribution );
 
   // Indicate that there is an uncommitted history contribution
-  this->setHasUncommittedHistoryContribution( thread_id );
+  this->setHasUncommittedHistoryContribution( history_buffer );
 }
 
 // Add estimator contribution from a portion of the current history
@@ -161,14 +161,18 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
 {
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
+  const unsigned history_buffer = this->getObservedHistoryBuffer();
+
   typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator
     cell_data, end_cell_data;
 
-  this->getCellIteratorFromUpdateTracker( thread_id, cell_data, end_cell_data );
+  this->getCellIteratorFromUpdateTracker( history_buffer,
+                                          cell_data,
+                                          end_cell_data );
 
   double energy_deposition_in_all_cells = 0.0;
   double charge_deposition_in_all_cells = 0.0;
-  double source_weight = d_update_tracker[thread_id].first;
+  double source_weight = d_update_tracker[history_buffer].first;
 
   size_t bin_index;
   double bin_contribution;
@@ -241,10 +245,10 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
   }
 
   // Reset the update tracker
-  this->resetUpdateTracker( thread_id );
+  this->resetUpdateTracker( history_buffer );
 
   // Reset the has uncommitted history contribution boolean
-  this->unsetHasUncommittedHistoryContribution( thread_id );
+  this->unsetHasUncommittedHistoryContribution( history_buffer );
 }
 
 // Print the estimator data
@@ -268,8 +272,8 @@ CellPulseHeightEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
 
   EntityEstimator::enableThreadSupport( num_threads );
 
-  // Add thread support to update tracker
-  d_update_tracker.resize( num_threads );
+  // Add thread support to update tracker (one per in flight history)
+  d_update_tracker.resize( this->getNumberOfHistoryBuffers( num_threads ) );
 
   // Add thread support to the dimension values
   d_dimension_values.resize( num_threads );
@@ -396,30 +400,30 @@ inline double CellPulseHeightEstimator<ContributionMultiplierPolicy>::calculateH
 // Add info to update tracker
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTracker(
-                                             const unsigned thread_id,
+                                             const unsigned history_buffer,
                                              const CellIdType cell_id,
                                              const double source_weight,
                                              const double energy_contribution,
                                              const double charge_contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer < d_update_tracker.size() );
 
-  SerialUpdateTracker& thread_update_tracker = d_update_tracker[thread_id];
+  SerialUpdateTracker& history_update_tracker = d_update_tracker[history_buffer];
 
-  auto cell_it = thread_update_tracker.second.find( cell_id );
+  auto cell_it = history_update_tracker.second.find( cell_id );
 
-  if( thread_update_tracker.first == 0.0 )
-    thread_update_tracker.first = source_weight;
+  if( history_update_tracker.first == 0.0 )
+    history_update_tracker.first = source_weight;
 
-  if( cell_it != thread_update_tracker.second.end() )
+  if( cell_it != history_update_tracker.second.end() )
   {
     Utility::get<0>( cell_it->second ) += energy_contribution;
     Utility::get<1>( cell_it->second ) += charge_contribution;
   }
   else
   {
-    thread_update_tracker.second[cell_id] =
+    history_update_tracker.second[cell_id] =
       std::make_pair( energy_contribution, charge_contribution );
   }
 }
@@ -427,28 +431,28 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTrac
 // Get the entity iterators from the update tracker
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::getCellIteratorFromUpdateTracker(
-                 const unsigned thread_id,
+                 const unsigned history_buffer,
                  typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& start_cell,
                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& end_cell ) const
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer < d_update_tracker.size() );
 
-  start_cell = d_update_tracker[thread_id].second.begin();
-  end_cell = d_update_tracker[thread_id].second.end();
+  start_cell = d_update_tracker[history_buffer].second.begin();
+  end_cell = d_update_tracker[history_buffer].second.end();
 }
 
 // Reset the update tracker
 template<typename ContributionMultiplierPolicy>
 void
 CellPulseHeightEstimator<ContributionMultiplierPolicy>::resetUpdateTracker(
-                                                     const unsigned thread_id )
+                                                     const unsigned history_buffer )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer < d_update_tracker.size() );
 
-  d_update_tracker[thread_id].first = 0.0;
-  d_update_tracker[thread_id].second.clear();
+  d_update_tracker[history_buffer].first = 0.0;
+  d_update_tracker[history_buffer].second.clear();
 }
 
 // Save the data to an archive
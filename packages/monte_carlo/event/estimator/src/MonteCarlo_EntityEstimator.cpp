@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -34,7 +37,9 @@ EntityEstimator::EntityEstimator( const Id id,
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_thread_private_moments_enabled( false ),
+    d_thread_private_moments()
 { /* ... */ }
 
 // Return the entity ids associated with this estimator
@@ -189,6 +194,9 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
 {
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Make sure that all thread contributions are in the shared moments
+  this->mergeThreadPrivateMoments();
   
   if( d_entity_bin_snapshots_enabled )
   {
@@ -482,6 +490,7 @@ void EntityEstimator::enableSampleMomentHistogramsOnEntityBins()
 
   this->initializeEntityEstimatorHistogramsMap();
   this->resizeEstimatorTotalHistograms();
+  this->initializeThreadPrivateMoments();
 }
 
 // Check if sample moment histograms are enabled on on entity bins
@@ -490,6 +499,34 @@ bool EntityEstimator::areSampleMomentHistogramsOnEntityBinsEnabled() const
   return d_entity_bin_histograms_enabled;
 }
 
+// Enable thread private moment accumulation
+/*! \details When thread private moment accumulation is enabled each thread
+ * (other than the root thread) will accumulate its history contributions in a
+ * private copy of the estimator moments and histograms. No locks are
+ * required when a history contribution is committed. The private copies
+ * are merged into the shared moments when a snapshot is taken or when the
+ * data is reduced. The memory required by the estimator moments will be
+ * increased by a factor equal to the number of threads. Note that the
+ * moments returned by the accessor methods will only contain the
+ * contributions from other threads after a snapshot or a reduction has
+ * been done.
+ */
+void EntityEstimator::enableThreadPrivateMomentAccumulation()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_thread_private_moments_enabled = true;
+
+  this->initializeThreadPrivateMoments();
+}
+
+// Check if thread private moment accumulation has been enabled
+bool EntityEstimator::isThreadPrivateMomentAccumulationEnabled() const
+{
+  return d_thread_private_moments_enabled;
+}
+
 // Get the entity bin sample moment histogram
 void EntityEstimator::getEntityBinSampleMomentHistogram(
                       const EntityId entity_id,
@@ -529,6 +566,17 @@ void EntityEstimator::getTotalBinSampleMomentHistogram(
     histogram = d_estimator_total_bin_histograms[bin_index];
 }
 
+// Enable support for multiple threads
+void EntityEstimator::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  Estimator::enableThreadSupport( num_threads );
+
+  this->initializeThreadPrivateMoments();
+}
+
 // Reset the estimator data
 void EntityEstimator::resetData()
 {
@@ -562,6 +610,26 @@ void EntityEstimator::resetData()
         histogram.reset();
     }
   }
+
+  // Reset the thread private moments
+  for( auto&& thread_moments : d_thread_private_moments )
+  {
+    thread_moments.total_bin_data.reset();
+
+    for( auto&& entity_data : thread_moments.entity_moments_map )
+      entity_data.second.reset();
+
+    for( auto&& histogram : thread_moments.total_bin_histograms )
+      histogram.reset();
+
+    for( auto&& entity_data : thread_moments.entity_histograms_map )
+    {
+      for( auto&& histogram : entity_data.second )
+        histogram.reset();
+    }
+
+    thread_moments.updated = false;
+  }
 }
 
 // Reduce estimator data on all processes and collect on the root process
@@ -571,6 +639,9 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Make sure that all thread contributions are in the shared moments
+  this->mergeThreadPrivateMoments();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -583,8 +654,6 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
                              "estimator " << this->getId() << " for entity "
                              "bin data!" );
 
-    comm.barrier();
-
     // Reduce bin data of total
     try{
       this->reduceCollection( comm, root_process, d_estimator_total_bin_data );
@@ -641,74 +710,50 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
 }
 
 // Reduce the entity collection maps
+/*! \details The moments of every entity are packed into a single buffer
+ * using a fixed global entity ordering (ascending entity id) so that only one
+ * reduction is required. The entities and the collection sizes must be the
+ * same on every process.
+ */
 void EntityEstimator::reduceEntityCollectionMaps(
                     const Utility::Communicator& comm,
                     const int root_process,
                     EntityEstimatorMomentsCollectionMap& collection_map ) const
 {
-  // Gather all of the entity data on the root process
-  if( comm.rank() == root_process )
-  {
-    std::vector<EntityEstimatorMomentsCollectionMap>
-      gathered_entity_data( comm.size() );
+  // Determine the global entity ordering
+  std::vector<EntityId> entity_ids;
+  entity_ids.reserve( collection_map.size() );
 
-    std::vector<Utility::Communicator::Request> gathered_requests;
+  size_t number_of_moments = 0;
 
-    for( size_t i = 0; i < comm.size(); ++i )
-    {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
+  for( auto&& entity_data : collection_map )
+  {
+    entity_ids.push_back( entity_data.first );
 
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
-    
-    Utility::wait( gathered_requests, gathered_statuses );
-    
-    this->reduceEntityCollections( gathered_entity_data,
-                                   root_process,
-                                   collection_map );
+    number_of_moments += 4*entity_data.second.size();
   }
-  else
-    Utility::send( comm, root_process, 0, collection_map );
-}
 
-// Reduce the entity moments
-void EntityEstimator::reduceEntityCollections(
-                    const std::vector<EntityEstimatorMomentsCollectionMap>&
-                    other_entity_estimator_moments_maps,
-                    const size_t root_index,
-                    EntityEstimatorMomentsCollectionMap& collection_map ) const
-{
-  // Reduce the data that was on each process
-  for( auto&& entity_data : collection_map )
-  {
-    // Don't double count data on this process (j starts from 1)
-    for( size_t j = 0; j < other_entity_estimator_moments_maps.size(); ++j )
-    {
-      if( j != root_index )
-      {
-        const EntityEstimatorMomentsCollectionMap::value_type&
-          other_entity_data = *other_entity_estimator_moments_maps[j].find( entity_data.first );
+  std::sort( entity_ids.begin(), entity_ids.end() );
 
-        for( size_t i = 0; i < entity_data.second.size(); ++i )
-        {
-          Utility::getCurrentScore<1>( entity_data.second, i ) +=
-            Utility::getCurrentScore<1>( other_entity_data.second, i );
+  // Pack the moments of every entity
+  std::vector<double> packed_moments;
+  packed_moments.reserve( number_of_moments );
 
-          Utility::getCurrentScore<2>( entity_data.second, i ) +=
-            Utility::getCurrentScore<2>( other_entity_data.second, i );
+  for( auto&& entity_id : entity_ids )
+    Estimator::packMoments( collection_map.find( entity_id )->second, packed_moments );
 
-          Utility::getCurrentScore<3>( entity_data.second, i ) +=
-            Utility::getCurrentScore<3>( other_entity_data.second, i );
+  this->reducePackedMoments( comm, root_process, packed_moments );
 
-          Utility::getCurrentScore<4>( entity_data.second, i ) +=
-            Utility::getCurrentScore<4>( other_entity_data.second, i );
-        }
-      }
+  // The root process will store the reduced moments
+  if( comm.rank() == root_process )
+  {
+    size_t offset = 0;
+
+    for( auto&& entity_id : entity_ids )
+    {
+      Estimator::unpackMoments( packed_moments,
+                                offset,
+                                collection_map.find( entity_id )->second );
     }
   }
 }
@@ -945,6 +990,9 @@ void EntityEstimator::assignEntities(
   this->resizeEstimatorTotalCollection();
   this->resizeEstimatorTotalSnapshots();
   this->resizeEstimatorTotalHistograms();
+
+  // Resize the thread private data
+  this->initializeThreadPrivateMoments();
 }
 
 // Assign discretization to an estimator dimension
@@ -974,6 +1022,9 @@ void EntityEstimator::assignDiscretization(
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
+
+  // Resize the thread private data
+  this->initializeThreadPrivateMoments();
 }
 
 // Set the response functions
@@ -999,6 +1050,9 @@ void EntityEstimator::assignResponseFunction(
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
+
+  // Resize the thread private data
+  this->initializeThreadPrivateMoments();
 }
 
 // Assign the history score pdf bins
@@ -1017,6 +1071,9 @@ void EntityEstimator::assignSampleMomentHistogramBins( const std::shared_ptr<con
         histogram.setBinBoundaries( bins );
     }
   }
+
+  // Reset the thread private histograms
+  this->initializeThreadPrivateMoments();
 }
 
 // Commit history contribution to a bin of an entity
@@ -1032,18 +1089,56 @@ void EntityEstimator::commitHistoryContributionToBinOfEntity(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  FourEstimatorMomentsCollection& entity_estimator_moments =
-    d_entity_estimator_moments_map.find( entity_id )->second;
-
-  // Update the moments
-  #pragma omp critical
+  if( d_thread_private_moments_enabled )
   {
-    entity_estimator_moments.addRawScore( bin_index, contribution );
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+    // The root thread has sole access to the shared moments until the
+    // thread private moments are merged
+    if( thread_id == 0 )
+    {
+      d_entity_estimator_moments_map.find( entity_id )->second.addRawScore(
+                                                    bin_index, contribution );
+
+      if( d_entity_bin_histograms_enabled )
+      {
+        d_entity_estimator_histograms_map.find( entity_id )->second[bin_index].addRawScore( contribution );
+      }
+    }
+    else
+    {
+      // Make sure the thread id is valid
+      testPrecondition( thread_id <= d_thread_private_moments.size() );
+      
+      ThreadPrivateMoments& thread_moments =
+        d_thread_private_moments[thread_id-1];
+
+      thread_moments.entity_moments_map.find( entity_id )->second.addRawScore(
+                                                    bin_index, contribution );
+
+      if( d_entity_bin_histograms_enabled )
+      {
+        thread_moments.entity_histograms_map.find( entity_id )->second[bin_index].addRawScore( contribution );
+      }
+
+      thread_moments.updated = true;
+    }
   }
+  else
+  {
+    FourEstimatorMomentsCollection& entity_estimator_moments =
+      d_entity_estimator_moments_map.find( entity_id )->second;
+    
+    // Update the moments
+    #pragma omp critical
+    {
+      entity_estimator_moments.addRawScore( bin_index, contribution );
+    }
 
-  this->addHistoryContributionToEntityBinHistogram( entity_id,
-                                                    bin_index,
-                                                    contribution );
+    this->addHistoryContributionToEntityBinHistogram( entity_id,
+                                                      bin_index,
+                                                      contribution );
+  }
 }
 
 // Add contribution to histogram
@@ -1082,13 +1177,163 @@ void EntityEstimator::commitHistoryContributionToBinOfTotal(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  // Update the moments
-  #pragma omp critical
+  if( d_thread_private_moments_enabled )
+  {
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+    // The root thread has sole access to the shared moments until the
+    // thread private moments are merged
+    if( thread_id == 0 )
+    {
+      d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+
+      if( d_entity_bin_histograms_enabled )
+        d_estimator_total_bin_histograms[bin_index].addRawScore( contribution );
+    }
+    else
+    {
+      // Make sure the thread id is valid
+      testPrecondition( thread_id <= d_thread_private_moments.size() );
+      
+      ThreadPrivateMoments& thread_moments =
+        d_thread_private_moments[thread_id-1];
+
+      thread_moments.total_bin_data.addRawScore( bin_index, contribution );
+
+      if( d_entity_bin_histograms_enabled )
+        thread_moments.total_bin_histograms[bin_index].addRawScore( contribution );
+
+      thread_moments.updated = true;
+    }
+  }
+  else
   {
-    d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    // Update the moments
+    #pragma omp critical
+    {
+      d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    }
+
+    this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
   }
+}
+
+// Merge the thread private moments into the shared moments
+/*! \details This must only be called by the root thread outside of a
+ * parallel region. The thread private moments will be reset after they
+ * have been merged. The moments are merged in thread order so that the
+ * results are reproducible for a fixed thread/history assignment.
+ */
+void EntityEstimator::mergeThreadPrivateMoments()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( auto&& thread_moments : d_thread_private_moments )
+  {
+    if( thread_moments.updated )
+    {
+      EntityEstimator::mergeThreadPrivateCollection(
+                                               thread_moments.total_bin_data,
+                                               d_estimator_total_bin_data );
+
+      EntityEstimator::mergeThreadPrivateCollectionMap(
+                                            thread_moments.entity_moments_map,
+                                            d_entity_estimator_moments_map );
+
+      if( d_entity_bin_histograms_enabled )
+      {
+        EntityEstimator::mergeThreadPrivateHistogramArray(
+                                         thread_moments.total_bin_histograms,
+                                         d_estimator_total_bin_histograms );
+
+        EntityEstimator::mergeThreadPrivateHistogramArrayMap(
+                                         thread_moments.entity_histograms_map,
+                                         d_entity_estimator_histograms_map );
+      }
 
-  this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
+      thread_moments.updated = false;
+    }
+  }
+}
+
+// Merge a thread private collection into a shared collection
+/*! \details The thread private collection will be reset.
+ */
+void EntityEstimator::mergeThreadPrivateCollection(
+                              FourEstimatorMomentsCollection& private_collection,
+                              FourEstimatorMomentsCollection& collection )
+{
+  // Make sure the collections are compatible
+  testPrecondition( private_collection.size() == collection.size() );
+
+  for( size_t i = 0; i < collection.size(); ++i )
+  {
+    Utility::getCurrentScore<1>( collection, i ) +=
+      Utility::getCurrentScore<1>( private_collection, i );
+
+    Utility::getCurrentScore<2>( collection, i ) +=
+      Utility::getCurrentScore<2>( private_collection, i );
+
+    Utility::getCurrentScore<3>( collection, i ) +=
+      Utility::getCurrentScore<3>( private_collection, i );
+
+    Utility::getCurrentScore<4>( collection, i ) +=
+      Utility::getCurrentScore<4>( private_collection, i );
+  }
+
+  private_collection.reset();
+}
+
+// Merge a thread private collection map into a shared collection map
+/*! \details The thread private collection map will be reset.
+ */
+void EntityEstimator::mergeThreadPrivateCollectionMap(
+                        EntityEstimatorMomentsCollectionMap& private_map,
+                        EntityEstimatorMomentsCollectionMap& collection_map )
+{
+  for( auto&& entity_data : private_map )
+  {
+    EntityEstimator::mergeThreadPrivateCollection(
+                           entity_data.second,
+                           collection_map.find( entity_data.first )->second );
+  }
+}
+
+// Merge a thread private histogram array into a shared histogram array
+/*! \details The thread private histograms will be reset.
+ */
+void EntityEstimator::mergeThreadPrivateHistogramArray(
+                         SampleMomentHistogramArray& private_histogram_array,
+                         SampleMomentHistogramArray& histogram_array )
+{
+  // Make sure the histogram arrays are compatible
+  testPrecondition( private_histogram_array.size() == histogram_array.size() );
+
+  for( size_t i = 0; i < histogram_array.size(); ++i )
+  {
+    if( private_histogram_array[i].getNumberOfScores() > 0 )
+    {
+      histogram_array[i].mergeHistograms( private_histogram_array[i] );
+
+      private_histogram_array[i].reset();
+    }
+  }
+}
+
+// Merge a thread private histogram map into a shared histogram map
+/*! \details The thread private histograms will be reset.
+ */
+void EntityEstimator::mergeThreadPrivateHistogramArrayMap(
+                 EntityEstimatorSampleMomentHistogramArrayMap& private_map,
+                 EntityEstimatorSampleMomentHistogramArrayMap& histogram_map )
+{
+  for( auto&& entity_data : private_map )
+  {
+    EntityEstimator::mergeThreadPrivateHistogramArray(
+                            entity_data.second,
+                            histogram_map.find( entity_data.first )->second );
+  }
 }
 
 // Add contribution to total bin histogram
@@ -1228,6 +1473,53 @@ void EntityEstimator::calculateTotalNormalizationConstant()
     d_total_norm_constant += entity_data.second;
 }
 
+// Initialize the thread private moments
+/*! \details The thread private moments will mirror the layout of the shared
+ * moments. Any contributions that have not been merged will be lost so this
+ * should only be called when the estimator is being set up.
+ */
+void EntityEstimator::initializeThreadPrivateMoments()
+{
+  d_thread_private_moments.clear();
+  
+  if( d_thread_private_moments_enabled &&
+      this->getNumberOfSupportedThreads() > 1 )
+  {
+    ThreadPrivateMoments default_thread_moments;
+
+    default_thread_moments.total_bin_data = d_estimator_total_bin_data;
+    default_thread_moments.total_bin_data.reset();
+
+    default_thread_moments.entity_moments_map = d_entity_estimator_moments_map;
+
+    for( auto&& entity_data : default_thread_moments.entity_moments_map )
+      entity_data.second.reset();
+
+    if( d_entity_bin_histograms_enabled )
+    {
+      default_thread_moments.total_bin_histograms =
+        d_estimator_total_bin_histograms;
+
+      for( auto&& histogram : default_thread_moments.total_bin_histograms )
+        histogram.reset();
+
+      default_thread_moments.entity_histograms_map =
+        d_entity_estimator_histograms_map;
+
+      for( auto&& entity_data : default_thread_moments.entity_histograms_map )
+      {
+        for( auto&& histogram : entity_data.second )
+          histogram.reset();
+      }
+    }
+
+    default_thread_moments.updated = false;
+
+    d_thread_private_moments.resize( this->getNumberOfSupportedThreads()-1,
+                                     default_thread_moments );
+  }
+}
+
 // Initialize entity estimator snapshots map
 void EntityEstimator::initializeEntityEstimatorSnapshotsMap()
 {
@@ -173,6 +173,12 @@ public:
   //! Check if sample moment histograms are enabled on on entity bins
   bool areSampleMomentHistogramsOnEntityBinsEnabled() const final override;
 
+  //! Enable thread private moment accumulation
+  void enableThreadPrivateMomentAccumulation() override;
+
+  //! Check if thread private moment accumulation has been enabled
+  bool isThreadPrivateMomentAccumulationEnabled() const final override;
+
   //! Get the entity bin sample moment histogram
   void getEntityBinSampleMomentHistogram(
       const EntityId entity_id,
@@ -184,6 +190,9 @@ public:
       const size_t bin_index,
       Utility::SampleMomentHistogram<double>& histogram ) const final override;
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) override;
+
   //! Reset estimator data
   void resetData() override;
 
@@ -222,6 +231,29 @@ protected:
   void commitHistoryContributionToBinOfTotal( const size_t bin_index,
 					      const double contribution );
 
+  //! Merge the thread private moments into the shared moments
+  virtual void mergeThreadPrivateMoments();
+
+  //! Merge a thread private collection into a shared collection
+  static void mergeThreadPrivateCollection(
+                              FourEstimatorMomentsCollection& private_collection,
+                              FourEstimatorMomentsCollection& collection );
+
+  //! Merge a thread private collection map into a shared collection map
+  static void mergeThreadPrivateCollectionMap(
+                        EntityEstimatorMomentsCollectionMap& private_map,
+                        EntityEstimatorMomentsCollectionMap& collection_map );
+
+  //! Merge a thread private histogram array into a shared histogram array
+  static void mergeThreadPrivateHistogramArray(
+                         SampleMomentHistogramArray& private_histogram_array,
+                         SampleMomentHistogramArray& histogram_array );
+
+  //! Merge a thread private histogram map into a shared histogram map
+  static void mergeThreadPrivateHistogramArrayMap(
+                  EntityEstimatorSampleMomentHistogramArrayMap& private_map,
+                  EntityEstimatorSampleMomentHistogramArrayMap& histogram_map );
+
   //! Print the estimator data
   virtual void printImplementation( std::ostream& os,
 				    const std::string& entity_type ) const;
@@ -258,6 +290,28 @@ protected:
 
 private:
 
+  // The thread private estimator moments (for threads other than the root)
+  struct ThreadPrivateMoments
+  {
+    // The estimator moments for each bin of the total
+    FourEstimatorMomentsCollection total_bin_data;
+
+    // The estimator moments for each bin and each entity
+    EntityEstimatorMomentsCollectionMap entity_moments_map;
+
+    // The sample moment histograms for each bin of the total
+    SampleMomentHistogramArray total_bin_histograms;
+
+    // The sample moment histograms for each bin and each entity
+    EntityEstimatorSampleMomentHistogramArrayMap entity_histograms_map;
+
+    // Records if the thread has committed a contribution since the last merge
+    bool updated;
+  };
+
+  // Initialize the thread private moments
+  void initializeThreadPrivateMoments();
+
   // Initialize entity estimator moments map
   template<typename InputEntityId>
   void initializeEntityEstimatorMomentsMap(
@@ -311,13 +365,6 @@ private:
   void addHistoryContributionToTotalBinHistogram( const size_t bin_index,
                                                   const double contribution );
 
-  // Reduce the entity collections
-  void reduceEntityCollections(
-                   const std::vector<EntityEstimatorMomentsCollectionMap>&
-                   other_entity_estimator_moments_maps,
-                   const size_t root_index,
-                   EntityEstimatorMomentsCollectionMap& collection_map ) const;
-
   // Reduce the entity snapshots
   void reduceEntitySnapshots(
            const std::vector<EntityEstimatorMomentsCollectionSnapshotsMap>&
@@ -389,11 +436,17 @@ private:
 
   // The entity normalization constants (surface areas or cell volumes)
   EntityNormConstMap d_entity_norm_constants_map;
+
+  // Bool that records if thread private moment accumulation has been enabled
+  bool d_thread_private_moments_enabled;
+
+  // The thread private moments (the root thread uses the shared moments)
+  std::vector<ThreadPrivateMoments> d_thread_private_moments;
 };
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes.
@@ -36,7 +36,9 @@ EntityEstimator::EntityEstimator(
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_thread_private_moments_enabled( false ),
+    d_thread_private_moments()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
                       std::runtime_error,
@@ -76,7 +78,9 @@ EntityEstimator::EntityEstimator( const Id id,
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_thread_private_moments_enabled( false ),
+    d_thread_private_moments()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
                       std::runtime_error,
@@ -159,6 +163,11 @@ void EntityEstimator::initializeEntityNormConstantsMap(
 template<typename Archive>
 void EntityEstimator::serialize( Archive& ar, const unsigned version )
 {
+  // The thread private moments are not archived - merge them into the
+  // shared moments (including the moments of derived classes) first
+  if( Archive::is_saving::value )
+    this->mergeThreadPrivateMoments();
+  
   // Serialize the base class data
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Estimator );
 
@@ -174,6 +183,17 @@ void EntityEstimator::serialize( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_histograms );
   ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_histograms_map );
   ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_thread_private_moments_enabled );
+  else
+    d_thread_private_moments_enabled = false;
+
+  // Do not serialize the thread private moments because they are thread
+  // specific - they were merged into the shared moments before the
+  // estimator was archived
+  if( Archive::is_loading::value )
+    d_thread_private_moments.clear();
 }
 
 } // end MonteCarlo namespace
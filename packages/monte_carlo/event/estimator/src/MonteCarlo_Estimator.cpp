@@ -22,7 +22,8 @@ std::shared_ptr<const std::vector<double> > Estimator::s_default_sample_moment_h
   
 // Default constructor
 Estimator::Estimator()
-  : d_id( std::numeric_limits<Id>::max() )
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_number_of_supported_threads( 1 )
 { /* ... */ }
   
 // Constructor
@@ -32,6 +33,7 @@ Estimator::Estimator( const Id id, const double multiplier )
     d_particle_types(),
     d_response_functions( 1 ),
     d_sample_moment_histogram_bins( Estimator::getDefaultSampleMomentHistogramBins() ),
+    d_number_of_supported_threads( 1 ),
     d_has_uncommitted_history_contribution( 1, false )
 {
   // Make sure the multiplier is valid
@@ -205,29 +207,41 @@ void Estimator::setCosineCutoffValue( const double )
 }
 
 // Check if the estimator has uncommitted history contributions
+/*! \details The history buffer is the thread id unless several histories
+ * can be in flight on each thread.
+ */
 bool Estimator::hasUncommittedHistoryContribution(
-					       const unsigned thread_id ) const
+                                          const unsigned history_buffer ) const
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer <
+                    d_has_uncommitted_history_contribution.size() );
 
-  return d_has_uncommitted_history_contribution[thread_id];
+  return d_has_uncommitted_history_contribution[history_buffer];
 }
 
 // Check if the estimator has uncommitted history contributions
 bool Estimator::hasUncommittedHistoryContribution() const
 {
   return this->hasUncommittedHistoryContribution(
-				    Utility::OpenMPProperties::getThreadId() );
+                                     this->getObservedHistoryBuffer() );
 }
 
 // Enable support for multiple threads
+/*! \details A history buffer will be created for every history that can be
+ * in flight on each thread.
+ */
 void Estimator::enableThreadSupport( const unsigned num_threads )
 {
   // Make sure only the master thread calls this function
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
-  d_has_uncommitted_history_contribution.resize( num_threads, false );
+  d_number_of_supported_threads = num_threads;
+
+  d_has_uncommitted_history_contribution.resize(
+                        this->getNumberOfHistoryBuffers( num_threads ), false );
+
+  this->enableDiscretizationThreadSupport( num_threads );
 }
 
 // Reduce estimator data on all processes and collect on the root process
@@ -1002,17 +1016,27 @@ size_t Estimator::getNumberOfAssignedParticleTypes() const
   return d_particle_types.size();
 }
 
+// Get the number of threads that are supported
+/*! \details This is the number of threads that was passed to the last
+ * call to enableThreadSupport (one by default).
+ */
+unsigned Estimator::getNumberOfSupportedThreads() const
+{
+  return d_number_of_supported_threads;
+}
+
 // Set the has uncommited history contribution flag
 /*! \details This should be called whenever the current history contributes
  * to the estimator.
  */
 void Estimator::setHasUncommittedHistoryContribution(
-						     const unsigned thread_id )
+                                                const unsigned history_buffer )
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer <
+                    d_has_uncommitted_history_contribution.size() );
 
-  d_has_uncommitted_history_contribution[thread_id] = true;
+  d_has_uncommitted_history_contribution[history_buffer] = true;
 }
 
 // Unset the has uncommited history contribution flag
@@ -1020,15 +1044,19 @@ void Estimator::setHasUncommittedHistoryContribution(
  * committed to the estimator
  */
 void Estimator::unsetHasUncommittedHistoryContribution(
-						     const unsigned thread_id )
+                                                const unsigned history_buffer )
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer <
+                    d_has_uncommitted_history_contribution.size() );
 
-  d_has_uncommitted_history_contribution[thread_id] = false;
+  d_has_uncommitted_history_contribution[history_buffer] = false;
 }
 
 // Reduce a single collection
+/*! \details All of the moments are packed into a single buffer so that only
+ * one reduction is required.
+ */
 void Estimator::reduceCollection(
                               const Utility::Communicator& comm,
                               const int root_process,
@@ -1037,38 +1065,26 @@ void Estimator::reduceCollection(
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
+  std::vector<double> packed_moments;
+  packed_moments.reserve( 2*collection.size() );
 
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
+  Estimator::packMoments( collection, packed_moments );
+
+  this->reducePackedMoments( comm, root_process, packed_moments );
 
   // The root process will store the reduced moments
   if( comm.rank() == root_process )
   {
-    for( size_t i = 0; i < collection.size(); ++i )
-    {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
-    }
-  }
+    size_t offset = 0;
 
-  comm.barrier();
+    Estimator::unpackMoments( packed_moments, offset, collection );
+  }
 }
 
 // Reduce a single collection
+/*! \details All of the moments are packed into a single buffer so that only
+ * one reduction is required.
+ */
 void Estimator::reduceCollection(
                              const Utility::Communicator& comm,
                              const int root_process,
@@ -1077,56 +1093,108 @@ void Estimator::reduceCollection(
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
+  std::vector<double> packed_moments;
+  packed_moments.reserve( 4*collection.size() );
 
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
+  Estimator::packMoments( collection, packed_moments );
 
-  comm.barrier();
+  this->reducePackedMoments( comm, root_process, packed_moments );
 
-  // Reduce the third moments
-  std::vector<double> reduced_third_moments;
+  // The root process will store the reduced moments
+  if( comm.rank() == root_process )
+  {
+    size_t offset = 0;
 
-  this->reduceCollectionAndReturnReducedMoments<3>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_third_moments );
+    Estimator::unpackMoments( packed_moments, offset, collection );
+  }
+}
 
-  comm.barrier();
+// Reduce packed moments
+/*! \details The packed moments of every process will be summed with a single
+ * collective reduction (the mpi implementation is free to use a tree-based
+ * algorithm). Every process must pack the same number of moments in the
+ * same order. Only the packed moments on the root process will be updated
+ * with the reduced values.
+ */
+void Estimator::reducePackedMoments( const Utility::Communicator& comm,
+                                     const int root_process,
+                                     std::vector<double>& packed_moments ) const
+{
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
 
-  // Reduce the fourth moments
-  std::vector<double> reduced_fourth_moments;
+  try{
+    if( comm.rank() == root_process )
+    {
+      std::vector<double> reduced_moments( packed_moments.size() );
 
-  this->reduceCollectionAndReturnReducedMoments<4>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_fourth_moments );
+      Utility::reduce( comm,
+                       Utility::ArrayView<const double>( packed_moments ),
+                       Utility::arrayView( reduced_moments ),
+                       std::plus<double>(),
+                       root_process );
 
-  // The root process will store the reduced moments
-  if( comm.rank() == root_process )
-  {
-    for( size_t i = 0; i < collection.size(); ++i )
+      packed_moments.swap( reduced_moments );
+    }
+    else
     {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
-      Utility::getCurrentScore<3>( collection, i ) = reduced_third_moments[i];
-      Utility::getCurrentScore<4>( collection, i ) = reduced_fourth_moments[i];
+      Utility::reduce( comm,
+                       Utility::ArrayView<const double>( packed_moments ),
+                       std::plus<double>(),
+                       root_process );
     }
   }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction over the packed "
+                           "moments of estimator " << d_id << "!" );
+}
+
+// Append the moments of a collection to the packed moments
+/*! \details The moments will be appended in order (all first moments, then
+ * all second moments).
+ */
+void Estimator::packMoments( const TwoEstimatorMomentsCollection& collection,
+                             std::vector<double>& packed_moments )
+{
+  Estimator::packMomentsOfOrder<1>( collection, packed_moments );
+  Estimator::packMomentsOfOrder<2>( collection, packed_moments );
+}
+
+// Append the moments of a collection to the packed moments
+/*! \details The moments will be appended in order (all first moments, then
+ * all second moments, etc.).
+ */
+void Estimator::packMoments( const FourEstimatorMomentsCollection& collection,
+                             std::vector<double>& packed_moments )
+{
+  Estimator::packMomentsOfOrder<1>( collection, packed_moments );
+  Estimator::packMomentsOfOrder<2>( collection, packed_moments );
+  Estimator::packMomentsOfOrder<3>( collection, packed_moments );
+  Estimator::packMomentsOfOrder<4>( collection, packed_moments );
+}
+
+// Extract the moments of a collection from the packed moments
+/*! \details The offset will be advanced past the extracted moments.
+ */
+void Estimator::unpackMoments( const std::vector<double>& packed_moments,
+                               size_t& offset,
+                               TwoEstimatorMomentsCollection& collection )
+{
+  Estimator::unpackMomentsOfOrder<1>( packed_moments, offset, collection );
+  Estimator::unpackMomentsOfOrder<2>( packed_moments, offset, collection );
+}
 
-  comm.barrier();
+// Extract the moments of a collection from the packed moments
+/*! \details The offset will be advanced past the extracted moments.
+ */
+void Estimator::unpackMoments( const std::vector<double>& packed_moments,
+                               size_t& offset,
+                               FourEstimatorMomentsCollection& collection )
+{
+  Estimator::unpackMomentsOfOrder<1>( packed_moments, offset, collection );
+  Estimator::unpackMomentsOfOrder<2>( packed_moments, offset, collection );
+  Estimator::unpackMomentsOfOrder<3>( packed_moments, offset, collection );
+  Estimator::unpackMomentsOfOrder<4>( packed_moments, offset, collection );
 }
 
 // Reduce snapshots
@@ -134,6 +134,12 @@ public:
   //! Check if sample moment histograms are enabled on on entity bins
   virtual bool areSampleMomentHistogramsOnEntityBinsEnabled() const = 0;
 
+  //! Enable thread private moment accumulation
+  virtual void enableThreadPrivateMomentAccumulation() = 0;
+
+  //! Check if thread private moment accumulation has been enabled
+  virtual bool isThreadPrivateMomentAccumulationEnabled() const = 0;
+
   //! Get the total estimator bin data first moments
   virtual Utility::ArrayView<const double> getTotalBinDataFirstMoments() const = 0;
 
@@ -438,7 +444,7 @@ public:
   virtual void setCosineCutoffValue( const double cosine_cutoff );
 
   //! Check if the estimator has uncommitted history contributions
-  bool hasUncommittedHistoryContribution( const unsigned thread_id ) const;
+  bool hasUncommittedHistoryContribution( const unsigned history_buffer ) const;
 
   //! Check if the estimator has uncommitted history contributions
   bool hasUncommittedHistoryContribution() const final override;
@@ -473,11 +479,14 @@ protected:
   //! Get the sample moment histogram bins
   const std::shared_ptr<const std::vector<double> >& getSampleMomentHistogramBins();
 
+  //! Get the number of threads that are supported
+  unsigned getNumberOfSupportedThreads() const;
+
   //! Set the has uncommitted history contribution flag
-  void setHasUncommittedHistoryContribution( const unsigned thread_id );
+  void setHasUncommittedHistoryContribution( const unsigned history_buffer );
 
   //! Unset the has uncommitted history contribution flag
-  void unsetHasUncommittedHistoryContribution( const unsigned thread_id );
+  void unsetHasUncommittedHistoryContribution( const unsigned history_buffer );
 
   //! Reduce a single collection
   void reduceCollection(
@@ -491,6 +500,29 @@ protected:
                       const int root_process,
                       FourEstimatorMomentsCollection& collection ) const;
 
+  //! Reduce packed moments
+  void reducePackedMoments( const Utility::Communicator& comm,
+                            const int root_process,
+                            std::vector<double>& packed_moments ) const;
+
+  //! Append the moments of a collection to the packed moments
+  static void packMoments( const TwoEstimatorMomentsCollection& collection,
+                           std::vector<double>& packed_moments );
+
+  //! Append the moments of a collection to the packed moments
+  static void packMoments( const FourEstimatorMomentsCollection& collection,
+                           std::vector<double>& packed_moments );
+
+  //! Extract the moments of a collection from the packed moments
+  static void unpackMoments( const std::vector<double>& packed_moments,
+                             size_t& offset,
+                             TwoEstimatorMomentsCollection& collection );
+
+  //! Extract the moments of a collection from the packed moments
+  static void unpackMoments( const std::vector<double>& packed_moments,
+                             size_t& offset,
+                             FourEstimatorMomentsCollection& collection );
+
   //! Reduce snapshots
   void reduceSnapshots(
                     const Utility::Communicator& comm,
@@ -605,13 +637,16 @@ private:
                        double& variance_of_variance,
                        double& figure_of_merit ) const;
 
-  // Reduce a single collection and return the reduced moments
+  // Append the moments of order N of a collection to the packed moments
   template<size_t N, typename Collection>
-  void reduceCollectionAndReturnReducedMoments(
-                                  const Utility::Communicator& comm,
-                                  const int root_process,
-                                  const Collection& collection,
-                                  std::vector<double>& reduced_moments ) const;
+  static void packMomentsOfOrder( const Collection& collection,
+                                  std::vector<double>& packed_moments );
+
+  // Extract the moments of order N of a collection from the packed moments
+  template<size_t N, typename Collection>
+  static void unpackMomentsOfOrder( const std::vector<double>& packed_moments,
+                                    size_t& offset,
+                                    Collection& collection );
 
   // Save the data to an archive
   template<typename Archive>
@@ -644,7 +679,11 @@ private:
   // The sample moment histogram bins
   std::shared_ptr<const std::vector<double> > d_sample_moment_histogram_bins;
 
-  // Records if there is an uncommitted history contribution for a thread
+  // The number of threads that are supported
+  unsigned d_number_of_supported_threads;
+
+  // Records if there is an uncommitted history contribution in a history
+  // buffer (one buffer per in flight history on each thread)
   // Note: uint8_t is used instead of bool deliberately due to a
   //       unusual thread safety issue that was encountered with
   //       std::vector<bool>.
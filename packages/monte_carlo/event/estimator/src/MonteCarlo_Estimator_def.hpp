@@ -39,30 +39,33 @@ void Estimator::calculateBinIndicesOfPoint(
     bin_indices[i] += response_function_index*this->getNumberOfBins();
 }
 
-// Reduce a single collection and return the reduced moments
+// Append the moments of order N of a collection to the packed moments
 template<size_t N, typename Collection>
-void Estimator::reduceCollectionAndReturnReducedMoments(
-                             const Utility::Communicator& comm,
-                             const int root_process,
-                             const Collection& collection,
-                             std::vector<double>& reduced_moments ) const
+void Estimator::packMomentsOfOrder( const Collection& collection,
+                                    std::vector<double>& packed_moments )
 {
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
-
-  // Resize the reduced moments array
-  reduced_moments.resize( collection.size() );
-
-  try{
-    Utility::reduce( comm,
-                     Utility::ArrayView<const double>( Utility::getCurrentScores<N>( collection ), collection.size() ),
-                     Utility::arrayView( reduced_moments ),
-                     std::plus<double>(),
-                     root_process );
-  }
-  EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                           "Unable to perform mpi reduction over moments of "
-                           "order " << N << " for estimator " << d_id << "!" );
+  const double* moments = Utility::getCurrentScores<N>( collection );
+
+  packed_moments.insert( packed_moments.end(),
+                         moments,
+                         moments + collection.size() );
+}
+
+// Extract the moments of order N of a collection from the packed moments
+template<size_t N, typename Collection>
+void Estimator::unpackMomentsOfOrder(
+                                    const std::vector<double>& packed_moments,
+                                    size_t& offset,
+                                    Collection& collection )
+{
+  // Make sure the packed moments are valid
+  testPrecondition( offset + collection.size() <= packed_moments.size() );
+
+  std::copy( packed_moments.begin() + offset,
+             packed_moments.begin() + offset + collection.size(),
+             Utility::getCurrentScores<N>( collection ) );
+
+  offset += collection.size();
 }
 
 // Save the data to an archive
@@ -97,6 +100,7 @@ void Estimator::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_sample_moment_histogram_bins );
   
   // Initialize the thread data
+  d_number_of_supported_threads = 1;
   d_has_uncommitted_history_contribution.resize( 1, false );
 }
 
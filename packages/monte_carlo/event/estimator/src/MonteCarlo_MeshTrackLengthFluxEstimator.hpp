@@ -59,6 +59,9 @@ public:
   //! Check if the estimator is a mesh estimator
   bool isMeshEstimator() const final override;
 
+  //! Return the mesh
+  const std::shared_ptr<const Utility::Mesh>& getMesh() const;
+
   //! Add current history estimator contribution
   void updateFromGlobalParticleSubtrackEndingEvent(
                                     const ParticleState& particle,
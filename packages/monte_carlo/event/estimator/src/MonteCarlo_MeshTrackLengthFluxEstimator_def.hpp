@@ -65,6 +65,14 @@ bool MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::isMeshEstimator
   return true;
 }
 
+// Return the mesh
+template<typename ContributionMultiplierPolicy>
+const std::shared_ptr<const Utility::Mesh>&
+MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getMesh() const
+{
+  return d_mesh;
+}
+
 // Add current history estimator contribution
 template<typename ContributionMultiplierPolicy>
 void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSubtrackEndingEvent(
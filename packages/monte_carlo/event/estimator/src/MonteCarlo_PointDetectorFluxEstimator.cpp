@@ -0,0 +1,27 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PointDetectorFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator class template instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightMultipliedPointDetectorFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightAndEnergyMultipliedPointDetectorFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightAndChargeMultipliedPointDetectorFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PointDetectorFluxEstimator.cpp
+//---------------------------------------------------------------------------//
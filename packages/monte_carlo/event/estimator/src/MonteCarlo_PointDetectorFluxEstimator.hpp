@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PointDetectorFluxEstimator.hpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+#define MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+
+// Boost Includes
+#include <boost/mpl/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardEntityEstimator.hpp"
+#include "MonteCarlo_ParticleCollidingGlobalEventObserver.hpp"
+#include "MonteCarlo_EstimatorContributionMultiplierPolicy.hpp"
+#include "Utility_Array.hpp"
+
+namespace MonteCarlo{
+
+/*! The point detector flux estimator class
+ * \details The uncollided flux at each detector point from every collision
+ * and source event is estimated deterministically (next-event estimator).
+ * The entity ids of the estimator are the detector indices. Contributions
+ * from events inside of the exclusion sphere of a detector use the
+ * average of \f$1/R^2\f$ over the sphere (\f$3/R_0^2\f$) to keep the
+ * variance of the estimator finite. Small contributions can be rouletted
+ * before the optical depth is evaluated and contributions that are
+ * attenuated by more than the max optical depth are rejected.
+ * \ingroup particle_colliding_global_event
+ */
+template<typename ContributionMultiplierPolicy = WeightMultiplier>
+class PointDetectorFluxEstimator : public StandardEntityEstimator,
+                                   public ParticleCollidingGlobalEventObserver
+{
+
+public:
+
+  //! Typedef for the detector position type
+  typedef std::array<double,3> DetectorPosition;
+
+  //! Typedef for event tags used for quick dispatcher registering
+  typedef boost::mpl::vector<ParticleCollidingGlobalEventObserver::EventTag>
+  EventTags;
+
+  //! Constructor
+  PointDetectorFluxEstimator(
+                      const Id id,
+                      const double multiplier,
+                      const std::vector<DetectorPosition>& detector_positions );
+
+  //! Destructor
+  ~PointDetectorFluxEstimator()
+  { /* ... */ }
+
+  //! Return the number of detectors
+  size_t getNumberOfDetectors() const;
+
+  //! Return the position of a detector
+  const DetectorPosition& getDetectorPosition(
+                                           const size_t detector_index ) const;
+
+  //! Set the exclusion sphere radius (cm)
+  void setExclusionSphereRadius( const double radius );
+
+  //! Return the exclusion sphere radius (cm)
+  double getExclusionSphereRadius() const;
+
+  //! Set the max optical depth
+  void setMaxOpticalDepth( const double max_optical_depth );
+
+  //! Return the max optical depth
+  double getMaxOpticalDepth() const;
+
+  //! Set the contribution roulette threshold
+  void setContributionRouletteThreshold( const double threshold );
+
+  //! Return the contribution roulette threshold
+  double getContributionRouletteThreshold() const;
+
+  //! Check if the estimator is a cell estimator
+  bool isCellEstimator() const final override;
+
+  //! Check if the estimator is a surface estimator
+  bool isSurfaceEstimator() const final override;
+
+  //! Check if the estimator is a mesh estimator
+  bool isMeshEstimator() const final override;
+
+  //! Add current history estimator contribution
+  void updateFromGlobalParticleCollidingEvent(
+     const ParticleState& particle,
+     const EmissionDensityEvaluator& emission_density_evaluator,
+     const OpticalDepthEvaluator& optical_depth_evaluator ) final override;
+
+  //! Print the estimator data summary
+  void printSummary( std::ostream& os ) const final override;
+
+protected:
+
+  //! Assign discretization to an estimator dimension
+  void assignDiscretization( const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+                             const bool range_dimension ) override;
+
+  //! Assign the particle type to the estimator
+  void assignParticleType( const ParticleType particle_type ) override;
+
+private:
+
+  // Default constructor
+  PointDetectorFluxEstimator();
+
+  // Create the detector entity ids
+  static std::vector<EntityId> createDetectorIds(
+                     const std::vector<DetectorPosition>& detector_positions );
+
+  // Serialize the estimator data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version );
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The detector positions
+  std::vector<DetectorPosition> d_detector_positions;
+
+  // The exclusion sphere radius (cm)
+  double d_exclusion_sphere_radius;
+
+  // The max optical depth
+  double d_max_optical_depth;
+
+  // The contribution roulette threshold
+  double d_contribution_roulette_threshold;
+};
+
+// Serialize the estimator data
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::serialize( Archive& ar, const unsigned version )
+{
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( StandardEntityEstimator );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleCollidingGlobalEventObserver );
+
+  ar & BOOST_SERIALIZATION_NVP( d_detector_positions );
+  ar & BOOST_SERIALIZATION_NVP( d_exclusion_sphere_radius );
+  ar & BOOST_SERIALIZATION_NVP( d_max_optical_depth );
+  ar & BOOST_SERIALIZATION_NVP( d_contribution_roulette_threshold );
+}
+
+//! The weight multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightMultiplier> WeightMultipliedPointDetectorFluxEstimator;
+
+//! The weight and energy multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightAndEnergyMultiplier> WeightAndEnergyMultipliedPointDetectorFluxEstimator;
+
+//! The weight and charge multiplied point detector flux estimator
+typedef PointDetectorFluxEstimator<WeightAndChargeMultiplier> WeightAndChargeMultipliedPointDetectorFluxEstimator;
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS1_VERSION( PointDetectorFluxEstimator, MonteCarlo, 0 );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_PointDetectorFluxEstimator_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PointDetectorFluxEstimator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,350 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PointDetectorFluxEstimator_def.hpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+#define MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+// Std Lib Includes
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExplicitTemplateInstantiationMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+template<typename ContributionMultiplierPolicy>
+PointDetectorFluxEstimator<ContributionMultiplierPolicy>::PointDetectorFluxEstimator()
+{ /* ... */ }
+
+// Constructor
+template<typename ContributionMultiplierPolicy>
+PointDetectorFluxEstimator<ContributionMultiplierPolicy>::PointDetectorFluxEstimator(
+                      const Id id,
+                      const double multiplier,
+                      const std::vector<DetectorPosition>& detector_positions )
+  : StandardEntityEstimator( id,
+                             multiplier,
+                             PointDetectorFluxEstimator::createDetectorIds( detector_positions ) ),
+    ParticleCollidingGlobalEventObserver(),
+    d_detector_positions( detector_positions ),
+    d_exclusion_sphere_radius( 0.0 ),
+    d_max_optical_depth( std::numeric_limits<double>::infinity() ),
+    d_contribution_roulette_threshold( 0.0 )
+{ /* ... */ }
+
+// Create the detector entity ids
+template<typename ContributionMultiplierPolicy>
+auto PointDetectorFluxEstimator<ContributionMultiplierPolicy>::createDetectorIds(
+                      const std::vector<DetectorPosition>& detector_positions )
+  -> std::vector<EntityId>
+{
+  TEST_FOR_EXCEPTION( detector_positions.empty(),
+                      std::runtime_error,
+                      "At least one detector position must be specified!" );
+
+  std::vector<EntityId> detector_ids( detector_positions.size() );
+
+  for( size_t i = 0; i < detector_ids.size(); ++i )
+    detector_ids[i] = i;
+
+  return detector_ids;
+}
+
+// Return the number of detectors
+template<typename ContributionMultiplierPolicy>
+size_t PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getNumberOfDetectors() const
+{
+  return d_detector_positions.size();
+}
+
+// Return the position of a detector
+template<typename ContributionMultiplierPolicy>
+auto PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getDetectorPosition(
+               const size_t detector_index ) const -> const DetectorPosition&
+{
+  // Make sure that the detector index is valid
+  testPrecondition( detector_index < d_detector_positions.size() );
+
+  return d_detector_positions[detector_index];
+}
+
+// Set the exclusion sphere radius (cm)
+/*! \details Every detector will have an exclusion sphere with this radius.
+ * A radius of zero (the default) disables the exclusion spheres - events
+ * that occur exactly at a detector position will then be ignored.
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::setExclusionSphereRadius( const double radius )
+{
+  TEST_FOR_EXCEPTION( radius < 0.0,
+                      std::runtime_error,
+                      "The exclusion sphere radius of point detector "
+                      "estimator " << this->getId() << " cannot be "
+                      "negative!" );
+
+  d_exclusion_sphere_radius = radius;
+}
+
+// Return the exclusion sphere radius (cm)
+template<typename ContributionMultiplierPolicy>
+double PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getExclusionSphereRadius() const
+{
+  return d_exclusion_sphere_radius;
+}
+
+// Set the max optical depth
+/*! \details Contributions that are attenuated by more than the max optical
+ * depth will be rejected (the optical depth evaluation stops once the
+ * max has been reached). The default max optical depth is infinity.
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::setMaxOpticalDepth( const double max_optical_depth )
+{
+  TEST_FOR_EXCEPTION( max_optical_depth <= 0.0,
+                      std::runtime_error,
+                      "The max optical depth of point detector estimator "
+                      << this->getId() << " must be positive!" );
+
+  d_max_optical_depth = max_optical_depth;
+}
+
+// Return the max optical depth
+template<typename ContributionMultiplierPolicy>
+double PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getMaxOpticalDepth() const
+{
+  return d_max_optical_depth;
+}
+
+// Set the contribution roulette threshold
+/*! \details An unattenuated contribution (c) below the threshold (T) will
+ * survive with probability c/T and will be set to T (before attenuation).
+ * Since the optical depth is only evaluated for surviving contributions the
+ * roulette can save a significant amount of ray tracing. The estimator
+ * remains unbiased. A threshold of zero (the default) disables the roulette.
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::setContributionRouletteThreshold( const double threshold )
+{
+  TEST_FOR_EXCEPTION( threshold < 0.0,
+                      std::runtime_error,
+                      "The contribution roulette threshold of point detector "
+                      "estimator " << this->getId() << " cannot be "
+                      "negative!" );
+
+  d_contribution_roulette_threshold = threshold;
+}
+
+// Return the contribution roulette threshold
+template<typename ContributionMultiplierPolicy>
+double PointDetectorFluxEstimator<ContributionMultiplierPolicy>::getContributionRouletteThreshold() const
+{
+  return d_contribution_roulette_threshold;
+}
+
+// Check if the estimator is a cell estimator
+template<typename ContributionMultiplierPolicy>
+bool PointDetectorFluxEstimator<ContributionMultiplierPolicy>::isCellEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a surface estimator
+template<typename ContributionMultiplierPolicy>
+bool PointDetectorFluxEstimator<ContributionMultiplierPolicy>::isSurfaceEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a mesh estimator
+template<typename ContributionMultiplierPolicy>
+bool PointDetectorFluxEstimator<ContributionMultiplierPolicy>::isMeshEstimator() const
+{
+  return false;
+}
+
+// Add estimator contribution from a portion of the current history
+/*! \details The contribution to each detector from each outgoing energy is
+ * \f$ w p(\Omega \rightarrow E') e^{-\tau(E')}/R^2\f$ where p is the
+ * emission density per unit solid angle in the direction of the detector.
+ * The contributions are made with a copy of the particle that has the
+ * outgoing energy, the direction of the detector and the time of arrival
+ * at the detector (the copy is only created if a contribution survives the
+ * roulette).
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleCollidingEvent(
+                 const ParticleState& particle,
+                 const EmissionDensityEvaluator& emission_density_evaluator,
+                 const OpticalDepthEvaluator& optical_depth_evaluator )
+{
+  // Make sure that the particle type is assigned to this estimator
+  testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
+
+  std::unique_ptr<ParticleState> detector_particle;
+
+  EmissionDensityArray outgoing_energies_and_densities;
+
+  for( size_t i = 0; i < d_detector_positions.size(); ++i )
+  {
+    double direction[3] =
+      {d_detector_positions[i][0] - particle.getXPosition(),
+       d_detector_positions[i][1] - particle.getYPosition(),
+       d_detector_positions[i][2] - particle.getZPosition()};
+
+    const double distance = Utility::vectorMagnitude( direction );
+
+    double inverse_distance_squared;
+
+    if( distance < d_exclusion_sphere_radius )
+    {
+      inverse_distance_squared =
+        3.0/(d_exclusion_sphere_radius*d_exclusion_sphere_radius);
+    }
+    else if( distance > 0.0 )
+      inverse_distance_squared = 1.0/(distance*distance);
+    // The direction to the detector is undefined
+    else
+      continue;
+
+    Utility::normalizeVector( direction );
+
+    emission_density_evaluator( direction, outgoing_energies_and_densities );
+
+    for( auto&& outgoing_energy_and_density :
+           outgoing_energies_and_densities )
+    {
+      if( !detector_particle )
+        detector_particle.reset( particle.clone() );
+
+      detector_particle->setEnergy( outgoing_energy_and_density.first );
+      detector_particle->setDirection( direction );
+      detector_particle->setTime( particle.getTime() +
+                                  distance/detector_particle->getSpeed() );
+
+      double contribution = outgoing_energy_and_density.second*
+        inverse_distance_squared*
+        ContributionMultiplierPolicy::multiplier( *detector_particle );
+
+      if( contribution == 0.0 )
+        continue;
+
+      // Roulette the small contributions before evaluating the optical depth
+      if( std::fabs( contribution ) < d_contribution_roulette_threshold )
+      {
+        if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+            d_contribution_roulette_threshold < std::fabs( contribution ) )
+        {
+          contribution = std::copysign( d_contribution_roulette_threshold,
+                                        contribution );
+        }
+        else
+          continue;
+      }
+
+      const double optical_depth =
+        optical_depth_evaluator( outgoing_energy_and_density.first,
+                                 direction,
+                                 distance,
+                                 d_max_optical_depth );
+
+      if( optical_depth >= d_max_optical_depth )
+        continue;
+
+      contribution *= std::exp( -optical_depth );
+
+      ObserverParticleStateWrapper particle_state_wrapper( *detector_particle );
+
+      this->addPartialHistoryPointContribution( i,
+                                                particle_state_wrapper,
+                                                contribution );
+    }
+  }
+}
+
+// Print the estimator data
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::printSummary( std::ostream& os ) const
+{
+  os << "Point Detector Estimator: " << this->getId() << "\n";
+
+  this->printImplementation( os, "Detector" );
+
+  os << std::flush;
+}
+
+// Assign discretization to an estimator dimension
+/*! \details The MonteCarlo::OBSERVER_COSINE_DIMENSION cannot be discretized in
+ * point detector estimators.
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::assignDiscretization(
+  const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+  const bool range_dimension )
+{
+  if( bins->getDimension() == OBSERVER_COSINE_DIMENSION )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                bins->getDimensionName() <<
+                                " bins cannot be set for point detector "
+                                "estimators. The bins requested for point "
+                                "detector estimator " << this->getId() <<
+                                " will be ignored!" );
+  }
+  else
+    StandardEntityEstimator::assignDiscretization( bins, range_dimension );
+}
+
+// Assign the particle type to the estimator
+/*! \details Only photons can contribute to point detector estimators (the
+ * emission densities are only available for photon collisions).
+ */
+template<typename ContributionMultiplierPolicy>
+void PointDetectorFluxEstimator<ContributionMultiplierPolicy>::assignParticleType(
+                                            const ParticleType particle_type )
+{
+  if( particle_type != PHOTON )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                "Only photons can contribute to point "
+                                "detector estimators. The requested particle "
+                                "type of " << particle_type << " for "
+                                "estimator " << this->getId() << " will be "
+                                "ignored!" );
+  }
+  else
+    Estimator::assignParticleType( particle_type );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndEnergyMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndChargeMultipliedPointDetectorFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::PointDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, PointDetectorFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+#endif // end MONTE_CARLO_POINT_DETECTOR_FLUX_ESTIMATOR_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PointDetectorFluxEstimator_def.hpp
+//---------------------------------------------------------------------------//
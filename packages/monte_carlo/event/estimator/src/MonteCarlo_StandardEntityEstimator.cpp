@@ -6,6 +6,10 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_StandardEntityEstimator.hpp"
@@ -30,7 +34,13 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1 ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_min_entity_id( 0 ),
+    d_entity_slots(),
+    d_slot_entities(),
+    d_update_tracker( 1 ),
+    d_thread_private_total_moments(),
+    d_thread_bin_indices( 1 ),
+    d_thread_bin_indices_and_weights( 1 )
 { /* ... */ }
 
 // Check if total data is available
@@ -133,6 +143,9 @@ void StandardEntityEstimator::takeSnapshot( const uint64_t num_histories_since_l
 {
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Make sure that all thread contributions are in the shared moments
+  this->mergeThreadPrivateMoments();
   
   d_total_estimator_moment_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                    time_since_last_snapshot,
@@ -418,104 +431,121 @@ void StandardEntityEstimator::getTotalSampleMomentHistogram(
   histogram = d_total_estimator_histograms[response_function_index];
 }
 
+// Enable thread private moment accumulation
+void StandardEntityEstimator::enableThreadPrivateMomentAccumulation()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  EntityEstimator::enableThreadPrivateMomentAccumulation();
+
+  this->initializeThreadPrivateTotalMoments();
+}
+
 // Commit the contribution from the current history to the estimator
-/*! \details This function must only be called within an omp critical block
- * if multiple threads are being used. Failure to do this may result in
- * race conditions.
+/*! \details If thread private moment accumulation has been enabled this
+ * function will not acquire any locks. Otherwise, the shared moments will be
+ * updated inside of omp critical blocks.
  */
 void StandardEntityEstimator::commitHistoryContribution()
 {
-  // Thread id
-  size_t thread_id = Utility::OpenMPProperties::getThreadId();
+  // The history buffer of the history that is being committed
+  const size_t history_buffer = this->getObservedHistoryBuffer();
 
-  // Number of bins per response function
-  size_t num_bins = this->getNumberOfBins();
+  SerialUpdateTracker& update_tracker = d_update_tracker[history_buffer];
 
-  // Number of response functions
-  size_t num_response_funcs = this->getNumberOfResponseFunctions();
-
-  // The entity totals
-  std::vector<double> entity_totals( num_response_funcs, 0.0 );
+  // The tracker may not have been used in this history
+  if( update_tracker.updated_entity_slots.empty() )
+    this->prepareUpdateTracker( update_tracker );
 
-  // The totals over all entities
-  std::vector<double> totals( num_response_funcs, 0.0 );
+  // Group the updated bins by entity block (the blocks are ordered by the
+  // first update of each entity)
+  std::sort( update_tracker.updated_bin_contributions.begin(),
+             update_tracker.updated_bin_contributions.end() );
 
-  // The bin totals over all entities
-  BinContributionMap bin_totals;
+  const size_t bins_per_entity = update_tracker.bins_per_entity;
 
-  // Get the entities with updated data
-  typename SerialUpdateTracker::const_iterator entity, end_entity;
+  // Number of response functions
+  const size_t num_response_funcs = this->getNumberOfResponseFunctions();
 
-  this->getEntityIteratorFromUpdateTracker( thread_id, entity, end_entity );
+  size_t i = 0;
 
-  while( entity != end_entity )
+  // Process each updated entity
+  while( i < update_tracker.updated_bin_contributions.size() )
   {
-    // Process each updated bin
-    BinContributionMap::const_iterator bin_data, end_bin_data;
+    const size_t block =
+      update_tracker.updated_bin_contributions[i]/bins_per_entity;
 
-    this->getBinIteratorFromUpdateTrackerIterator( thread_id,
-                                                   entity,
-                                                   bin_data,
-                                                   end_bin_data );
+    const EntityId entity_id =
+      d_slot_entities[update_tracker.updated_entity_slots[block]];
 
-    while( bin_data != end_bin_data )
+    // Process each updated bin of the entity
+    while( i < update_tracker.updated_bin_contributions.size() )
     {
-      size_t response_func_index =
-	this->calculateResponseFunctionIndex( bin_data->first );
+      const size_t index = update_tracker.updated_bin_contributions[i];
 
-      const double bin_contribution = bin_data->second;
+      if( index/bins_per_entity != block )
+        break;
 
-      entity_totals[response_func_index] += bin_contribution;
+      const size_t bin_index = index - block*bins_per_entity;
 
-      totals[response_func_index] += bin_contribution;
+      const size_t response_func_index =
+        this->calculateResponseFunctionIndex( bin_index );
 
-      if( bin_totals.find( bin_data->first ) != bin_totals.end() )
-	bin_totals[bin_data->first] += bin_contribution;
+      const double bin_contribution = update_tracker.bin_contributions[index];
+
+      update_tracker.entity_totals[response_func_index] += bin_contribution;
+
+      update_tracker.totals[response_func_index] += bin_contribution;
+
+      if( update_tracker.bin_total_updated[bin_index] )
+        update_tracker.bin_totals[bin_index] += bin_contribution;
       else
-	bin_totals[bin_data->first] = bin_contribution;
+      {
+        update_tracker.bin_totals[bin_index] = bin_contribution;
+        update_tracker.bin_total_updated[bin_index] = 1;
+        update_tracker.updated_bin_totals.push_back( bin_index );
+      }
 
-      this->commitHistoryContributionToBinOfEntity( entity->first,
-						    bin_data->first,
-						    bin_contribution );
+      this->commitHistoryContributionToBinOfEntity( entity_id,
+                                                    bin_index,
+                                                    bin_contribution );
 
-      ++bin_data;
+      ++i;
     }
 
     // Commit the entity totals
-    for( size_t i = 0; i < num_response_funcs; ++i )
+    for( size_t r = 0; r < num_response_funcs; ++r )
     {
-      this->commitHistoryContributionToTotalOfEntity( entity->first,
-                                                      i,
-                                                      entity_totals[i] );
+      this->commitHistoryContributionToTotalOfEntity(
+                                             entity_id,
+                                             r,
+                                             update_tracker.entity_totals[r] );
 
       // Reset the entity totals
-      entity_totals[i] = 0.0;
+      update_tracker.entity_totals[r] = 0.0;
     }
-
-    ++entity;
   }
 
   // Commit the totals over all entities
-  for( size_t i = 0; i < num_response_funcs; ++i )
-    this->commitHistoryContributionToTotalOfEstimator( i, totals[i] );
+  for( size_t r = 0; r < num_response_funcs; ++r )
+    this->commitHistoryContributionToTotalOfEstimator( r, update_tracker.totals[r] );
 
   // Commit the bin totals over all entities
-  BinContributionMap::const_iterator bin_data, end_bin_data;
-  bin_data = bin_totals.begin();
-  end_bin_data = bin_totals.end();
-
-  while( bin_data != end_bin_data )
+  for( size_t j = 0; j < update_tracker.updated_bin_totals.size(); ++j )
   {
-    this->commitHistoryContributionToBinOfTotal( bin_data->first,
-						 bin_data->second );
-    ++bin_data;
+    const size_t bin_index = update_tracker.updated_bin_totals[j];
+
+    this->commitHistoryContributionToBinOfTotal(
+                                     bin_index,
+                                     update_tracker.bin_totals[bin_index] );
   }
 
   // Reset the update tracker
-  this->resetUpdateTracker( thread_id );
+  this->resetUpdateTracker( history_buffer );
 
   // Unset the uncommitted history contribution flag
-  this->unsetHasUncommittedHistoryContribution( thread_id );
+  this->unsetHasUncommittedHistoryContribution( history_buffer );
 }
 
 // Enable support for multiple threads
@@ -526,8 +556,17 @@ void StandardEntityEstimator::enableThreadSupport( const unsigned num_threads )
 
   EntityEstimator::enableThreadSupport( num_threads );
 
-  // Add thread support to update tracker
-  d_update_tracker.resize( num_threads );
+  // Add thread support to update tracker (one per in flight history)
+  d_update_tracker.resize( this->getNumberOfHistoryBuffers( num_threads ) );
+
+  this->initializeUpdateTrackers();
+
+  // Add thread support to the total moments
+  this->initializeThreadPrivateTotalMoments();
+
+  // Add thread support to the bin index buffers
+  d_thread_bin_indices.resize( num_threads );
+  d_thread_bin_indices_and_weights.resize( num_threads );
 }
 
 // Reset the estimator data
@@ -563,10 +602,30 @@ void StandardEntityEstimator::resetData()
       histogram.reset();
   }
 
+  // Reset the thread private total moments
+  for( auto&& thread_moments : d_thread_private_total_moments )
+  {
+    thread_moments.total_moments.reset();
+
+    for( auto&& entity_data : thread_moments.entity_total_moments_map )
+      entity_data.second.reset();
+
+    for( auto&& histogram : thread_moments.total_histograms )
+      histogram.reset();
+
+    for( auto&& entity_data : thread_moments.entity_total_histograms_map )
+    {
+      for( auto&& histogram : entity_data.second )
+        histogram.reset();
+    }
+
+    thread_moments.updated = false;
+  }
+
   // Reset the update tracker
   for( size_t i = 0; i < d_update_tracker.size(); ++i )
   {
-    d_update_tracker[i].clear();
+    this->resetUpdateTracker( i );
 
     this->unsetHasUncommittedHistoryContribution( i );
   }
@@ -581,6 +640,9 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Make sure that all thread contributions are in the shared moments
+  this->mergeThreadPrivateMoments();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -593,8 +655,6 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
                              "standard entity estimator " << this->getId() <<
                              " for entity total data!" );
 
-    comm.barrier();
-
     // Reduce the total data
     try{
       this->reduceCollection( comm, root_process, d_total_estimator_moments );
@@ -684,6 +744,12 @@ void StandardEntityEstimator::assignEntities(
     d_total_estimator_histograms.resize( this->getNumberOfResponseFunctions(),
                                          default_histogram );
   }
+
+  // Resize the thread private total moments
+  this->initializeThreadPrivateTotalMoments();
+
+  // Assign the entity slots
+  this->initializeUpdateTrackers();
 }
 
 // Set the response functions
@@ -709,6 +775,9 @@ void StandardEntityEstimator::assignResponseFunction(
     d_total_estimator_histograms.resize( this->getNumberOfResponseFunctions(),
                                          default_histogram );
   }
+
+  // Resize the thread private total moments
+  this->initializeThreadPrivateTotalMoments();
 }
 
 // Assign the history score pdf bins
@@ -724,6 +793,45 @@ void StandardEntityEstimator::assignSampleMomentHistogramBins( const std::shared
     for( auto&& histogram : entity_data.second )
       histogram.setBinBoundaries( bins );
   }
+
+  // Reset the thread private total histograms
+  this->initializeThreadPrivateTotalMoments();
+}
+
+// Merge the thread private moments into the shared moments
+/*! \details This must only be called by the root thread outside of a
+ * parallel region.
+ */
+void StandardEntityEstimator::mergeThreadPrivateMoments()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( auto&& thread_moments : d_thread_private_total_moments )
+  {
+    if( thread_moments.updated )
+    {
+      EntityEstimator::mergeThreadPrivateCollection(
+                                                  thread_moments.total_moments,
+                                                  d_total_estimator_moments );
+
+      EntityEstimator::mergeThreadPrivateCollectionMap(
+                                      thread_moments.entity_total_moments_map,
+                                      d_entity_total_estimator_moments_map );
+
+      EntityEstimator::mergeThreadPrivateHistogramArray(
+                                               thread_moments.total_histograms,
+                                               d_total_estimator_histograms );
+
+      EntityEstimator::mergeThreadPrivateHistogramArrayMap(
+                                   thread_moments.entity_total_histograms_map,
+                                   d_entity_total_estimator_histograms_map );
+
+      thread_moments.updated = false;
+    }
+  }
+
+  EntityEstimator::mergeThreadPrivateMoments();
 }
 
 // Print the estimator data
@@ -770,9 +878,9 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
 		   const ObserverParticleStateWrapper& particle_state_wrapper,
                    const double contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( Utility::OpenMPProperties::getThreadId() <
-		    d_update_tracker.size() );
+  // Make sure the history buffer is valid
+  testPrecondition( this->getObservedHistoryBuffer() <
+                    d_update_tracker.size() );
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
   // Make sure that the particle type is assigned
@@ -780,11 +888,13 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
 
   const size_t thread_id = Utility::OpenMPProperties::getThreadId();
 
+  const size_t history_buffer = this->getObservedHistoryBuffer();
+
   // Only add the contribution if the particle state is in the phase space
   if( this->isPointInObserverPhaseSpace( particle_state_wrapper ) )
   {
-    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexArray
-      bin_indices;
+    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexArray&
+      bin_indices = d_thread_bin_indices[thread_id];
 
     for( size_t r = 0; r < this->getNumberOfResponseFunctions(); ++r )
     {
@@ -798,19 +908,17 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
 
       for( size_t i = 0; i < bin_indices.size(); ++i )
       {
-        this->addInfoToUpdateTracker( thread_id,
+        this->addInfoToUpdateTracker( history_buffer,
                                       entity_id,
                                       bin_indices[i],
                                       processed_contribution );
       }
-
-      bin_indices.clear();
     }
   }
 
   // Indicate that there is an uncommitted history contribution
-  if( !this->hasUncommittedHistoryContribution( thread_id ) )
-    this->setHasUncommittedHistoryContribution( thread_id );
+  if( !this->hasUncommittedHistoryContribution( history_buffer ) )
+    this->setHasUncommittedHistoryContribution( history_buffer );
 }
 
 // Add estimator contribution from a range of the current history
@@ -822,9 +930,9 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
                    const ObserverParticleStateWrapper& particle_state_wrapper,
                    const double contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( Utility::OpenMPProperties::getThreadId() <
-		    d_update_tracker.size() );
+  // Make sure the history buffer is valid
+  testPrecondition( this->getObservedHistoryBuffer() <
+                    d_update_tracker.size() );
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
   // Make sure that the particle type is assigned
@@ -832,11 +940,13 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
 
   const size_t thread_id = Utility::OpenMPProperties::getThreadId();
 
+  const size_t history_buffer = this->getObservedHistoryBuffer();
+
   // Only add the contribution if the particle state is in the phase space
   if( this->doesRangeIntersectObserverPhaseSpace( particle_state_wrapper ) )
   {
-    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray
-      bin_indices_and_weights;
+    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray&
+      bin_indices_and_weights = d_thread_bin_indices_and_weights[thread_id];
 
     this->calculateBinIndicesAndWeightsOfRange( particle_state_wrapper,
                                                 0,
@@ -856,7 +966,7 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
         const size_t complete_bin_index =
           Utility::get<0>( bin_indices_and_weights[i] ) + bin_index_shift;
 
-        this->addInfoToUpdateTracker( thread_id,
+        this->addInfoToUpdateTracker( history_buffer,
                                       entity_id,
                                       complete_bin_index,
                                       processed_contribution );
@@ -865,8 +975,8 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
   }
 
   // Indicate that there is an uncommitted history contribution
-  if( !this->hasUncommittedHistoryContribution( thread_id ) )
-    this->setHasUncommittedHistoryContribution( thread_id );
+  if( !this->hasUncommittedHistoryContribution( history_buffer ) )
+    this->setHasUncommittedHistoryContribution( history_buffer );
 }
 
 // Get the total estimator data
@@ -925,17 +1035,47 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEntity(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Estimator::FourEstimatorMomentsCollection&
-    entity_total_estimator_moments_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
+  if( this->isThreadPrivateMomentAccumulationEnabled() )
+  {
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  // Update the moments
-  #pragma omp critical
+    // The root thread has sole access to the shared moments until the
+    // thread private moments are merged
+    if( thread_id == 0 )
+    {
+      d_entity_total_estimator_moments_map.find( entity_id )->second.addRawScore( response_function_index, contribution );
+
+      d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index].addRawScore( contribution );
+    }
+    else
+    {
+      // Make sure the thread id is valid
+      testPrecondition( thread_id <= d_thread_private_total_moments.size() );
+      
+      ThreadPrivateTotalMoments& thread_moments =
+        d_thread_private_total_moments[thread_id-1];
+
+      thread_moments.entity_total_moments_map.find( entity_id )->second.addRawScore( response_function_index, contribution );
+
+      thread_moments.entity_total_histograms_map.find( entity_id )->second[response_function_index].addRawScore( contribution );
+
+      thread_moments.updated = true;
+    }
+  }
+  else
   {
-    entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
+    Estimator::FourEstimatorMomentsCollection&
+      entity_total_estimator_moments_collection =
+      d_entity_total_estimator_moments_map.find( entity_id )->second;
+    
+    // Update the moments
+    #pragma omp critical
+    {
+      entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
+    }
+    
+    this->addHistoryContributionToEntityBinHistogram( entity_id, response_function_index, contribution );
   }
-
-  this->addHistoryContributionToEntityBinHistogram( entity_id, response_function_index, contribution );
 }
 
 // Add contribution to entity bin histogram
@@ -973,14 +1113,46 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEstimator(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  // Update the moments
-  #pragma omp critical
+  if( this->isThreadPrivateMomentAccumulationEnabled() )
   {
-    d_total_estimator_moments.addRawScore( response_function_index, contribution );
-  }
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
-  this->addHistoryContributionToTotalBinHistogram( response_function_index,
-                                                   contribution );
+    // The root thread has sole access to the shared moments until the
+    // thread private moments are merged
+    if( thread_id == 0 )
+    {
+      d_total_estimator_moments.addRawScore( response_function_index,
+                                             contribution );
+
+      d_total_estimator_histograms[response_function_index].addRawScore( contribution );
+    }
+    else
+    {
+      // Make sure the thread id is valid
+      testPrecondition( thread_id <= d_thread_private_total_moments.size() );
+      
+      ThreadPrivateTotalMoments& thread_moments =
+        d_thread_private_total_moments[thread_id-1];
+
+      thread_moments.total_moments.addRawScore( response_function_index,
+                                                contribution );
+
+      thread_moments.total_histograms[response_function_index].addRawScore( contribution );
+
+      thread_moments.updated = true;
+    }
+  }
+  else
+  {
+    // Update the moments
+    #pragma omp critical
+    {
+      d_total_estimator_moments.addRawScore( response_function_index, contribution );
+    }
+    
+    this->addHistoryContributionToTotalBinHistogram( response_function_index,
+                                                     contribution );
+  }
 }
 
 // Add contribution to total bin histogram
@@ -1004,61 +1176,235 @@ void StandardEntityEstimator::addHistoryContributionToTotalBinHistogram(
   }
 }
 
-// Add info to update tracker
-void StandardEntityEstimator::addInfoToUpdateTracker(
-						    const size_t thread_id,
-						    const EntityId entity_id,
-						    const size_t bin_index,
-						    const double contribution )
+// Initialize the thread private total moments
+/*! \details The thread private total moments will mirror the layout of the
+ * shared total moments. Any contributions that have not been merged will be
+ * lost so this should only be called when the estimator is being set up.
+ */
+void StandardEntityEstimator::initializeThreadPrivateTotalMoments()
+{
+  d_thread_private_total_moments.clear();
+
+  if( this->isThreadPrivateMomentAccumulationEnabled() &&
+      this->getNumberOfSupportedThreads() > 1 )
+  {
+    ThreadPrivateTotalMoments default_thread_moments;
+
+    default_thread_moments.total_moments = d_total_estimator_moments;
+    default_thread_moments.total_moments.reset();
+
+    default_thread_moments.entity_total_moments_map =
+      d_entity_total_estimator_moments_map;
+
+    for( auto&& entity_data : default_thread_moments.entity_total_moments_map )
+      entity_data.second.reset();
+
+    default_thread_moments.total_histograms = d_total_estimator_histograms;
+
+    for( auto&& histogram : default_thread_moments.total_histograms )
+      histogram.reset();
+
+    default_thread_moments.entity_total_histograms_map =
+      d_entity_total_estimator_histograms_map;
+
+    for( auto&& entity_data : default_thread_moments.entity_total_histograms_map )
+    {
+      for( auto&& histogram : entity_data.second )
+        histogram.reset();
+    }
+
+    default_thread_moments.updated = false;
+
+    d_thread_private_total_moments.resize(
+                                       this->getNumberOfSupportedThreads()-1,
+                                       default_thread_moments );
+  }
+}
+
+// Initialize the entity slots and the update trackers
+/*! \details Each entity is assigned a slot that is used to index the dense
+ * update trackers. The slots are assigned in ascending entity id order. When
+ * the entity ids are compact a direct index table is used to look up the
+ * slot of an entity. Otherwise the slot is found with a binary search of the
+ * sorted entity ids. This must only be called by the root thread outside of
+ * a parallel region.
+ */
+void StandardEntityEstimator::initializeUpdateTrackers()
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  d_min_entity_id = 0;
+  d_entity_slots.clear();
+  d_slot_entities.clear();
+
+  for( auto&& entity_data : d_entity_total_estimator_moments_map )
+    d_slot_entities.push_back( entity_data.first );
+
+  std::sort( d_slot_entities.begin(), d_slot_entities.end() );
 
-  BinContributionMap& thread_entity_bin_contribution_map =
-    d_update_tracker[thread_id][entity_id];
+  if( !d_slot_entities.empty() )
+  {
+    d_min_entity_id = d_slot_entities.front();
+
+    const EntityId entity_id_range =
+      d_slot_entities.back() - d_slot_entities.front();
+
+    // Only use the direct index table if it will not be much larger than
+    // the number of entities
+    if( entity_id_range < 4*d_slot_entities.size() + 64 )
+    {
+      d_entity_slots.resize( entity_id_range + 1,
+                             std::numeric_limits<size_t>::max() );
 
-  BinContributionMap::iterator entity_bin_data =
-    thread_entity_bin_contribution_map.find( bin_index );
+      for( size_t i = 0; i < d_slot_entities.size(); ++i )
+        d_entity_slots[d_slot_entities[i] - d_min_entity_id] = i;
+    }
+  }
 
-  if( entity_bin_data != thread_entity_bin_contribution_map.end() )
-    entity_bin_data->second += contribution;
+  for( auto&& update_tracker : d_update_tracker )
+  {
+    update_tracker = SerialUpdateTracker();
+
+    update_tracker.entity_slot_blocks.resize( d_slot_entities.size(),
+                                              std::numeric_limits<size_t>::max() );
+  }
+}
+
+// Return the update tracker slot of an entity
+size_t StandardEntityEstimator::getEntitySlot( const EntityId entity_id ) const
+{
+  // Make sure the entity has a slot
+  testPrecondition( std::binary_search( d_slot_entities.begin(),
+                                        d_slot_entities.end(),
+                                        entity_id ) );
+
+  if( !d_entity_slots.empty() )
+    return d_entity_slots[entity_id - d_min_entity_id];
   else
-    thread_entity_bin_contribution_map[bin_index] = contribution;
+  {
+    return std::lower_bound( d_slot_entities.begin(),
+                             d_slot_entities.end(),
+                             entity_id ) - d_slot_entities.begin();
+  }
 }
 
-// Get the bin iterator from an update tracker iterator
-void StandardEntityEstimator::getEntityIteratorFromUpdateTracker(
-              const size_t thread_id,
-	      typename SerialUpdateTracker::const_iterator& start_entity,
-	      typename SerialUpdateTracker::const_iterator& end_entity ) const
+// Prepare the update tracker for a new history
+/*! \details The number of bins can change when the discretization or the
+ * response functions are changed so the tracker must be checked before the
+ * first contribution of every history.
+ */
+void StandardEntityEstimator::prepareUpdateTracker(
+                                   SerialUpdateTracker& update_tracker ) const
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  const size_t num_response_funcs = this->getNumberOfResponseFunctions();
+
+  const size_t bins_per_entity = this->getNumberOfBins()*num_response_funcs;
 
-  start_entity = d_update_tracker[thread_id].begin();
-  end_entity = d_update_tracker[thread_id].end();
+  if( update_tracker.bins_per_entity != bins_per_entity )
+  {
+    update_tracker.bins_per_entity = bins_per_entity;
+
+    update_tracker.bin_contributions.clear();
+    update_tracker.bin_contribution_updated.clear();
+
+    update_tracker.bin_totals.assign( bins_per_entity, 0.0 );
+    update_tracker.bin_total_updated.assign( bins_per_entity, 0 );
+  }
+
+  if( update_tracker.totals.size() != num_response_funcs )
+  {
+    update_tracker.entity_totals.assign( num_response_funcs, 0.0 );
+    update_tracker.totals.assign( num_response_funcs, 0.0 );
+  }
 }
 
-// Get the bin iterator from an update tracker iterator
-void StandardEntityEstimator::getBinIteratorFromUpdateTrackerIterator(
-           const size_t thread_id,
-	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
-	   BinContributionMap::const_iterator& start_bin,
-	   BinContributionMap::const_iterator& end_bin ) const
+// Add info to update tracker
+void StandardEntityEstimator::addInfoToUpdateTracker(
+						    const size_t history_buffer,
+						    const EntityId entity_id,
+						    const size_t bin_index,
+						    const double contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
-  // Make sure the entity iterator is valid
-  testPrecondition( entity_iterator != d_update_tracker[thread_id].end() );
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer < d_update_tracker.size() );
+  SerialUpdateTracker& update_tracker = d_update_tracker[history_buffer];
 
-  start_bin = entity_iterator->second.begin();
-  end_bin = entity_iterator->second.end();
+  if( update_tracker.updated_entity_slots.empty() )
+    this->prepareUpdateTracker( update_tracker );
+
+  // Make sure the bin index is valid
+  testPrecondition( bin_index < update_tracker.bins_per_entity );
+
+  const size_t entity_slot = this->getEntitySlot( entity_id );
+
+  size_t& block = update_tracker.entity_slot_blocks[entity_slot];
+
+  // Assign the next block to the entity
+  if( block == std::numeric_limits<size_t>::max() )
+  {
+    block = update_tracker.updated_entity_slots.size();
+
+    update_tracker.updated_entity_slots.push_back( entity_slot );
+
+    const size_t min_size = (block+1)*update_tracker.bins_per_entity;
+
+    if( update_tracker.bin_contributions.size() < min_size )
+    {
+      update_tracker.bin_contributions.resize( min_size, 0.0 );
+      update_tracker.bin_contribution_updated.resize( min_size, 0 );
+    }
+  }
+
+  const size_t index = block*update_tracker.bins_per_entity + bin_index;
+
+  if( update_tracker.bin_contribution_updated[index] )
+    update_tracker.bin_contributions[index] += contribution;
+  else
+  {
+    update_tracker.bin_contributions[index] = contribution;
+    update_tracker.bin_contribution_updated[index] = 1;
+    update_tracker.updated_bin_contributions.push_back( index );
+  }
 }
 
 // Reset the update tracker
-void StandardEntityEstimator::resetUpdateTracker( const size_t thread_id )
+/*! \details Only the updated entries are reset.
+ */
+void StandardEntityEstimator::resetUpdateTracker( const size_t history_buffer )
 {
-  d_update_tracker[thread_id].clear();
+  // Make sure the history buffer is valid
+  testPrecondition( history_buffer < d_update_tracker.size() );
+
+  SerialUpdateTracker& update_tracker = d_update_tracker[history_buffer];
+
+  for( size_t i = 0; i < update_tracker.updated_bin_contributions.size(); ++i )
+  {
+    const size_t index = update_tracker.updated_bin_contributions[i];
+
+    update_tracker.bin_contributions[index] = 0.0;
+    update_tracker.bin_contribution_updated[index] = 0;
+  }
+
+  update_tracker.updated_bin_contributions.clear();
+
+  for( size_t i = 0; i < update_tracker.updated_entity_slots.size(); ++i )
+  {
+    update_tracker.entity_slot_blocks[update_tracker.updated_entity_slots[i]] =
+      std::numeric_limits<size_t>::max();
+  }
+
+  update_tracker.updated_entity_slots.clear();
+
+  for( size_t i = 0; i < update_tracker.updated_bin_totals.size(); ++i )
+  {
+    const size_t bin_index = update_tracker.updated_bin_totals[i];
+
+    update_tracker.bin_totals[bin_index] = 0.0;
+    update_tracker.bin_total_updated[bin_index] = 0;
+  }
+
+  update_tracker.updated_bin_totals.clear();
+
+  for( size_t i = 0; i < update_tracker.totals.size(); ++i )
+    update_tracker.totals[i] = 0.0;
 }
 
 EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::StandardEntityEstimator );
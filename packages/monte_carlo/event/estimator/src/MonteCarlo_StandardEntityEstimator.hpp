@@ -19,18 +19,60 @@ namespace MonteCarlo{
 
 /*! The standard entity estimator class
  * \details This class has been set up to get correct results with multiple
- * threads. However, the commitHistoryContribution member function call should
- * only appear within an omp critical block. Use the enable thread support
- * member function to set up an instance of this class for the requested number
- * of threads. The classes default initialization is for a single thread.
+ * threads. Use the enable thread support member function to set up an
+ * instance of this class for the requested number of threads. The classes
+ * default initialization is for a single thread. By default the shared
+ * moments are updated inside of omp critical blocks. When thread private
+ * moment accumulation is enabled each thread will accumulate its
+ * contributions without locking and the contributions will be merged when a
+ * snapshot is taken or when the data is reduced.
  */
 class StandardEntityEstimator : public EntityEstimator
 {
-  // Typedef for bin contribution map
-  typedef std::unordered_map<size_t,double> BinContributionMap;
+  // The update tracker of a single thread
+  /* \details The tracker is dense: each entity that is updated during a
+   * history is assigned a contiguous block of bin contributions (one entry
+   * for each bin of each response function). The updated entities and bins
+   * are recorded so that committing and resetting the tracker only visits
+   * what was updated. The blocks are reused between histories so no
+   * allocations occur once the tracker has grown to the largest number of
+   * entities updated in a single history.
+   */
+  struct SerialUpdateTracker
+  {
+    // The number of bins (over all response functions) in an entity block
+    size_t bins_per_entity;
 
-  // Typedef for serial update tracker
-  typedef std::unordered_map<EntityId,BinContributionMap> SerialUpdateTracker;
+    // The block assigned to each entity slot (invalid if not updated)
+    std::vector<size_t> entity_slot_blocks;
+
+    // The updated entity slots (the index is the assigned block)
+    std::vector<size_t> updated_entity_slots;
+
+    // The bin contributions (indexed by block*bins_per_entity + bin)
+    std::vector<double> bin_contributions;
+
+    // The bin contribution update flags
+    std::vector<unsigned char> bin_contribution_updated;
+
+    // The indices of the updated bin contributions
+    std::vector<size_t> updated_bin_contributions;
+
+    // The bin totals over all entities (used when committing)
+    std::vector<double> bin_totals;
+
+    // The bin total update flags (used when committing)
+    std::vector<unsigned char> bin_total_updated;
+
+    // The updated bin totals (used when committing)
+    std::vector<size_t> updated_bin_totals;
+
+    // The entity totals for each response function (used when committing)
+    std::vector<double> entity_totals;
+
+    // The totals over all entities for each resp. func. (used when committing)
+    std::vector<double> totals;
+  };
 
   // Typedef for parallel update tracker
   typedef std::vector<SerialUpdateTracker> ParallelUpdateTracker;
@@ -176,6 +218,9 @@ public:
       const size_t response_function_index,
       Utility::SampleMomentHistogram<double>& histogram ) const final override;
 
+  //! Enable thread private moment accumulation
+  void enableThreadPrivateMomentAccumulation() final override;
+
   //! Commit the contribution from the current history to the estimator
   void commitHistoryContribution() final override;
 
@@ -206,6 +251,9 @@ protected:
   //! Assign the history score pdf bins
   void assignSampleMomentHistogramBins( const std::shared_ptr<const std::vector<double> >& bins ) final override;
 
+  //! Merge the thread private moments into the shared moments
+  void mergeThreadPrivateMoments() override;
+
   //! Print the estimator data
   void printImplementation( std::ostream& os,
 			    const std::string& entity_type ) const final override;
@@ -231,6 +279,28 @@ protected:
 
 private:
 
+  // The thread private total moments (for threads other than the root)
+  struct ThreadPrivateTotalMoments
+  {
+    // The total estimator moments across all entities
+    Estimator::FourEstimatorMomentsCollection total_moments;
+
+    // The total estimator moments for each entity
+    EntityEstimatorMomentsCollectionMap entity_total_moments_map;
+
+    // The sample moment histograms across all entities
+    SampleMomentHistogramArray total_histograms;
+
+    // The sample moment histograms for each entity
+    EntityEstimatorSampleMomentHistogramArrayMap entity_total_histograms_map;
+
+    // Records if the thread has committed a contribution since the last merge
+    bool updated;
+  };
+
+  // Initialize the thread private total moments
+  void initializeThreadPrivateTotalMoments();
+
   // Resize the entity total estimator moments map collections
   void resizeEntityTotalEstimatorMomentsMapCollections();
 
@@ -260,27 +330,23 @@ private:
   template<typename InputEntityId>
   void initializeMomentsMaps( const std::vector<InputEntityId>& entity_ids );
 
+  // Initialize the entity slots and the update trackers
+  void initializeUpdateTrackers();
+
+  // Return the update tracker slot of an entity
+  size_t getEntitySlot( const EntityId entity_id ) const;
+
+  // Prepare the update tracker for a new history
+  void prepareUpdateTracker( SerialUpdateTracker& update_tracker ) const;
+
   // Add info to update tracker
-  void addInfoToUpdateTracker( const size_t thread_id,
+  void addInfoToUpdateTracker( const size_t history_buffer,
                                const EntityId entity_id,
                                const size_t bin_index,
                                const double contribution );
 
-  // Get entity iterators from update tracker
-  void getEntityIteratorFromUpdateTracker(
-	      const size_t thread_id,
-	      typename SerialUpdateTracker::const_iterator& start_entity,
-	      typename SerialUpdateTracker::const_iterator& end_entity ) const;
-
-  // Get the bin iterator from an update tracker iterator
-  void getBinIteratorFromUpdateTrackerIterator(
-	   const size_t thread_id,
-	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
-	   BinContributionMap::const_iterator& start_bin,
-	   BinContributionMap::const_iterator& end_bin ) const;
-
   // Reset the update tracker
-  void resetUpdateTracker( const size_t thread_id );
+  void resetUpdateTracker( const size_t history_buffer );
 
   // Save the data to an archive
   template<typename Archive>
@@ -313,8 +379,29 @@ private:
   // The total estimator moment histograms for each entity and response func.
   EntityEstimatorSampleMomentHistogramArrayMap d_entity_total_estimator_histograms_map;
 
-  // The entities/bins that have been updated
+  // The smallest entity id (the offset of the entity slot table)
+  EntityId d_min_entity_id;
+
+  // The update tracker slot of each entity (indexed by entity id - min id)
+  // - this table will be empty if the entity ids are too sparse
+  std::vector<size_t> d_entity_slots;
+
+  // The entity id of each update tracker slot (sorted)
+  std::vector<EntityId> d_slot_entities;
+
+  // The entities/bins that have been updated (one tracker per history buffer)
   ParallelUpdateTracker d_update_tracker;
+
+  // The thread private total moments (the root thread uses the shared moments)
+  std::vector<ThreadPrivateTotalMoments> d_thread_private_total_moments;
+
+  // The thread bin index buffers (reused by every point contribution)
+  std::vector<ObserverPhaseSpaceDimensionDiscretization::BinIndexArray>
+  d_thread_bin_indices;
+
+  // The thread bin index and weight buffers (reused by every range contrib.)
+  std::vector<ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray>
+  d_thread_bin_indices_and_weights;
 };
 
 } // end MonteCarlo namespace
@@ -25,9 +25,14 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_min_entity_id( 0 ),
+    d_entity_slots(),
+    d_slot_entities(),
+    d_update_tracker( 1 ),
+    d_thread_private_total_moments()
 {
   this->initializeMomentsMaps( entity_ids );
+  this->initializeUpdateTrackers();
 }
 
 // Constructor (for non-flux estimators)
@@ -43,9 +48,14 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1, Utility::SampleMomentHistogram<double>( this->getSampleMomentHistogramBins() ) ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_min_entity_id( 0 ),
+    d_entity_slots(),
+    d_slot_entities(),
+    d_update_tracker( 1 ),
+    d_thread_private_total_moments()
 {
   this->initializeMomentsMaps( entity_ids );
+  this->initializeUpdateTrackers();
 }
 
 // Initialize the moments maps
@@ -109,6 +119,11 @@ void StandardEntityEstimator::load( Archive& ar, const unsigned version )
 
   // Initialize the thread data
   d_update_tracker.resize( 1 );
+  d_thread_private_total_moments.clear();
+  d_thread_bin_indices.resize( 1 );
+  d_thread_bin_indices_and_weights.resize( 1 );
+
+  this->initializeUpdateTrackers();
 }
 
 } // end MonteCarlo namespace
@@ -74,6 +74,14 @@ public:
   bool areSampleMomentHistogramsOnEntityBinsEnabled() const final override
   { return false; }
 
+  //! Enable thread private moment accumulation
+  void enableThreadPrivateMomentAccumulation() final override
+  { /* ... */ }
+
+  //! Check if thread private moment accumulation has been enabled
+  bool isThreadPrivateMomentAccumulationEnabled() const final override
+  { return false; }
+
   //! Get the total estimator bin data first moments
   Utility::ArrayView<const double> getTotalBinDataFirstMoments() const final override
   { return Utility::ArrayView<const double>(); }
@@ -134,6 +142,10 @@ public:
   using MonteCarlo::Estimator::getResponseFunctionName;
   using MonteCarlo::Estimator::getBinName;
   using MonteCarlo::Estimator::calculateResponseFunctionIndex;
+  using MonteCarlo::Estimator::TwoEstimatorMomentsCollection;
+  using MonteCarlo::Estimator::FourEstimatorMomentsCollection;
+  using MonteCarlo::Estimator::packMoments;
+  using MonteCarlo::Estimator::unpackMoments;
 };
 
 TestEstimator::TestEstimator( const uint32_t id, const double multiplier )
@@ -711,6 +723,58 @@ FRENSIE_UNIT_TEST( Estimator, hasUncommittedHistoryContribution_parallel_safe )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the moments of a collection can be packed and unpacked
+FRENSIE_UNIT_TEST( Estimator, packMoments_unpackMoments )
+{
+  TestEstimator::FourEstimatorMomentsCollection collection( 2 );
+
+  for( size_t i = 0; i < collection.size(); ++i )
+  {
+    Utility::getCurrentScore<1>( collection, i ) = 1.0 + i;
+    Utility::getCurrentScore<2>( collection, i ) = 2.0 + i;
+    Utility::getCurrentScore<3>( collection, i ) = 3.0 + i;
+    Utility::getCurrentScore<4>( collection, i ) = 4.0 + i;
+  }
+
+  TestEstimator::TwoEstimatorMomentsCollection total_collection( 1 );
+
+  Utility::getCurrentScore<1>( total_collection, 0 ) = 5.0;
+  Utility::getCurrentScore<2>( total_collection, 0 ) = 6.0;
+
+  std::vector<double> packed_moments;
+
+  TestEstimator::packMoments( collection, packed_moments );
+  TestEstimator::packMoments( total_collection, packed_moments );
+
+  FRENSIE_CHECK_EQUAL( packed_moments,
+                       std::vector<double>( {1.0, 2.0, 2.0, 3.0, 3.0, 4.0, 4.0, 5.0, 5.0, 6.0} ) );
+
+  // Double the packed moments (e.g. reduction over two processes)
+  for( size_t i = 0; i < packed_moments.size(); ++i )
+    packed_moments[i] *= 2;
+
+  size_t offset = 0;
+
+  TestEstimator::unpackMoments( packed_moments, offset, collection );
+
+  FRENSIE_CHECK_EQUAL( offset, 8 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( collection, 0 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( collection, 1 ), 4.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( collection, 0 ), 4.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( collection, 1 ), 6.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( collection, 0 ), 6.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( collection, 1 ), 8.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( collection, 0 ), 8.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( collection, 1 ), 10.0 );
+
+  TestEstimator::unpackMoments( packed_moments, offset, total_collection );
+
+  FRENSIE_CHECK_EQUAL( offset, 10 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( total_collection, 0 ), 10.0 );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( total_collection, 0 ), 12.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the bin name can be created
 FRENSIE_UNIT_TEST( Estimator, getBinName )
@@ -0,0 +1,280 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPointDetectorFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  Point detector flux estimator unit tests.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_PointDetectorFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_Array.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef MonteCarlo::ParticleCollidingGlobalEventObserver::EmissionDensityArray
+EmissionDensityArray;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create an estimator with a detector at 2 cm and a detector at 0.5 cm
+std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+createEstimator()
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedPointDetectorFluxEstimator(
+                                         0u,
+                                         1.0,
+                                         {{2.0, 0.0, 0.0}, {0.0, 0.0, 0.5}} ) );
+
+  estimator->setExclusionSphereRadius( 1.0 );
+  estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+
+  return estimator;
+}
+
+// Isotropic emission at 1 MeV
+void evaluateIsotropicEmissionDensity( const double[3],
+                                       EmissionDensityArray& densities )
+{
+  densities.assign( 1, std::make_pair( 1.0, 0.25/Utility::PhysicalConstants::pi ) );
+}
+
+// A uniform medium with a macroscopic total cross section of 0.5 1/cm
+double evaluateOpticalDepth( const double,
+                             const double[3],
+                             const double distance,
+                             const double )
+{
+  return 0.5*distance;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the estimator is not a cell, surface or mesh type estimator
+FRENSIE_UNIT_TEST_TEMPLATE( PointDetectorFluxEstimator,
+                            check_type,
+                            MonteCarlo::WeightMultiplier,
+                            MonteCarlo::WeightAndEnergyMultiplier,
+                            MonteCarlo::WeightAndChargeMultiplier )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+         new MonteCarlo::PointDetectorFluxEstimator<ContributionMultiplierPolicy>(
+                                                   0u,
+                                                   10.0,
+                                                   {{1.0, 2.0, 3.0}} ) );
+
+  FRENSIE_CHECK( !estimator->isCellEstimator() );
+  FRENSIE_CHECK( !estimator->isSurfaceEstimator() );
+  FRENSIE_CHECK( !estimator->isMeshEstimator() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the detectors can be returned
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, getDetectorPosition )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator = createEstimator();
+
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfDetectors(), 2 );
+  FRENSIE_CHECK( estimator->isEntityAssigned( 0 ) );
+  FRENSIE_CHECK( estimator->isEntityAssigned( 1 ) );
+  FRENSIE_CHECK( !estimator->isEntityAssigned( 2 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getDetectorPosition( 0 ),
+                       (std::array<double,3>({2.0, 0.0, 0.0})) );
+  FRENSIE_CHECK_EQUAL( estimator->getDetectorPosition( 1 ),
+                       (std::array<double,3>({0.0, 0.0, 0.5})) );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::WeightMultipliedPointDetectorFluxEstimator( 1u, 1.0, std::vector<std::array<double,3> >() ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the contribution controls can be set
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator, contribution_controls )
+{
+  MonteCarlo::WeightMultipliedPointDetectorFluxEstimator
+    estimator( 0u, 1.0, {{1.0, 2.0, 3.0}} );
+
+  FRENSIE_CHECK_EQUAL( estimator.getExclusionSphereRadius(), 0.0 );
+  FRENSIE_CHECK_EQUAL( estimator.getMaxOpticalDepth(),
+                       std::numeric_limits<double>::infinity() );
+  FRENSIE_CHECK_EQUAL( estimator.getContributionRouletteThreshold(), 0.0 );
+
+  estimator.setExclusionSphereRadius( 0.1 );
+  estimator.setMaxOpticalDepth( 10.0 );
+  estimator.setContributionRouletteThreshold( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( estimator.getExclusionSphereRadius(), 0.1 );
+  FRENSIE_CHECK_EQUAL( estimator.getMaxOpticalDepth(), 10.0 );
+  FRENSIE_CHECK_EQUAL( estimator.getContributionRouletteThreshold(), 1e-3 );
+
+  FRENSIE_CHECK_THROW( estimator.setExclusionSphereRadius( -1.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( estimator.setMaxOpticalDepth( 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( estimator.setContributionRouletteThreshold( -1.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a partial history contribution can be added to the estimator
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromGlobalParticleCollidingEvent )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator = createEstimator();
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setPosition( 0.0, 0.0, 0.0 );
+  particle.setDirection( 0.0, 0.0, 1.0 );
+  particle.setEnergy( 2.0 );
+  particle.setWeight( 2.0 );
+
+  estimator->updateFromGlobalParticleCollidingEvent(
+                                            particle,
+                                            &evaluateIsotropicEmissionDensity,
+                                            &evaluateOpticalDepth );
+
+  FRENSIE_CHECK( estimator->hasUncommittedHistoryContribution() );
+
+  estimator->commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 1.0 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  // Outside of the exclusion sphere: w/(4 pi R^2) exp(-tau)
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+            estimator->getEntityBinDataFirstMoments( 0 ),
+            std::vector<double>( 1, 2.0*0.25/Utility::PhysicalConstants::pi/4.0*std::exp( -1.0 ) ),
+            1e-15 );
+
+  // Inside of the exclusion sphere: 3w/(4 pi R0^2) exp(-tau)
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+            estimator->getEntityBinDataFirstMoments( 1 ),
+            std::vector<double>( 1, 2.0*0.25/Utility::PhysicalConstants::pi*3.0*std::exp( -0.25 ) ),
+            1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that contributions beyond the max optical depth are rejected
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromGlobalParticleCollidingEvent_max_optical_depth )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator = createEstimator();
+
+  estimator->setMaxOpticalDepth( 0.5 );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setEnergy( 2.0 );
+  particle.setWeight( 1.0 );
+
+  estimator->updateFromGlobalParticleCollidingEvent(
+                                            particle,
+                                            &evaluateIsotropicEmissionDensity,
+                                            &evaluateOpticalDepth );
+
+  estimator->commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 1.0 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                       std::vector<double>( 1, 0.0 ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+            estimator->getEntityBinDataFirstMoments( 1 ),
+            std::vector<double>( 1, 0.25/Utility::PhysicalConstants::pi*3.0*std::exp( -0.25 ) ),
+            1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that small contributions are rouletted
+FRENSIE_UNIT_TEST( PointDetectorFluxEstimator,
+                   updateFromGlobalParticleCollidingEvent_roulette )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedPointDetectorFluxEstimator>
+    estimator = createEstimator();
+
+  // Only the contribution to the first detector is below the threshold
+  estimator->setContributionRouletteThreshold( 0.1 );
+
+  MonteCarlo::PhotonState particle( 0ull );
+  particle.setEnergy( 2.0 );
+  particle.setWeight( 1.0 );
+
+  // The first contribution survives, the second is killed
+  std::vector<double> fake_stream( {0.1, 0.5} );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  estimator->updateFromGlobalParticleCollidingEvent(
+                                            particle,
+                                            &evaluateIsotropicEmissionDensity,
+                                            &evaluateOpticalDepth );
+
+  estimator->updateFromGlobalParticleCollidingEvent(
+                                            particle,
+                                            &evaluateIsotropicEmissionDensity,
+                                            &evaluateOpticalDepth );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  estimator->commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 1.0 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( estimator->getEntityBinDataFirstMoments( 0 ),
+                                   std::vector<double>( 1, 0.1*std::exp( -1.0 ) ),
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+            estimator->getEntityBinDataFirstMoments( 1 ),
+            std::vector<double>( 1, 2.0*0.25/Utility::PhysicalConstants::pi*3.0*std::exp( -0.25 ) ),
+            1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstPointDetectorFluxEstimator.cpp
+//---------------------------------------------------------------------------//
@@ -644,6 +644,322 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
                        expected_histogram_values );
 }
 
+//---------------------------------------------------------------------------//
+// Check that repeated contributions to an entity in a history are summed
+// before the history is committed
+FRENSIE_UNIT_TEST( StandardEntityEstimator,
+                   addPartialHistoryPointContribution_repeated_entity )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  // bin 0 (E=0, Mu=0, T=0, Col=0)
+  MonteCarlo::PhotonState particle( 0ull );
+  MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+  particle.setEnergy( 1e-2 );
+  particle_wrapper.setAngleCosine( -0.5 );
+  particle.setTime( 5e-6 );
+
+  estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+  estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+  estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 2.0 );
+
+  // bin 1 (E=1, Mu=0, T=0, Col=0)
+  particle.setEnergy( 0.11 );
+
+  estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+  estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+  estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+  // Commit the contributions
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  // Check the entity bin data moments
+  std::vector<double> expected_bin_first_moments( 32, 0.0 );
+  expected_bin_first_moments[0] = 3.0;
+  expected_bin_first_moments[1] = 2.0;
+  expected_bin_first_moments[16] = 3.0;
+  expected_bin_first_moments[17] = 2.0;
+
+  std::vector<double> expected_bin_second_moments( 32, 0.0 );
+  expected_bin_second_moments[0] = 9.0;
+  expected_bin_second_moments[1] = 4.0;
+  expected_bin_second_moments[16] = 9.0;
+  expected_bin_second_moments[17] = 4.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1 ),
+                       expected_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 1 ),
+                       expected_bin_second_moments );
+
+  expected_bin_first_moments[0] = 1.0;
+  expected_bin_first_moments[1] = 1.0;
+  expected_bin_first_moments[16] = 1.0;
+  expected_bin_first_moments[17] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                       expected_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 0 ),
+                       expected_bin_first_moments );
+
+  // Check the total bin data moments
+  expected_bin_first_moments[0] = 4.0;
+  expected_bin_first_moments[1] = 3.0;
+  expected_bin_first_moments[16] = 4.0;
+  expected_bin_first_moments[17] = 3.0;
+
+  expected_bin_second_moments[0] = 16.0;
+  expected_bin_second_moments[1] = 9.0;
+  expected_bin_second_moments[16] = 16.0;
+  expected_bin_second_moments[17] = 9.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       expected_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataSecondMoments(),
+                       expected_bin_second_moments );
+
+  // Check the entity total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 1 ),
+                       std::vector<double>( 2, 5.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 1 ),
+                       std::vector<double>( 2, 25.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 0 ),
+                       std::vector<double>( 2, 2.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 0 ),
+                       std::vector<double>( 2, 4.0 ) );
+
+  // Check the total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 7.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataSecondMoments(),
+                       std::vector<double>( 2, 49.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the contributions of a history are reset once committed
+FRENSIE_UNIT_TEST( StandardEntityEstimator,
+                   commitHistoryContribution_reset )
+{
+  // Use sparse entity ids
+  std::vector<uint64_t> entity_ids( 2 );
+  entity_ids[0] = 1000000;
+  entity_ids[1] = 3;
+
+  std::vector<double> entity_norm_constants( 2, 1.0 );
+
+  std::shared_ptr<TestStandardEntityEstimator>
+    estimator( new TestStandardEntityEstimator( 0ull,
+                                                10.0,
+                                                entity_ids,
+                                                entity_norm_constants ) );
+
+  std::vector<MonteCarlo::ParticleType> particle_types( 1 );
+  particle_types[0] = MonteCarlo::PHOTON;
+
+  estimator->setParticleTypes( particle_types );
+
+  setEstimatorBins( *estimator, false );
+
+  // bin 0 (E=0, Mu=0, T=0, Col=0)
+  MonteCarlo::PhotonState particle( 0ull );
+  MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+  particle.setEnergy( 1e-2 );
+  particle_wrapper.setAngleCosine( -0.5 );
+  particle.setTime( 5e-6 );
+
+  // First history
+  estimator->addPartialHistoryPointContribution( 1000000,
+                                                 particle_wrapper,
+                                                 1.0 );
+  estimator->commitHistoryContribution();
+
+  // An empty history
+  estimator->commitHistoryContribution();
+
+  // Second history: bin 1 (E=1, Mu=0, T=0, Col=0)
+  particle.setEnergy( 0.11 );
+
+  estimator->addPartialHistoryPointContribution( 3, particle_wrapper, 2.0 );
+  estimator->addPartialHistoryPointContribution( 1000000,
+                                                 particle_wrapper,
+                                                 1.0 );
+  estimator->commitHistoryContribution();
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  // Check the entity bin data moments
+  std::vector<double> expected_bin_first_moments( 32, 0.0 );
+  expected_bin_first_moments[0] = 1.0;
+  expected_bin_first_moments[1] = 1.0;
+  expected_bin_first_moments[16] = 1.0;
+  expected_bin_first_moments[17] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1000000 ),
+                       expected_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 1000000 ),
+                       expected_bin_first_moments );
+
+  expected_bin_first_moments.assign( 32, 0.0 );
+  expected_bin_first_moments[1] = 2.0;
+  expected_bin_first_moments[17] = 2.0;
+
+  std::vector<double> expected_bin_second_moments( 32, 0.0 );
+  expected_bin_second_moments[1] = 4.0;
+  expected_bin_second_moments[17] = 4.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 3 ),
+                       expected_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 3 ),
+                       expected_bin_second_moments );
+
+  // Check the total bin data moments
+  expected_bin_first_moments[0] = 1.0;
+  expected_bin_first_moments[1] = 3.0;
+  expected_bin_first_moments[16] = 1.0;
+  expected_bin_first_moments[17] = 3.0;
+
+  expected_bin_second_moments[0] = 1.0;
+  expected_bin_second_moments[1] = 9.0;
+  expected_bin_second_moments[16] = 1.0;
+  expected_bin_second_moments[17] = 9.0;
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       expected_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataSecondMoments(),
+                       expected_bin_second_moments );
+
+  // Check the entity total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 1000000 ),
+                       std::vector<double>( 2, 2.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 1000000 ),
+                       std::vector<double>( 2, 2.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 3 ),
+                       std::vector<double>( 2, 2.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 3 ),
+                       std::vector<double>( 2, 4.0 ) );
+
+  // Check the total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 4.0 ) );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataSecondMoments(),
+                       std::vector<double>( 2, 10.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that history contributions can be accumulated in thread private
+// moments and merged when a snapshot is taken
+FRENSIE_UNIT_TEST( StandardEntityEstimator,
+                   commitHistoryContribution_thread_private_moments )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  FRENSIE_CHECK( !estimator->isThreadPrivateMomentAccumulationEnabled() );
+
+  estimator->enableThreadPrivateMomentAccumulation();
+
+  FRENSIE_CHECK( estimator->isThreadPrivateMomentAccumulationEnabled() );
+  
+  // Enable thread support
+  estimator->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  #pragma omp parallel num_threads( threads )
+  {
+    // bin 0 (E=0, Mu=0, T=0, Col=0)
+    MonteCarlo::PhotonState particle( 0ull );
+    MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+  
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-6 );
+
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+    // Commit the contributions
+    estimator->commitHistoryContribution();
+  }
+
+  for( unsigned i = 0; i < threads; ++i )
+  {
+    FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution( i ) );
+  }
+
+  // Only the root thread contributions are in the shared moments until
+  // the thread private moments are merged
+  std::vector<double> expected_total_bin_first_moments( 32, 0.0 );
+  expected_total_bin_first_moments[0] = 2.0;
+  expected_total_bin_first_moments[16] = 2.0;
+  
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       expected_total_bin_first_moments );
+
+  estimator->takeSnapshot( threads, 1.0 );
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( threads );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  // Check the total bin data moments
+  std::vector<double> expected_total_bin_second_moments( 32, 0.0 );
+  expected_total_bin_first_moments[0] = 2.0*threads;
+  expected_total_bin_first_moments[16] = 2.0*threads;
+  expected_total_bin_second_moments[0] = 4.0*threads;
+  expected_total_bin_second_moments[16] = 4.0*threads;
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       expected_total_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataSecondMoments(),
+                       expected_total_bin_second_moments );
+
+  // Check the entity bin data moments
+  std::vector<double> expected_entity_bin_moments( 32, 0.0 );
+  expected_entity_bin_moments[0] = threads;
+  expected_entity_bin_moments[16] = threads;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                       expected_entity_bin_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 0 ),
+                       expected_entity_bin_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1 ),
+                       expected_entity_bin_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 1 ),
+                       expected_entity_bin_moments );
+
+  // Check the entity total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 0 ),
+                       std::vector<double>( 2, 1.0*threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 0 ),
+                       std::vector<double>( 2, 1.0*threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 1 ),
+                       std::vector<double>( 2, 1.0*threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataSecondMoments( 1 ),
+                       std::vector<double>( 2, 1.0*threads ) );
+
+  // Check the total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 2.0*threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataSecondMoments(),
+                       std::vector<double>( 2, 4.0*threads ) );
+
+  // Check the total histograms
+  Utility::SampleMomentHistogram<double> histogram;
+
+  estimator->getTotalSampleMomentHistogram( 0, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+
+  estimator->getEntityTotalSampleMomentHistogram( 0, 0, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a partial history contribution can be added to the estimator
 FRENSIE_UNIT_TEST( StandardEntityEstimator,
@@ -8180,6 +8496,111 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( StandardEntityEstimator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the thread private moments are merged before an estimator is
+// archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( StandardEntityEstimator,
+                                   archive_thread_private_moments,
+                                   TestArchives )
+{
+  if( Utility::GlobalMPISession::rank() == 0 )
+  {
+    FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+    FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+    typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+    typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+    std::string archive_base_name( "test_standard_entity_estimator" );
+    std::ostringstream archive_ostream;
+
+    unsigned threads =
+      Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+    {
+      std::unique_ptr<OArchive> oarchive;
+
+      createOArchive( archive_base_name, archive_ostream, oarchive );
+
+      std::shared_ptr<TestStandardEntityEstimator> estimator;
+      initializeStandardEntityEstimator( estimator );
+
+      estimator->enableThreadPrivateMomentAccumulation();
+      estimator->enableThreadSupport( threads );
+
+      #pragma omp parallel num_threads( threads )
+      {
+        // bin 0 (E=0, Mu=0, T=0, Col=0)
+        MonteCarlo::PhotonState particle( 0ull );
+        MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+        particle.setEnergy( 1e-2 );
+        particle_wrapper.setAngleCosine( -0.5 );
+        particle.setTime( 5e-6 );
+
+        estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+        estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+        // Commit the contributions
+        estimator->commitHistoryContribution();
+      }
+
+      // Do not take a snapshot - the thread private moments must be merged
+      // when the estimator is saved
+      FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( estimator ) );
+    }
+
+    // Copy the archive ostream to an istream
+    std::istringstream archive_istream( archive_ostream.str() );
+
+    // Load the archived estimator
+    std::unique_ptr<IArchive> iarchive;
+
+    createIArchive( archive_istream, iarchive );
+
+    std::shared_ptr<TestStandardEntityEstimator> estimator;
+
+    FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( estimator ) );
+
+    iarchive.reset();
+
+    FRENSIE_CHECK( estimator->isThreadPrivateMomentAccumulationEnabled() );
+
+    // Check the total bin data moments
+    std::vector<double> expected_total_bin_first_moments( 32, 0.0 );
+    std::vector<double> expected_total_bin_second_moments( 32, 0.0 );
+    expected_total_bin_first_moments[0] = 2.0*threads;
+    expected_total_bin_first_moments[16] = 2.0*threads;
+    expected_total_bin_second_moments[0] = 4.0*threads;
+    expected_total_bin_second_moments[16] = 4.0*threads;
+
+    FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                         expected_total_bin_first_moments );
+    FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataSecondMoments(),
+                         expected_total_bin_second_moments );
+
+    // Check the entity bin data moments
+    std::vector<double> expected_entity_bin_moments( 32, 0.0 );
+    expected_entity_bin_moments[0] = threads;
+    expected_entity_bin_moments[16] = threads;
+
+    FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                         expected_entity_bin_moments );
+    FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 0 ),
+                         expected_entity_bin_moments );
+    FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1 ),
+                         expected_entity_bin_moments );
+    FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 1 ),
+                         expected_entity_bin_moments );
+
+    // Check the total data moments
+    FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                         std::vector<double>( 2, 2.0*threads ) );
+    FRENSIE_CHECK_EQUAL( estimator->getTotalDataSecondMoments(),
+                         std::vector<double>( 2, 4.0*threads ) );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackRecord.hpp
+//! \author Alex Robinson
+//! \brief  Particle track record declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_TRACK_RECORD_HPP
+#define MONTE_CARLO_PARTICLE_TRACK_RECORD_HPP
+
+// Std Lib Includes
+#include <stdint.h>
+#include <type_traits>
+
+namespace MonteCarlo{
+
+namespace Details{
+
+//! The particle track file magic number ("FRNSTRK1")
+const uint64_t particle_track_file_magic_number = 0x314B5254534E5246ULL;
+
+//! The particle track file format version
+const uint64_t particle_track_file_format_version = 1;
+
+//! The particle track file header size (magic, version, record size)
+const uint64_t particle_track_file_header_size = 3*sizeof(uint64_t);
+
+//! The particle track file trailer size (index offset, records, magic)
+const uint64_t particle_track_file_trailer_size = 3*sizeof(uint64_t);
+
+} // end Details namespace
+
+/*! The particle track record
+ * \details A track record stores the state of a particle at a single track
+ * point. The layout is fixed (96 bytes with no padding) so that records can
+ * be written to and read from a track file directly. The particle index
+ * is unique within a history and is used to group the records that
+ * belong to the same particle.
+ */
+struct ParticleTrackRecord
+{
+  //! The history number
+  uint64_t history_number;
+
+  //! The position
+  double position[3];
+
+  //! The direction
+  double direction[3];
+
+  //! The energy
+  double energy;
+
+  //! The time
+  double time;
+
+  //! The weight
+  double weight;
+
+  //! The collision number
+  uint32_t collision_number;
+
+  //! The generation number
+  uint32_t generation_number;
+
+  //! The particle index (unique within the history)
+  uint32_t particle_index;
+
+  //! The particle type
+  uint32_t particle_type;
+};
+
+static_assert( sizeof(ParticleTrackRecord) == 96,
+               "The particle track record layout must not be padded!" );
+static_assert( std::is_pod<ParticleTrackRecord>::value,
+               "The particle track record must be a POD type!" );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_TRACK_RECORD_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackRecord.hpp
+//---------------------------------------------------------------------------//
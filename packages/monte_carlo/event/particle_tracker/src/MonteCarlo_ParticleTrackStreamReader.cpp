@@ -0,0 +1,230 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackStreamReader.cpp
+//! \author Alex Robinson
+//! \brief  Particle track stream reader definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackStreamReader.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace Details{
+
+// Read a value from a track file
+template<typename T>
+inline T readParticleTrackFileValue( std::istream& is )
+{
+  T value;
+
+  is.read( reinterpret_cast<char*>( &value ), sizeof(T) );
+
+  return value;
+}
+
+} // end Details namespace
+
+// Constructor
+ParticleTrackStreamReader::ParticleTrackStreamReader(
+                             const boost::filesystem::path& track_file_name )
+  : d_track_file_name( track_file_name ),
+    d_number_of_records( 0 ),
+    d_history_index()
+{
+  std::ifstream stream( track_file_name.string(), std::ifstream::binary );
+
+  TEST_FOR_EXCEPTION( !stream.good(),
+                      std::runtime_error,
+                      "Could not open the particle track file "
+                      << d_track_file_name.string() << "!" );
+
+  // Read the header
+  const uint64_t magic_number =
+    Details::readParticleTrackFileValue<uint64_t>( stream );
+  const uint64_t format_version =
+    Details::readParticleTrackFileValue<uint64_t>( stream );
+  const uint64_t record_size =
+    Details::readParticleTrackFileValue<uint64_t>( stream );
+
+  TEST_FOR_EXCEPTION( !stream.good() ||
+                      magic_number != Details::particle_track_file_magic_number,
+                      std::runtime_error,
+                      d_track_file_name.string() << " is not a particle "
+                      "track file!" );
+
+  TEST_FOR_EXCEPTION( format_version !=
+                      Details::particle_track_file_format_version ||
+                      record_size != sizeof(ParticleTrackRecord),
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name.string()
+                      << " has an unsupported format (version "
+                      << format_version << ", record size " << record_size
+                      << ")!" );
+
+  // Read the trailer
+  stream.seekg( 0, std::ifstream::end );
+
+  const int64_t file_size = stream.tellg();
+
+  TEST_FOR_EXCEPTION( file_size < (int64_t)(Details::particle_track_file_header_size +
+                                            Details::particle_track_file_trailer_size),
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name.string()
+                      << " has not been finalized!" );
+
+  stream.seekg( file_size - Details::particle_track_file_trailer_size );
+
+  const uint64_t index_offset =
+    Details::readParticleTrackFileValue<uint64_t>( stream );
+
+  d_number_of_records =
+    Details::readParticleTrackFileValue<uint64_t>( stream );
+
+  const uint64_t trailer_magic_number =
+    Details::readParticleTrackFileValue<uint64_t>( stream );
+
+  TEST_FOR_EXCEPTION( !stream.good() ||
+                      trailer_magic_number !=
+                      Details::particle_track_file_magic_number ||
+                      index_offset != Details::particle_track_file_header_size +
+                      d_number_of_records*sizeof(ParticleTrackRecord),
+                      std::runtime_error,
+                      "The particle track file " << d_track_file_name.string()
+                      << " has not been finalized!" );
+
+  // Read the history index
+  stream.seekg( index_offset );
+
+  const uint64_t number_of_histories =
+    Details::readParticleTrackFileValue<uint64_t>( stream );
+
+  for( uint64_t i = 0; i < number_of_histories; ++i )
+  {
+    const uint64_t history_number =
+      Details::readParticleTrackFileValue<uint64_t>( stream );
+
+    const uint64_t number_of_ranges =
+      Details::readParticleTrackFileValue<uint64_t>( stream );
+
+    RecordRanges& ranges = d_history_index[history_number];
+
+    ranges.resize( number_of_ranges );
+
+    for( uint64_t j = 0; j < number_of_ranges; ++j )
+    {
+      ranges[j].first =
+        Details::readParticleTrackFileValue<uint64_t>( stream );
+      ranges[j].second =
+        Details::readParticleTrackFileValue<uint64_t>( stream );
+    }
+  }
+
+  TEST_FOR_EXCEPTION( !stream.good(),
+                      std::runtime_error,
+                      "Could not read the history index of the particle "
+                      "track file " << d_track_file_name.string() << "!" );
+}
+
+// Return the track file name
+const boost::filesystem::path&
+ParticleTrackStreamReader::getTrackFileName() const
+{
+  return d_track_file_name;
+}
+
+// Return the number of records in the track file
+uint64_t ParticleTrackStreamReader::getNumberOfRecords() const
+{
+  return d_number_of_records;
+}
+
+// Return the histories in the track file
+void ParticleTrackStreamReader::getHistories(
+                                        std::set<uint64_t>& histories ) const
+{
+  histories.clear();
+
+  for( auto&& history_ranges : d_history_index )
+    histories.insert( history_ranges.first );
+}
+
+// Check if a history is in the track file
+bool ParticleTrackStreamReader::hasHistory(
+                                        const uint64_t history_number ) const
+{
+  return d_history_index.find( history_number ) != d_history_index.end();
+}
+
+// Return the records of a history
+/*! \details Only the record ranges that belong to the history will be read
+ * from the file. If the history is not in the file, no records will be
+ * returned.
+ */
+void ParticleTrackStreamReader::getHistoryRecords(
+                           const uint64_t history_number,
+                           std::vector<ParticleTrackRecord>& records ) const
+{
+  records.clear();
+
+  std::map<uint64_t,RecordRanges>::const_iterator history_ranges =
+    d_history_index.find( history_number );
+
+  if( history_ranges == d_history_index.end() )
+    return;
+
+  std::ifstream stream( d_track_file_name.string(), std::ifstream::binary );
+
+  for( auto&& range : history_ranges->second )
+  {
+    const size_t first_record = records.size();
+
+    records.resize( first_record + range.second );
+
+    stream.seekg( Details::particle_track_file_header_size +
+                  range.first*sizeof(ParticleTrackRecord) );
+
+    stream.read( reinterpret_cast<char*>( records.data() + first_record ),
+                 range.second*sizeof(ParticleTrackRecord) );
+  }
+
+  TEST_FOR_EXCEPTION( !stream.good(),
+                      std::runtime_error,
+                      "Could not read the records of history "
+                      << history_number << " from the particle track file "
+                      << d_track_file_name.string() << "!" );
+}
+
+// Return all of the records
+void ParticleTrackStreamReader::getRecords(
+                           std::vector<ParticleTrackRecord>& records ) const
+{
+  records.resize( d_number_of_records );
+
+  if( d_number_of_records == 0 )
+    return;
+
+  std::ifstream stream( d_track_file_name.string(), std::ifstream::binary );
+
+  stream.seekg( Details::particle_track_file_header_size );
+
+  stream.read( reinterpret_cast<char*>( records.data() ),
+               d_number_of_records*sizeof(ParticleTrackRecord) );
+
+  TEST_FOR_EXCEPTION( !stream.good(),
+                      std::runtime_error,
+                      "Could not read the records from the particle track "
+                      "file " << d_track_file_name.string() << "!" );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackStreamReader.cpp
+//---------------------------------------------------------------------------//
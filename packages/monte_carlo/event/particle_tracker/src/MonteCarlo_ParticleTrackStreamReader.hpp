@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackStreamReader.hpp
+//! \author Alex Robinson
+//! \brief  Particle track stream reader declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_TRACK_STREAM_READER_HPP
+#define MONTE_CARLO_PARTICLE_TRACK_STREAM_READER_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <map>
+#include <set>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackRecord.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle track stream reader
+ * \details Only the history index of the track file is loaded when the
+ * reader is constructed. The records of a history are read from the file
+ * on request.
+ */
+class ParticleTrackStreamReader
+{
+
+public:
+
+  //! Constructor
+  ParticleTrackStreamReader( const boost::filesystem::path& track_file_name );
+
+  //! Destructor
+  ~ParticleTrackStreamReader()
+  { /* ... */ }
+
+  //! Return the track file name
+  const boost::filesystem::path& getTrackFileName() const;
+
+  //! Return the number of records in the track file
+  uint64_t getNumberOfRecords() const;
+
+  //! Return the histories in the track file
+  void getHistories( std::set<uint64_t>& histories ) const;
+
+  //! Check if a history is in the track file
+  bool hasHistory( const uint64_t history_number ) const;
+
+  //! Return the records of a history
+  void getHistoryRecords( const uint64_t history_number,
+                          std::vector<ParticleTrackRecord>& records ) const;
+
+  //! Return all of the records
+  void getRecords( std::vector<ParticleTrackRecord>& records ) const;
+
+private:
+
+  // The record ranges (first record, number of records)
+  typedef std::vector<std::pair<uint64_t,uint64_t> > RecordRanges;
+
+  // The track file name
+  boost::filesystem::path d_track_file_name;
+
+  // The number of records
+  uint64_t d_number_of_records;
+
+  // The history index
+  std::map<uint64_t,RecordRanges> d_history_index;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_TRACK_STREAM_READER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackStreamReader.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,303 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackStreamWriter.cpp
+//! \author Alex Robinson
+//! \brief  Particle track stream writer definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackStreamWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace Details{
+
+// Write a value to a track file
+template<typename T>
+inline void writeParticleTrackFileValue( std::ostream& os, const T value )
+{
+  os.write( reinterpret_cast<const char*>( &value ), sizeof(T) );
+}
+
+} // end Details namespace
+
+// Constructor
+ParticleTrackStreamWriter::ParticleTrackStreamWriter(
+                          const boost::filesystem::path& track_file_name,
+                          const size_t max_number_of_pending_chunks )
+  : d_track_file_name( track_file_name ),
+    d_stream( track_file_name.string(),
+              std::ofstream::binary | std::ofstream::trunc ),
+    d_max_number_of_pending_chunks( max_number_of_pending_chunks ),
+    d_pending_chunks(),
+    d_queue_mutex(),
+    d_chunk_queued(),
+    d_chunk_written(),
+    d_writing_chunk( false ),
+    d_stop_writing( false ),
+    d_write_failed( false ),
+    d_finalized( false ),
+    d_number_of_written_records( 0 ),
+    d_history_index(),
+    d_writer_thread()
+{
+  // Make sure that at least one chunk can be pending
+  testPrecondition( max_number_of_pending_chunks > 0 );
+
+  TEST_FOR_EXCEPTION( !d_stream.good(),
+                      std::runtime_error,
+                      "Could not create the particle track file "
+                      << d_track_file_name.string() << "!" );
+
+  // Write the header
+  Details::writeParticleTrackFileValue(
+                      d_stream, Details::particle_track_file_magic_number );
+  Details::writeParticleTrackFileValue(
+                      d_stream, Details::particle_track_file_format_version );
+  Details::writeParticleTrackFileValue(
+                      d_stream, (uint64_t)sizeof(ParticleTrackRecord) );
+
+  // Start the writer thread
+  d_writer_thread =
+    std::thread( &ParticleTrackStreamWriter::writeQueuedChunks, this );
+}
+
+// Destructor
+ParticleTrackStreamWriter::~ParticleTrackStreamWriter()
+{
+  try{
+    this->finalize();
+  }
+  EXCEPTION_CATCH_AND_LOG( std::exception,
+                           "Could not finalize the particle track file "
+                           << d_track_file_name.string() << "!" );
+}
+
+// Return the track file name
+const boost::filesystem::path&
+ParticleTrackStreamWriter::getTrackFileName() const
+{
+  return d_track_file_name;
+}
+
+// Queue a chunk of records for writing
+/*! \details The chunk will be swapped into the queue (the chunk will be
+ * empty on return). If the maximum number of pending chunks has been
+ * reached, the calling thread will wait until the writer thread has taken
+ * a chunk from the queue.
+ */
+void ParticleTrackStreamWriter::queueChunk(
+                                  std::vector<ParticleTrackRecord>& chunk )
+{
+  if( chunk.empty() )
+    return;
+
+  std::unique_lock<std::mutex> lock( d_queue_mutex );
+
+  TEST_FOR_EXCEPTION( d_finalized,
+                      std::runtime_error,
+                      "Cannot queue track records because the particle "
+                      "track file " << d_track_file_name.string() <<
+                      " has been finalized!" );
+
+  d_chunk_written.wait( lock, [this]{
+      return d_pending_chunks.size() < d_max_number_of_pending_chunks ||
+        d_write_failed; } );
+
+  TEST_FOR_EXCEPTION( d_write_failed,
+                      std::runtime_error,
+                      "Could not write track records to the particle track "
+                      "file " << d_track_file_name.string() << "!" );
+
+  d_pending_chunks.emplace_back();
+  d_pending_chunks.back().swap( chunk );
+
+  lock.unlock();
+
+  d_chunk_queued.notify_one();
+}
+
+// Wait for all of the queued chunks to be written
+void ParticleTrackStreamWriter::flush()
+{
+  std::unique_lock<std::mutex> lock( d_queue_mutex );
+
+  d_chunk_written.wait( lock, [this]{
+      return (d_pending_chunks.empty() && !d_writing_chunk) ||
+        d_write_failed; } );
+
+  TEST_FOR_EXCEPTION( d_write_failed,
+                      std::runtime_error,
+                      "Could not write track records to the particle track "
+                      "file " << d_track_file_name.string() << "!" );
+}
+
+// Finalize the track file (write the history index)
+/*! \details All queued chunks will be written before the index is written.
+ * No records can be queued after the file has been finalized.
+ */
+void ParticleTrackStreamWriter::finalize()
+{
+  {
+    std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+    if( d_finalized )
+      return;
+
+    d_finalized = true;
+    d_stop_writing = true;
+  }
+
+  d_chunk_queued.notify_one();
+
+  d_writer_thread.join();
+
+  TEST_FOR_EXCEPTION( d_write_failed,
+                      std::runtime_error,
+                      "Could not write track records to the particle track "
+                      "file " << d_track_file_name.string() << "!" );
+
+  this->writeIndex();
+}
+
+// Check if the track file has been finalized
+bool ParticleTrackStreamWriter::isFinalized() const
+{
+  std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+  return d_finalized;
+}
+
+// Return the number of records that have been written
+uint64_t ParticleTrackStreamWriter::getNumberOfWrittenRecords() const
+{
+  std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+  return d_number_of_written_records;
+}
+
+// Write the queued chunks (executed by the writer thread)
+void ParticleTrackStreamWriter::writeQueuedChunks()
+{
+  std::vector<ParticleTrackRecord> chunk;
+
+  while( true )
+  {
+    {
+      std::unique_lock<std::mutex> lock( d_queue_mutex );
+
+      d_chunk_queued.wait( lock, [this]{
+          return !d_pending_chunks.empty() || d_stop_writing; } );
+
+      if( d_pending_chunks.empty() )
+        break;
+
+      chunk.swap( d_pending_chunks.front() );
+      d_pending_chunks.pop_front();
+
+      d_writing_chunk = true;
+    }
+
+    // A slot in the queue is now free
+    d_chunk_written.notify_all();
+
+    this->writeChunk( chunk );
+
+    chunk.clear();
+
+    {
+      std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+      d_writing_chunk = false;
+
+      if( !d_stream.good() )
+        d_write_failed = true;
+    }
+
+    d_chunk_written.notify_all();
+
+    if( d_write_failed )
+      break;
+  }
+}
+
+// Write a chunk of records
+/*! \details The history index is updated with the record ranges in the
+ * chunk. Consecutive records from the same history are merged into a single
+ * range.
+ */
+void ParticleTrackStreamWriter::writeChunk(
+                              const std::vector<ParticleTrackRecord>& chunk )
+{
+  d_stream.write( reinterpret_cast<const char*>( chunk.data() ),
+                  chunk.size()*sizeof(ParticleTrackRecord) );
+
+  uint64_t record_index;
+
+  {
+    std::lock_guard<std::mutex> lock( d_queue_mutex );
+
+    record_index = d_number_of_written_records;
+
+    d_number_of_written_records += chunk.size();
+  }
+
+  for( size_t i = 0; i < chunk.size(); ++i, ++record_index )
+  {
+    RecordRanges& ranges = d_history_index[chunk[i].history_number];
+
+    if( !ranges.empty() &&
+        ranges.back().first + ranges.back().second == record_index )
+      ++ranges.back().second;
+    else
+      ranges.push_back( std::make_pair( record_index, 1ull ) );
+  }
+}
+
+// Write the history index and the trailer
+void ParticleTrackStreamWriter::writeIndex()
+{
+  const uint64_t index_offset = d_stream.tellp();
+
+  Details::writeParticleTrackFileValue( d_stream,
+                                        (uint64_t)d_history_index.size() );
+
+  for( auto&& history_ranges : d_history_index )
+  {
+    Details::writeParticleTrackFileValue( d_stream, history_ranges.first );
+    Details::writeParticleTrackFileValue( d_stream,
+                                          (uint64_t)history_ranges.second.size() );
+
+    for( auto&& range : history_ranges.second )
+    {
+      Details::writeParticleTrackFileValue( d_stream, range.first );
+      Details::writeParticleTrackFileValue( d_stream, range.second );
+    }
+  }
+
+  // Write the trailer
+  Details::writeParticleTrackFileValue( d_stream, index_offset );
+  Details::writeParticleTrackFileValue( d_stream,
+                                        d_number_of_written_records );
+  Details::writeParticleTrackFileValue(
+                      d_stream, Details::particle_track_file_magic_number );
+
+  d_stream.close();
+
+  TEST_FOR_EXCEPTION( d_stream.fail(),
+                      std::runtime_error,
+                      "Could not write the history index to the particle "
+                      "track file " << d_track_file_name.string() << "!" );
+
+  d_history_index.clear();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackStreamWriter.cpp
+//---------------------------------------------------------------------------//
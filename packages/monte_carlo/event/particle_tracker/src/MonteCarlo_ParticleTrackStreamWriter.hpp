@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleTrackStreamWriter.hpp
+//! \author Alex Robinson
+//! \brief  Particle track stream writer declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_TRACK_STREAM_WRITER_HPP
+#define MONTE_CARLO_PARTICLE_TRACK_STREAM_WRITER_HPP
+
+// Std Lib Includes
+#include <fstream>
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackRecord.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle track stream writer
+ * \details Chunks of track records are queued by the tracking threads and
+ * written to the track file by a dedicated writer thread so that the
+ * tracking threads never wait on the file system (unless the maximum number
+ * of pending chunks has been reached, which bounds the memory used by the
+ * writer). The file consists of a header, the records (in the order that
+ * the chunks were queued) and a history index that stores the record
+ * ranges that belong to each history. The index is written when the writer
+ * is finalized.
+ */
+class ParticleTrackStreamWriter
+{
+
+public:
+
+  //! Constructor
+  ParticleTrackStreamWriter( const boost::filesystem::path& track_file_name,
+                             const size_t max_number_of_pending_chunks = 4 );
+
+  //! Destructor
+  ~ParticleTrackStreamWriter();
+
+  //! Return the track file name
+  const boost::filesystem::path& getTrackFileName() const;
+
+  //! Queue a chunk of records for writing
+  void queueChunk( std::vector<ParticleTrackRecord>& chunk );
+
+  //! Wait for all of the queued chunks to be written
+  void flush();
+
+  //! Finalize the track file (write the history index)
+  void finalize();
+
+  //! Check if the track file has been finalized
+  bool isFinalized() const;
+
+  //! Return the number of records that have been written
+  uint64_t getNumberOfWrittenRecords() const;
+
+private:
+
+  // Write the queued chunks (executed by the writer thread)
+  void writeQueuedChunks();
+
+  // Write a chunk of records
+  void writeChunk( const std::vector<ParticleTrackRecord>& chunk );
+
+  // Write the history index and the trailer
+  void writeIndex();
+
+  // The record ranges (first record, number of records)
+  typedef std::vector<std::pair<uint64_t,uint64_t> > RecordRanges;
+
+  // The track file name
+  boost::filesystem::path d_track_file_name;
+
+  // The track file stream (only used by the writer thread)
+  std::ofstream d_stream;
+
+  // The maximum number of chunks that can be pending
+  size_t d_max_number_of_pending_chunks;
+
+  // The pending chunks
+  std::deque<std::vector<ParticleTrackRecord> > d_pending_chunks;
+
+  // The queue mutex
+  mutable std::mutex d_queue_mutex;
+
+  // The chunk queued condition (used by the writer thread)
+  std::condition_variable d_chunk_queued;
+
+  // The chunk written condition (used by the tracking threads)
+  std::condition_variable d_chunk_written;
+
+  // Records if the writer thread is currently writing a chunk
+  bool d_writing_chunk;
+
+  // Records if the writer thread should stop once the queue is empty
+  bool d_stop_writing;
+
+  // Records if a write has failed
+  bool d_write_failed;
+
+  // Records if the track file has been finalized
+  bool d_finalized;
+
+  // The number of written records
+  uint64_t d_number_of_written_records;
+
+  // The history index
+  std::map<uint64_t,RecordRanges> d_history_index;
+
+  // The writer thread
+  std::thread d_writer_thread;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_TRACK_STREAM_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleTrackStreamWriter.hpp
+//---------------------------------------------------------------------------//
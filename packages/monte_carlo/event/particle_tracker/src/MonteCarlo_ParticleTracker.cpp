@@ -6,20 +6,38 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Boost Includes
+#include <boost/filesystem.hpp>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
+#include "MonteCarlo_ParticleTrackStreamReader.hpp"
 #include "MonteCarlo_ObserverParticleStateWrapper.hpp"
 #include "MonteCarlo_ParticleType.hpp"
+#include "Utility_GlobalMPISession.hpp"
 #include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// Constructor
+ParticleTracker::TrackRecordBuffer::TrackRecordBuffer()
+  : records(),
+    particle_indices(),
+    history_number( std::numeric_limits<uint64_t>::max() ),
+    next_particle_index( 0 )
+{ /* ... */ }
+
 // Default constructor
 ParticleTracker::ParticleTracker()
-  : d_id( std::numeric_limits<Id>::max() )
+  : d_id( std::numeric_limits<Id>::max() ),
+    d_track_file_name(),
+    d_max_number_of_buffered_records( 65536 ),
+    d_track_record_buffers( 1 ),
+    d_track_writer()
 { /* ... */ }
 
 // Constructor
@@ -28,7 +46,11 @@ ParticleTracker::ParticleTracker( const Id id,
   : d_id( id ),
     d_histories_to_track(),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_history_number_map(),
+    d_track_file_name(),
+    d_max_number_of_buffered_records( 65536 ),
+    d_track_record_buffers( 1 ),
+    d_track_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( number_of_histories >= 0 );
@@ -43,12 +65,30 @@ ParticleTracker::ParticleTracker( const Id id,
   : d_id( id ),
     d_histories_to_track( history_numbers ),
     d_partial_history_map( 1 ),
-    d_history_number_map()
+    d_history_number_map(),
+    d_track_file_name(),
+    d_max_number_of_buffered_records( 65536 ),
+    d_track_record_buffers( 1 ),
+    d_track_writer()
 {
   // Make sure there are some particles being tracked
   testPrecondition( history_numbers.size() > 0 )
 }
 
+// Destructor
+ParticleTracker::~ParticleTracker()
+{
+  if( d_track_writer )
+  {
+    try{
+      this->finalizeTrackFile();
+    }
+    EXCEPTION_CATCH_AND_LOG( std::exception,
+                             "Could not finalize the track file of particle "
+                             "tracker " << this->getId() << "!" );
+  }
+}
+
 // Return the estimator id
 auto ParticleTracker::getId() const -> Id
 {
@@ -61,6 +101,73 @@ const std::set<uint64_t>& ParticleTracker::getTrackedHistories() const
   return d_histories_to_track;
 }
 
+// Stream the tracked histories to a track file
+/*! \details Once a track file has been set, the track points will no longer
+ * be stored in memory. Each thread will buffer at most the requested number
+ * of track records before handing them off to the track file writer. The
+ * track file will be created when the first buffer is handed off. If more
+ * than one process is used, the process rank will be appended to the file
+ * name (e.g. tracks_1.trk). The track file must be finalized before the
+ * history data can be retrieved.
+ */
+void ParticleTracker::setTrackFile( const std::string& track_file_name,
+                                    const size_t max_number_of_buffered_records )
+{
+  // Make sure the file name is valid
+  testPrecondition( !track_file_name.empty() );
+  // Make sure the buffer size is valid
+  testPrecondition( max_number_of_buffered_records > 0 );
+
+  TEST_FOR_EXCEPTION( d_track_writer.get(),
+                      std::runtime_error,
+                      "The track file of particle tracker " << this->getId()
+                      << " cannot be changed while it is being written!" );
+
+  d_track_file_name = track_file_name;
+  d_max_number_of_buffered_records = max_number_of_buffered_records;
+}
+
+// Check if the tracked histories are streamed to a track file
+bool ParticleTracker::hasTrackFile() const
+{
+  return !d_track_file_name.empty();
+}
+
+// Return the track file name
+const std::string& ParticleTracker::getTrackFileName() const
+{
+  return d_track_file_name;
+}
+
+// Return the max number of buffered track records (per thread)
+size_t ParticleTracker::getMaxNumberOfBufferedTrackRecords() const
+{
+  return d_max_number_of_buffered_records;
+}
+
+// Write the buffered track records and finalize the track file
+/*! \details This method must not be called inside of a parallel region.
+ * Any track records that are added after the track file has been finalized
+ * will be written to a new track file (the finalized file will be
+ * overwritten).
+ */
+void ParticleTracker::finalizeTrackFile()
+{
+  for( size_t i = 0; i < d_track_record_buffers.size(); ++i )
+  {
+    this->flushTrackRecordBuffer( d_track_record_buffers[i] );
+
+    d_track_record_buffers[i].particle_indices.clear();
+  }
+
+  if( d_track_writer )
+  {
+    d_track_writer->finalize();
+
+    d_track_writer.reset();
+  }
+}
+
 // Add current history estimator contribution
 void ParticleTracker::updateFromGlobalParticleSubtrackEndingEvent(
 						 const ParticleState& particle,
@@ -71,58 +178,193 @@ void ParticleTracker::updateFromGlobalParticleSubtrackEndingEvent(
   if( d_histories_to_track.find( particle.getHistoryNumber() ) !=
       d_histories_to_track.end() )
   {
-    unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+    if( this->hasTrackFile() )
+      this->addTrackRecords( particle, start_point, end_point );
+    else
+      this->addPartialHistoryData( particle, start_point, end_point );
+  }
+}
+
+// Add a track point to the partial history map
+void ParticleTracker::addPartialHistoryData( const ParticleState& particle,
+                                             const double start_point[3],
+                                             const double end_point[3] )
+{
+  const unsigned history_buffer = this->getObservedHistoryBuffer();
+
+  PartialHistorySubmap& thread_partial_history_map =
+    d_partial_history_map[history_buffer];
+
+  if( thread_partial_history_map.find( &particle ) ==
+      thread_partial_history_map.end() )
+  {
+    ObserverParticleStateWrapper particle_wrapper( particle );
 
-    PartialHistorySubmap& thread_partial_history_map =
-      d_partial_history_map[thread_id];
+    const double track_length =
+      std::sqrt( (end_point[0] - start_point[0])*(end_point[0] - start_point[0]) +
+                 (end_point[1] - start_point[1])*(end_point[1] - start_point[1]) +
+                 (end_point[2] - start_point[2])*(end_point[2] - start_point[2]) );
 
-    if( thread_partial_history_map.find( &particle ) ==
-        thread_partial_history_map.end() )
-    {
-      ObserverParticleStateWrapper particle_wrapper( particle );
-
-      const double track_length =
-        std::sqrt( (end_point[0] - start_point[0])*(end_point[0] - start_point[0]) +
-                   (end_point[1] - start_point[1])*(end_point[1] - start_point[1]) +
-                   (end_point[2] - start_point[2])*(end_point[2] - start_point[2]) );
-
-      particle_wrapper.calculateStateTimesUsingParticleTimeAsEndTime( track_length );
-      
-      thread_partial_history_map[&particle].push_back(
-           std::make_tuple( std::array<double,3>( {start_point[0],
-                                                   start_point[1],
-                                                   start_point[2]} ),
-                            std::array<double,3>( {particle.getXDirection(),
-                                                   particle.getYDirection(),
-                                                   particle.getZDirection()} ),
-                            particle.getEnergy(),
-                            particle_wrapper.getStartTime(),
-                            particle.getWeight(),
-                            particle.getCollisionNumber() ) );
-    }
+    particle_wrapper.calculateStateTimesUsingParticleTimeAsEndTime( track_length );
     
     thread_partial_history_map[&particle].push_back(
-           std::make_tuple( std::array<double,3>( {end_point[0],
-                                                   end_point[1],
-                                                   end_point[2]} ),
-                            std::array<double,3>( {particle.getXDirection(),
-                                                   particle.getYDirection(),
-                                                   particle.getZDirection()} ),
-                            particle.getEnergy(),
-                            particle.getTime(),
-                            particle.getWeight(),
-                            particle.getCollisionNumber() ) );
+         std::make_tuple( std::array<double,3>( {start_point[0],
+                                                 start_point[1],
+                                                 start_point[2]} ),
+                          std::array<double,3>( {particle.getXDirection(),
+                                                 particle.getYDirection(),
+                                                 particle.getZDirection()} ),
+                          particle.getEnergy(),
+                          particle_wrapper.getStartTime(),
+                          particle.getWeight(),
+                          particle.getCollisionNumber() ) );
+  }
+  
+  thread_partial_history_map[&particle].push_back(
+         std::make_tuple( std::array<double,3>( {end_point[0],
+                                                 end_point[1],
+                                                 end_point[2]} ),
+                          std::array<double,3>( {particle.getXDirection(),
+                                                 particle.getYDirection(),
+                                                 particle.getZDirection()} ),
+                          particle.getEnergy(),
+                          particle.getTime(),
+                          particle.getWeight(),
+                          particle.getCollisionNumber() ) );
+}
+
+// Add a track point to the track record buffer
+/*! \details The first time that a particle is encountered, a record for the
+ * start point of the track will also be added.
+ */
+void ParticleTracker::addTrackRecords( const ParticleState& particle,
+                                       const double start_point[3],
+                                       const double end_point[3] )
+{
+  TrackRecordBuffer& buffer =
+    d_track_record_buffers[this->getObservedHistoryBuffer()];
+
+  // The particle indices are only unique within a history
+  if( buffer.history_number != particle.getHistoryNumber() )
+  {
+    buffer.history_number = particle.getHistoryNumber();
+    buffer.particle_indices.clear();
+    buffer.next_particle_index = 0;
+  }
+
+  if( buffer.records.capacity() == 0 )
+    buffer.records.reserve( d_max_number_of_buffered_records + 1 );
+
+  ParticleTrackRecord record;
+  record.history_number = particle.getHistoryNumber();
+  record.direction[0] = particle.getXDirection();
+  record.direction[1] = particle.getYDirection();
+  record.direction[2] = particle.getZDirection();
+  record.energy = particle.getEnergy();
+  record.weight = particle.getWeight();
+  record.collision_number = particle.getCollisionNumber();
+  record.generation_number = particle.getGenerationNumber();
+  record.particle_type = particle.getParticleType();
+
+  std::unordered_map<const ParticleState*,uint32_t>::const_iterator
+    particle_index_it = buffer.particle_indices.find( &particle );
+
+  if( particle_index_it == buffer.particle_indices.end() )
+  {
+    record.particle_index = buffer.next_particle_index;
+
+    buffer.particle_indices[&particle] = buffer.next_particle_index;
+
+    ++buffer.next_particle_index;
+
+    ObserverParticleStateWrapper particle_wrapper( particle );
+
+    const double track_length =
+      std::sqrt( (end_point[0] - start_point[0])*(end_point[0] - start_point[0]) +
+                 (end_point[1] - start_point[1])*(end_point[1] - start_point[1]) +
+                 (end_point[2] - start_point[2])*(end_point[2] - start_point[2]) );
+
+    particle_wrapper.calculateStateTimesUsingParticleTimeAsEndTime( track_length );
+
+    record.position[0] = start_point[0];
+    record.position[1] = start_point[1];
+    record.position[2] = start_point[2];
+    record.time = particle_wrapper.getStartTime();
+
+    buffer.records.push_back( record );
   }
+  else
+    record.particle_index = particle_index_it->second;
+
+  record.position[0] = end_point[0];
+  record.position[1] = end_point[1];
+  record.position[2] = end_point[2];
+  record.time = particle.getTime();
+
+  buffer.records.push_back( record );
+
+  if( buffer.records.size() >= d_max_number_of_buffered_records )
+    this->flushTrackRecordBuffer( buffer );
+}
+
+// Hand off the buffered track records to the track file writer
+/*! \details The track file writer will be created the first time that this
+ * method is called with a non-empty buffer.
+ */
+void ParticleTracker::flushTrackRecordBuffer( TrackRecordBuffer& buffer )
+{
+  if( buffer.records.empty() )
+    return;
+
+  #pragma omp critical( particle_tracker_writer_creation )
+  {
+    if( !d_track_writer )
+    {
+      d_track_writer.reset(
+             new ParticleTrackStreamWriter( this->getProcessTrackFileName() ) );
+    }
+  }
+
+  d_track_writer->queueChunk( buffer.records );
+
+  buffer.records.reserve( d_max_number_of_buffered_records + 1 );
+}
+
+// Return the track file name used by this process
+std::string ParticleTracker::getProcessTrackFileName() const
+{
+  if( Utility::GlobalMPISession::size() > 1 )
+  {
+    boost::filesystem::path track_file_path( d_track_file_name );
+
+    std::ostringstream process_track_file_name;
+
+    process_track_file_name
+      << (track_file_path.parent_path()/track_file_path.stem()).string()
+      << "_" << Utility::GlobalMPISession::rank()
+      << track_file_path.extension().string();
+
+    return process_track_file_name.str();
+  }
+  else
+    return d_track_file_name;
 }
 
 // Update the observer
 void ParticleTracker::updateFromGlobalParticleGoneEvent(
                                                 const ParticleState& particle )
 {
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  const unsigned history_buffer = this->getObservedHistoryBuffer();
 
-  if( d_partial_history_map[thread_id].find( &particle ) !=
-      d_partial_history_map[thread_id].end() )
+  if( this->hasTrackFile() )
+  {
+    d_track_record_buffers[history_buffer].particle_indices.erase( &particle );
+
+    return;
+  }
+
+  if( d_partial_history_map[history_buffer].find( &particle ) !=
+      d_partial_history_map[history_buffer].end() )
   {
     #pragma omp critical
     {
@@ -136,19 +378,26 @@ void ParticleTracker::updateFromGlobalParticleGoneEvent(
         ++i;
 
       // Add the particle state data
-      particle_data[i] = d_partial_history_map[thread_id][&particle];
+      particle_data[i] = d_partial_history_map[history_buffer][&particle];
 
       // Remove the particle state data from the partial data map
-      d_partial_history_map[thread_id].erase( &particle );
+      d_partial_history_map[history_buffer].erase( &particle );
     }
   }
 }
 
 // Take a snapshot
+/*! \details If a track file has been set, the buffered track records will be
+ * handed off to the track file writer so that the buffers only hold the
+ * records of the current micro batch.
+ */
 void ParticleTracker::takeSnapshot(
                               const uint64_t num_histories_since_last_snapshot,
                               const double time_since_last_snapshot )
-{ /* ... */ }
+{
+  for( size_t i = 0; i < d_track_record_buffers.size(); ++i )
+    this->flushTrackRecordBuffer( d_track_record_buffers[i] );
+}
 
 // Reset data
 void ParticleTracker::resetData()
@@ -161,6 +410,20 @@ void ParticleTracker::resetData()
 
   // Clear the history number map
   d_history_number_map.clear();
+
+  // Discard the buffered track records (the written records are kept)
+  for( size_t i = 0; i < d_track_record_buffers.size(); ++i )
+  {
+    d_track_record_buffers[i].records.clear();
+    d_track_record_buffers[i].particle_indices.clear();
+  }
+
+  if( d_track_writer )
+  {
+    d_track_writer->finalize();
+
+    d_track_writer.reset();
+  }
 }
 
 // Enable support for multiple threads
@@ -168,7 +431,9 @@ void ParticleTracker::enableThreadSupport( const unsigned num_threads )
 {
   testPrecondition( num_threads > 0 );
   
-  d_partial_history_map.resize( num_threads );
+  // One buffer is needed for every in flight history
+  d_partial_history_map.resize( this->getNumberOfHistoryBuffers( num_threads ) );
+  d_track_record_buffers.resize( this->getNumberOfHistoryBuffers( num_threads ) );
 }
 
 // Has Uncommited History Contribution
@@ -190,6 +455,16 @@ void ParticleTracker::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Each process writes its own track file - no reduction is required
+  if( this->hasTrackFile() )
+  {
+    this->finalizeTrackFile();
+
+    comm.barrier();
+
+    return;
+  }
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -269,14 +544,141 @@ void ParticleTracker::printSummary( std::ostream& os ) const
     if( i < tracked_histories.size() - 1 )
       os << ", ";
   }
+
+  if( this->hasTrackFile() )
+    os << " (streamed to " << d_track_file_name << ")";
   
   os << std::endl;
 }
 
 // Get the data map
+/*! \details If a track file has been set, the data will be read from the
+ * (finalized) track file of this process.
+ */
 void ParticleTracker::getHistoryData( OverallHistoryMap& history_map ) const
 {
-  history_map = d_history_number_map;
+  if( this->hasTrackFile() )
+  {
+    TEST_FOR_EXCEPTION( d_track_writer.get(),
+                        std::runtime_error,
+                        "The track file of particle tracker "
+                        << this->getId() << " must be finalized before the "
+                        "history data can be retrieved!" );
+
+    history_map.clear();
+
+    const std::string track_file_name = this->getProcessTrackFileName();
+
+    // No records have been written
+    if( !boost::filesystem::exists( track_file_name ) )
+      return;
+
+    std::vector<ParticleTrackRecord> records;
+
+    ParticleTrackStreamReader( track_file_name ).getRecords( records );
+
+    ParticleTracker::convertTrackRecords( records, history_map );
+  }
+  else
+    history_map = d_history_number_map;
+}
+
+// Get the data of a single history
+/*! \details If a track file has been set, only the records of the requested
+ * history will be read from the (finalized) track file of this process
+ * using the track file history index.
+ */
+void ParticleTracker::getHistoryData( const uint64_t history_number,
+                                      ParticleTypeSubmap& history_data ) const
+{
+  history_data.clear();
+
+  if( this->hasTrackFile() )
+  {
+    TEST_FOR_EXCEPTION( d_track_writer.get(),
+                        std::runtime_error,
+                        "The track file of particle tracker "
+                        << this->getId() << " must be finalized before the "
+                        "history data can be retrieved!" );
+
+    const std::string track_file_name = this->getProcessTrackFileName();
+
+    // No records have been written
+    if( !boost::filesystem::exists( track_file_name ) )
+      return;
+
+    std::vector<ParticleTrackRecord> records;
+
+    ParticleTrackStreamReader( track_file_name ).getHistoryRecords(
+                                                history_number, records );
+
+    OverallHistoryMap history_map;
+
+    ParticleTracker::convertTrackRecords( records, history_map );
+
+    if( !history_map.empty() )
+      history_data.swap( history_map.begin()->second );
+  }
+  else
+  {
+    OverallHistoryMap::const_iterator history_it =
+      d_history_number_map.find( history_number );
+
+    if( history_it != d_history_number_map.end() )
+      history_data = history_it->second;
+  }
+}
+
+// Convert track records to history data
+/*! \details The particles of each generation will be numbered in the order
+ * that their first records appear.
+ */
+void ParticleTracker::convertTrackRecords(
+                             const std::vector<ParticleTrackRecord>& records,
+                             OverallHistoryMap& history_map )
+{
+  typedef std::tuple<uint64_t,uint32_t,uint32_t,uint32_t> ParticleKey;
+
+  std::map<ParticleKey,unsigned> particle_ids;
+
+  for( size_t i = 0; i < records.size(); ++i )
+  {
+    const ParticleTrackRecord& record = records[i];
+
+    IndividualParticleSubmap& particle_data =
+      history_map[record.history_number][(ParticleType)record.particle_type][record.generation_number];
+
+    const ParticleKey particle_key( record.history_number,
+                                    record.particle_type,
+                                    record.generation_number,
+                                    record.particle_index );
+
+    std::map<ParticleKey,unsigned>::const_iterator particle_id_it =
+      particle_ids.find( particle_key );
+
+    unsigned particle_id;
+
+    if( particle_id_it == particle_ids.end() )
+    {
+      particle_id = particle_data.size();
+
+      particle_ids[particle_key] = particle_id;
+    }
+    else
+      particle_id = particle_id_it->second;
+
+    particle_data[particle_id].push_back(
+           std::make_tuple( std::array<double,3>( {record.position[0],
+                                                   record.position[1],
+                                                   record.position[2]} ),
+                            std::array<double,3>( {record.direction[0],
+                                                   record.direction[1],
+                                                   record.direction[2]} ),
+                            record.energy,
+                            record.time,
+                            record.weight,
+                            (ParticleState::collisionNumberType)record.collision_number ) );
+  }
 }
 
 } // end MonteCarlo namespace
@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_PARTICLE_TRACKER_HPP
 #define MONTE_CARLO_PARTICLE_TRACKER_HPP
 
+// Std Lib Includes
+#include <memory>
+
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
 #include <boost/serialization/version.hpp>
@@ -22,6 +25,7 @@
 #include "MonteCarlo_ParticleGoneGlobalEventObserver.hpp"
 #include "MonteCarlo_ParticleHistoryObserver.hpp"
 #include "MonteCarlo_UniqueIdManager.hpp"
+#include "MonteCarlo_ParticleTrackStreamWriter.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_Array.hpp"
@@ -32,6 +36,12 @@
 namespace MonteCarlo{
 
 /*! The particle tracking class, similar to the PTRAC function in MCNP
+ * \details By default the tracked histories are stored in memory until the
+ * end of the simulation. When a track file has been set, the track points
+ * are appended to bounded per-thread record buffers instead. Full buffers
+ * are handed off to a ParticleTrackStreamWriter, which writes them to the
+ * track file on a separate thread. The memory used by the tracker is
+ * therefore independent of the number of tracked histories.
  */
 class ParticleTracker : public ParticleSubtrackEndingGlobalEventObserver,
                         public ParticleGoneGlobalEventObserver,
@@ -82,8 +92,7 @@ public:
                    const std::set<uint64_t>& history_numbers );
 
   //! Destructor
-  ~ParticleTracker()
-  { /* ... */ }
+  ~ParticleTracker();
 
   //! Return the estimator id
   Id getId() const;
@@ -91,6 +100,22 @@ public:
   //! Return the histories that will be tracked
   const std::set<uint64_t>& getTrackedHistories() const;
 
+  //! Stream the tracked histories to a track file
+  void setTrackFile( const std::string& track_file_name,
+                     const size_t max_number_of_buffered_records = 65536 );
+
+  //! Check if the tracked histories are streamed to a track file
+  bool hasTrackFile() const;
+
+  //! Return the track file name
+  const std::string& getTrackFileName() const;
+
+  //! Return the max number of buffered track records (per thread)
+  size_t getMaxNumberOfBufferedTrackRecords() const;
+
+  //! Write the buffered track records and finalize the track file
+  void finalizeTrackFile();
+
   //! Add current history contribution
   void updateFromGlobalParticleSubtrackEndingEvent(
                                     const ParticleState& particle,
@@ -128,11 +153,55 @@ public:
   //! Get the data map
   void getHistoryData( OverallHistoryMap& history_map ) const;
 
+  //! Get the data of a single history
+  void getHistoryData( const uint64_t history_number,
+                       ParticleTypeSubmap& history_data ) const;
+
 private:
 
+  // The per-thread track record buffer
+  struct TrackRecordBuffer
+  {
+    // Constructor
+    TrackRecordBuffer();
+
+    // The buffered records
+    std::vector<ParticleTrackRecord> records;
+
+    // The indices of the live particles of the current history
+    std::unordered_map<const ParticleState*,uint32_t> particle_indices;
+
+    // The current history
+    uint64_t history_number;
+
+    // The next particle index of the current history
+    uint32_t next_particle_index;
+  };
+
   // Default constructor
   ParticleTracker();
 
+  // Add a track point to the partial history map
+  void addPartialHistoryData( const ParticleState& particle,
+                              const double start_point[3],
+                              const double end_point[3] );
+
+  // Add a track point to the track record buffer
+  void addTrackRecords( const ParticleState& particle,
+                        const double start_point[3],
+                        const double end_point[3] );
+
+  // Hand off the buffered track records to the track file writer
+  void flushTrackRecordBuffer( TrackRecordBuffer& buffer );
+
+  // Return the track file name used by this process
+  std::string getProcessTrackFileName() const;
+
+  // Convert track records to history data
+  static void convertTrackRecords(
+                             const std::vector<ParticleTrackRecord>& records,
+                             OverallHistoryMap& history_map );
+
   // Save the data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -158,6 +227,18 @@ private:
 
   // The tracked history info
   OverallHistoryMap d_history_number_map;
+
+  // The track file name (empty if the histories are stored in memory)
+  std::string d_track_file_name;
+
+  // The max number of buffered track records (per thread)
+  size_t d_max_number_of_buffered_records;
+
+  // The track record buffers
+  std::vector<TrackRecordBuffer> d_track_record_buffers;
+
+  // The track file writer
+  std::unique_ptr<ParticleTrackStreamWriter> d_track_writer;
 };
 
 // Save the estimator data
@@ -173,6 +254,8 @@ void ParticleTracker::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_id );
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
   ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
+  ar & BOOST_SERIALIZATION_NVP( d_track_file_name );
+  ar & BOOST_SERIALIZATION_NVP( d_max_number_of_buffered_records );
 }
 
 // Load the estimator data
@@ -189,12 +272,19 @@ void ParticleTracker::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
   ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
 
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_track_file_name );
+    ar & BOOST_SERIALIZATION_NVP( d_max_number_of_buffered_records );
+  }
+
   d_partial_history_map.resize( 1 );
+  d_track_record_buffers.resize( 1 );
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleTracker, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleTracker, MonteCarlo, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( ParticleTracker, MonteCarlo );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, ParticleTracker );
 
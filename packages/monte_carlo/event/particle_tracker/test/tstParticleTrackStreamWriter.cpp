@@ -0,0 +1,166 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstParticleTrackStreamWriter.cpp
+//! \author Alex Robinson
+//! \brief  Particle track stream writer and reader unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleTrackStreamWriter.hpp"
+#include "MonteCarlo_ParticleTrackStreamReader.hpp"
+#include "MonteCarlo_ParticleType.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a chunk of records (the energy stores the record number)
+std::vector<MonteCarlo::ParticleTrackRecord> createChunk(
+                                          const uint64_t first_record_number,
+                                          const std::vector<uint64_t>& histories )
+{
+  std::vector<MonteCarlo::ParticleTrackRecord> chunk( histories.size() );
+
+  for( size_t i = 0; i < histories.size(); ++i )
+  {
+    chunk[i].history_number = histories[i];
+    chunk[i].position[0] = 1.0;
+    chunk[i].position[1] = 2.0;
+    chunk[i].position[2] = 3.0;
+    chunk[i].direction[0] = 0.0;
+    chunk[i].direction[1] = 0.0;
+    chunk[i].direction[2] = 1.0;
+    chunk[i].energy = first_record_number + i;
+    chunk[i].time = 1e-9;
+    chunk[i].weight = 1.0;
+    chunk[i].collision_number = i;
+    chunk[i].generation_number = 0;
+    chunk[i].particle_index = 0;
+    chunk[i].particle_type = MonteCarlo::PHOTON;
+  }
+
+  return chunk;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that chunks can be queued and written
+FRENSIE_UNIT_TEST( ParticleTrackStreamWriter, queueChunk )
+{
+  MonteCarlo::ParticleTrackStreamWriter
+    writer( "test_particle_track_stream.trk", 1 );
+
+  FRENSIE_CHECK_EQUAL( writer.getTrackFileName().string(),
+                       "test_particle_track_stream.trk" );
+  FRENSIE_CHECK( !writer.isFinalized() );
+
+  std::vector<MonteCarlo::ParticleTrackRecord> chunk =
+    createChunk( 0, {0, 0, 1} );
+
+  writer.queueChunk( chunk );
+
+  FRENSIE_CHECK( chunk.empty() );
+
+  chunk = createChunk( 3, {1, 2, 2, 0} );
+
+  writer.queueChunk( chunk );
+
+  chunk = createChunk( 7, {3} );
+
+  writer.queueChunk( chunk );
+
+  writer.flush();
+
+  FRENSIE_CHECK_EQUAL( writer.getNumberOfWrittenRecords(), 8 );
+
+  writer.finalize();
+
+  FRENSIE_CHECK( writer.isFinalized() );
+
+  chunk = createChunk( 8, {4} );
+
+  FRENSIE_CHECK_THROW( writer.queueChunk( chunk ), std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a finalized track file can be read
+FRENSIE_UNIT_TEST( ParticleTrackStreamReader, getHistoryRecords )
+{
+  {
+    MonteCarlo::ParticleTrackStreamWriter
+      writer( "test_particle_track_stream.trk" );
+
+    std::vector<MonteCarlo::ParticleTrackRecord> chunk =
+      createChunk( 0, {0, 0, 1} );
+
+    writer.queueChunk( chunk );
+
+    chunk = createChunk( 3, {1, 2, 2, 0} );
+
+    writer.queueChunk( chunk );
+
+    // The destructor will finalize the file
+  }
+
+  MonteCarlo::ParticleTrackStreamReader
+    reader( "test_particle_track_stream.trk" );
+
+  FRENSIE_CHECK_EQUAL( reader.getNumberOfRecords(), 7 );
+
+  std::set<uint64_t> histories;
+
+  reader.getHistories( histories );
+
+  FRENSIE_CHECK_EQUAL( histories, std::set<uint64_t>({0, 1, 2}) );
+  FRENSIE_CHECK( reader.hasHistory( 2 ) );
+  FRENSIE_CHECK( !reader.hasHistory( 3 ) );
+
+  std::vector<MonteCarlo::ParticleTrackRecord> records;
+
+  reader.getHistoryRecords( 0, records );
+
+  FRENSIE_REQUIRE_EQUAL( records.size(), 3 );
+  FRENSIE_CHECK_EQUAL( records[0].energy, 0.0 );
+  FRENSIE_CHECK_EQUAL( records[1].energy, 1.0 );
+  FRENSIE_CHECK_EQUAL( records[2].energy, 6.0 );
+  FRENSIE_CHECK_EQUAL( records[2].collision_number, 3 );
+  FRENSIE_CHECK_EQUAL( records[2].position[2], 3.0 );
+
+  reader.getHistoryRecords( 1, records );
+
+  FRENSIE_REQUIRE_EQUAL( records.size(), 2 );
+  FRENSIE_CHECK_EQUAL( records[0].energy, 2.0 );
+  FRENSIE_CHECK_EQUAL( records[1].energy, 3.0 );
+
+  reader.getHistoryRecords( 3, records );
+
+  FRENSIE_CHECK( records.empty() );
+
+  reader.getRecords( records );
+
+  FRENSIE_REQUIRE_EQUAL( records.size(), 7 );
+
+  for( size_t i = 0; i < records.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( records[i].energy, (double)i );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that an invalid track file cannot be read
+FRENSIE_UNIT_TEST( ParticleTrackStreamReader, constructor_invalid_file )
+{
+  FRENSIE_CHECK_THROW( MonteCarlo::ParticleTrackStreamReader( "dummy.trk" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// end tstParticleTrackStreamWriter.cpp
+//---------------------------------------------------------------------------//
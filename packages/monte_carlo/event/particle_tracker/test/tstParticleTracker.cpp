@@ -220,6 +220,150 @@ FRENSIE_UNIT_TEST( ParticleTracker, resetData )
   FRENSIE_CHECK( history_map.empty() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the tracked histories can be streamed to a track file
+FRENSIE_UNIT_TEST( ParticleTracker, setTrackFile )
+{
+  MonteCarlo::ParticleTracker particle_tracker( 0, 2 );
+
+  FRENSIE_CHECK( !particle_tracker.hasTrackFile() );
+
+  // Use a tiny buffer so that the records of a particle span several chunks
+  particle_tracker.setTrackFile( "test_particle_tracker.trk", 3 );
+
+  FRENSIE_CHECK( particle_tracker.hasTrackFile() );
+  FRENSIE_CHECK_EQUAL( particle_tracker.getTrackFileName(),
+                       "test_particle_tracker.trk" );
+  FRENSIE_CHECK_EQUAL( particle_tracker.getMaxNumberOfBufferedTrackRecords(),
+                       3 );
+
+  double start_point[3] = { 1.0, 1.0, 1.0 };
+  double mid_point[3] = { 2.0, 1.0, 1.0 };
+  double end_point[3] = { 3.0, 1.0, 1.0 };
+
+  // History 0: a photon with two tracks and a secondary electron
+  {
+    MonteCarlo::PhotonState photon( 0 );
+    photon.setPosition( 2.0, 1.0, 1.0 );
+    photon.setDirection( 1.0, 0.0, 0.0 );
+    photon.setEnergy( 2.5 );
+    photon.setTime( 5e-11 );
+    photon.setWeight( 1.0 );
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                  start_point,
+                                                                  mid_point );
+
+    MonteCarlo::ElectronState electron( photon, true, false );
+    electron.setEnergy( 1.0 );
+
+    photon.setPosition( 3.0, 1.0, 1.0 );
+    photon.setEnergy( 1.5 );
+    photon.setTime( 1e-10 );
+    photon.incrementCollisionNumber();
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                  mid_point,
+                                                                  end_point );
+
+    photon.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( photon );
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( electron,
+                                                                  mid_point,
+                                                                  end_point );
+
+    electron.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( electron );
+  }
+
+  // History 1: a photon with one track
+  {
+    MonteCarlo::PhotonState photon( 1 );
+    photon.setPosition( 2.0, 1.0, 1.0 );
+    photon.setDirection( 1.0, 0.0, 0.0 );
+    photon.setEnergy( 2.5 );
+    photon.setTime( 5e-11 );
+    photon.setWeight( 0.5 );
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                  start_point,
+                                                                  mid_point );
+
+    photon.setAsGone();
+
+    particle_tracker.updateFromGlobalParticleGoneEvent( photon );
+  }
+
+  // History 2 is not tracked
+  {
+    MonteCarlo::PhotonState photon( 2 );
+    photon.setPosition( 2.0, 1.0, 1.0 );
+    photon.setDirection( 1.0, 0.0, 0.0 );
+
+    particle_tracker.updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                  start_point,
+                                                                  mid_point );
+  }
+
+  particle_tracker.takeSnapshot( 3, 1.0 );
+
+  // The track file must be finalized before the data can be retrieved
+  MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+  FRENSIE_CHECK_THROW( particle_tracker.getHistoryData( history_map ),
+                       std::runtime_error );
+
+  particle_tracker.finalizeTrackFile();
+
+  particle_tracker.getHistoryData( history_map );
+
+  FRENSIE_REQUIRE_EQUAL( history_map.size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( history_map[0].size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( history_map[0][MonteCarlo::PHOTON][0].size(), 1 );
+  FRENSIE_REQUIRE_EQUAL( history_map[0][MonteCarlo::ELECTRON][1].size(), 1 );
+
+  const MonteCarlo::ParticleTracker::ParticleDataArray& photon_data =
+    history_map[0][MonteCarlo::PHOTON][0][0];
+
+  FRENSIE_REQUIRE_EQUAL( photon_data.size(), 3 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( photon_data[0] ),
+                       (std::array<double,3>( {1.0, 1.0, 1.0} )) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<3>( photon_data[0] ),
+                                   1.664359048018479962e-11,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( photon_data[1] ),
+                       (std::array<double,3>( {2.0, 1.0, 1.0} )) );
+  FRENSIE_CHECK_EQUAL( Utility::get<2>( photon_data[1] ), 2.5 );
+  FRENSIE_CHECK_EQUAL( Utility::get<5>( photon_data[1] ), 0 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( photon_data[2] ),
+                       (std::array<double,3>( {3.0, 1.0, 1.0} )) );
+  FRENSIE_CHECK_EQUAL( Utility::get<2>( photon_data[2] ), 1.5 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<3>( photon_data[2] ),
+                                   1e-10,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( Utility::get<5>( photon_data[2] ), 1 );
+
+  FRENSIE_CHECK_EQUAL( history_map[0][MonteCarlo::ELECTRON][1][0].size(), 2 );
+
+  // Retrieve a single history using the track file index
+  MonteCarlo::ParticleTracker::ParticleTypeSubmap history_data;
+
+  particle_tracker.getHistoryData( 1, history_data );
+
+  FRENSIE_REQUIRE_EQUAL( history_data.size(), 1 );
+  FRENSIE_REQUIRE_EQUAL( history_data[MonteCarlo::PHOTON][0].size(), 1 );
+  FRENSIE_REQUIRE_EQUAL( history_data[MonteCarlo::PHOTON][0][0].size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<4>( history_data[MonteCarlo::PHOTON][0][0][1] ),
+                       0.5 );
+
+  particle_tracker.getHistoryData( 2, history_data );
+
+  FRENSIE_CHECK( history_data.empty() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that particle tracker data can be reduced
 FRENSIE_UNIT_TEST( ParticleTracker, reduceData )
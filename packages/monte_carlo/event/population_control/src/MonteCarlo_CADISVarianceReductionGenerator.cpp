@@ -0,0 +1,485 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CADISVarianceReductionGenerator.cpp
+//! \author Alex Robinson
+//! \brief  CADIS variance reduction generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <functional>
+#include <set>
+
+// FRENSIE Includes
+#include "MonteCarlo_CADISVarianceReductionGenerator.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_HistogramDistribution.hpp"
+#include "Utility_GaussKronrodIntegrator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The adjoint flux estimator can only have an energy
+ * discretization and the energy bins must cover the source energy
+ * distribution. The source element probabilities will be normalized.
+ */
+CADISVarianceReductionGenerator::CADISVarianceReductionGenerator(
+     const std::shared_ptr<const AdjointFluxEstimator>& adjoint_flux_estimator,
+     const SourceElementProbabilityMap& source_element_probabilities,
+     const std::shared_ptr<const Utility::UnivariateDistribution>&
+     source_energy_distribution )
+  : d_adjoint_flux_estimator( adjoint_flux_estimator ),
+    d_source_element_probabilities( source_element_probabilities ),
+    d_source_energy_distribution( source_energy_distribution ),
+    d_upper_to_lower_weight_ratio( 5.0 ),
+    d_max_relative_error( 0.5 ),
+    d_energy_bin_boundaries(),
+    d_source_energy_bin_probabilities()
+{
+  TEST_FOR_EXCEPTION( !d_adjoint_flux_estimator.get(),
+                      std::runtime_error,
+                      "The CADIS variance reduction generator requires an "
+                      "adjoint flux estimator!" );
+
+  TEST_FOR_EXCEPTION( !d_source_energy_distribution.get(),
+                      std::runtime_error,
+                      "The CADIS variance reduction generator requires a "
+                      "source energy distribution!" );
+
+  // Check the adjoint flux estimator discretization
+  std::vector<ObserverPhaseSpaceDimension> discretized_dimensions;
+
+  d_adjoint_flux_estimator->getDiscretizedDimensions( discretized_dimensions );
+
+  for( auto&& dimension : discretized_dimensions )
+  {
+    TEST_FOR_EXCEPTION( dimension != OBSERVER_ENERGY_DIMENSION,
+                        std::runtime_error,
+                        "The adjoint flux estimator "
+                        << d_adjoint_flux_estimator->getId() <<
+                        " cannot be used to generate weight windows because "
+                        "it has a " << dimension << " discretization (only "
+                        "an energy discretization is allowed)!" );
+  }
+
+  // Set the energy bin boundaries
+  const double source_min_energy =
+    d_source_energy_distribution->getLowerBoundOfIndepVar();
+
+  const double source_max_energy =
+    d_source_energy_distribution->getUpperBoundOfIndepVar();
+
+  if( d_adjoint_flux_estimator->doesDimensionHaveDiscretization( OBSERVER_ENERGY_DIMENSION ) )
+  {
+    d_adjoint_flux_estimator->getDiscretization<OBSERVER_ENERGY_DIMENSION>( d_energy_bin_boundaries );
+
+    TEST_FOR_EXCEPTION( source_min_energy < d_energy_bin_boundaries.front() ||
+                        source_max_energy > d_energy_bin_boundaries.back(),
+                        std::runtime_error,
+                        "The energy bins of adjoint flux estimator "
+                        << d_adjoint_flux_estimator->getId() << " do not "
+                        "cover the source energy distribution!" );
+  }
+  else
+  {
+    d_energy_bin_boundaries.push_back( source_min_energy );
+    d_energy_bin_boundaries.push_back( source_max_energy );
+  }
+
+  // Normalize the source element probabilities
+  double source_element_probability_sum = 0.0;
+
+  for( auto&& source_element_probability : d_source_element_probabilities )
+  {
+    TEST_FOR_EXCEPTION( !d_adjoint_flux_estimator->isEntityAssigned( source_element_probability.first ),
+                        std::runtime_error,
+                        "Source element " << source_element_probability.first
+                        << " is not a mesh element of adjoint flux estimator "
+                        << d_adjoint_flux_estimator->getId() << "!" );
+
+    TEST_FOR_EXCEPTION( source_element_probability.second < 0.0,
+                        std::runtime_error,
+                        "Source element " << source_element_probability.first
+                        << " has a negative probability!" );
+
+    source_element_probability_sum += source_element_probability.second;
+  }
+
+  TEST_FOR_EXCEPTION( source_element_probability_sum <= 0.0,
+                      std::runtime_error,
+                      "The source element probabilities must sum to a "
+                      "positive value!" );
+
+  for( auto&& source_element_probability : d_source_element_probabilities )
+    source_element_probability.second /= source_element_probability_sum;
+
+  this->calculateSourceEnergyBinProbabilities();
+}
+
+// Return the adjoint flux estimator
+auto CADISVarianceReductionGenerator::getAdjointFluxEstimator() const -> const std::shared_ptr<const AdjointFluxEstimator>&
+{
+  return d_adjoint_flux_estimator;
+}
+
+// Return the source element probabilities (normalized)
+auto CADISVarianceReductionGenerator::getSourceElementProbabilities() const -> const SourceElementProbabilityMap&
+{
+  return d_source_element_probabilities;
+}
+
+// Return the source energy distribution
+const std::shared_ptr<const Utility::UnivariateDistribution>&
+CADISVarianceReductionGenerator::getSourceEnergyDistribution() const
+{
+  return d_source_energy_distribution;
+}
+
+// Set the ratio of the upper weight bound to the lower weight bound
+void CADISVarianceReductionGenerator::setUpperToLowerWeightRatio(
+                                                           const double ratio )
+{
+  TEST_FOR_EXCEPTION( ratio <= 1.0,
+                      std::runtime_error,
+                      "The ratio of the upper weight bound to the lower "
+                      "weight bound must be greater than 1.0!" );
+
+  d_upper_to_lower_weight_ratio = ratio;
+}
+
+// Return the ratio of the upper weight bound to the lower weight bound
+double CADISVarianceReductionGenerator::getUpperToLowerWeightRatio() const
+{
+  return d_upper_to_lower_weight_ratio;
+}
+
+// Set the max relative error of the adjoint flux estimates that will be used
+void CADISVarianceReductionGenerator::setMaxRelativeError(
+                                               const double max_relative_error )
+{
+  TEST_FOR_EXCEPTION( max_relative_error <= 0.0,
+                      std::runtime_error,
+                      "The max relative error must be greater than 0.0!" );
+
+  d_max_relative_error = max_relative_error;
+}
+
+// Return the max relative error of the adjoint flux estimates that will be used
+double CADISVarianceReductionGenerator::getMaxRelativeError() const
+{
+  return d_max_relative_error;
+}
+
+// Return the estimated response
+/*! \details The response is estimated from the source and the reliable
+ * adjoint fluxes.
+ */
+double CADISVarianceReductionGenerator::getEstimatedResponse() const
+{
+  AdjointFluxMap adjoint_fluxes;
+  std::vector<double> source_adjoint_fluxes;
+
+  return this->extractAdjointFluxes( adjoint_fluxes, source_adjoint_fluxes );
+}
+
+// Generate the weight window mesh
+/*! \details The weight window center is R/phi^+ and the upper and lower
+ * weight bounds are chosen so that the center is their arithmetic mean. The
+ * survival weight is the window center. Mesh elements and energy bins
+ * without a reliable adjoint flux estimate will have open weight windows.
+ */
+std::shared_ptr<WeightWindowMesh>
+CADISVarianceReductionGenerator::generateWeightWindowMesh() const
+{
+  AdjointFluxMap adjoint_fluxes;
+  std::vector<double> source_adjoint_fluxes;
+
+  const double response =
+    this->extractAdjointFluxes( adjoint_fluxes, source_adjoint_fluxes );
+
+  const double lower_weight_multiplier =
+    2.0/(1.0 + d_upper_to_lower_weight_ratio);
+
+  // Create the weight windows
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >
+    weight_window_map;
+
+  for( auto&& element_adjoint_fluxes : adjoint_fluxes )
+  {
+    std::vector<WeightWindow>& weight_windows =
+      weight_window_map[element_adjoint_fluxes.first];
+
+    weight_windows.resize( element_adjoint_fluxes.second.size() );
+
+    for( size_t i = 0; i < weight_windows.size(); ++i )
+    {
+      if( element_adjoint_fluxes.second[i] > 0.0 )
+      {
+        const double window_center =
+          response/element_adjoint_fluxes.second[i];
+
+        weight_windows[i].lower_weight = lower_weight_multiplier*window_center;
+        weight_windows[i].upper_weight =
+          d_upper_to_lower_weight_ratio*weight_windows[i].lower_weight;
+        weight_windows[i].survival_weight = window_center;
+      }
+      else
+        weight_windows[i] = WeightWindowMeshGenerator::getOpenWeightWindow();
+    }
+  }
+
+  // Create the weight window mesh
+  std::shared_ptr<WeightWindowMesh> weight_window_mesh( new WeightWindowMesh );
+
+  weight_window_mesh->setMesh( d_adjoint_flux_estimator->getMesh() );
+
+  if( d_adjoint_flux_estimator->doesDimensionHaveDiscretization( OBSERVER_ENERGY_DIMENSION ) )
+  {
+    weight_window_mesh->setDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                     d_energy_bin_boundaries );
+  }
+
+  weight_window_mesh->setWeightWindowMap( weight_window_map );
+
+  return weight_window_mesh;
+}
+
+// Generate the importance sampled source energy dimension distribution
+/*! \details The importance distribution is a histogram over the energy bins
+ * (clipped to the source energy bounds) with bin probabilities proportional
+ * to q_g phi^+_g, where phi^+_g is the source region averaged adjoint flux.
+ * On average, a source particle born in an energy bin will have the weight
+ * window center weight R/phi^+_g. Energy bins without a reliable adjoint
+ * flux estimate in the source region still contain source particles, so
+ * they must not be given a zero importance (the biased source would no
+ * longer cover the support of the source and the response would be biased).
+ * The adjoint flux in these bins is set to the response R, which gives
+ * them the analog importance q_g (up to the normalization of the biased
+ * source) and a weight on the order of one, consistent with the open weight
+ * windows that are assigned to them. Only continuous
+ * source energy distributions with an energy discretization of the adjoint
+ * flux estimator can be importance sampled.
+ */
+std::shared_ptr<ImportanceSampledIndependentEnergyDimensionDistribution>
+CADISVarianceReductionGenerator::generateSourceEnergyDimensionDistribution() const
+{
+  TEST_FOR_EXCEPTION( !d_source_energy_distribution->isContinuous(),
+                      std::runtime_error,
+                      "A discrete source energy distribution cannot be "
+                      "importance sampled!" );
+
+  TEST_FOR_EXCEPTION( !d_adjoint_flux_estimator->doesDimensionHaveDiscretization( OBSERVER_ENERGY_DIMENSION ),
+                      std::runtime_error,
+                      "The source energy distribution can only be importance "
+                      "sampled when adjoint flux estimator "
+                      << d_adjoint_flux_estimator->getId() << " has an "
+                      "energy discretization!" );
+
+  AdjointFluxMap adjoint_fluxes;
+  std::vector<double> source_adjoint_fluxes;
+
+  const double response =
+    this->extractAdjointFluxes( adjoint_fluxes, source_adjoint_fluxes );
+
+  // Create the importance distribution bins
+  const double source_min_energy =
+    d_source_energy_distribution->getLowerBoundOfIndepVar();
+
+  const double source_max_energy =
+    d_source_energy_distribution->getUpperBoundOfIndepVar();
+
+  std::vector<double> bin_boundaries( 1, source_min_energy ), bin_values;
+
+  for( size_t i = 0; i < d_source_energy_bin_probabilities.size(); ++i )
+  {
+    const double bin_max_energy =
+      std::min( d_energy_bin_boundaries[i+1], source_max_energy );
+
+    if( bin_max_energy > bin_boundaries.back() )
+    {
+      // Use the analog importance if there is no reliable adjoint flux
+      const double adjoint_flux =
+        (source_adjoint_fluxes[i] > 0.0 ? source_adjoint_fluxes[i] : response);
+
+      bin_values.push_back( d_source_energy_bin_probabilities[i]*
+                            adjoint_flux/
+                            (bin_max_energy - bin_boundaries.back()) );
+      bin_boundaries.push_back( bin_max_energy );
+    }
+  }
+
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    importance_distribution( new Utility::HistogramDistribution( bin_boundaries, bin_values ) );
+
+  return std::make_shared<ImportanceSampledIndependentEnergyDimensionDistribution>( d_source_energy_distribution, importance_distribution );
+}
+
+// Calculate the source energy bin probabilities
+/*! \details The CDF of tabular distributions will be used. The PDF of other
+ * continuous distributions will be integrated over each bin.
+ */
+void CADISVarianceReductionGenerator::calculateSourceEnergyBinProbabilities()
+{
+  const size_t number_of_bins = d_energy_bin_boundaries.size() - 1;
+
+  d_source_energy_bin_probabilities.resize( number_of_bins );
+
+  const double source_min_energy =
+    d_source_energy_distribution->getLowerBoundOfIndepVar();
+
+  const double source_max_energy =
+    d_source_energy_distribution->getUpperBoundOfIndepVar();
+
+  if( d_source_energy_distribution->isTabular() )
+  {
+    const Utility::TabularUnivariateDistribution& tabular_distribution =
+      dynamic_cast<const Utility::TabularUnivariateDistribution&>( *d_source_energy_distribution );
+
+    double bin_lower_cdf = 0.0;
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      const double bin_upper_cdf =
+        tabular_distribution.evaluateCDF( d_energy_bin_boundaries[i+1] );
+
+      d_source_energy_bin_probabilities[i] = bin_upper_cdf - bin_lower_cdf;
+
+      bin_lower_cdf = bin_upper_cdf;
+    }
+  }
+  else
+  {
+    TEST_FOR_EXCEPTION( !d_source_energy_distribution->isContinuous(),
+                        std::runtime_error,
+                        "The source energy bin probabilities cannot be "
+                        "calculated for a discrete non-tabular source energy "
+                        "distribution!" );
+
+    std::function<double(double)> source_energy_pdf =
+      std::bind<double>( &Utility::UnivariateDistribution::evaluatePDF,
+                         std::cref( *d_source_energy_distribution ),
+                         std::placeholders::_1 );
+
+    Utility::GaussKronrodIntegrator<double> integrator( 1e-8 );
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      const double bin_min_energy =
+        std::max( d_energy_bin_boundaries[i], source_min_energy );
+
+      const double bin_max_energy =
+        std::min( d_energy_bin_boundaries[i+1], source_max_energy );
+
+      d_source_energy_bin_probabilities[i] = 0.0;
+
+      if( bin_max_energy > bin_min_energy )
+      {
+        double abs_error;
+
+        integrator.integrateAdaptively<15>( source_energy_pdf,
+                                            bin_min_energy,
+                                            bin_max_energy,
+                                            d_source_energy_bin_probabilities[i],
+                                            abs_error );
+      }
+    }
+  }
+
+  // Normalize the probabilities (correct for integration errors)
+  double probability_sum = 0.0;
+
+  for( auto&& probability : d_source_energy_bin_probabilities )
+  {
+    probability = std::max( probability, 0.0 );
+
+    probability_sum += probability;
+  }
+
+  TEST_FOR_EXCEPTION( probability_sum <= 0.0,
+                      std::runtime_error,
+                      "The source energy distribution does not have any "
+                      "probability in the energy bins!" );
+
+  for( auto&& probability : d_source_energy_bin_probabilities )
+    probability /= probability_sum;
+}
+
+// Extract the reliable adjoint fluxes and return the estimated response
+/*! \details The processed adjoint flux estimator data will be used so the
+ * number of histories must be set before this method is called.
+ */
+double CADISVarianceReductionGenerator::extractAdjointFluxes(
+                        AdjointFluxMap& adjoint_fluxes,
+                        std::vector<double>& source_adjoint_fluxes ) const
+{
+  const size_t number_of_bins = d_source_energy_bin_probabilities.size();
+
+  std::set<Estimator::EntityId> element_handles;
+
+  d_adjoint_flux_estimator->getEntityIds( element_handles );
+
+  adjoint_fluxes.clear();
+
+  std::vector<double> mean, relative_error, variance_of_variance,
+    figure_of_merit;
+
+  for( auto&& element_handle : element_handles )
+  {
+    d_adjoint_flux_estimator->getEntityBinProcessedData( element_handle,
+                                                         mean,
+                                                         relative_error,
+                                                         variance_of_variance,
+                                                         figure_of_merit );
+
+    std::vector<double>& element_adjoint_fluxes =
+      adjoint_fluxes[element_handle];
+
+    element_adjoint_fluxes.resize( number_of_bins, 0.0 );
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( mean[i] > 0.0 && relative_error[i] <= d_max_relative_error )
+        element_adjoint_fluxes[i] = mean[i];
+    }
+  }
+
+  // Calculate the source region averaged adjoint fluxes and the response
+  source_adjoint_fluxes.clear();
+  source_adjoint_fluxes.resize( number_of_bins, 0.0 );
+
+  for( auto&& source_element_probability : d_source_element_probabilities )
+  {
+    const std::vector<double>& element_adjoint_fluxes =
+      adjoint_fluxes.find( source_element_probability.first )->second;
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      source_adjoint_fluxes[i] +=
+        source_element_probability.second*element_adjoint_fluxes[i];
+    }
+  }
+
+  double response = 0.0;
+
+  for( size_t i = 0; i < number_of_bins; ++i )
+    response += d_source_energy_bin_probabilities[i]*source_adjoint_fluxes[i];
+
+  TEST_FOR_EXCEPTION( response <= 0.0,
+                      std::runtime_error,
+                      "The adjoint flux estimator "
+                      << d_adjoint_flux_estimator->getId() << " does not "
+                      "have any reliable adjoint flux estimates in the "
+                      "source region!" );
+
+  return response;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CADISVarianceReductionGenerator.cpp
+//---------------------------------------------------------------------------//
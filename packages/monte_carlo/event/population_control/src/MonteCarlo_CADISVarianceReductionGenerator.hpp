@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CADISVarianceReductionGenerator.hpp
+//! \author Alex Robinson
+//! \brief  CADIS variance reduction generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CADIS_VARIANCE_REDUCTION_GENERATOR_HPP
+#define MONTE_CARLO_CADIS_VARIANCE_REDUCTION_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_ImportanceSampledIndependentPhaseSpaceDimensionDistribution.hpp"
+#include "Utility_UnivariateDistribution.hpp"
+
+namespace MonteCarlo{
+
+/*! The CADIS variance reduction generator class
+ * \details The adjoint flux estimated in each mesh element and energy bin
+ * by a mesh track length flux estimator during an adjoint simulation (with
+ * the response function of interest as the adjoint source) is used to
+ * generate consistent forward weight windows and a biased source energy
+ * distribution (the CADIS method). The forward source is described by the
+ * probability that a source particle is born in each mesh element and by
+ * the source energy distribution. The estimated response is
+ * R = sum_{e,g} p_e q_g phi^+_{e,g}, where p_e is the source element
+ * probability, q_g is the source energy bin probability and phi^+_{e,g} is
+ * the adjoint flux. The weight window center in each mesh element and
+ * energy bin is R/phi^+_{e,g}, which is the weight that a biased source
+ * particle is born with when the adjoint flux is uniform over the source
+ * region. The energy dimension of the source is biased by the source
+ * region averaged adjoint flux using an importance sampled energy
+ * dimension distribution. A biased joint spatial-energy source cannot be
+ * represented by the independent phase space dimension distributions, so
+ * the spatial biasing is left to the weight windows. Adjoint flux estimates
+ * with a relative error above the max relative error are not used and the
+ * corresponding weight windows will be open.
+ */
+class CADISVarianceReductionGenerator
+{
+
+public:
+
+  //! The adjoint flux estimator type
+  typedef WeightMultipliedMeshTrackLengthFluxEstimator AdjointFluxEstimator;
+
+  //! The source element probability map type
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,double>
+  SourceElementProbabilityMap;
+
+  //! Constructor
+  CADISVarianceReductionGenerator(
+     const std::shared_ptr<const AdjointFluxEstimator>& adjoint_flux_estimator,
+     const SourceElementProbabilityMap& source_element_probabilities,
+     const std::shared_ptr<const Utility::UnivariateDistribution>&
+     source_energy_distribution );
+
+  //! Destructor
+  ~CADISVarianceReductionGenerator()
+  { /* ... */ }
+
+  //! Return the adjoint flux estimator
+  const std::shared_ptr<const AdjointFluxEstimator>&
+  getAdjointFluxEstimator() const;
+
+  //! Return the source element probabilities (normalized)
+  const SourceElementProbabilityMap& getSourceElementProbabilities() const;
+
+  //! Return the source energy distribution
+  const std::shared_ptr<const Utility::UnivariateDistribution>&
+  getSourceEnergyDistribution() const;
+
+  //! Set the ratio of the upper weight bound to the lower weight bound
+  void setUpperToLowerWeightRatio( const double ratio );
+
+  //! Return the ratio of the upper weight bound to the lower weight bound
+  double getUpperToLowerWeightRatio() const;
+
+  //! Set the max relative error of the adjoint flux estimates that will be used
+  void setMaxRelativeError( const double max_relative_error );
+
+  //! Return the max relative error of the adjoint flux estimates that will be used
+  double getMaxRelativeError() const;
+
+  //! Return the estimated response
+  double getEstimatedResponse() const;
+
+  //! Generate the weight window mesh
+  std::shared_ptr<WeightWindowMesh> generateWeightWindowMesh() const;
+
+  //! Generate the importance sampled source energy dimension distribution
+  std::shared_ptr<ImportanceSampledIndependentEnergyDimensionDistribution>
+  generateSourceEnergyDimensionDistribution() const;
+
+private:
+
+  // The adjoint flux map type
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >
+  AdjointFluxMap;
+
+  // Calculate the source energy bin probabilities
+  void calculateSourceEnergyBinProbabilities();
+
+  // Extract the reliable adjoint fluxes and return the estimated response
+  double extractAdjointFluxes(
+                       AdjointFluxMap& adjoint_fluxes,
+                       std::vector<double>& source_adjoint_fluxes ) const;
+
+  // The adjoint flux estimator
+  std::shared_ptr<const AdjointFluxEstimator> d_adjoint_flux_estimator;
+
+  // The source element probabilities
+  SourceElementProbabilityMap d_source_element_probabilities;
+
+  // The source energy distribution
+  std::shared_ptr<const Utility::UnivariateDistribution>
+  d_source_energy_distribution;
+
+  // The ratio of the upper weight bound to the lower weight bound
+  double d_upper_to_lower_weight_ratio;
+
+  // The max relative error of the adjoint flux estimates that will be used
+  double d_max_relative_error;
+
+  // The energy bin boundaries
+  std::vector<double> d_energy_bin_boundaries;
+
+  // The source energy bin probabilities
+  std::vector<double> d_source_energy_bin_probabilities;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CADIS_VARIANCE_REDUCTION_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CADISVarianceReductionGenerator.hpp
+//---------------------------------------------------------------------------//
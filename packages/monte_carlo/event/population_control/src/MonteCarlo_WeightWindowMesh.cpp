@@ -67,6 +67,12 @@ const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>
   return d_weight_window_map;
 }
 
+// The name that will be used when archiving the object
+const char* WeightWindowMesh::getArchiveName() const
+{
+  return "weight_window_mesh";
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::WeightWindowMesh );
@@ -15,13 +15,19 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_WeightWindow.hpp"
+#include "Utility_ArchivableObject.hpp"
 #include "Utility_Mesh.hpp"
 #include "Utility_Map.hpp"
 
 namespace MonteCarlo{
 
-//! The weight window mesh class
-class WeightWindowMesh : public WeightWindowBase
+/*! The weight window mesh class
+ * \details The weight window mesh can be saved to (and loaded from) an
+ * archive so that the weight windows generated in one simulation can be
+ * used in a later simulation.
+ */
+class WeightWindowMesh : public WeightWindowBase,
+                         public Utility::ArchivableObject<WeightWindowMesh>
 {
 
 public:
@@ -49,6 +55,9 @@ public:
   //! Get the weight window map (for viewing purposes only)
   const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>>& getWeightWindowMap() const;
 
+  //! The name that will be used when archiving the object
+  const char* getArchiveName() const override;
+
 private:
 
   // Declare the boost serialization access object as a friend
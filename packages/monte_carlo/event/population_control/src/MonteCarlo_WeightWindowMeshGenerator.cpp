@@ -0,0 +1,312 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details Only an energy discretization can be used with the flux
+ * estimator since the weight windows are only discretized in energy.
+ */
+WeightWindowMeshGenerator::WeightWindowMeshGenerator(
+                   const std::shared_ptr<const FluxEstimator>& flux_estimator )
+  : d_flux_estimator( flux_estimator ),
+    d_upper_to_lower_weight_ratio( 5.0 ),
+    d_survival_to_lower_weight_ratio( 2.5 ),
+    d_reference_lower_weight( 0.5 ),
+    d_max_relative_error( 0.5 ),
+    d_previous_weight_windows()
+{
+  TEST_FOR_EXCEPTION( !d_flux_estimator.get(),
+                      std::runtime_error,
+                      "The weight window mesh generator requires a flux "
+                      "estimator!" );
+
+  std::vector<ObserverPhaseSpaceDimension> discretized_dimensions;
+
+  d_flux_estimator->getDiscretizedDimensions( discretized_dimensions );
+
+  for( auto&& dimension : discretized_dimensions )
+  {
+    TEST_FOR_EXCEPTION( dimension != OBSERVER_ENERGY_DIMENSION,
+                        std::runtime_error,
+                        "The flux estimator " << d_flux_estimator->getId() <<
+                        " cannot be used to generate weight windows because "
+                        "it has a " << dimension << " discretization (only "
+                        "an energy discretization is allowed)!" );
+  }
+}
+
+// Return the flux estimator
+auto WeightWindowMeshGenerator::getFluxEstimator() const -> const std::shared_ptr<const FluxEstimator>&
+{
+  return d_flux_estimator;
+}
+
+// Set the ratio of the upper weight bound to the lower weight bound
+void WeightWindowMeshGenerator::setUpperToLowerWeightRatio( const double ratio )
+{
+  TEST_FOR_EXCEPTION( ratio <= 1.0,
+                      std::runtime_error,
+                      "The ratio of the upper weight bound to the lower "
+                      "weight bound must be greater than 1.0!" );
+
+  TEST_FOR_EXCEPTION( ratio < d_survival_to_lower_weight_ratio,
+                      std::runtime_error,
+                      "The ratio of the upper weight bound to the lower "
+                      "weight bound cannot be less than the ratio of the "
+                      "survival weight to the lower weight bound!" );
+
+  d_upper_to_lower_weight_ratio = ratio;
+}
+
+// Return the ratio of the upper weight bound to the lower weight bound
+double WeightWindowMeshGenerator::getUpperToLowerWeightRatio() const
+{
+  return d_upper_to_lower_weight_ratio;
+}
+
+// Set the ratio of the survival weight to the lower weight bound
+void WeightWindowMeshGenerator::setSurvivalToLowerWeightRatio( const double ratio )
+{
+  TEST_FOR_EXCEPTION( ratio < 1.0 || ratio > d_upper_to_lower_weight_ratio,
+                      std::runtime_error,
+                      "The ratio of the survival weight to the lower weight "
+                      "bound must be in [1.0, "
+                      << d_upper_to_lower_weight_ratio << "]!" );
+
+  d_survival_to_lower_weight_ratio = ratio;
+}
+
+// Return the ratio of the survival weight to the lower weight bound
+double WeightWindowMeshGenerator::getSurvivalToLowerWeightRatio() const
+{
+  return d_survival_to_lower_weight_ratio;
+}
+
+// Set the lower weight bound in the mesh element with the max flux
+void WeightWindowMeshGenerator::setReferenceLowerWeight( const double weight )
+{
+  TEST_FOR_EXCEPTION( weight <= 0.0,
+                      std::runtime_error,
+                      "The reference lower weight bound must be greater "
+                      "than 0.0!" );
+
+  d_reference_lower_weight = weight;
+}
+
+// Return the lower weight bound in the mesh element with the max flux
+double WeightWindowMeshGenerator::getReferenceLowerWeight() const
+{
+  return d_reference_lower_weight;
+}
+
+// Set the max relative error of the flux estimates that will be used
+void WeightWindowMeshGenerator::setMaxRelativeError(
+                                               const double max_relative_error )
+{
+  TEST_FOR_EXCEPTION( max_relative_error <= 0.0,
+                      std::runtime_error,
+                      "The max relative error must be greater than 0.0!" );
+
+  d_max_relative_error = max_relative_error;
+}
+
+// Return the max relative error of the flux estimates that will be used
+double WeightWindowMeshGenerator::getMaxRelativeError() const
+{
+  return d_max_relative_error;
+}
+
+// Set the previous weight window mesh
+/*! \details The previous weight window mesh must use the same mesh and
+ * energy discretization as the flux estimator.
+ */
+void WeightWindowMeshGenerator::setPreviousWeightWindowMesh(
+      const std::shared_ptr<const WeightWindowMesh>& previous_weight_windows )
+{
+  if( previous_weight_windows )
+  {
+    TEST_FOR_EXCEPTION( !previous_weight_windows->getMesh() ||
+                        previous_weight_windows->getMesh()->getNumberOfElements() !=
+                        d_flux_estimator->getMesh()->getNumberOfElements(),
+                        std::runtime_error,
+                        "The previous weight window mesh does not use the "
+                        "mesh of flux estimator "
+                        << d_flux_estimator->getId() << "!" );
+
+    TEST_FOR_EXCEPTION( previous_weight_windows->getNumberOfBins() !=
+                        d_flux_estimator->getNumberOfBins(),
+                        std::runtime_error,
+                        "The previous weight window mesh does not use the "
+                        "energy discretization of flux estimator "
+                        << d_flux_estimator->getId() << "!" );
+  }
+
+  d_previous_weight_windows = previous_weight_windows;
+}
+
+// Return the previous weight window mesh
+const std::shared_ptr<const WeightWindowMesh>&
+WeightWindowMeshGenerator::getPreviousWeightWindowMesh() const
+{
+  return d_previous_weight_windows;
+}
+
+// Generate the weight window mesh
+/*! \details The processed flux estimator data will be used so the number
+ * of histories must be set before the weight windows are generated.
+ */
+std::shared_ptr<WeightWindowMesh>
+WeightWindowMeshGenerator::generateWeightWindowMesh() const
+{
+  const size_t number_of_bins = d_flux_estimator->getNumberOfBins();
+
+  std::set<Estimator::EntityId> element_handles;
+
+  d_flux_estimator->getEntityIds( element_handles );
+
+  // Extract the reliable flux estimates and the max flux in each bin
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >
+    element_fluxes;
+
+  std::vector<double> max_fluxes( number_of_bins, 0.0 );
+
+  std::vector<double> mean, relative_error, variance_of_variance,
+    figure_of_merit;
+
+  for( auto&& element_handle : element_handles )
+  {
+    d_flux_estimator->getEntityBinProcessedData( element_handle,
+                                                 mean,
+                                                 relative_error,
+                                                 variance_of_variance,
+                                                 figure_of_merit );
+
+    std::vector<double>& fluxes = element_fluxes[element_handle];
+
+    fluxes.resize( number_of_bins, 0.0 );
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( mean[i] > 0.0 && relative_error[i] <= d_max_relative_error )
+      {
+        fluxes[i] = mean[i];
+
+        max_fluxes[i] = std::max( max_fluxes[i], mean[i] );
+      }
+    }
+  }
+
+  // Create the weight windows
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >
+    weight_window_map;
+
+  for( auto&& element_flux : element_fluxes )
+  {
+    std::vector<WeightWindow>& weight_windows =
+      weight_window_map[element_flux.first];
+
+    weight_windows.resize( number_of_bins );
+
+    for( size_t i = 0; i < number_of_bins; ++i )
+    {
+      if( element_flux.second[i] > 0.0 )
+      {
+        weight_windows[i] = this->createWeightWindow(
+                d_reference_lower_weight*element_flux.second[i]/max_fluxes[i] );
+      }
+      else
+        weight_windows[i] = this->getPreviousWeightWindow( element_flux.first, i );
+    }
+  }
+
+  // Create the weight window mesh
+  std::shared_ptr<WeightWindowMesh> weight_window_mesh( new WeightWindowMesh );
+
+  weight_window_mesh->setMesh( d_flux_estimator->getMesh() );
+
+  if( d_flux_estimator->doesDimensionHaveDiscretization( OBSERVER_ENERGY_DIMENSION ) )
+  {
+    std::vector<double> energy_bin_boundaries;
+
+    d_flux_estimator->getDiscretization<OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+
+    weight_window_mesh->setDiscretization<OBSERVER_ENERGY_DIMENSION>( energy_bin_boundaries );
+  }
+
+  weight_window_mesh->setWeightWindowMap( weight_window_map );
+
+  return weight_window_mesh;
+}
+
+// Return an open weight window (no splitting or roulette)
+/*! \details The largest finite weight is used as the upper weight bound so
+ * that the window can be stored in any archive type.
+ */
+WeightWindow WeightWindowMeshGenerator::getOpenWeightWindow()
+{
+  WeightWindow weight_window;
+
+  weight_window.upper_weight = std::numeric_limits<double>::max();
+  weight_window.survival_weight = 0.0;
+  weight_window.lower_weight = 0.0;
+
+  return weight_window;
+}
+
+// Return the previous weight window (open if there isn't one)
+WeightWindow WeightWindowMeshGenerator::getPreviousWeightWindow(
+                            const Utility::Mesh::ElementHandle element_handle,
+                            const size_t bin_index ) const
+{
+  if( d_previous_weight_windows )
+  {
+    const std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> >&
+      previous_weight_window_map =
+      d_previous_weight_windows->getWeightWindowMap();
+
+    auto previous_weight_windows =
+      previous_weight_window_map.find( element_handle );
+
+    if( previous_weight_windows != previous_weight_window_map.end() &&
+        bin_index < previous_weight_windows->second.size() )
+      return previous_weight_windows->second[bin_index];
+  }
+
+  return WeightWindowMeshGenerator::getOpenWeightWindow();
+}
+
+// Create a weight window from the lower weight bound
+WeightWindow WeightWindowMeshGenerator::createWeightWindow(
+                                              const double lower_weight ) const
+{
+  WeightWindow weight_window;
+
+  weight_window.upper_weight = d_upper_to_lower_weight_ratio*lower_weight;
+  weight_window.survival_weight = d_survival_to_lower_weight_ratio*lower_weight;
+  weight_window.lower_weight = lower_weight;
+
+  return weight_window;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh generator class
+ * \details The weight windows are generated from the flux estimated in
+ * each mesh element and energy bin by a mesh track length flux estimator
+ * during a forward simulation (the MAGIC method). The lower weight bound
+ * in each mesh element is proportional to the flux in the element
+ * normalized by the maximum flux in the energy bin so that the particle
+ * population will be approximately uniform across the mesh. Only flux
+ * estimates with a relative error below the max relative error are used.
+ * The remaining windows are taken from the previous weight window mesh
+ * (if one has been set) or are left open (no splitting or roulette). The
+ * generated weight window mesh can be used in the next simulation and then
+ * set as the previous weight window mesh of the next generator so that the
+ * windows are refined iteratively. The flux estimator must be registered
+ * with the event handler of the simulation and only its first response
+ * function will be used.
+ */
+class WeightWindowMeshGenerator
+{
+
+public:
+
+  //! The flux estimator type
+  typedef WeightMultipliedMeshTrackLengthFluxEstimator FluxEstimator;
+
+  //! Constructor
+  WeightWindowMeshGenerator(
+                  const std::shared_ptr<const FluxEstimator>& flux_estimator );
+
+  //! Destructor
+  ~WeightWindowMeshGenerator()
+  { /* ... */ }
+
+  //! Return the flux estimator
+  const std::shared_ptr<const FluxEstimator>& getFluxEstimator() const;
+
+  //! Set the ratio of the upper weight bound to the lower weight bound
+  void setUpperToLowerWeightRatio( const double ratio );
+
+  //! Return the ratio of the upper weight bound to the lower weight bound
+  double getUpperToLowerWeightRatio() const;
+
+  //! Set the ratio of the survival weight to the lower weight bound
+  void setSurvivalToLowerWeightRatio( const double ratio );
+
+  //! Return the ratio of the survival weight to the lower weight bound
+  double getSurvivalToLowerWeightRatio() const;
+
+  //! Set the lower weight bound in the mesh element with the max flux
+  void setReferenceLowerWeight( const double weight );
+
+  //! Return the lower weight bound in the mesh element with the max flux
+  double getReferenceLowerWeight() const;
+
+  //! Set the max relative error of the flux estimates that will be used
+  void setMaxRelativeError( const double max_relative_error );
+
+  //! Return the max relative error of the flux estimates that will be used
+  double getMaxRelativeError() const;
+
+  //! Set the previous weight window mesh
+  void setPreviousWeightWindowMesh(
+     const std::shared_ptr<const WeightWindowMesh>& previous_weight_windows );
+
+  //! Return the previous weight window mesh
+  const std::shared_ptr<const WeightWindowMesh>&
+  getPreviousWeightWindowMesh() const;
+
+  //! Generate the weight window mesh
+  std::shared_ptr<WeightWindowMesh> generateWeightWindowMesh() const;
+
+  //! Return an open weight window (no splitting or roulette)
+  static WeightWindow getOpenWeightWindow();
+
+private:
+
+  // Return the previous weight window (open if there isn't one)
+  WeightWindow getPreviousWeightWindow(
+                            const Utility::Mesh::ElementHandle element_handle,
+                            const size_t bin_index ) const;
+
+  // Create a weight window from the lower weight bound
+  WeightWindow createWeightWindow( const double lower_weight ) const;
+
+  // The flux estimator
+  std::shared_ptr<const FluxEstimator> d_flux_estimator;
+
+  // The ratio of the upper weight bound to the lower weight bound
+  double d_upper_to_lower_weight_ratio;
+
+  // The ratio of the survival weight to the lower weight bound
+  double d_survival_to_lower_weight_ratio;
+
+  // The lower weight bound in the mesh element with the max flux
+  double d_reference_lower_weight;
+
+  // The max relative error of the flux estimates that will be used
+  double d_max_relative_error;
+
+  // The previous weight window mesh
+  std::shared_ptr<const WeightWindowMesh> d_previous_weight_windows;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,434 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCADISVarianceReductionGenerator.cpp
+//! \author Alex Robinson
+//! \brief  CADIS variance reduction generator unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_CADISVarianceReductionGenerator.hpp"
+#include "MonteCarlo_AdjointPhotonState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_PhaseSpacePoint.hpp"
+#include "Utility_BasicCartesianCoordinateConversionPolicy.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UniformDistribution.hpp"
+#include "Utility_ExponentialDistribution.hpp"
+#include "Utility_DeltaDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> hex_mesh;
+
+std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+adjoint_flux_estimator;
+
+MonteCarlo::CADISVarianceReductionGenerator::SourceElementProbabilityMap
+source_element_probabilities;
+
+std::shared_ptr<const Utility::UnivariateDistribution>
+source_energy_distribution( new Utility::UniformDistribution( 0.0, 2.0, 1.0 ) );
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Return the weight window at a point on the mesh centerline
+MonteCarlo::WeightWindow getWeightWindow(
+                            const MonteCarlo::WeightWindowMesh& weight_windows,
+                            const double x_position,
+                            const double energy )
+{
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( x_position, 0.5, 0.5 );
+  photon.setEnergy( energy );
+
+  return weight_windows.getWeightWindow( photon );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the generator can be constructed
+FRENSIE_UNIT_TEST( CADISVarianceReductionGenerator, constructor )
+{
+  MonteCarlo::CADISVarianceReductionGenerator
+    generator( adjoint_flux_estimator,
+               {{source_element_probabilities.begin()->first, 2.0}},
+               source_energy_distribution );
+
+  FRENSIE_CHECK( generator.getAdjointFluxEstimator() == adjoint_flux_estimator );
+  FRENSIE_CHECK_EQUAL( generator.getSourceElementProbabilities().size(), 1 );
+  FRENSIE_CHECK_EQUAL( generator.getSourceElementProbabilities().begin()->second,
+                       1.0 );
+  FRENSIE_CHECK( generator.getSourceEnergyDistribution() ==
+                 source_energy_distribution );
+  FRENSIE_CHECK_EQUAL( generator.getUpperToLowerWeightRatio(), 5.0 );
+  FRENSIE_CHECK_EQUAL( generator.getMaxRelativeError(), 0.5 );
+
+  generator.setUpperToLowerWeightRatio( 3.0 );
+  generator.setMaxRelativeError( 0.1 );
+
+  FRENSIE_CHECK_EQUAL( generator.getUpperToLowerWeightRatio(), 3.0 );
+  FRENSIE_CHECK_EQUAL( generator.getMaxRelativeError(), 0.1 );
+
+  FRENSIE_CHECK_THROW( generator.setUpperToLowerWeightRatio( 1.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setMaxRelativeError( 0.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an invalid source cannot be used
+FRENSIE_UNIT_TEST( CADISVarianceReductionGenerator, constructor_bad_source )
+{
+  // The source energy distribution is not covered by the energy bins
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    bad_energy_distribution( new Utility::UniformDistribution( 1.0, 20.0, 1.0 ) );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISVarianceReductionGenerator generator(
+                                                 adjoint_flux_estimator,
+                                                 source_element_probabilities,
+                                                 bad_energy_distribution ),
+                       std::runtime_error );
+
+  // The source element is not in the mesh
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISVarianceReductionGenerator generator(
+                                                 adjoint_flux_estimator,
+                                                 {{100, 1.0}},
+                                                 source_energy_distribution ),
+                       std::runtime_error );
+
+  // The source element probabilities are invalid
+  FRENSIE_CHECK_THROW( MonteCarlo::CADISVarianceReductionGenerator generator(
+                       adjoint_flux_estimator,
+                       {{source_element_probabilities.begin()->first, 0.0}},
+                       source_energy_distribution ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the response can be estimated
+FRENSIE_UNIT_TEST( CADISVarianceReductionGenerator, getEstimatedResponse )
+{
+  MonteCarlo::CADISVarianceReductionGenerator
+    generator( adjoint_flux_estimator,
+               source_element_probabilities,
+               source_energy_distribution );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( generator.getEstimatedResponse(),
+                                   0.75,
+                                   1e-12 );
+
+  // The CDF of a non-tabular distribution must be integrated
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    exponential_energy_distribution(
+                 new Utility::ExponentialDistribution( 1.0, 1.0, 0.0, 2.0 ) );
+
+  MonteCarlo::CADISVarianceReductionGenerator
+    exponential_generator( adjoint_flux_estimator,
+                           source_element_probabilities,
+                           exponential_energy_distribution );
+
+  const double bin_0_probability = (1.0 - exp(-1.0))/(1.0 - exp(-2.0));
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( exponential_generator.getEstimatedResponse(),
+                                   bin_0_probability +
+                                   0.5*(1.0 - bin_0_probability),
+                                   1e-9 );
+
+  // A monoenergetic source is only in one energy bin
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    delta_energy_distribution( new Utility::DeltaDistribution( 1.5 ) );
+
+  MonteCarlo::CADISVarianceReductionGenerator
+    delta_generator( adjoint_flux_estimator,
+                     source_element_probabilities,
+                     delta_energy_distribution );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( delta_generator.getEstimatedResponse(),
+                                   0.5,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight window mesh can be generated
+FRENSIE_UNIT_TEST( CADISVarianceReductionGenerator, generateWeightWindowMesh )
+{
+  MonteCarlo::CADISVarianceReductionGenerator
+    generator( adjoint_flux_estimator,
+               source_element_probabilities,
+               source_energy_distribution );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+    generator.generateWeightWindowMesh();
+
+  FRENSIE_REQUIRE( weight_windows.get() != NULL );
+  FRENSIE_CHECK( weight_windows->getMesh() == hex_mesh );
+  FRENSIE_CHECK_EQUAL( weight_windows->getWeightWindowMap().size(), 2 );
+  FRENSIE_CHECK_EQUAL( weight_windows->getNumberOfBins(), 2 );
+
+  // The window center is the response divided by the adjoint flux
+  MonteCarlo::WeightWindow weight_window =
+    getWeightWindow( *weight_windows, 0.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.25, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 0.75, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 1.25, 1e-12 );
+
+  weight_window = getWeightWindow( *weight_windows, 1.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.25, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 0.75, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 1.25, 1e-12 );
+
+  weight_window = getWeightWindow( *weight_windows, 0.5, 1.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 1.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 2.5, 1e-12 );
+
+  // No adjoint flux was estimated in the second energy bin of element 1
+  weight_window = getWeightWindow( *weight_windows, 1.5, 1.5 );
+
+  FRENSIE_CHECK_EQUAL( weight_window.lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window.survival_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window.upper_weight,
+                       std::numeric_limits<double>::max() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the importance sampled source energy dimension distribution can
+// be generated
+FRENSIE_UNIT_TEST( CADISVarianceReductionGenerator,
+                   generateSourceEnergyDimensionDistribution )
+{
+  MonteCarlo::CADISVarianceReductionGenerator
+    generator( adjoint_flux_estimator,
+               source_element_probabilities,
+               source_energy_distribution );
+
+  std::shared_ptr<MonteCarlo::ImportanceSampledIndependentEnergyDimensionDistribution>
+    energy_distribution = generator.generateSourceEnergyDimensionDistribution();
+
+  FRENSIE_REQUIRE( energy_distribution.get() != NULL );
+  FRENSIE_CHECK_EQUAL( energy_distribution->getDimension(),
+                       MonteCarlo::ENERGY_DIMENSION );
+
+  std::shared_ptr<const Utility::SpatialCoordinateConversionPolicy>
+    spatial_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  std::shared_ptr<const Utility::DirectionalCoordinateConversionPolicy>
+    directional_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  MonteCarlo::PhaseSpacePoint point( spatial_coord_conversion_policy,
+                                     directional_coord_conversion_policy );
+
+  // The biased source particles are born at the weight window center
+  std::vector<double> fake_stream( 2 );
+  fake_stream[0] = 0.5;
+  fake_stream[1] = 0.8;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinate(), 0.75, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinateWeight(),
+                                   0.75,
+                                   1e-12 );
+
+  energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinate(), 1.4, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinateWeight(),
+                                   1.5,
+                                   1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // A discrete source energy distribution cannot be importance sampled
+  std::shared_ptr<const Utility::UnivariateDistribution>
+    delta_energy_distribution( new Utility::DeltaDistribution( 1.5 ) );
+
+  MonteCarlo::CADISVarianceReductionGenerator
+    delta_generator( adjoint_flux_estimator,
+                     source_element_probabilities,
+                     delta_energy_distribution );
+
+  FRENSIE_CHECK_THROW( delta_generator.generateSourceEnergyDimensionDistribution(),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that source energy bins without a reliable adjoint flux estimate will
+// still be sampled
+FRENSIE_UNIT_TEST( CADISVarianceReductionGenerator,
+                   generateSourceEnergyDimensionDistribution_unreliable_bin )
+{
+  // No adjoint flux was estimated in the second energy bin of element 1
+  MonteCarlo::CADISVarianceReductionGenerator::SourceElementProbabilityMap
+    unreliable_source_element_probabilities;
+
+  double source_point[3] = {1.5, 0.5, 0.5};
+
+  unreliable_source_element_probabilities[hex_mesh->whichElementIsPointIn( source_point )] = 1.0;
+
+  MonteCarlo::CADISVarianceReductionGenerator
+    generator( adjoint_flux_estimator,
+               unreliable_source_element_probabilities,
+               source_energy_distribution );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( generator.getEstimatedResponse(),
+                                   0.5,
+                                   1e-12 );
+
+  std::shared_ptr<MonteCarlo::ImportanceSampledIndependentEnergyDimensionDistribution>
+    energy_distribution = generator.generateSourceEnergyDimensionDistribution();
+
+  FRENSIE_REQUIRE( energy_distribution.get() != NULL );
+
+  std::shared_ptr<const Utility::SpatialCoordinateConversionPolicy>
+    spatial_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  std::shared_ptr<const Utility::DirectionalCoordinateConversionPolicy>
+    directional_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  MonteCarlo::PhaseSpacePoint point( spatial_coord_conversion_policy,
+                                     directional_coord_conversion_policy );
+
+  // The unreliable bin has the analog importance (phi^+ = R), so the biased
+  // source still covers the full support of the source
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.5;
+  fake_stream[2] = 0.8;
+  fake_stream[3] = 1.0-1e-15;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_SMALL( point.getEnergyCoordinate(), 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinateWeight(),
+                                   0.75,
+                                   1e-12 );
+
+  energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinate(), 0.75, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinateWeight(),
+                                   0.75,
+                                   1e-12 );
+
+  energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinate(), 1.4, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinateWeight(),
+                                   1.5,
+                                   1e-12 );
+
+  energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinate(), 2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( point.getEnergyCoordinateWeight(),
+                                   1.5,
+                                   1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // The expected weight of the biased source must be one (unbiased)
+  double weight_sum = 0.0;
+
+  const int number_of_samples = 10000;
+
+  for( int i = 0; i < number_of_samples; ++i )
+  {
+    energy_distribution->sampleWithoutCascade( point );
+
+    FRENSIE_CHECK( point.getEnergyCoordinateWeight() > 0.0 );
+
+    weight_sum += point.getEnergyCoordinateWeight();
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_sum/number_of_samples, 1.0, 0.02 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+
+  // Set up a mesh with two elements along the x-axis
+  std::vector<double> x_planes( {0, 1, 2} ),
+    y_planes( {0, 1} ),
+    z_planes( {0, 1} );
+
+  hex_mesh.reset( new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  // The source is in the first element
+  double source_point[3] = {0.5, 0.5, 0.5};
+
+  source_element_probabilities[hex_mesh->whichElementIsPointIn( source_point )] = 1.0;
+
+  // Set up the adjoint flux estimator
+  adjoint_flux_estimator.reset(
+            new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                          0, 1.0, hex_mesh ) );
+
+  adjoint_flux_estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                        std::vector<double>( {0.0, 1.0, 2.0} ) );
+  adjoint_flux_estimator->setParticleTypes(
+     std::vector<MonteCarlo::ParticleType>( {MonteCarlo::ADJOINT_PHOTON} ) );
+
+  // Two identical adjoint histories: the first energy bin crosses both
+  // elements and the second energy bin crosses half of the first element
+  double start_point[3] = {0.0, 0.5, 0.5};
+  double end_point_1[3] = {2.0, 0.5, 0.5};
+  double end_point_2[3] = {0.5, 0.5, 0.5};
+
+  MonteCarlo::AdjointPhotonState adjoint_photon( 0 );
+  adjoint_photon.setWeight( 1.0 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    adjoint_photon.setEnergy( 0.5 );
+
+    adjoint_flux_estimator->updateFromGlobalParticleSubtrackEndingEvent(
+                                                                adjoint_photon,
+                                                                start_point,
+                                                                end_point_1 );
+
+    adjoint_photon.setEnergy( 1.5 );
+
+    adjoint_flux_estimator->updateFromGlobalParticleSubtrackEndingEvent(
+                                                                adjoint_photon,
+                                                                start_point,
+                                                                end_point_2 );
+
+    adjoint_flux_estimator->commitHistoryContribution();
+  }
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2.0 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCADISVarianceReductionGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -241,6 +241,37 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( WeightWindowMesh,
 
 }
 
+//---------------------------------------------------------------------------//
+// Check that the weight window mesh can be saved to and loaded from a file
+FRENSIE_UNIT_TEST( WeightWindowMesh, saveToFile_loadFromFile )
+{
+  weight_window_mesh->saveToFile( "test_weight_window_mesh.xml", true );
+
+  MonteCarlo::WeightWindowMesh loaded_weight_window_mesh;
+
+  loaded_weight_window_mesh.loadFromFile( "test_weight_window_mesh.xml" );
+
+  FRENSIE_CHECK_EQUAL( loaded_weight_window_mesh.getMesh()->getNumberOfElements(), 2 );
+
+  std::vector<double> energy_discretization_bounds;
+
+  loaded_weight_window_mesh.getDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( energy_discretization_bounds );
+
+  FRENSIE_CHECK_EQUAL( energy_discretization_bounds,
+                       std::vector<double>( {0.0, 1e-1, 20.0} ) );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 1.5, 0.5, 0.5 );
+
+  const MonteCarlo::WeightWindow& weight_window =
+    loaded_weight_window_mesh.getWeightWindow( photon );
+
+  FRENSIE_CHECK_EQUAL( weight_window.lower_weight, 0.5 );
+  FRENSIE_CHECK_EQUAL( weight_window.upper_weight, 0.6 );
+  FRENSIE_CHECK_EQUAL( weight_window.survival_weight, 0.55 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
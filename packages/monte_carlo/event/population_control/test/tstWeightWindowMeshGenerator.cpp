@@ -0,0 +1,267 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMeshGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Weight window mesh generator unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> hex_mesh;
+
+std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+flux_estimator;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Return the weight window at a point on the mesh centerline
+MonteCarlo::WeightWindow getWeightWindow(
+                            const MonteCarlo::WeightWindowMesh& weight_windows,
+                            const double x_position,
+                            const double energy )
+{
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( x_position, 0.5, 0.5 );
+  photon.setEnergy( energy );
+
+  return weight_windows.getWeightWindow( photon );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a flux estimator with a non-energy discretization cannot be used
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, constructor_bad_discretization )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                          1, 1.0, hex_mesh ) );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_TIME_DIMENSION>(
+                                             std::vector<double>( {0.0, 1.0} ) );
+
+  FRENSIE_CHECK_THROW( MonteCarlo::WeightWindowMeshGenerator generator( estimator ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator settings can be changed
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, settings )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( flux_estimator );
+
+  FRENSIE_CHECK( generator.getFluxEstimator() == flux_estimator );
+  FRENSIE_CHECK_EQUAL( generator.getUpperToLowerWeightRatio(), 5.0 );
+  FRENSIE_CHECK_EQUAL( generator.getSurvivalToLowerWeightRatio(), 2.5 );
+  FRENSIE_CHECK_EQUAL( generator.getReferenceLowerWeight(), 0.5 );
+  FRENSIE_CHECK_EQUAL( generator.getMaxRelativeError(), 0.5 );
+  FRENSIE_CHECK( !generator.getPreviousWeightWindowMesh() );
+
+  generator.setUpperToLowerWeightRatio( 4.0 );
+  generator.setSurvivalToLowerWeightRatio( 2.0 );
+  generator.setReferenceLowerWeight( 0.25 );
+  generator.setMaxRelativeError( 0.1 );
+
+  FRENSIE_CHECK_EQUAL( generator.getUpperToLowerWeightRatio(), 4.0 );
+  FRENSIE_CHECK_EQUAL( generator.getSurvivalToLowerWeightRatio(), 2.0 );
+  FRENSIE_CHECK_EQUAL( generator.getReferenceLowerWeight(), 0.25 );
+  FRENSIE_CHECK_EQUAL( generator.getMaxRelativeError(), 0.1 );
+
+  FRENSIE_CHECK_THROW( generator.setUpperToLowerWeightRatio( 1.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setUpperToLowerWeightRatio( 1.5 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setSurvivalToLowerWeightRatio( 0.5 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setSurvivalToLowerWeightRatio( 5.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setReferenceLowerWeight( 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setMaxRelativeError( 0.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight window mesh can be generated
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateWeightWindowMesh )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( flux_estimator );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+    generator.generateWeightWindowMesh();
+
+  FRENSIE_REQUIRE( weight_windows.get() != NULL );
+  FRENSIE_CHECK( weight_windows->getMesh() == hex_mesh );
+  FRENSIE_CHECK_EQUAL( weight_windows->getWeightWindowMap().size(), 2 );
+  FRENSIE_CHECK_EQUAL( weight_windows->getNumberOfBins(), 2 );
+
+  // The lower weight is proportional to the flux
+  MonteCarlo::WeightWindow weight_window;
+
+  weight_window = getWeightWindow( *weight_windows, 0.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 1.25, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 2.5, 1e-12 );
+
+  weight_window = getWeightWindow( *weight_windows, 1.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.25, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 0.625, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 1.25, 1e-12 );
+
+  // No flux was estimated in the second energy bin
+  weight_window = getWeightWindow( *weight_windows, 0.5, 5.0 );
+
+  FRENSIE_CHECK_EQUAL( weight_window.lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window.survival_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window.upper_weight,
+                       std::numeric_limits<double>::max() );
+
+  weight_window = getWeightWindow( *weight_windows, 1.5, 5.0 );
+
+  FRENSIE_CHECK_EQUAL( weight_window.lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window.survival_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window.upper_weight,
+                       std::numeric_limits<double>::max() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the previous weight windows are used where the flux estimate
+// is unreliable
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator,
+                   generateWeightWindowMesh_previous_weight_windows )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( flux_estimator );
+
+  generator.setReferenceLowerWeight( 1.0 );
+  generator.setUpperToLowerWeightRatio( 4.0 );
+  generator.setSurvivalToLowerWeightRatio( 2.0 );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> previous_weight_windows =
+    generator.generateWeightWindowMesh();
+
+  // Replace the open windows in the second energy bin
+  {
+    std::unordered_map<Utility::Mesh::ElementHandle,std::vector<MonteCarlo::WeightWindow> >
+      weight_window_map = previous_weight_windows->getWeightWindowMap();
+
+    for( auto&& element_weight_windows : weight_window_map )
+    {
+      element_weight_windows.second[1].lower_weight = 0.1;
+      element_weight_windows.second[1].survival_weight = 0.2;
+      element_weight_windows.second[1].upper_weight = 0.3;
+    }
+
+    previous_weight_windows->setWeightWindowMap( weight_window_map );
+  }
+
+  generator.setPreviousWeightWindowMesh( previous_weight_windows );
+
+  FRENSIE_CHECK( generator.getPreviousWeightWindowMesh() ==
+                 previous_weight_windows );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_windows =
+    generator.generateWeightWindowMesh();
+
+  MonteCarlo::WeightWindow weight_window;
+
+  weight_window = getWeightWindow( *weight_windows, 0.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 4.0, 1e-12 );
+
+  weight_window = getWeightWindow( *weight_windows, 1.5, 0.5 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.5, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 2.0, 1e-12 );
+
+  weight_window = getWeightWindow( *weight_windows, 0.5, 5.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.1, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 0.2, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 0.3, 1e-12 );
+
+  weight_window = getWeightWindow( *weight_windows, 1.5, 5.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.1, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 0.2, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 0.3, 1e-12 );
+
+  // The previous weight windows must be compatible with the estimator
+  std::shared_ptr<MonteCarlo::WeightWindowMesh>
+    bad_weight_windows( new MonteCarlo::WeightWindowMesh );
+
+  bad_weight_windows->setMesh( hex_mesh );
+
+  FRENSIE_CHECK_THROW( generator.setPreviousWeightWindowMesh( bad_weight_windows ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up a mesh with two elements along the x-axis
+  std::vector<double> x_planes( {0, 1, 2} ),
+    y_planes( {0, 1} ),
+    z_planes( {0, 1} );
+
+  hex_mesh.reset( new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  // Set up the flux estimator
+  flux_estimator.reset(
+            new MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator(
+                                                          0, 1.0, hex_mesh ) );
+
+  flux_estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                       std::vector<double>( {0.0, 1.0, 10.0} ) );
+  flux_estimator->setParticleTypes(
+                   std::vector<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  // Two identical histories that cross all of the first element and half
+  // of the second element
+  double start_point[3] = {0.0, 0.5, 0.5};
+  double end_point[3] = {1.5, 0.5, 0.5};
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 0.5 );
+  photon.setWeight( 1.0 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    flux_estimator->updateFromGlobalParticleSubtrackEndingEvent( photon,
+                                                                 start_point,
+                                                                 end_point );
+    flux_estimator->commitHistoryContribution();
+  }
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2.0 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -61,6 +61,12 @@ protected:
   //! The signal handler
   void signalHandler( int signal ) final override;
 
+  //! Handle the completion of a micro batch
+  void handleMicroBatchCompletion() final override;
+
+  //! Handle the completion of a history on the master thread
+  void handleMasterThreadHistoryCompletion() final override;
+
 private:
 
   // Coorindate workers
@@ -78,14 +84,32 @@ private:
   void assignWorkToIdleWorker( const Utility::Communicator::Status& idle_worker_info,
                                const std::pair<uint64_t,uint64_t>& task );
 
+  // Assign work to all idle workers
+  void assignWorkToIdleWorkers();
+
+  // Create the next task
+  void createNextTask( std::pair<uint64_t,uint64_t>& task ) const;
+
   // Complete assigned work
   void work();
 
+  // Complete assigned work (prefetch the next task)
+  void workWithTaskPrefetch();
+
+  // Request a task from the root process
+  void requestTask( std::pair<uint64_t,uint64_t>& task ) const;
+
   // The communicator
   std::shared_ptr<const Utility::Communicator> d_comm;
 
   // The number of batches per rendezvous
   uint64_t d_batches_per_rendezvous;
+
+  // The current batch number (root process only)
+  uint64_t d_batch_number;
+
+  // Records if the root process simulates batches
+  bool d_root_process_transport;
 };
   
 } // end MonteCarlo namespace
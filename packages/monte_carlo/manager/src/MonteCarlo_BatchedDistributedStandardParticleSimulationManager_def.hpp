@@ -10,6 +10,8 @@
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
 // FRENSIE Includes
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -41,16 +43,41 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                                              rendezvous_number,
                                              use_single_rendezvous_file ),
   d_comm( comm ),
-  d_batches_per_rendezvous( 0 )
+  d_batches_per_rendezvous( 0 ),
+  d_batch_number( 0 ),
+  d_root_process_transport( properties->isRootProcessTransportModeOn() )
 {
   // Make sure that the communicator pointer is valid
   testPrecondition( comm.get() );
   // Make sure that the communicator is not a serial communicator
   testPrecondition( comm->size() > 1 );
 
-  // Calculate the batch size
-  d_batches_per_rendezvous =
-    properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+  // In root process transport mode the master thread of the root process
+  // services work requests from inside of the parallel region
+  if( d_root_process_transport &&
+      Utility::OpenMPProperties::getRequestedNumberOfThreads() > 1 )
+  {
+    TEST_FOR_EXCEPTION( Utility::GlobalMPISession::threadLevel() <
+                        (int)Utility::GlobalMPISession::FunneledThreading,
+                        std::runtime_error,
+                        "Root process transport mode with multiple threads "
+                        "requires at least funneled MPI thread support (the "
+                        "provided MPI thread support level is "
+                        << Utility::GlobalMPISession::threadLevel() << ")!" );
+  }
+
+  // Calculate the number of batches per rendezvous (the root process only
+  // simulates batches in root process transport mode)
+  if( d_root_process_transport )
+  {
+    d_batches_per_rendezvous =
+      properties->getNumberOfBatchesPerProcessor()*comm->size();
+  }
+  else
+  {
+    d_batches_per_rendezvous =
+      properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+  }
 
   // Calculate the batch size
   uint64_t batch_size =
@@ -135,11 +162,17 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
 }
 
 // Coorindate workers
+/*! \details In root process transport mode the root process will simulate a
+ * batch itself whenever there are no idle workers. The work requests that
+ * arrive while the root process is simulating a batch will be serviced after
+ * each history that its master thread completes (see
+ * handleMasterThreadHistoryCompletion).
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorkers()
 {
-  // The current batch number
-  uint64_t batch_number = 0;
+  // Reset the batch number
+  d_batch_number = 0;
 
   // The batch info (start history, end history + 1)
   std::pair<uint64_t,uint64_t> task;
@@ -153,44 +186,64 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorker
   {
     if( this->isSimulationComplete() )
     {
-      this->stopWorkersAndRecordWork( true, rendezvous_required, batch_number );
+      this->stopWorkersAndRecordWork( true, rendezvous_required, d_batch_number );
 
       break;
     }
-    else if( batch_number == d_batches_per_rendezvous )
+    else if( d_batch_number == d_batches_per_rendezvous )
     {
-      this->stopWorkersAndRecordWork( false, true, batch_number );
+      this->stopWorkersAndRecordWork( false, true, d_batch_number );
       
       // The rendezvous is complete
       rendezvous_required = false;
       
       // Reset the batch number
-      batch_number = 0;
+      d_batch_number = 0;
       
       continue;
     }
     else if( this->isIdleWorkerPresent( idle_worker_info ) )
     {
-      // Set the batch start history
-      task.first = this->getNextHistory() + batch_number*this->getBatchSize();
-      
-      task.second = task.first + this->getBatchSize();
-
-      // Check if the size of the last batch is correct
-      if( batch_number == d_batches_per_rendezvous - 1 )
-      {
-        task.second += this->getRendezvousBatchSize() -
-          d_batches_per_rendezvous*this->getBatchSize();
-      }
+      this->createNextTask( task );
 
       this->assignWorkToIdleWorker( idle_worker_info, task );
 
       // Increment the batch number
-      ++batch_number;
+      ++d_batch_number;
 
       // A rendezvous is required
       rendezvous_required = true;
     }
+    else if( d_root_process_transport )
+    {
+      this->createNextTask( task );
+
+      // Increment the batch number
+      ++d_batch_number;
+
+      // A rendezvous is required
+      rendezvous_required = true;
+
+      this->runSimulationBatch( task.first, task.second );
+    }
+  }
+}
+
+// Create the next task
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::createNextTask(
+                                   std::pair<uint64_t,uint64_t>& task ) const
+{
+  // Set the batch start history
+  task.first = this->getNextHistory() + d_batch_number*this->getBatchSize();
+      
+  task.second = task.first + this->getBatchSize();
+
+  // Check if the size of the last batch is correct
+  if( d_batch_number == d_batches_per_rendezvous - 1 )
+  {
+    task.second += this->getRendezvousBatchSize() -
+      d_batches_per_rendezvous*this->getBatchSize();
   }
 }
 
@@ -310,35 +363,140 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdle
                            << idle_worker_info.source() << "!" );
 }
 
-// Complete assigned work
+// Assign work to all idle workers
 template<ParticleModeType mode>
-void BatchedDistributedStandardParticleSimulationManager<mode>::work()
+void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorkers()
 {
+  // The batch info (start history, end history + 1)
   std::pair<uint64_t,uint64_t> task;
 
-  int idle_message = 1;
-  
-  while( true )
+  // The idle worker info
+  Utility::Communicator::Status idle_worker_info;
+
+  while( d_batch_number < d_batches_per_rendezvous )
   {
-    // Tell the root process that a new task can be done
-    try{
-      Utility::send( *d_comm, 0, 0, idle_message );
+    if( this->isIdleWorkerPresent( idle_worker_info ) )
+    {
+      this->createNextTask( task );
+
+      this->assignWorkToIdleWorker( idle_worker_info, task );
+
+      // Increment the batch number
+      ++d_batch_number;
     }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Worker process " << d_comm->rank() <<
-                             " unable to request work from root process!" );
+    else
+      break;
+  }
+}
 
-    // Get the task from the root process
-    try{
-      Utility::receive( *d_comm, 0, 0, task );
+// Handle the completion of a micro batch
+/*! \details The root process will only simulate micro batches in root
+ * process transport mode. Any work requests that arrived while the master
+ * thread was waiting on the other threads to finish the micro batch will be
+ * serviced.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::handleMicroBatchCompletion()
+{
+  if( d_root_process_transport && d_comm->rank() == 0 )
+    this->assignWorkToIdleWorkers();
+}
+
+// Handle the completion of a history on the master thread
+/*! \details The root process will only simulate histories in root process
+ * transport mode. Any work requests that arrived while the history was being
+ * simulated will be serviced so that the workers do not wait on the root
+ * process for the duration of a micro batch.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::handleMasterThreadHistoryCompletion()
+{
+  if( d_root_process_transport && d_comm->rank() == 0 )
+    this->assignWorkToIdleWorkers();
+}
+
+// Complete assigned work
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::work()
+{
+  if( d_root_process_transport )
+    this->workWithTaskPrefetch();
+  else
+  {
+    std::pair<uint64_t,uint64_t> task;
+
+    while( true )
+    {
+      // Get the next task from the root process
+      this->requestTask( task );
+
+      // Run the simulation batch
+      if( task.first != task.second )
+        this->runSimulationBatch( task.first, task.second );
+      else
+      {
+        // Rendezvous with the root process
+        if( task.first < 2 )
+          this->rendezvous();
+
+        // The simulation is complete
+        if( task.first > 0 )
+          break;
+      }
     }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Worker process " << d_comm->rank() <<
-                             " unable to receive work from root process!" );
+  }
+}
+
+// Complete assigned work (prefetch the next task)
+/*! \details This method will only be used in root process transport mode.
+ * Since the root process can only answer a request between the histories
+ * that it simulates, the next task will be requested from the root process
+ * before the current task is simulated (prefetched) so that the worker does
+ * not have to wait on the root process between batches. Each worker still
+ * has exactly one outstanding request, which keeps the stop/rendezvous
+ * protocol unchanged.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::workWithTaskPrefetch()
+{
+  std::pair<uint64_t,uint64_t> task, next_task;
+
+  int idle_message = 1;
 
+  // Get the first task from the root process
+  this->requestTask( task );
+  
+  while( true )
+  {
     // Run the simulation batch
     if( task.first != task.second )
+    {
+      std::vector<Utility::Communicator::Request> requests;
+
+      // Request the next task from the root process
+      try{
+        requests.push_back( Utility::isend( *d_comm, 0, 0, idle_message ) );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Worker process " << d_comm->rank() <<
+                               " unable to request work from root process!" );
+
+      try{
+        requests.push_back( Utility::ireceive( *d_comm, 0, 0, next_task ) );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Worker process " << d_comm->rank() <<
+                               " unable to receive work from root process!" );
+      
       this->runSimulationBatch( task.first, task.second );
+
+      // Wait for the next task
+      std::vector<Utility::Communicator::Status> statuses( requests.size() );
+
+      Utility::wait( requests, statuses );
+
+      task = next_task;
+    }
     else
     {
       // Rendezvous with the root process
@@ -348,10 +506,37 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
       // The simulation is complete
       if( task.first > 0 )
         break;
+
+      // Get the next task from the root process
+      this->requestTask( task );
     }
   }
 }
 
+// Request a task from the root process
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::requestTask(
+                                   std::pair<uint64_t,uint64_t>& task ) const
+{
+  int idle_message = 1;
+
+  // Tell the root process that a new task can be done
+  try{
+    Utility::send( *d_comm, 0, 0, idle_message );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Worker process " << d_comm->rank() <<
+                           " unable to request work from root process!" );
+
+  // Get the task from the root process
+  try{
+    Utility::receive( *d_comm, 0, 0, task );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Worker process " << d_comm->rank() <<
+                           " unable to receive work from root process!" );
+}
+
 // Print the simulation data to the desired stream
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::printSimulationSummary( std::ostream& os ) const
@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <csignal>
 #include <fstream>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManager.hpp"
@@ -413,6 +414,8 @@ void ParticleSimulationManager::runSimulation()
   // The simulation has finished
   this->registerSimulationStoppedEvent();
 
+  this->logThreadLoadBalance();
+
   if( !d_end_simulation && !d_exit_simulation )
   {
     FRENSIE_LOG_NOTIFICATION( "Simulation finished. " );
@@ -456,6 +459,30 @@ void ParticleSimulationManager::runInterruptibleSimulation()
   }
 }
 
+// Sample the thick-target bremsstrahlung photons of an untracked electron
+/*! \details This should only be called for electrons that will not be
+ * transported in the particle mode (the electron state will not be
+ * modified). The photons will only be sampled if thick-target bremsstrahlung
+ * mode is on and the electron is in a non-void cell.
+ */
+void ParticleSimulationManager::simulateThickTargetBremsstrahlung(
+                                                const ParticleState& electron,
+                                                ParticleBank& bank ) const
+{
+  // Make sure the particle is an electron
+  testPrecondition( electron.getParticleType() == ELECTRON );
+
+  if( d_properties->isThickTargetBremsstrahlungModeOn() &&
+      electron.isEmbeddedInModel( *d_model ) &&
+      !d_model->isCellVoid<PhotonState>( electron.getCell() ) )
+  {
+    static_cast<const FilledPhotonGeometryModel&>( *d_model ).getMaterial( electron.getCell() )->sampleThickTargetBremsstrahlungPhotons(
+                                              electron,
+                                              d_properties->getMinPhotonEnergy(),
+                                              bank );
+  }
+}
+
 // Get the collision forcer
 const CollisionForcer& ParticleSimulationManager::getCollisionForcer() const
 {
@@ -471,8 +498,25 @@ void ParticleSimulationManager::enableThreadSupport()
   // Enable source thread support
   d_source->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 
+  // Each thread has a batch of histories in flight in event-based mode
+  if( d_properties->isEventBasedTransportModeOn() )
+  {
+    ParticleHistoryObserver::setNumberOfHistoriesInFlightPerThread(
+                      Utility::OpenMPProperties::getRequestedNumberOfThreads(),
+                      d_properties->getEventBasedHistoryBatchSize() );
+  }
+  else
+  {
+    ParticleHistoryObserver::setNumberOfHistoriesInFlightPerThread(
+                      Utility::OpenMPProperties::getRequestedNumberOfThreads(),
+                      1 );
+  }
+
   // Enable event handler thread support
   d_event_handler->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Enable population controller thread support
+  d_population_controller->enableDiscretizationThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 }
 
 // Reset data
@@ -613,10 +657,43 @@ void ParticleSimulationManager::runSimulationBatch(
     
     // Micro batch complete - take a snapshot of the observer states
     d_event_handler->takeSnapshotOfObserverStates();
+
+    this->handleMicroBatchCompletion();
   }
 }
 
+// Handle the completion of a micro batch
+/*! \details This method will be called outside of any parallel region after
+ * each micro batch has been completed and its observer snapshot has been
+ * taken. It does nothing by default. Distributed managers can override it to
+ * do work that must be interleaved with the simulation (e.g. servicing work
+ * requests from other processes).
+ */
+void ParticleSimulationManager::handleMicroBatchCompletion()
+{ /* ... */ }
+
+// Handle the completion of a history on the master thread
+/*! \details This method will only be called by the master thread inside of
+ * the micro batch parallel region after each history (or event-based track
+ * batch) that it completes. It does nothing by default. Distributed managers
+ * can override it to service requests from other processes while the
+ * simulation is in progress (the MPI threading support level must be at
+ * least funneled when more than one thread is used).
+ */
+void ParticleSimulationManager::handleMasterThreadHistoryCompletion()
+{ /* ... */ }
+
 // Run the simulation micro batch
+/*! \details The histories are distributed to the threads using the history
+ * schedule (and chunk size) specified in the simulation properties. A
+ * dynamic or guided schedule should be used when the cost of a history
+ * varies significantly (e.g. deep penetration or variance reduction
+ * problems) since the threads will request more histories as they finish
+ * their current ones. The results do not depend on the schedule since the
+ * random number generator is initialized using the history number. The time
+ * that each thread spends simulating histories and waiting for the other
+ * threads to finish will be recorded.
+ */
 void ParticleSimulationManager::runSimulationMicroBatch(
                                             const uint64_t batch_start_history,
                                             const uint64_t batch_end_history )
@@ -624,74 +701,339 @@ void ParticleSimulationManager::runSimulationMicroBatch(
   // Make sure the history range is valid
   testPrecondition( batch_start_history < batch_end_history );
 
-  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  const unsigned number_of_threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  // Create the collision scratch banks for each thread (the banks will keep
+  // their storage between micro batches)
+  d_thread_collision_banks.resize( number_of_threads );
+
+  // Create the ray navigators used by the next-event estimators for each
+  // thread (the navigators will also be reused between micro batches)
+  while( d_thread_ray_navigators.size() < number_of_threads )
+  {
+    d_thread_ray_navigators.push_back(
+                           d_model->getUnfilledModel().createNavigator() );
+  }
+
+  d_thread_busy_times.resize( number_of_threads, 0.0 );
+  d_thread_idle_times.resize( number_of_threads, 0.0 );
+
+  // Set the schedule that will be used to distribute the histories
+  switch( d_properties->getHistoryScheduleType() )
   {
+  case DYNAMIC_HISTORY_SCHEDULE:
+  {
+    Utility::OpenMPProperties::setRuntimeSchedule(
+                           Utility::OpenMPProperties::DYNAMIC_SCHEDULE,
+                           d_properties->getHistoryScheduleChunkSize() );
+    break;
+  }
+  case GUIDED_HISTORY_SCHEDULE:
+  {
+    Utility::OpenMPProperties::setRuntimeSchedule(
+                           Utility::OpenMPProperties::GUIDED_SCHEDULE,
+                           d_properties->getHistoryScheduleChunkSize() );
+    break;
+  }
+  default:
+  {
+    Utility::OpenMPProperties::setRuntimeSchedule(
+                           Utility::OpenMPProperties::STATIC_SCHEDULE,
+                           d_properties->getHistoryScheduleChunkSize() );
+  }
+  }
+
+  #pragma omp parallel num_threads( number_of_threads )
+  {
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
     // Create a bank for each thread
     ParticleBank source_bank, bank;
 
-    #pragma omp for
-    for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+    // Create the event-based transport data for each thread
+    ParticleGeneration generation;
+    EventBasedTrackBatch track_batch;
+
+    // Create the load balance timers for each thread
+    std::shared_ptr<Utility::Timer> loop_timer =
+      Utility::OpenMPProperties::createTimer();
+
+    std::shared_ptr<Utility::Timer> busy_timer =
+      Utility::OpenMPProperties::createTimer();
+
+    loop_timer->start();
+    busy_timer->start();
+    busy_timer->stop();
+
+    if( d_properties->isEventBasedTransportModeOn() )
     {
-      // End the simulation if requested (by the signal handler)
-      // Note: Conformal OpenMP code cannot have a break statement. Therefore
-      //       we will simply loop through remaining histories without doing
-      //       anything if the simulation needs to be ended.
-      if( d_exit_simulation )
-        continue;
-
-      // Initialize the random number generator for this history
-      Utility::RandomNumberGenerator::initialize( history );
-
-      // Sample a particle state from the source
-      try{
-        d_source->sampleParticleState( source_bank, history );
-      }
-      catch( const Geometry::GeometryError& exception )
-      {
-        LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+      // Each thread transports the histories of a track batch together
+      const uint64_t track_batch_size =
+        d_properties->getEventBasedHistoryBatchSize();
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+      const uint64_t number_of_track_batches =
+        (batch_end_history - batch_start_history + track_batch_size - 1)/
+        track_batch_size;
 
-        continue;
-      }
-      catch( const std::runtime_error& exception )
+      #pragma omp for schedule( runtime )
+      for( uint64_t i = 0; i < number_of_track_batches; ++i )
       {
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        // End the simulation if requested (by the signal handler)
+        if( d_exit_simulation )
+          continue;
 
-        continue;
+        const uint64_t first_history =
+          batch_start_history + i*track_batch_size;
+
+        busy_timer->resume();
+
+        this->simulateHistoriesEventBased(
+                   first_history,
+                   std::min( first_history + track_batch_size,
+                             batch_end_history ),
+                   source_bank,
+                   bank,
+                   generation,
+                   track_batch );
+
+        busy_timer->stop();
+
+        if( thread_id == 0 )
+          this->handleMasterThreadHistoryCompletion();
       }
-      // The source has likely been constructed incorrectly
-      catch( const std::logic_error& exception )
+    }
+    else
+    {
+      #pragma omp for schedule( runtime )
+      for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
       {
-        FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+        // End the simulation if requested (by the signal handler)
+        // Note: Conformal OpenMP code cannot have a break statement. Therefore
+        //       we will simply loop through remaining histories without doing
+        //       anything if the simulation needs to be ended.
+        if( d_exit_simulation )
+          continue;
+
+        busy_timer->resume();
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        this->simulateHistory( history, source_bank, bank );
 
-        d_exit_simulation = true;
+        busy_timer->stop();
 
-        continue;
+        if( thread_id == 0 )
+          this->handleMasterThreadHistoryCompletion();
       }
+    }
 
-      // Simulate the particles generated by the source first
-      while( source_bank.size() > 0 )
-      {
-        this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+    // All threads have finished the loop (implicit barrier)
+    loop_timer->stop();
 
-        source_bank.pop();
-      }
+    const double busy_time = busy_timer->elapsed().count();
 
-      // This history only ends when the particle bank is empty
-      while( bank.size() > 0 )
-      {
-        this->simulateUnresolvedParticle( bank.top(), bank, false );
+    d_thread_busy_times[thread_id] += busy_time;
+    d_thread_idle_times[thread_id] +=
+      std::max( loop_timer->elapsed().count() - busy_time, 0.0 );
+  }
+}
 
-        bank.pop();
-      }
+// Simulate a history
+void ParticleSimulationManager::simulateHistory( const uint64_t history,
+                                                 ParticleBank& source_bank,
+                                                 ParticleBank& bank )
+{
+  // Initialize the random number generator for this history
+  Utility::RandomNumberGenerator::initialize( history );
+
+  // Sample a particle state from the source
+  if( !this->sampleSourceParticleStates( history, source_bank ) )
+    return;
+
+  // Simulate the particles generated by the source first
+  while( source_bank.size() > 0 )
+  {
+    this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+
+    source_bank.pop();
+  }
+
+  // This history only ends when the particle bank is empty
+  while( bank.size() > 0 )
+  {
+    this->simulateUnresolvedParticle( bank.top(), bank, false );
+
+    bank.pop();
+  }
+
+  // History complete - commit all observer history contributions
+  d_event_handler->commitObserverHistoryContributions();
+}
+
+// Sample the source particle states of a history
+/*! \details If the source cannot be sampled the history will be skipped
+ * (false will be returned).
+ */
+bool ParticleSimulationManager::sampleSourceParticleStates(
+                                                   const uint64_t history,
+                                                   ParticleBank& source_bank )
+{
+  try{
+    d_source->sampleParticleState( source_bank, history );
+  }
+  catch( const Geometry::GeometryError& exception )
+  {
+    LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  // The source has likely been constructed incorrectly
+  catch( const std::logic_error& exception )
+  {
+    FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    d_exit_simulation = true;
+
+    return false;
+  }
+
+  return true;
+}
+
+// Get the time that each thread has spent simulating histories (s)
+const std::vector<double>& ParticleSimulationManager::getThreadBusyTimes() const
+{
+  return d_thread_busy_times;
+}
+
+// Get the time that each thread has spent waiting for other threads (s)
+/*! \details The idle time of a thread is the time that it spent waiting at
+ * the end of each micro batch for the other threads to finish their
+ * histories. Large idle times indicate that a dynamic or guided history
+ * schedule should be used.
+ */
+const std::vector<double>& ParticleSimulationManager::getThreadIdleTimes() const
+{
+  return d_thread_idle_times;
+}
+
+// Log the thread load balance
+void ParticleSimulationManager::logThreadLoadBalance() const
+{
+  if( d_thread_busy_times.size() > 1 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "Thread load balance ("
+                              << d_properties->getHistoryScheduleType()
+                              << "):" );
+
+    for( size_t i = 0; i < d_thread_busy_times.size(); ++i )
+    {
+      FRENSIE_LOG_NOTIFICATION( " Thread " << i << ": "
+                                << d_thread_busy_times[i] << "s busy, "
+                                << d_thread_idle_times[i] << "s idle" );
+    }
+  }
+}
+
+// Simulate a batch of histories using event-based transport
+/*! \details The particles generated by the source for every history in the
+ * batch make up the first generation. The particles created while simulating
+ * a generation make up the next generation. The batch ends when a generation
+ * is empty. Each history in the batch has its own observer history buffer so
+ * the contribution from every history can be committed separately once the
+ * batch is complete. The random number stream of the batch starts at the
+ * stream of its first history and runs through the streams of the other
+ * histories in the batch, which no other batch will use.
+ */
+void ParticleSimulationManager::simulateHistoriesEventBased(
+                                           const uint64_t first_history,
+                                           const uint64_t end_history,
+                                           ParticleBank& source_bank,
+                                           ParticleBank& bank,
+                                           ParticleGeneration& generation,
+                                           EventBasedTrackBatch& track_batch )
+{
+  // Make sure the batch is valid
+  testPrecondition( end_history > first_history );
+  testPrecondition( end_history - first_history <=
+                    ParticleHistoryObserver::getNumberOfHistoriesInFlightPerThread() );
+
+  // Initialize the random number generator for this batch
+  Utility::RandomNumberGenerator::initialize( first_history );
+
+  track_batch.first_history = first_history;
+  track_batch.sampled_histories.assign( end_history - first_history, 0 );
+
+  generation.clear();
+
+  // Sample the source particle states of every history in the batch
+  ParticleGeneration discarded_particles;
+
+  for( uint64_t history = first_history; history < end_history; ++history )
+  {
+    ParticleHistoryObserver::setObservedHistoryInFlight( history - first_history );
+
+    if( this->sampleSourceParticleStates( history, source_bank ) )
+    {
+      track_batch.sampled_histories[history - first_history] = 1;
+
+      source_bank.release( generation );
+    }
+    else
+    {
+      discarded_particles.clear();
+      source_bank.release( discarded_particles );
+    }
+  }
+
+  bool source_generation = true;
+
+  while( !generation.empty() )
+  {
+    this->simulateUnresolvedParticleGeneration( generation,
+                                                bank,
+                                                source_generation,
+                                                track_batch );
+
+    source_generation = false;
+
+    generation.clear();
+    bank.release( generation );
+  }
+
+  // Batch complete - commit all observer history contributions
+  for( uint64_t history = first_history; history < end_history; ++history )
+  {
+    if( track_batch.sampled_histories[history - first_history] )
+    {
+      ParticleHistoryObserver::setObservedHistoryInFlight( history - first_history );
 
-      // History complete - commit all observer history contributions
       d_event_handler->commitObserverHistoryContributions();
     }
   }
+
+  ParticleHistoryObserver::setObservedHistoryInFlight( 0 );
+}
+
+// Observe the in flight history that an event-based track belongs to
+void ParticleSimulationManager::observeEventBasedTrackHistory(
+                                const ParticleState& particle,
+                                const EventBasedTrackBatch& track_batch ) const
+{
+  // Make sure the particle belongs to the batch
+  testPrecondition( particle.getHistoryNumber() >= track_batch.first_history );
+
+  ParticleHistoryObserver::setObservedHistoryInFlight(
+                     particle.getHistoryNumber() - track_batch.first_history );
 }
 
 // The signal handler
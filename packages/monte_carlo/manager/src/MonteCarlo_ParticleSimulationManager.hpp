@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -108,6 +109,12 @@ public:
   //! Log the simulation data
   virtual void logSimulationSummary() const;
 
+  //! Get the time that each thread has spent simulating histories (s)
+  const std::vector<double>& getThreadBusyTimes() const;
+
+  //! Get the time that each thread has spent waiting for other threads (s)
+  const std::vector<double>& getThreadIdleTimes() const;
+
 protected:
 
   //! Constructor
@@ -137,12 +144,77 @@ protected:
   void runSimulationBatch( const uint64_t batch_start_history,
                            const uint64_t batch_end_history );
 
+  //! Handle the completion of a micro batch
+  virtual void handleMicroBatchCompletion();
+
+  //! Handle the completion of a history on the master thread
+  virtual void handleMasterThreadHistoryCompletion();
+
   //! Simulate an unresolved particle
   virtual void simulateUnresolvedParticle(
                                         ParticleState& unresolved_particle,
                                         ParticleBank& bank,
                                         const bool source_particle ) = 0;
 
+  //! The particle generation type
+  typedef std::vector<std::shared_ptr<ParticleState> > ParticleGeneration;
+
+  //! The tracks of a particle generation (event-based transport)
+  struct EventBasedTrackBatch
+  {
+    //! The first history in the batch
+    uint64_t first_history;
+
+    //! Records if the source was sampled for each history in the batch
+    std::vector<unsigned char> sampled_histories;
+
+    //! The particles (one track per particle)
+    std::vector<ParticleState*> particles;
+
+    //! The remaining optical path of each track
+    std::vector<double> remaining_optical_paths;
+
+    //! The total macroscopic cross section at the current track position
+    std::vector<double> total_macro_cross_sections;
+
+    //! The total macroscopic cross section cache of each track
+    std::vector<MacroscopicCrossSectionCache> cross_section_caches;
+
+    //! The distance to the collision site in the current cell
+    std::vector<double> distances_to_collision;
+
+    //! The distance to the next surface hit in the current cell
+    std::vector<double> distances_to_surface_hit;
+
+    //! The next surface hit
+    std::vector<Geometry::Model::EntityId> surfaces_hit;
+
+    //! The start point of each track (3 entries per track)
+    std::vector<double> track_start_points;
+
+    //! Records if the global subtrack ending event has been dispatched
+    std::vector<unsigned char> global_subtrack_ending_events_dispatched;
+
+    //! The tracks that are in flight
+    std::vector<size_t> active_tracks;
+
+    //! The tracks that will be in flight after the current stages
+    std::vector<size_t> next_active_tracks;
+
+    //! The tracks that will cross a surface in the current stage
+    std::vector<size_t> surface_crossing_tracks;
+
+    //! The tracks that will collide in the current stage
+    std::vector<size_t> colliding_tracks;
+  };
+
+  //! Simulate a generation of unresolved particles (event-based transport)
+  virtual void simulateUnresolvedParticleGeneration(
+                                        const ParticleGeneration& generation,
+                                        ParticleBank& bank,
+                                        const bool source_generation,
+                                        EventBasedTrackBatch& track_batch ) = 0;
+
   //! Simulate a resolved particle
   template<typename State>
   void simulateParticle( ParticleState& unresolved_particle,
@@ -155,6 +227,25 @@ protected:
                                     ParticleBank& bank,
                                     const bool source_particle );
 
+  //! Simulate a generation of resolved particles using event-based tracking
+  template<typename State>
+  void simulateParticleGeneration( const ParticleGeneration& generation,
+                                   ParticleBank& bank,
+                                   const bool source_generation,
+                                   EventBasedTrackBatch& track_batch );
+
+  //! Simulate a generation of resolved particles using the "alternative" tracking method
+  template<typename State>
+  void simulateParticleGenerationAlternative(
+                                        const ParticleGeneration& generation,
+                                        ParticleBank& bank,
+                                        const bool source_generation,
+                                        EventBasedTrackBatch& track_batch );
+
+  //! Sample the thick-target bremsstrahlung photons of an untracked electron
+  void simulateThickTargetBremsstrahlung( const ParticleState& electron,
+                                          ParticleBank& bank ) const;
+
   //! Get the collision forcer
   const CollisionForcer& getCollisionForcer() const;
 
@@ -210,6 +301,50 @@ private:
   void runSimulationMicroBatch( const uint64_t batch_start_history,
                                 const uint64_t batch_end_history );
 
+  // Simulate a history
+  void simulateHistory( const uint64_t history,
+                        ParticleBank& source_bank,
+                        ParticleBank& bank );
+
+  // Sample the source particle states of a history
+  bool sampleSourceParticleStates( const uint64_t history,
+                                   ParticleBank& source_bank );
+
+  // Log the thread load balance
+  void logThreadLoadBalance() const;
+
+  // Simulate a batch of histories using event-based transport
+  void simulateHistoriesEventBased( const uint64_t first_history,
+                                    const uint64_t end_history,
+                                    ParticleBank& source_bank,
+                                    ParticleBank& bank,
+                                    ParticleGeneration& generation,
+                                    EventBasedTrackBatch& track_batch );
+
+  // Observe the in flight history that an event-based track belongs to
+  void observeEventBasedTrackHistory(
+                               const ParticleState& particle,
+                               const EventBasedTrackBatch& track_batch ) const;
+
+  // Start a new event-based track for a particle that is still alive
+  template<typename State>
+  void startEventBasedParticleTrack( State& particle,
+                                     const size_t track,
+                                     const bool starting_from_source,
+                                     EventBasedTrackBatch& track_batch );
+
+  // Apply the cutoffs to a particle and start a new event-based track
+  template<typename State>
+  void continueEventBasedParticle( State& particle,
+                                   const size_t track,
+                                   EventBasedTrackBatch& track_batch );
+
+  // Finish an event-based track
+  template<typename State>
+  void finishEventBasedParticleTrack( State& particle,
+                                      const size_t track,
+                                      EventBasedTrackBatch& track_batch );
+
   // Simulate a resolved particle implementation
   template<typename State, typename SimulateParticleTrackMethod>
   void simulateParticleImpl( ParticleState& unresolved_particle,
@@ -253,7 +388,14 @@ private:
   void advanceParticleToCellBoundary(
                               State& particle,
                               const Geometry::Model::EntityId surface_to_cross,
-                              const double distance_to_surface );
+                              const double distance_to_surface,
+                              const double energy_loss = 0.0 );
+
+  // Relocate a particle that has been redirected on a cell boundary
+  template<typename State>
+  void relocateParticleOnCellBoundary(
+                             State& particle,
+                             const Geometry::Model::EntityId surface_crossed );
 
   // Advance a particle to a collision site
   template<typename State>
@@ -264,11 +406,23 @@ private:
                                const double track_start_position[3],
                                bool& global_subtrack_ending_event_dispatched );
 
+  // Dispatch a particle colliding global event
+  template<typename State>
+  void dispatchParticleCollidingGlobalEvent( const State& particle,
+                                             const bool source_emission );
+
   // Collide with the cell material
   template<typename State>
   void collideWithCellMaterial( State& particle,
                                 ParticleBank& bank );
 
+  // Collide with the cell material using the scratch banks
+  template<typename State>
+  void collideWithCellMaterial( State& particle,
+                                ParticleBank& bank,
+                                ParticleBank& local_bank,
+                                ParticleBank& split_particle_bank );
+
   // Conduct a basic rendezvous
   void basicRendezvous() const;
 
@@ -308,6 +462,18 @@ private:
   // The simulation properties
   std::shared_ptr<const SimulationProperties> d_properties;
 
+  // The collision scratch banks (local bank, split bank) of each thread
+  std::vector<std::pair<ParticleBank,ParticleBank> > d_thread_collision_banks;
+
+  // The ray navigators used by the next-event estimators of each thread
+  std::vector<std::shared_ptr<Geometry::Navigator> > d_thread_ray_navigators;
+
+  // The time that each thread has spent simulating histories (s)
+  std::vector<double> d_thread_busy_times;
+
+  // The time that each thread has spent waiting for other threads (s)
+  std::vector<double> d_thread_idle_times;
+
   // The next history to run
   uint64_t d_next_history;
 
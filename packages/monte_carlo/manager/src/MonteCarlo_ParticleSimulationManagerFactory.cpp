@@ -175,6 +175,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
  *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfBatchesPerProcessor()</li>
  *  <li>MonteCarlo::SimulationGeneralProperties::getNumberOfSnapshotsPerBatch()</li>
  *  <li>MonteCarlo::SimulationGeneralProperties::getSimulationWallTime()</li>
+ *  <li>MonteCarlo::SimulationGeneralProperties::isEventBasedTransportModeOn()</li>
+ *  <li>MonteCarlo::SimulationGeneralProperties::getEventBasedHistoryBatchSize()</li>
  * </ul>
  */
 ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
@@ -193,6 +195,14 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfBatchesPerProcessor( updated_general_props.getNumberOfBatchesPerProcessor() );
   const_cast<SimulationProperties&>( *d_properties ).setNumberOfSnapshotsPerBatch( updated_general_props.getNumberOfSnapshotsPerBatch() );
   const_cast<SimulationProperties&>( *d_properties ).setSimulationWallTime( updated_general_props.getSimulationWallTime() );
+
+  if( updated_general_props.isEventBasedTransportModeOn() )
+    const_cast<SimulationProperties&>( *d_properties ).setEventBasedTransportModeOn();
+  else
+    const_cast<SimulationProperties&>( *d_properties ).setHistoryBasedTransportModeOn();
+
+  const_cast<SimulationProperties&>( *d_properties ).setEventBasedHistoryBatchSize( updated_general_props.getEventBasedHistoryBatchSize() );
+
   Utility::OpenMPProperties::setNumberOfThreads( threads );
 
   // Update the completion criterion
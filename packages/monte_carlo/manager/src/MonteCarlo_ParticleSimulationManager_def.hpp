@@ -12,6 +12,14 @@
 // Std Lib Includes
 #include <functional>
 #include <type_traits>
+#include <algorithm>
+#include <limits>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_DesignByContract.hpp"
 
 //! Log lost particle details
 #define LOG_LOST_PARTICLE_DETAILS( particle )   \
@@ -126,6 +134,200 @@ struct RaySafetyHelper<State,typename std::enable_if<std::is_base_of<MonteCarlo:
   }
 };
 
+//! \brief The Condensed History Helper class
+template<typename State, typename Enabled=void>
+struct CondensedHistoryHelper
+{
+  //! Check if condensed history mode is on for the particle type
+  static inline bool isCondensedHistoryModeOn( const SimulationProperties& )
+  { return false; }
+
+  //! Return the condensed history step length in the particle's cell
+  static inline double getStepLength( const FilledGeometryModel&,
+                                      const SimulationProperties&,
+                                      const State& )
+  { return std::numeric_limits<double>::infinity(); }
+
+  //! Apply a condensed history step with the material in the cell
+  static inline void applyStep( const FilledGeometryModel&,
+                                const SimulationProperties&,
+                                const Geometry::Model::EntityId,
+                                State&,
+                                const double )
+  { /* ... */ }
+
+  //! Check if the particle stops over a partial step in the cell
+  static inline bool doesParticleStop( const FilledGeometryModel&,
+                                       const SimulationProperties&,
+                                       const Geometry::Model::EntityId,
+                                       const State&,
+                                       const double,
+                                       double& energy_loss )
+  {
+    energy_loss = 0.0;
+
+    return false;
+  }
+
+  //! Apply the deflection of a partial step with the material in the cell
+  static inline void applyDeflection( const FilledGeometryModel&,
+                                      const Geometry::Model::EntityId,
+                                      State&,
+                                      const double,
+                                      const double )
+  { /* ... */ }
+};
+
+//! \brief The Condensed History Helper class
+template<typename State>
+struct CondensedHistoryHelper<State,typename std::enable_if<std::is_same<MonteCarlo::ElectronState,State>::value>::type>
+{
+  //! Check if condensed history mode is on for the particle type
+  static inline bool isCondensedHistoryModeOn(
+                                       const SimulationProperties& properties )
+  { return properties.isCondensedHistoryModeOn(); }
+
+  //! Return the condensed history step length in the particle's cell
+  static inline double getStepLength( const FilledGeometryModel& model,
+                                      const SimulationProperties& properties,
+                                      const State& particle )
+  {
+    return static_cast<const FilledElectronGeometryModel&>( model ).getMaterial( particle.getCell() )->getCondensedHistoryStepLength(
+                   particle.getEnergy(),
+                   properties.getCondensedHistoryMaxEnergyLossFraction() );
+  }
+
+  //! Apply a condensed history step with the material in the cell
+  static inline void applyStep( const FilledGeometryModel& model,
+                                const SimulationProperties& properties,
+                                const Geometry::Model::EntityId cell,
+                                State& particle,
+                                const double step_length )
+  {
+    static_cast<const FilledElectronGeometryModel&>( model ).getMaterial( cell )->applyCondensedHistoryStep( particle, step_length );
+
+    // Check if the particle energy is below the cutoff
+    if( particle && particle.getEnergy() < properties.getMinElectronEnergy() )
+      particle.setAsGone();
+  }
+
+  /*! Check if the particle stops over a partial step in the cell
+   * \details The particle stops if it loses all of its energy or if its
+   * energy falls below the cutoff energy. The particle will not be modified.
+   */
+  static inline bool doesParticleStop( const FilledGeometryModel& model,
+                                       const SimulationProperties& properties,
+                                       const Geometry::Model::EntityId cell,
+                                       const State& particle,
+                                       const double step_length,
+                                       double& energy_loss )
+  {
+    energy_loss = static_cast<const FilledElectronGeometryModel&>( model ).getMaterial( cell )->getCondensedHistoryEnergyLoss( particle.getEnergy(), step_length );
+
+    return energy_loss >= particle.getEnergy() ||
+      particle.getEnergy() - energy_loss < properties.getMinElectronEnergy();
+  }
+
+  //! Apply the deflection of a partial step with the material in the cell
+  static inline void applyDeflection( const FilledGeometryModel& model,
+                                      const Geometry::Model::EntityId cell,
+                                      State& particle,
+                                      const double mean_energy,
+                                      const double step_length )
+  {
+    static_cast<const FilledElectronGeometryModel&>( model ).getMaterial( cell )->applyCondensedHistoryDeflection( particle, mean_energy, step_length );
+  }
+};
+
+//! \brief The Range Rejection Helper class
+template<typename State, typename Enabled=void>
+struct RangeRejectionHelper
+{
+  //! Terminate the particle if it cannot escape its cell
+  static inline void rejectParticle( const FilledGeometryModel&,
+                                     const SimulationProperties&,
+                                     State& )
+  { /* ... */ }
+};
+
+//! \brief The Range Rejection Helper class
+template<typename State>
+struct RangeRejectionHelper<State,typename std::enable_if<std::is_same<MonteCarlo::ElectronState,State>::value>::type>
+{
+  /*! Terminate the particle if it cannot escape its cell
+   * \details The electron will be terminated (its energy is deposited
+   * locally) if its CSDA range in the cell material is less than its ray
+   * safety distance (the electron cannot reach a boundary). Electrons with an
+   * energy at or above the bremsstrahlung guard energy are never terminated.
+   * The ray safety distance is not updated for this check, which is
+   * conservative since the stored distance never exceeds the true distance
+   * to the closest boundary.
+   */
+  static inline void rejectParticle( const FilledGeometryModel& model,
+                                     const SimulationProperties& properties,
+                                     State& particle )
+  {
+    if( properties.isElectronRangeRejectionModeOn() &&
+        particle.getEnergy() <
+        properties.getElectronRangeRejectionBremsstrahlungGuardEnergy() &&
+        !model.isCellVoid<State>( particle.getCell() ) )
+    {
+      const double csda_range =
+        static_cast<const FilledElectronGeometryModel&>( model ).getMaterial( particle.getCell() )->getCSDARange( particle.getEnergy() );
+
+      if( csda_range < particle.getRaySafetyDistance() )
+        particle.setAsGone();
+    }
+  }
+};
+
+//! \brief The Next Event Helper class
+template<typename State, typename Enabled=void>
+struct NextEventHelper
+{
+  //! Check if next-event estimation is supported for the particle type
+  static inline bool isNextEventEstimationSupported()
+  { return false; }
+
+  //! Evaluate the scattering densities of the cell material
+  static inline void evaluateScatteringDensities(
+                const FilledGeometryModel&,
+                const State&,
+                const double[3],
+                std::vector<std::pair<double,double> >& outgoing_energies_and_densities )
+  { outgoing_energies_and_densities.clear(); }
+};
+
+//! \brief The Next Event Helper class
+template<typename State>
+struct NextEventHelper<State,typename std::enable_if<std::is_same<MonteCarlo::PhotonState,State>::value>::type>
+{
+  //! Check if next-event estimation is supported for the particle type
+  static inline bool isNextEventEstimationSupported()
+  { return true; }
+
+  //! Evaluate the scattering densities of the cell material
+  static inline void evaluateScatteringDensities(
+                const FilledGeometryModel& model,
+                const State& particle,
+                const double direction[3],
+                std::vector<std::pair<double,double> >& outgoing_energies_and_densities )
+  {
+    double scattering_angle_cosine =
+      Utility::calculateCosineOfAngleBetweenVectors( particle.getDirection(),
+                                                     direction );
+
+    // Correct for round-off
+    scattering_angle_cosine =
+      std::max( -1.0, std::min( 1.0, scattering_angle_cosine ) );
+
+    static_cast<const FilledPhotonGeometryModel&>( model ).getMaterial( particle.getCell() )->evaluateNextEventScatteringDensities(
+                                          particle.getEnergy(),
+                                          scattering_angle_cosine,
+                                          outgoing_energies_and_densities );
+  }
+};
+
 } // end Details namespace
 
 // Simulate a resolved particle
@@ -237,6 +439,14 @@ void ParticleSimulationManager::simulateParticleImpl(
     // Roulette the particle if it is below the threshold weight
     d_weight_roulette->rouletteParticleWeight( particle );
 
+    // Terminate the particle if it cannot escape its cell
+    if( particle )
+    {
+      Details::RangeRejectionHelper<State>::rejectParticle( *d_model,
+                                                            *d_properties,
+                                                            particle );
+    }
+
     if( particle )
     {
       simulate_particle_track( particle,
@@ -247,6 +457,371 @@ void ParticleSimulationManager::simulateParticleImpl(
   }
 }
 
+// Simulate a generation of resolved particles using event-based tracking
+/*! \details Only the particles in the generation of type State will be
+ * simulated. The tracks of all of the particles are processed together one
+ * stage at a time (cross section lookup, distance to collision, ray trace,
+ * surface crossing and collision) until every particle is gone. Any
+ * particles that are created will be added to the bank (next generation).
+ * Forced collisions cannot be done with this tracking method. If condensed
+ * history mode is on for the particle type, the particles will be simulated
+ * one at a time.
+ */
+template<typename State>
+void ParticleSimulationManager::simulateParticleGeneration(
+                                        const ParticleGeneration& generation,
+                                        ParticleBank& bank,
+                                        const bool source_generation,
+                                        EventBasedTrackBatch& track_batch )
+{
+  // Condensed history steps cannot be broken into stages - simulate the
+  // particles one at a time
+  if( Details::CondensedHistoryHelper<State>::isCondensedHistoryModeOn( *d_properties ) )
+  {
+    for( size_t i = 0; i < generation.size(); ++i )
+    {
+      if( generation[i]->getParticleType() == State::type && *generation[i] )
+      {
+        this->observeEventBasedTrackHistory( *generation[i], track_batch );
+
+        this->simulateParticle<State>( *generation[i],
+                                       bank,
+                                       source_generation );
+      }
+    }
+
+    return;
+  }
+
+  // Gather the particles of this type
+  track_batch.particles.clear();
+
+  for( size_t i = 0; i < generation.size(); ++i )
+  {
+    if( generation[i]->getParticleType() == State::type && *generation[i] )
+    {
+      // Make sure that the particle is embedded in the model
+      testPrecondition( generation[i]->isEmbeddedInModel( *d_model ) );
+
+      track_batch.particles.push_back( generation[i].get() );
+    }
+  }
+
+  const size_t number_of_tracks = track_batch.particles.size();
+
+  if( number_of_tracks == 0 )
+    return;
+
+  track_batch.remaining_optical_paths.resize( number_of_tracks );
+  track_batch.total_macro_cross_sections.resize( number_of_tracks );
+  track_batch.cross_section_caches.resize( number_of_tracks );
+  track_batch.distances_to_collision.resize( number_of_tracks );
+  track_batch.distances_to_surface_hit.resize( number_of_tracks );
+  track_batch.surfaces_hit.resize( number_of_tracks );
+  track_batch.track_start_points.resize( 3*number_of_tracks );
+  track_batch.global_subtrack_ending_events_dispatched.resize( number_of_tracks );
+
+  track_batch.active_tracks.clear();
+  track_batch.next_active_tracks.clear();
+
+  // Start the first track of each particle
+  for( size_t track = 0; track < number_of_tracks; ++track )
+  {
+    State& particle = static_cast<State&>( *track_batch.particles[track] );
+
+    this->observeEventBasedTrackHistory( particle, track_batch );
+
+    if( source_generation )
+    {
+      // Check if the particle energy is below the cutoff
+      if( particle.getEnergy() < d_properties->getMinParticleEnergy<State>() )
+      {
+        FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                             " born below global cutoff energy. Check source "
+                             "definition!\n" << particle );
+
+        particle.setAsGone();
+      }
+      // Check if the particle energy is above the max energy
+      else if( particle.getEnergy() > d_properties->getMaxParticleEnergy<State>() )
+      {
+        FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                             " born above global max energy. Check source "
+                             "definition!\n" << particle );
+
+        particle.setAsGone();
+      }
+      else
+      {
+        d_population_controller->checkParticleWithPopulationController( particle, bank );
+
+        this->startEventBasedParticleTrack( particle, track, true, track_batch );
+      }
+    }
+    else
+      this->continueEventBasedParticle( particle, track, track_batch );
+  }
+
+  track_batch.active_tracks.swap( track_batch.next_active_tracks );
+
+  // Process the tracks one stage at a time until all particles are gone
+  while( !track_batch.active_tracks.empty() )
+  {
+    // Cross section lookup stage
+    for( size_t i = 0; i < track_batch.active_tracks.size(); ++i )
+    {
+      const size_t track = track_batch.active_tracks[i];
+
+      const State& particle =
+        static_cast<const State&>( *track_batch.particles[track] );
+
+      if( !d_model->isCellVoid<State>( particle.getCell() ) )
+      {
+        track_batch.total_macro_cross_sections[track] =
+          d_model->getMacroscopicTotalForwardCrossSectionQuick(
+                                   particle,
+                                   track_batch.cross_section_caches[track] );
+      }
+      else
+        track_batch.total_macro_cross_sections[track] = 0.0;
+    }
+
+    // Distance to collision stage
+    for( size_t i = 0; i < track_batch.active_tracks.size(); ++i )
+    {
+      const size_t track = track_batch.active_tracks[i];
+
+      track_batch.distances_to_collision[track] =
+        track_batch.remaining_optical_paths[track]/
+        track_batch.total_macro_cross_sections[track];
+    }
+
+    // Ray trace stage
+    track_batch.surface_crossing_tracks.clear();
+    track_batch.colliding_tracks.clear();
+
+    for( size_t i = 0; i < track_batch.active_tracks.size(); ++i )
+    {
+      const size_t track = track_batch.active_tracks[i];
+
+      State& particle = static_cast<State&>( *track_batch.particles[track] );
+
+      this->observeEventBasedTrackHistory( particle, track_batch );
+
+      try{
+        track_batch.distances_to_surface_hit[track] =
+          Details::RaySafetyHelper<State>::getDistanceToSurfaceHit(
+                                   particle,
+                                   track_batch.surfaces_hit[track],
+                                   track_batch.distances_to_collision[track] );
+      }
+      CATCH_LOST_PARTICLE_AND_CONTINUE( particle, this->finishEventBasedParticleTrack( particle, track, track_batch ) );
+
+      // Convert the distance to the surface to optical path
+      const double op_to_surface_hit =
+        track_batch.distances_to_surface_hit[track]*
+        track_batch.total_macro_cross_sections[track];
+
+      if( op_to_surface_hit < track_batch.remaining_optical_paths[track] )
+        track_batch.surface_crossing_tracks.push_back( track );
+      else
+        track_batch.colliding_tracks.push_back( track );
+    }
+
+    // Surface crossing stage
+    for( size_t i = 0; i < track_batch.surface_crossing_tracks.size(); ++i )
+    {
+      const size_t track = track_batch.surface_crossing_tracks[i];
+
+      State& particle = static_cast<State&>( *track_batch.particles[track] );
+
+      this->observeEventBasedTrackHistory( particle, track_batch );
+
+      try{
+        this->advanceParticleToCellBoundary(
+                                 particle,
+                                 track_batch.surfaces_hit[track],
+                                 track_batch.distances_to_surface_hit[track] );
+      }
+      CATCH_LOST_PARTICLE_AND_CONTINUE( particle, this->finishEventBasedParticleTrack( particle, track, track_batch ) );
+
+      // The particle has exited the geometry
+      if( d_model->isTerminationCell( particle.getCell() ) )
+      {
+        particle.setAsGone();
+
+        this->finishEventBasedParticleTrack( particle, track, track_batch );
+
+        continue;
+      }
+
+      // Update the remaining track optical path
+      track_batch.remaining_optical_paths[track] -=
+        track_batch.distances_to_surface_hit[track]*
+        track_batch.total_macro_cross_sections[track];
+
+      // Set the ray safety distance to zero
+      particle.setRaySafetyDistance( 0.0 );
+
+      track_batch.next_active_tracks.push_back( track );
+    }
+
+    // Collision stage
+    for( size_t i = 0; i < track_batch.colliding_tracks.size(); ++i )
+    {
+      const size_t track = track_batch.colliding_tracks[i];
+
+      State& particle = static_cast<State&>( *track_batch.particles[track] );
+
+      this->observeEventBasedTrackHistory( particle, track_batch );
+
+      bool global_subtrack_ending_event_dispatched = false;
+
+      this->advanceParticleToCollisionSite(
+                        particle,
+                        track_batch.remaining_optical_paths[track],
+                        track_batch.distances_to_collision[track],
+                        &track_batch.track_start_points[3*track],
+                        global_subtrack_ending_event_dispatched );
+
+      track_batch.global_subtrack_ending_events_dispatched[track] =
+        global_subtrack_ending_event_dispatched;
+
+      // Update the particle's ray safety distance
+      Details::RaySafetyHelper<State>::updateRaySafetyDistance(
+                                   particle,
+                                   track_batch.distances_to_collision[track] );
+
+      this->collideWithCellMaterial( particle, bank );
+
+      // This track is finished
+      this->finishEventBasedParticleTrack( particle, track, track_batch );
+
+      // Start the next track of the particle
+      this->continueEventBasedParticle( particle, track, track_batch );
+    }
+
+    track_batch.active_tracks.swap( track_batch.next_active_tracks );
+    track_batch.next_active_tracks.clear();
+  }
+}
+
+// Simulate a generation of resolved particles using the "alternative" tracking method
+/*! \details Only the particles in the generation of type State will be
+ * simulated. The particles are simulated one at a time because the
+ * "alternative" tracking method (required for forced collisions) cannot be
+ * broken into stages. Any particles that are created will be added to the
+ * bank (next generation).
+ */
+template<typename State>
+void ParticleSimulationManager::simulateParticleGenerationAlternative(
+                                        const ParticleGeneration& generation,
+                                        ParticleBank& bank,
+                                        const bool source_generation,
+                                        EventBasedTrackBatch& track_batch )
+{
+  for( size_t i = 0; i < generation.size(); ++i )
+  {
+    if( generation[i]->getParticleType() == State::type && *generation[i] )
+    {
+      this->observeEventBasedTrackHistory( *generation[i], track_batch );
+
+      this->simulateParticleAlternative<State>( *generation[i],
+                                                bank,
+                                                source_generation );
+    }
+  }
+}
+
+// Start a new event-based track for a particle that is still alive
+template<typename State>
+void ParticleSimulationManager::startEventBasedParticleTrack(
+                                          State& particle,
+                                          const size_t track,
+                                          const bool starting_from_source,
+                                          EventBasedTrackBatch& track_batch )
+{
+  track_batch.remaining_optical_paths[track] =
+    d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+
+  track_batch.track_start_points[3*track] = particle.getXPosition();
+  track_batch.track_start_points[3*track+1] = particle.getYPosition();
+  track_batch.track_start_points[3*track+2] = particle.getZPosition();
+
+  track_batch.global_subtrack_ending_events_dispatched[track] = false;
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+
+    this->dispatchParticleCollidingGlobalEvent( particle, true );
+  }
+
+  track_batch.next_active_tracks.push_back( track );
+}
+
+// Apply the cutoffs to a particle and start a new event-based track
+template<typename State>
+void ParticleSimulationManager::continueEventBasedParticle(
+                                          State& particle,
+                                          const size_t track,
+                                          EventBasedTrackBatch& track_batch )
+{
+  if( particle )
+  {
+    // Check if the particle energy is below the cutoff
+    if( particle.getEnergy() < d_properties->getMinParticleEnergy<State>() )
+    {
+      particle.setAsGone();
+
+      return;
+    }
+    // Check if the particle energy is above the max energy
+    if( particle.getEnergy() > d_properties->getMaxParticleEnergy<State>() )
+    {
+      particle.setAsGone();
+
+      return;
+    }
+
+    // Roulette the particle if it is below the threshold weight
+    d_weight_roulette->rouletteParticleWeight( particle );
+
+    // Terminate the particle if it cannot escape its cell
+    if( particle )
+    {
+      Details::RangeRejectionHelper<State>::rejectParticle( *d_model,
+                                                            *d_properties,
+                                                            particle );
+    }
+
+    if( particle )
+      this->startEventBasedParticleTrack( particle, track, false, track_batch );
+  }
+}
+
+// Finish an event-based track
+template<typename State>
+void ParticleSimulationManager::finishEventBasedParticleTrack(
+                                          State& particle,
+                                          const size_t track,
+                                          EventBasedTrackBatch& track_batch )
+{
+  if( !track_batch.global_subtrack_ending_events_dispatched[track] )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                   particle,
+                                   &track_batch.track_start_points[3*track],
+                                   particle.getPosition() );
+  }
+
+  if( !particle )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+}
+
 // Simulate an unresolved particle track
 template<typename State>
 void ParticleSimulationManager::simulateUnresolvedParticleTrack(
@@ -264,6 +839,9 @@ void ParticleSimulationManager::simulateUnresolvedParticleTrack(
 // Simulate a resolved particle track
 // Note: Forced collisions cannot be done with this tracking method. Use the
 //       "alternative" tracking method when forced collisions are requested.
+//       If condensed history mode is on for the particle type, the track
+//       will be broken into condensed history steps. The soft collisions
+//       are applied at the end of each step (and at each surface crossing).
 template<typename State>
 void ParticleSimulationManager::simulateParticleTrack(
                                               State& particle,
@@ -289,15 +867,28 @@ void ParticleSimulationManager::simulateParticleTrack(
   // Cell information
   double cell_total_macro_cross_section;
 
+  // The cell total macroscopic cross section cache (only reevaluated when
+  // the cell material or the particle energy changes)
+  MacroscopicCrossSectionCache cross_section_cache;
+
   // Records if global subtrack ending event has been dispatched
   bool global_subtrack_ending_event_dispatched = false;
 
+  // Condensed history information
+  const bool condensed_history_mode_on =
+    Details::CondensedHistoryHelper<State>::isCondensedHistoryModeOn( *d_properties );
+
+  double condensed_history_step_length =
+    std::numeric_limits<double>::infinity();
+
   // If the particle started from a source point, update the relevant
   // particle entering cell event observers
   if( starting_from_source )
   {
     d_event_handler->updateObserversFromParticleEnteringCellEvent(
                                                 particle, particle.getCell() );
+
+    this->dispatchParticleCollidingGlobalEvent( particle, true );
   }
 
   // Ray trace until the necessary number of optical paths have been traveled
@@ -307,30 +898,126 @@ void ParticleSimulationManager::simulateParticleTrack(
     if( !d_model->isCellVoid<State>( particle.getCell() ) )
     {
       cell_total_macro_cross_section =
-        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+        d_model->getMacroscopicTotalForwardCrossSectionQuick(
+                                               particle, cross_section_cache );
+
+      if( condensed_history_mode_on )
+      {
+        condensed_history_step_length =
+          Details::CondensedHistoryHelper<State>::getStepLength( *d_model,
+                                                                 *d_properties,
+                                                                 particle );
+      }
     }
     else
+    {
       cell_total_macro_cross_section = 0.0;
 
+      condensed_history_step_length = std::numeric_limits<double>::infinity();
+    }
+
     double cell_distance_to_collision = remaining_track_op/cell_total_macro_cross_section;
 
     // Fire a ray through the cell currently containing the particle
     try{
       distance_to_surface_hit =
-        Details::RaySafetyHelper<State>::getDistanceToSurfaceHit( particle, surface_hit, cell_distance_to_collision );
+        Details::RaySafetyHelper<State>::getDistanceToSurfaceHit(
+                                       particle,
+                                       surface_hit,
+                                       std::min( cell_distance_to_collision,
+                                                 condensed_history_step_length ) );
     }
     CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
     // Convert the distance to the surface to optical path
     op_to_surface_hit = distance_to_surface_hit*cell_total_macro_cross_section;
 
+    // The condensed history step ends in this cell before the next
+    // surface crossing or collision
+    if( condensed_history_step_length < distance_to_surface_hit &&
+        condensed_history_step_length < cell_distance_to_collision )
+    {
+      this->advanceParticleToCollisionSite( particle,
+                                            condensed_history_step_length*
+                                            cell_total_macro_cross_section,
+                                            condensed_history_step_length,
+                                            track_start_point,
+                                            global_subtrack_ending_event_dispatched );
+
+      // Apply the soft collisions
+      Details::CondensedHistoryHelper<State>::applyStep( *d_model,
+                                                         *d_properties,
+                                                         particle.getCell(),
+                                                         particle,
+                                                         condensed_history_step_length );
+
+      // Update the particle's ray safety distance
+      Details::RaySafetyHelper<State>::updateRaySafetyDistance(
+                                               particle,
+                                               condensed_history_step_length );
+
+      if( !particle )
+        break;
+
+      // Update the remaining subtrack mfp
+      remaining_track_op -=
+        condensed_history_step_length*cell_total_macro_cross_section;
+
+      // Start a new subtrack from the end of the step
+      track_start_point[0] = particle.getXPosition();
+      track_start_point[1] = particle.getYPosition();
+      track_start_point[2] = particle.getZPosition();
+
+      global_subtrack_ending_event_dispatched = false;
+
+      subtrack_starting_from_source_point = false;
+      subtrack_starting_from_cell_boundary = false;
+    }
+
     // The particle passes through this cell to the next
-    if( op_to_surface_hit < remaining_track_op )
+    else if( op_to_surface_hit < remaining_track_op )
     {
+      const Geometry::Model::EntityId start_cell = particle.getCell();
+
+      const double start_energy = particle.getEnergy();
+
+      // The soft collisions that occur before the surface is reached
+      const bool condensed_history_step_taken =
+        condensed_history_mode_on &&
+        condensed_history_step_length < std::numeric_limits<double>::infinity();
+
+      double condensed_history_energy_loss = 0.0;
+
+      if( condensed_history_step_taken )
+      {
+        // The particle stops in this cell (its remaining energy is
+        // deposited in this cell)
+        if( Details::CondensedHistoryHelper<State>::doesParticleStop(
+                                        *d_model,
+                                        *d_properties,
+                                        start_cell,
+                                        particle,
+                                        distance_to_surface_hit,
+                                        condensed_history_energy_loss ) )
+        {
+          this->advanceParticleToCollisionSite( particle,
+                                                op_to_surface_hit,
+                                                distance_to_surface_hit,
+                                                track_start_point,
+                                                global_subtrack_ending_event_dispatched );
+
+          particle.setAsGone();
+
+          break;
+        }
+      }
+
+      // The energy loss is applied before the particle leaves the cell
       try{
         this->advanceParticleToCellBoundary( particle,
                                              surface_hit,
-                                             distance_to_surface_hit );
+                                             distance_to_surface_hit,
+                                             condensed_history_energy_loss );
       }
       CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
@@ -342,6 +1029,32 @@ void ParticleSimulationManager::simulateParticleTrack(
         break;
       }
 
+      // Deflect the particle on the surface. The deflection can turn the
+      // particle back toward the cell that it just left so the cell that
+      // contains the particle must be found again.
+      if( condensed_history_step_taken )
+      {
+        Details::CondensedHistoryHelper<State>::applyDeflection(
+                           *d_model,
+                           start_cell,
+                           particle,
+                           start_energy - 0.5*condensed_history_energy_loss,
+                           distance_to_surface_hit );
+
+        try{
+          this->relocateParticleOnCellBoundary( particle, surface_hit );
+        }
+        CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+        // The particle has exited the geometry
+        if( d_model->isTerminationCell( particle.getCell() ) )
+        {
+          particle.setAsGone();
+
+          break;
+        }
+      }
+
       // Update the remaining subtrack mfp
       remaining_track_op -= op_to_surface_hit;
 
@@ -368,6 +1081,20 @@ void ParticleSimulationManager::simulateParticleTrack(
                                                   particle,
                                                   cell_distance_to_collision );
 
+      // Apply the soft collisions that occur before the hard collision
+      if( condensed_history_mode_on &&
+          condensed_history_step_length < std::numeric_limits<double>::infinity() )
+      {
+        Details::CondensedHistoryHelper<State>::applyStep( *d_model,
+                                                           *d_properties,
+                                                           particle.getCell(),
+                                                           particle,
+                                                           cell_distance_to_collision );
+
+        if( !particle )
+          break;
+      }
+
       this->collideWithCellMaterial( particle, bank );
 
       // This track is finished
@@ -433,6 +1160,10 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
   // Cell information
   double cell_total_macro_cross_section;
 
+  // The cell total macroscopic cross section cache (only reevaluated when
+  // the cell material or the particle energy changes)
+  MacroscopicCrossSectionCache cross_section_cache;
+
   // Records if global subtrack ending event has been dispatched
   bool global_subtrack_ending_event_dispatched = false;
 
@@ -442,6 +1173,8 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
   {
     d_event_handler->updateObserversFromParticleEnteringCellEvent(
                                                 particle, particle.getCell() );
+
+    this->dispatchParticleCollidingGlobalEvent( particle, true );
   }
 
   // Ray trace until a collision occurs
@@ -457,7 +1190,8 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     if( !d_model->isCellVoid<State>( particle.getCell() ) )
     {
       cell_total_macro_cross_section =
-        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+        d_model->getMacroscopicTotalForwardCrossSectionQuick(
+                                               particle, cross_section_cache );
 
       // Only consider a forced collision cell if the subtrack is starting from
       // the source or from a cell boundary
@@ -569,11 +1303,16 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
 }
 
 // Advance a particle to the cell boundary
+/*! \details The energy loss (e.g. continuous soft collision energy loss) will
+ * be subtracted from the particle energy after the subtrack ending in cell
+ * event and before the particle leaving cell event have been dispatched.
+ */
 template<typename State>
 void ParticleSimulationManager::advanceParticleToCellBoundary(
                               State& particle,
                               const Geometry::Model::EntityId surface_to_cross,
-                              const double distance_to_surface )
+                              const double distance_to_surface,
+                              const double energy_loss )
 {
   // Advance the particle to the cell boundary
   // Note: this will change the particle's cell
@@ -588,6 +1327,10 @@ void ParticleSimulationManager::advanceParticleToCellBoundary(
                                                          start_cell,
                                                          distance_to_surface );
 
+  // Apply the energy loss that occurred in the cell
+  if( energy_loss > 0.0 )
+    particle.setEnergy( particle.getEnergy() - energy_loss );
+
   // Update the observers: particle leaving cell event
   d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, start_cell );
 
@@ -610,6 +1353,47 @@ void ParticleSimulationManager::advanceParticleToCellBoundary(
   d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell() );
 }
 
+// Relocate a particle that has been redirected on a cell boundary
+/*! \details The cell that contains the particle will be found again using
+ * the current particle direction. If the particle now points into a
+ * different cell (e.g. back into the cell that it just left) the observers
+ * will be updated as if the particle had crossed the surface again.
+ */
+template<typename State>
+void ParticleSimulationManager::relocateParticleOnCellBoundary(
+                               State& particle,
+                               const Geometry::Model::EntityId surface_crossed )
+{
+  const Geometry::Model::EntityId current_cell = particle.getCell();
+
+  // Reset the navigator state (the cell will be found with the new direction)
+  particle.setPosition( particle.getXPosition(),
+                        particle.getYPosition(),
+                        particle.getZPosition() );
+
+  if( particle.getCell() != current_cell )
+  {
+    double surface_normal[3];
+
+    particle.navigator().getSurfaceNormal( surface_crossed,
+                                           particle.navigator().getPosition(),
+                                           particle.getDirection(),
+                                           surface_normal );
+
+    // Update the observers: particle leaving cell event
+    d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, current_cell );
+
+    // Update the observers: particle crossing surface event
+    d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
+                                                              particle,
+                                                              surface_crossed,
+                                                              surface_normal );
+
+    // Update the observers: particle entering cell event
+    d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell() );
+  }
+}
+
 // Advance a particle to a collision site
 template<typename State>
 void ParticleSimulationManager::advanceParticleToCollisionSite(
@@ -637,12 +1421,150 @@ void ParticleSimulationManager::advanceParticleToCollisionSite(
   global_subtrack_ending_event_dispatched = true;
 }
 
+// Dispatch a particle colliding global event
+/*! \details The next-event estimators will be updated with the expected
+ * contribution from the particle's emission (source emission or scattering
+ * from the cell material) toward each detector. Source emissions will only
+ * be considered if the source is isotropic, in which case the emission
+ * density is 1/(4pi). The optical depth to each detector is evaluated with
+ * the ray navigator of the calling thread (if no ray navigator has been
+ * created for the calling thread, a temporary navigator will be used).
+ */
+template<typename State>
+void ParticleSimulationManager::dispatchParticleCollidingGlobalEvent(
+                                                  const State& particle,
+                                                  const bool source_emission )
+{
+  if( !Details::NextEventHelper<State>::isNextEventEstimationSupported() )
+    return;
+
+  if( d_event_handler->getParticleCollidingGlobalEventDispatcher().getNumberOfObservers( particle.getParticleType() ) == 0 )
+    return;
+
+  if( source_emission && !d_source->isDirectionallyUniform() )
+    return;
+
+  ParticleCollidingGlobalEventObserver::EmissionDensityEvaluator
+    emission_density_evaluator;
+
+  if( source_emission )
+  {
+    emission_density_evaluator =
+      [&particle]( const double[3],
+                   ParticleCollidingGlobalEventObserver::EmissionDensityArray&
+                   outgoing_energies_and_densities )
+      {
+        outgoing_energies_and_densities.assign(
+             1, std::make_pair( particle.getEnergy(),
+                                0.25/Utility::PhysicalConstants::pi ) );
+      };
+  }
+  else
+  {
+    emission_density_evaluator =
+      [this,&particle]( const double direction[3],
+                        ParticleCollidingGlobalEventObserver::EmissionDensityArray&
+                        outgoing_energies_and_densities )
+      {
+        Details::NextEventHelper<State>::evaluateScatteringDensities(
+                                            *d_model,
+                                            particle,
+                                            direction,
+                                            outgoing_energies_and_densities );
+      };
+  }
+
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  std::shared_ptr<Geometry::Navigator> ray_navigator;
+
+  if( thread_id < d_thread_ray_navigators.size() )
+    ray_navigator = d_thread_ray_navigators[thread_id];
+  else
+    ray_navigator = d_model->getUnfilledModel().createNavigator();
+
+  ParticleCollidingGlobalEventObserver::OpticalDepthEvaluator
+    optical_depth_evaluator =
+    [this,&particle,&ray_navigator]( const double energy,
+                                     const double direction[3],
+                                     const double distance,
+                                     const double max_optical_depth )
+    {
+      try{
+        ray_navigator->setState(
+             Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( particle.getPosition() ),
+             direction,
+             particle.getCell() );
+
+        return ray_navigator->getOpticalDepthAlongRay(
+          Geometry::Navigator::Length::from_value( distance ),
+          [this,energy]( const Geometry::Model::EntityId cell )
+          {
+            if( d_model->isTerminationCell( cell ) )
+              return std::numeric_limits<double>::infinity();
+            else
+              return d_model->getMacroscopicTotalCrossSection<State>( cell, energy );
+          },
+          max_optical_depth );
+      }
+      // A contribution along a lost ray will not be made
+      catch( const std::runtime_error& )
+      {
+        return std::numeric_limits<double>::infinity();
+      }
+    };
+
+  d_event_handler->updateObserversFromParticleCollidingGlobalEvent(
+                                                  particle,
+                                                  emission_density_evaluator,
+                                                  optical_depth_evaluator );
+}
+
 // Collide with the cell material
+/*! \details The scratch banks that were created for the calling thread will be
+ * used to store the particles created in the collision so that no bank
+ * storage needs to be allocated after the first few collisions of a
+ * simulation. If no scratch banks have been created for the calling
+ * thread, temporary banks will be used instead.
+ */
 template<typename State>
 void ParticleSimulationManager::collideWithCellMaterial( State& particle,
                                                          ParticleBank& bank )
 {
-  ParticleBank local_bank;
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  if( thread_id < d_thread_collision_banks.size() )
+  {
+    this->collideWithCellMaterial( particle,
+                                   bank,
+                                   d_thread_collision_banks[thread_id].first,
+                                   d_thread_collision_banks[thread_id].second );
+  }
+  else
+  {
+    ParticleBank local_bank, split_particle_bank;
+
+    this->collideWithCellMaterial( particle,
+                                   bank,
+                                   local_bank,
+                                   split_particle_bank );
+  }
+}
+
+// Collide with the cell material using the scratch banks
+template<typename State>
+void ParticleSimulationManager::collideWithCellMaterial(
+                                           State& particle,
+                                           ParticleBank& bank,
+                                           ParticleBank& local_bank,
+                                           ParticleBank& split_particle_bank )
+{
+  // Make sure the scratch banks are empty
+  testPrecondition( local_bank.isEmpty() );
+  testPrecondition( split_particle_bank.isEmpty() );
+
+  // Update the next-event estimators before the collision
+  this->dispatchParticleCollidingGlobalEvent( particle, false );
 
   // Undergo a collision with the material in the cell
   try{
@@ -658,18 +1580,16 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
     d_population_controller->checkParticleWithPopulationController( particle, bank );
   }
 
+  std::shared_ptr<ParticleState> local_particle;
+
   while( !local_bank.isEmpty() )
   {
-    ParticleBank split_particle_bank;
-
     if( local_bank.top() )
     {
       d_population_controller->checkParticleWithPopulationController( local_bank.top(),
                                                                       split_particle_bank );
     }
 
-    std::shared_ptr<ParticleState> local_particle;
-
     local_bank.pop( local_particle );
 
     // If the particle wasn't terminated, add it to the bank
@@ -678,6 +1598,12 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
       bank.push( local_particle );
       bank.splice( split_particle_bank );
     }
+    // Discard the split particles so that the scratch bank can be reused
+    else
+    {
+      while( !split_particle_bank.isEmpty() )
+        split_particle_bank.pop();
+    }
   }
 }
 
@@ -55,6 +55,13 @@ protected:
                                    ParticleBank& bank,
                                    const bool source_particle ) final override;
 
+  //! Simulate a generation of unresolved particles (event-based transport)
+  void simulateUnresolvedParticleGeneration(
+                          const ParticleGeneration& generation,
+                          ParticleBank& bank,
+                          const bool source_generation,
+                          EventBasedTrackBatch& track_batch ) final override;
+
 private:
 
   // Add simulate particle function for particle type
@@ -73,6 +80,15 @@ private:
   SimulateParticleFunctionMap;
 
   SimulateParticleFunctionMap d_simulate_particle_function_map;
+
+  // The generation simulation functions (event-based transport)
+  typedef std::function<void(const ParticleGeneration&, ParticleBank&, const bool, EventBasedTrackBatch&)>
+  SimulateParticleGenerationFunction;
+
+  typedef std::map<ParticleType,SimulateParticleGenerationFunction>
+  SimulateParticleGenerationFunctionMap;
+
+  SimulateParticleGenerationFunctionMap d_simulate_particle_generation_function_map;
 };
   
 } // end MonteCarlo namespace
@@ -19,6 +19,7 @@
 #include "MonteCarlo_ParticleModeTypeTraits.hpp"
 #include "MonteCarlo_CollisionForcer.hpp"
 #include "MonteCarlo_StandardCollisionForcer.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
 
@@ -98,7 +99,58 @@ void StandardParticleSimulationManager<mode>::simulateUnresolvedParticle(
     simulation_function_it->second( unresolved_particle, bank, source_particle );
   }
   else
+  {
+    // Electrons that are not transported can still produce bremsstrahlung
+    if( unresolved_particle.getParticleType() == ELECTRON &&
+        d_simulate_particle_function_map.find( PHOTON ) !=
+        d_simulate_particle_function_map.end() )
+    {
+      this->simulateThickTargetBremsstrahlung( unresolved_particle, bank );
+    }
+
     unresolved_particle.setAsGone();
+  }
+}
+
+// Simulate a generation of unresolved particles (event-based transport)
+template<ParticleModeType mode>
+void StandardParticleSimulationManager<mode>::simulateUnresolvedParticleGeneration(
+                                        const ParticleGeneration& generation,
+                                        ParticleBank& bank,
+                                        const bool source_generation,
+                                        EventBasedTrackBatch& track_batch )
+{
+  // Only simulate the particles if there is a simulation function associated
+  // with the type
+  for( size_t i = 0; i < generation.size(); ++i )
+  {
+    if( d_simulate_particle_generation_function_map.find( generation[i]->getParticleType() ) ==
+        d_simulate_particle_generation_function_map.end() )
+    {
+      // Electrons that are not transported can still produce bremsstrahlung
+      if( generation[i]->getParticleType() == ELECTRON &&
+          d_simulate_particle_generation_function_map.find( PHOTON ) !=
+          d_simulate_particle_generation_function_map.end() )
+      {
+        this->simulateThickTargetBremsstrahlung( *generation[i], bank );
+      }
+
+      generation[i]->setAsGone();
+    }
+  }
+
+  typename SimulateParticleGenerationFunctionMap::const_iterator
+    simulation_function_it = d_simulate_particle_generation_function_map.begin();
+
+  while( simulation_function_it != d_simulate_particle_generation_function_map.end() )
+  {
+    simulation_function_it->second( generation,
+                                    bank,
+                                    source_generation,
+                                    track_batch );
+
+    ++simulation_function_it;
+  }
 }
 
 // Add simulate particle function for particle type
@@ -113,12 +165,27 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
 
   if( this->getCollisionForcer().hasForcedCollisionCells( particle_type ) )
   {
+    // Condensed history steps cannot be taken with the "alternative"
+    // tracking method
+    TEST_FOR_EXCEPTION( Details::CondensedHistoryHelper<State>::isCondensedHistoryModeOn( this->getSimulationProperties() ),
+                        std::runtime_error,
+                        "Forced collisions cannot be used when condensed "
+                        "history mode is on for " << particle_type << "s!" );
+
     d_simulate_particle_function_map[particle_type] =
       std::bind<void>( &ParticleSimulationManager::simulateParticleAlternative<State>,
                        std::ref( *this ),
                        std::placeholders::_1,
                        std::placeholders::_2,
                        std::placeholders::_3 );
+
+    d_simulate_particle_generation_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticleGenerationAlternative<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3,
+                       std::placeholders::_4 );
   }
   else
   {
@@ -128,6 +195,14 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
                        std::placeholders::_1,
                        std::placeholders::_2,
                        std::placeholders::_3 );
+
+    d_simulate_particle_generation_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticleGeneration<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3,
+                       std::placeholders::_4 );
   }
 }
 
@@ -757,6 +757,158 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run with root process transport mode off
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_root_process_transport_off )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+  const uint64_t number_of_histories =
+    (Utility::GlobalMPISession::size()-1)*100;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( number_of_histories );
+    properties->setMinNumberOfRendezvous( 2 );
+    properties->setNumberOfSnapshotsPerBatch( 2 );
+    properties->setRootProcessTransportModeOff();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+  
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+  
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+  
+    event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+  
+    manager = factory->getManager();
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  // Every history must be simulated exactly once
+  if( Utility::GlobalMPISession::rank() == 0 )
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), number_of_histories );
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(),
+                         number_of_histories );
+    FRENSIE_CHECK( manager->getNumberOfRendezvous() >= 2 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 0 );
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 0 );
+    FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run with root process transport mode on
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_root_process_transport_on )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+  const uint64_t number_of_histories =
+    (Utility::GlobalMPISession::size()-1)*100;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( number_of_histories );
+    properties->setMinNumberOfRendezvous( 2 );
+    properties->setNumberOfSnapshotsPerBatch( 2 );
+    properties->setRootProcessTransportModeOn();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+  
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+  
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+  
+    event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+  
+    manager = factory->getManager();
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  // Every history must be simulated exactly once
+  if( Utility::GlobalMPISession::rank() == 0 )
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), number_of_histories );
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(),
+                         number_of_histories );
+    FRENSIE_CHECK( manager->getNumberOfRendezvous() >= 2 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 0 );
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 0 );
+    FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle simulation summary can be printed
 FRENSIE_UNIT_TEST( ParticleSimulationManager, printSimulationSummary )
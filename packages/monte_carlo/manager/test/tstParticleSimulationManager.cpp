@@ -11,18 +11,24 @@
 #include <memory>
 #include <csignal>
 #include <functional>
+#include <atomic>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_ElectronState.hpp"
 #include "MonteCarlo_StandardParticleSource.hpp"
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_CellPulseHeightEstimator.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
+#include "Geometry_Navigator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 #include "FRENSIE_config.hpp"
@@ -35,6 +41,381 @@ using boost::units::si::kelvin;
 using boost::units::cgs::cubic_centimeter;
 using Utility::Units::MeV;
 
+//---------------------------------------------------------------------------//
+// Testing Structs
+//---------------------------------------------------------------------------//
+// A navigator for a thin slab (cell 2) between two half spaces (cells 1, 3)
+class SlabNavigator : public Geometry::Navigator
+{
+
+public:
+
+  // The slab thickness (cm)
+  static constexpr double slab_thickness = 0.01;
+
+  // The number of rays fired from a cell that the ray does not point into
+  static std::atomic<size_t> inconsistent_ray_count;
+
+  // The number of surface points relocated to a different cell
+  static std::atomic<size_t> relocation_count;
+
+  // The number of surface crossings
+  static std::atomic<size_t> crossing_count;
+
+  // Constructor
+  SlabNavigator( const AdvanceCompleteCallback& advance_complete_callback =
+                 AdvanceCompleteCallback() )
+    : Geometry::Navigator( advance_complete_callback ),
+      d_cell( Geometry::Navigator::invalidCellId() )
+  {
+    d_position[0] = Length::from_value( 0.0 );
+    d_position[1] = Length::from_value( 0.0 );
+    d_position[2] = Length::from_value( 0.0 );
+
+    d_direction[0] = 0.0;
+    d_direction[1] = 0.0;
+    d_direction[2] = 1.0;
+  }
+
+  // Get the cell that contains a point (the direction is used on surfaces)
+  static EntityId getCell( const double z_position, const double z_direction )
+  {
+    if( std::fabs( z_position ) <= 1e-9 )
+      return z_direction > 0.0 ? 2 : 1;
+    else if( std::fabs( z_position - slab_thickness ) <= 1e-9 )
+      return z_direction > 0.0 ? 3 : 2;
+    else if( z_position < 0.0 )
+      return 1;
+    else if( z_position < slab_thickness )
+      return 2;
+    else
+      return 3;
+  }
+
+  Geometry::PointLocation getPointLocation( const Length position[3],
+                                            const double direction[3],
+                                            const EntityId cell ) const override
+  {
+    if( SlabNavigator::getCell( position[2].value(), direction[2] ) == cell )
+      return Geometry::POINT_INSIDE_CELL;
+    else
+      return Geometry::POINT_OUTSIDE_CELL;
+  }
+
+  void getSurfaceNormal( const EntityId,
+                         const Length[3],
+                         const double direction[3],
+                         double normal[3] ) const override
+  {
+    normal[0] = 0.0;
+    normal[1] = 0.0;
+    normal[2] = direction[2] >= 0.0 ? 1.0 : -1.0;
+  }
+
+  EntityId findCellContainingRay( const Length position[3],
+                                  const double direction[3],
+                                  CellIdSet& found_cell_cache ) const override
+  {
+    EntityId cell = this->findCellContainingRay( position, direction );
+
+    found_cell_cache.insert( cell );
+
+    return cell;
+  }
+
+  EntityId findCellContainingRay( const Length position[3],
+                                  const double direction[3] ) const override
+  { return SlabNavigator::getCell( position[2].value(), direction[2] ); }
+
+  bool isStateSet() const override
+  { return d_cell != Geometry::Navigator::invalidCellId(); }
+
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction ) override
+  {
+    const EntityId cell =
+      SlabNavigator::getCell( z_position.value(), z_direction );
+
+    if( d_cell != Geometry::Navigator::invalidCellId() && cell != d_cell )
+      ++relocation_count;
+
+    this->setState( x_position, y_position, z_position,
+                    x_direction, y_direction, z_direction,
+                    cell );
+  }
+
+  void setState( const Length x_position,
+                 const Length y_position,
+                 const Length z_position,
+                 const double x_direction,
+                 const double y_direction,
+                 const double z_direction,
+                 const EntityId start_cell ) override
+  {
+    d_position[0] = x_position;
+    d_position[1] = y_position;
+    d_position[2] = z_position;
+
+    d_direction[0] = x_direction;
+    d_direction[1] = y_direction;
+    d_direction[2] = z_direction;
+
+    d_cell = start_cell;
+  }
+
+  using Geometry::Navigator::setState;
+
+  const Length* getPosition() const override
+  { return d_position; }
+
+  const double* getDirection() const override
+  { return d_direction; }
+
+  EntityId getCurrentCell() const override
+  { return d_cell; }
+
+  Length getDistanceToClosestBoundary() override
+  {
+    if( d_cell == 2 )
+    {
+      return Length::from_value(
+                           std::min( d_position[2].value(),
+                                     slab_thickness - d_position[2].value() ) );
+    }
+    else if( d_cell == 1 )
+      return Length::from_value( -d_position[2].value() );
+    else
+      return Length::from_value( d_position[2].value() - slab_thickness );
+  }
+
+  Length fireRay( EntityId* surface_hit ) override
+  {
+    if( SlabNavigator::getCell( d_position[2].value(), d_direction[2] ) != d_cell )
+      ++inconsistent_ray_count;
+
+    double surface_z;
+
+    if( d_direction[2] > 0.0 && d_cell < 3 )
+      surface_z = d_cell == 1 ? 0.0 : slab_thickness;
+    else if( d_direction[2] < 0.0 && d_cell > 1 )
+      surface_z = d_cell == 3 ? slab_thickness : 0.0;
+    else
+    {
+      if( surface_hit != NULL )
+        *surface_hit = Geometry::Navigator::invalidSurfaceId();
+
+      return Utility::QuantityTraits<Length>::inf();
+    }
+
+    if( surface_hit != NULL )
+      *surface_hit = surface_z == 0.0 ? 1 : 2;
+
+    return Length::from_value(
+            std::max( (surface_z - d_position[2].value())/d_direction[2], 0.0 ) );
+  }
+
+  void changeDirection( const double x_direction,
+                        const double y_direction,
+                        const double z_direction ) override
+  {
+    d_direction[0] = x_direction;
+    d_direction[1] = y_direction;
+    d_direction[2] = z_direction;
+  }
+
+  SlabNavigator* clone( const AdvanceCompleteCallback& advance_complete_callback ) const override
+  {
+    SlabNavigator* cloned_navigator =
+      new SlabNavigator( advance_complete_callback );
+
+    cloned_navigator->setState( d_position, d_direction, d_cell );
+
+    return cloned_navigator;
+  }
+
+  SlabNavigator* clone() const override
+  { return this->clone( AdvanceCompleteCallback() ); }
+
+protected:
+
+  bool advanceToCellBoundaryImpl( double* surface_normal,
+                                  Length& distance_traveled ) override
+  {
+    distance_traveled = this->fireRay( NULL );
+
+    this->advanceBySubstepImpl( distance_traveled );
+
+    // Snap the position to the surface and move to the next cell
+    if( d_direction[2] > 0.0 )
+    {
+      d_position[2] = Length::from_value( d_cell == 1 ? 0.0 : slab_thickness );
+      ++d_cell;
+    }
+    else
+    {
+      d_position[2] = Length::from_value( d_cell == 3 ? slab_thickness : 0.0 );
+      --d_cell;
+    }
+
+    if( surface_normal != NULL )
+      this->getSurfaceNormal( 0, d_position, d_direction, surface_normal );
+
+    ++crossing_count;
+
+    return false;
+  }
+
+  void advanceBySubstepImpl( const Length step_size ) override
+  {
+    d_position[0] += d_direction[0]*step_size;
+    d_position[1] += d_direction[1]*step_size;
+    d_position[2] += d_direction[2]*step_size;
+  }
+
+private:
+
+  // The cell that contains the internal ray
+  EntityId d_cell;
+
+  // The position
+  Length d_position[3];
+
+  // The direction
+  double d_direction[3];
+};
+
+std::atomic<size_t> SlabNavigator::inconsistent_ray_count( 0 );
+std::atomic<size_t> SlabNavigator::relocation_count( 0 );
+std::atomic<size_t> SlabNavigator::crossing_count( 0 );
+
+// A thin slab model (all cells are filled with material 1)
+class SlabModel : public Geometry::Model
+{
+
+public:
+
+  std::string getName() const override
+  { return "Slab"; }
+
+  bool hasCellEstimatorData() const override
+  { return false; }
+
+  void getMaterialIds( MaterialIdSet& material_ids ) const override
+  { material_ids.insert( 1 ); }
+
+  void getCells( CellIdSet& cell_set, const bool, const bool ) const override
+  { cell_set.insert( {1, 2, 3} ); }
+
+  void getCellMaterialIds( CellIdMatIdMap& cell_id_mat_id_map ) const override
+  {
+    for( EntityId cell = 1; cell <= 3; ++cell )
+      cell_id_mat_id_map[cell] = 1;
+  }
+
+  void getCellDensities( CellIdDensityMap& cell_id_density_map ) const override
+  {
+    for( EntityId cell = 1; cell <= 3; ++cell )
+      cell_id_density_map[cell] = -1.0/cubic_centimeter;
+  }
+
+  void getCellEstimatorData( CellEstimatorIdDataMap& ) const override
+  { /* ... */ }
+
+  bool doesCellExist( const EntityId cell ) const override
+  { return cell >= 1 && cell <= 3; }
+
+  bool isTerminationCell( const EntityId ) const override
+  { return false; }
+
+  bool isVoidCell( const EntityId ) const override
+  { return false; }
+
+  Volume getCellVolume( const EntityId ) const override
+  { return Utility::QuantityTraits<Volume>::inf(); }
+
+  SlabNavigator* createNavigatorAdvanced(
+                                    const Geometry::Navigator::AdvanceCompleteCallback&
+                                    advance_complete_callback ) const override
+  { return new SlabNavigator( advance_complete_callback ); }
+
+  SlabNavigator* createNavigatorAdvanced() const override
+  { return new SlabNavigator; }
+
+  bool isInitialized() const override
+  { return true; }
+
+protected:
+
+  void initializeJustInTime() override
+  { /* ... */ }
+};
+
+// An electron simulation manager with access to the particle simulation
+// methods
+class TestElectronSimulationManager : public MonteCarlo::StandardParticleSimulationManager<MonteCarlo::ELECTRON_MODE>
+{
+
+public:
+
+  // Constructor
+  TestElectronSimulationManager(
+          const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+          const std::shared_ptr<MonteCarlo::ParticleSource>& source,
+          const std::shared_ptr<MonteCarlo::EventHandler>& event_handler,
+          const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties )
+    : MonteCarlo::StandardParticleSimulationManager<MonteCarlo::ELECTRON_MODE>(
+                                    "test_slab_sim",
+                                    "xml",
+                                    model,
+                                    source,
+                                    event_handler,
+                                    MonteCarlo::PopulationControl::getDefault(),
+                                    MonteCarlo::CollisionForcer::getDefault(),
+                                    properties,
+                                    0ull,
+                                    0ull,
+                                    true )
+  { /* ... */ }
+
+  // Allow public access to the protected member functions
+  using MonteCarlo::StandardParticleSimulationManager<MonteCarlo::ELECTRON_MODE>::simulateUnresolvedParticle;
+};
+
+// A photon simulation manager with access to the particle simulation methods
+class TestPhotonSimulationManager : public MonteCarlo::StandardParticleSimulationManager<MonteCarlo::PHOTON_MODE>
+{
+
+public:
+
+  // Constructor
+  TestPhotonSimulationManager(
+          const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+          const std::shared_ptr<MonteCarlo::ParticleSource>& source,
+          const std::shared_ptr<MonteCarlo::EventHandler>& event_handler,
+          const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties )
+    : MonteCarlo::StandardParticleSimulationManager<MonteCarlo::PHOTON_MODE>(
+                                    "test_ttb_sim",
+                                    "xml",
+                                    model,
+                                    source,
+                                    event_handler,
+                                    MonteCarlo::PopulationControl::getDefault(),
+                                    MonteCarlo::CollisionForcer::getDefault(),
+                                    properties,
+                                    0ull,
+                                    0ull,
+                                    true )
+  { /* ... */ }
+
+  // Allow public access to the protected member functions
+  using MonteCarlo::StandardParticleSimulationManager<MonteCarlo::PHOTON_MODE>::simulateUnresolvedParticle;
+  using MonteCarlo::ParticleSimulationManager::simulateThickTargetBremsstrahlung;
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables
 //---------------------------------------------------------------------------//
@@ -924,6 +1305,208 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run using event-based transport
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_event_based )
+{
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( 5 );
+    properties->setEventBasedTransportModeOn();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    manager = factory->getManager();
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 5 );
+  FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the estimator results of an event-based simulation are
+// consistent with the estimator results of a history-based simulation
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_event_based_estimator_consistency )
+{
+  const uint64_t number_of_histories = 1000;
+
+  // Index 0: history-based, Index 1: event-based
+  std::vector<std::vector<double> > pulse_height_first_moments( 2 );
+  std::vector<std::vector<double> > pulse_height_second_moments( 2 );
+  std::vector<double> flux_first_moments( 2 );
+  std::vector<double> flux_second_moments( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( number_of_histories );
+
+    if( i == 1 )
+    {
+      properties->setEventBasedTransportModeOn();
+      properties->setEventBasedHistoryBatchSize( 16 );
+    }
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    // Every history deposits the full source energy (1 MeV) in the cell. If
+    // the contributions of histories transported in the same track batch
+    // were mixed the deposited energy would land in a higher energy bin.
+    std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator>
+      pulse_height_estimator(
+               new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                                              0, 1.0, std::vector<uint64_t>( 1, 1 ) ) );
+
+    pulse_height_estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>( std::vector<double>( {0.0, 0.5, 1.5, 3.0} ) );
+    pulse_height_estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+
+    event_handler->addEstimator( pulse_height_estimator );
+
+    std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+      flux_estimator(
+               new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                             1,
+                                             1.0,
+                                             std::vector<uint64_t>( 1, 1 ),
+                                             std::vector<double>( 1, 1.0 ) ) );
+
+    flux_estimator->setParticleTypes( std::vector<MonteCarlo::ParticleType>( 1, MonteCarlo::PHOTON ) );
+
+    event_handler->addEstimator( flux_estimator );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+      factory->getManager();
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), number_of_histories );
+
+    Utility::ArrayView<const double> first_moments =
+      pulse_height_estimator->getEntityBinDataFirstMoments( 1 );
+
+    Utility::ArrayView<const double> second_moments =
+      pulse_height_estimator->getEntityBinDataSecondMoments( 1 );
+
+    pulse_height_first_moments[i].assign( first_moments.begin(),
+                                          first_moments.end() );
+    pulse_height_second_moments[i].assign( second_moments.begin(),
+                                           second_moments.end() );
+
+    flux_first_moments[i] =
+      flux_estimator->getEntityBinDataFirstMoments( 1 ).front();
+    flux_second_moments[i] =
+      flux_estimator->getEntityBinDataSecondMoments( 1 ).front();
+  }
+
+  std::vector<double> expected_pulse_height_moments( {0.0, 1000.0, 0.0} );
+
+  FRENSIE_CHECK_EQUAL( pulse_height_first_moments[0],
+                       expected_pulse_height_moments );
+  FRENSIE_CHECK_EQUAL( pulse_height_second_moments[0],
+                       expected_pulse_height_moments );
+  FRENSIE_CHECK_EQUAL( pulse_height_first_moments[1],
+                       expected_pulse_height_moments );
+  FRENSIE_CHECK_EQUAL( pulse_height_second_moments[1],
+                       expected_pulse_height_moments );
+
+  // The event-based histories use different random number streams than the
+  // history-based histories so the mean fluxes will only agree statistically
+  const double n = number_of_histories;
+
+  std::vector<double> flux_means( 2 );
+  std::vector<double> flux_mean_variances( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    flux_means[i] = flux_first_moments[i]/n;
+    flux_mean_variances[i] =
+      (flux_second_moments[i]/n - flux_means[i]*flux_means[i])/(n - 1.0);
+  }
+
+  FRENSIE_CHECK( flux_means[0] > 0.0 );
+  FRENSIE_CHECK( flux_means[1] > 0.0 );
+  FRENSIE_CHECK_SMALL( flux_means[1] - flux_means[0],
+                       4.0*std::sqrt( flux_mean_variances[0] +
+                                      flux_mean_variances[1] ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a simulation can be run
 FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
@@ -1607,6 +2190,7 @@ FRENSIE_DATA_UNIT_TEST_DECL( ParticleSimulationManager,
   updated_properties.setMaxBatchSize( 10 );
   updated_properties.setNumberOfSnapshotsPerBatch( 3 );
   updated_properties.setSimulationWallTime( 1.0 );
+  updated_properties.setEventBasedTransportModeOn();
 
   std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
 
@@ -1634,6 +2218,257 @@ FRENSIE_DATA_UNIT_TEST_INST( ParticleSimulationManager, restart_updated_props )
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// Check that electrons that cannot escape their cell are terminated
+FRENSIE_UNIT_TEST( ParticleSimulationManager, electron_range_rejection )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::ELECTRON_MODE );
+  properties->setElectronRangeRejectionModeOn();
+  properties->setElectronRangeRejectionBremsstrahlungGuardEnergy( 0.5 );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  typedef MonteCarlo::Details::RangeRejectionHelper<MonteCarlo::ElectronState>
+    RangeRejectionHelper;
+
+  // The range is less than the safety distance
+  {
+    MonteCarlo::ElectronState electron( 0 );
+    electron.setEnergy( 1e-2 );
+    electron.embedInModel( *model );
+    electron.setRaySafetyDistance( 1.0 );
+
+    RangeRejectionHelper::rejectParticle( *model, *properties, electron );
+
+    FRENSIE_CHECK( electron.isGone() );
+  }
+
+  // The range is greater than the safety distance
+  {
+    MonteCarlo::ElectronState electron( 1 );
+    electron.setEnergy( 1e-2 );
+    electron.embedInModel( *model );
+    electron.setRaySafetyDistance( 1e-8 );
+
+    RangeRejectionHelper::rejectParticle( *model, *properties, electron );
+
+    FRENSIE_CHECK( !electron.isGone() );
+  }
+
+  // The energy is above the bremsstrahlung guard energy
+  {
+    MonteCarlo::ElectronState electron( 2 );
+    electron.setEnergy( 1.0 );
+    electron.embedInModel( *model );
+    electron.setRaySafetyDistance( 1e3 );
+
+    RangeRejectionHelper::rejectParticle( *model, *properties, electron );
+
+    FRENSIE_CHECK( !electron.isGone() );
+  }
+
+  // Range rejection is off
+  properties->setElectronRangeRejectionModeOff();
+
+  {
+    MonteCarlo::ElectronState electron( 3 );
+    electron.setEnergy( 1e-2 );
+    electron.embedInModel( *model );
+    electron.setRaySafetyDistance( 1.0 );
+
+    RangeRejectionHelper::rejectParticle( *model, *properties, electron );
+
+    FRENSIE_CHECK( !electron.isGone() );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that untracked electrons bank thick-target bremsstrahlung photons in
+// photon mode
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   simulateUnresolvedParticle_thick_target_bremsstrahlung )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setThickTargetBremsstrahlungModeOn();
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestPhotonSimulationManager manager( model,
+                                       source,
+                                       event_handler,
+                                       properties );
+
+  size_t number_of_photons = 0;
+
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    MonteCarlo::ElectronState electron( i );
+    electron.setEnergy( 1.0 );
+    electron.setDirection( 0.0, 0.0, 1.0 );
+    electron.embedInModel( *model );
+
+    MonteCarlo::ParticleBank bank;
+
+    manager.simulateUnresolvedParticle( electron, bank, false );
+
+    // The electron is not transported
+    FRENSIE_CHECK( electron.isGone() );
+
+    double total_photon_energy = 0.0;
+
+    while( !bank.isEmpty() )
+    {
+      FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+      FRENSIE_CHECK( bank.top().getEnergy() >=
+                     properties->getMinPhotonEnergy() );
+
+      total_photon_energy += bank.top().getEnergy();
+
+      ++number_of_photons;
+
+      bank.pop();
+    }
+
+    FRENSIE_CHECK( total_photon_energy <= 1.0 );
+  }
+
+  FRENSIE_CHECK( number_of_photons > 0 );
+
+  // No photons are banked when thick-target bremsstrahlung mode is off
+  properties->setThickTargetBremsstrahlungModeOff();
+
+  {
+    MonteCarlo::ElectronState electron( 1000 );
+    electron.setEnergy( 1.0 );
+    electron.setDirection( 0.0, 0.0, 1.0 );
+    electron.embedInModel( *model );
+
+    MonteCarlo::ParticleBank bank;
+
+    manager.simulateThickTargetBremsstrahlung( electron, bank );
+
+    FRENSIE_CHECK( bank.isEmpty() );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that condensed history electrons that are deflected on a surface
+// remain in the cell that they point into
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   simulateUnresolvedParticle_condensed_history_slab )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::ELECTRON_MODE );
+  properties->setCondensedHistoryModeOn();
+
+  std::shared_ptr<const Geometry::Model> slab_model( new SlabModel );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        slab_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardElectronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     slab_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestElectronSimulationManager manager( model,
+                                         source,
+                                         event_handler,
+                                         properties );
+
+  SlabNavigator::inconsistent_ray_count = 0;
+  SlabNavigator::relocation_count = 0;
+  SlabNavigator::crossing_count = 0;
+
+  const double position[3] = {0.0, 0.0, 0.5*SlabNavigator::slab_thickness};
+  const double direction[3] = {0.0, 0.0, 1.0};
+
+  size_t lost_particles = 0;
+
+  for( size_t i = 0; i < 50; ++i )
+  {
+    MonteCarlo::ParticleBank bank;
+
+    {
+      MonteCarlo::ElectronState electron( i );
+      electron.setEnergy( 1.0 );
+      electron.embedInModel( *model, position, direction );
+
+      manager.simulateUnresolvedParticle( electron, bank, true );
+
+      if( electron.isLost() )
+        ++lost_particles;
+    }
+
+    while( bank.size() > 0 )
+    {
+      manager.simulateUnresolvedParticle( bank.top(), bank, false );
+
+      if( bank.top().isLost() )
+        ++lost_particles;
+
+      bank.pop();
+    }
+  }
+
+  FRENSIE_CHECK_EQUAL( lost_particles, 0 );
+  FRENSIE_CHECK( SlabNavigator::crossing_count > 0 );
+  FRENSIE_CHECK( SlabNavigator::relocation_count > 0 );
+  FRENSIE_CHECK_EQUAL( SlabNavigator::inconsistent_ray_count, 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
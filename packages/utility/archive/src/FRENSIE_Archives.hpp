@@ -13,6 +13,7 @@
 
 // FRENSIE Includes
 #include "FRENSIE_config.hpp"
+#include "Utility_FlatBinaryArchive.hpp"
 
 #ifdef HAVE_FRENSIE_HDF5
 #include "Utility_HDF5OArchive.hpp"
@@ -0,0 +1,382 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatBinaryArchive.cpp
+//! \author Alex Robinson
+//! \brief  Flat binary (memory mapped) archive class definitions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+
+// FRENSIE Includes
+#include "Utility_FlatBinaryArchive.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+
+namespace Utility{
+
+namespace Details{
+
+//! The flat binary archive magic string
+const char flat_binary_archive_magic[8] = {'F','R','N','S','F','B','I','N'};
+
+//! The flat binary archive byte order mark
+const uint32_t flat_binary_archive_byte_order_mark = 0x01020304;
+
+//! The flat binary archive array alignment (bytes)
+const uint64_t flat_binary_archive_alignment = 64;
+
+static_assert( sizeof(FlatBinaryArchiveHeader) == 64,
+               "The flat binary archive header must be 64 bytes!" );
+
+// Validate the offsets of a flattened collection array
+void validateFlatBinaryArchiveOffsets(
+                               const Utility::ArrayView<const uint64_t>& offsets,
+                               const size_t number_of_collections,
+                               const std::string& name )
+{
+  TEST_FOR_EXCEPTION( offsets.size() != number_of_collections+1,
+                      std::runtime_error,
+                      "Flat binary archive array " << name << "/offsets has "
+                      << offsets.size() << " values but "
+                      << number_of_collections+1 << " were expected!" );
+
+  TEST_FOR_EXCEPTION( offsets[0] != 0,
+                      std::runtime_error,
+                      "Flat binary archive array " << name << "/offsets "
+                      "must start at 0!" );
+
+  for( size_t i = 1; i < offsets.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( offsets[i] < offsets[i-1],
+                        std::runtime_error,
+                        "Flat binary archive array " << name << "/offsets "
+                        "must be sorted!" );
+  }
+}
+
+// Read a value from a buffer
+template<typename T>
+inline T readFlatBinaryArchiveValue( const char* buffer,
+                                     const size_t buffer_size,
+                                     size_t& position )
+{
+  TEST_FOR_EXCEPTION( position + sizeof(T) > buffer_size,
+                      std::runtime_error,
+                      "The flat binary archive directory is corrupt!" );
+
+  T value;
+
+  std::memcpy( &value, buffer + position, sizeof(T) );
+
+  position += sizeof(T);
+
+  return value;
+}
+
+// Write a value to a stream
+template<typename T>
+inline void writeFlatBinaryArchiveValue( std::ostream& os, const T value )
+{
+  os.write( reinterpret_cast<const char*>( &value ), sizeof(T) );
+}
+
+} // end Details namespace
+
+// Initialize static member data
+const uint32_t FlatBinaryOArchive::format_version = 1;
+
+// Constructor
+FlatBinaryOArchive::FlatBinaryOArchive(
+                       const boost::filesystem::path& archive_name_with_path )
+  : d_archive_name( archive_name_with_path ),
+    d_stream( archive_name_with_path.string(),
+              std::ofstream::binary | std::ofstream::trunc ),
+    d_prefix(),
+    d_directory(),
+    d_names(),
+    d_closed( false )
+{
+  TEST_FOR_EXCEPTION( !d_stream.good(),
+                      std::runtime_error,
+                      "Could not create the flat binary archive "
+                      << d_archive_name.string() << "!" );
+
+  // Reserve space for the header (written when the archive is closed)
+  const char placeholder[sizeof(Details::FlatBinaryArchiveHeader)] = {};
+
+  d_stream.write( placeholder, sizeof(placeholder) );
+}
+
+// Destructor
+FlatBinaryOArchive::~FlatBinaryOArchive()
+{
+  try{
+    this->close();
+  }
+  EXCEPTION_CATCH_AND_LOG( std::exception,
+                           "Could not close the flat binary archive "
+                           << d_archive_name.string() << "!" );
+}
+
+// Save an array of raw data
+void FlatBinaryOArchive::saveRawArray( const std::string& name,
+                                       const uint32_t type_code,
+                                       const size_t element_size,
+                                       const void* values,
+                                       const size_t number_of_values )
+{
+  TEST_FOR_EXCEPTION( d_closed,
+                      std::runtime_error,
+                      "Cannot save array " << name << " because the flat "
+                      "binary archive " << d_archive_name.string() <<
+                      " has been closed!" );
+
+  TEST_FOR_EXCEPTION( !d_names.insert( name ).second,
+                      std::runtime_error,
+                      "Array " << name << " has already been saved to the "
+                      "flat binary archive " << d_archive_name.string() <<
+                      "!" );
+
+  // Pad the file so that the array is aligned
+  uint64_t offset = d_stream.tellp();
+
+  const uint64_t padding = (Details::flat_binary_archive_alignment -
+                            offset%Details::flat_binary_archive_alignment)%
+    Details::flat_binary_archive_alignment;
+
+  const char zeros[Details::flat_binary_archive_alignment] = {};
+
+  d_stream.write( zeros, padding );
+
+  offset += padding;
+
+  if( number_of_values > 0 )
+  {
+    d_stream.write( static_cast<const char*>( values ),
+                    element_size*number_of_values );
+  }
+
+  TEST_FOR_EXCEPTION( !d_stream.good(),
+                      std::runtime_error,
+                      "Could not write array " << name << " to the flat "
+                      "binary archive " << d_archive_name.string() << "!" );
+
+  Details::FlatBinaryArchiveEntry entry;
+  entry.name = name;
+  entry.type_code = type_code;
+  entry.offset = offset;
+  entry.number_of_elements = number_of_values;
+
+  d_directory.push_back( entry );
+}
+
+// Finish writing the archive
+/*! \details The array directory and the header will be written. No more
+ * arrays can be saved after the archive has been closed. Calling this method
+ * more than once has no effect.
+ */
+void FlatBinaryOArchive::close()
+{
+  if( d_closed )
+    return;
+
+  d_closed = true;
+
+  // Write the directory
+  const uint64_t directory_offset = d_stream.tellp();
+
+  for( auto&& entry : d_directory )
+  {
+    Details::writeFlatBinaryArchiveValue<uint32_t>( d_stream,
+                                                    entry.name.size() );
+
+    d_stream.write( entry.name.data(), entry.name.size() );
+
+    Details::writeFlatBinaryArchiveValue( d_stream, entry.type_code );
+    Details::writeFlatBinaryArchiveValue( d_stream, entry.offset );
+    Details::writeFlatBinaryArchiveValue( d_stream, entry.number_of_elements );
+  }
+
+  const uint64_t directory_size =
+    (uint64_t)d_stream.tellp() - directory_offset;
+
+  // Write the header
+  Details::FlatBinaryArchiveHeader header;
+  std::memset( &header, 0, sizeof(header) );
+  std::memcpy( header.magic,
+               Details::flat_binary_archive_magic,
+               sizeof(header.magic) );
+
+  header.format_version = FlatBinaryOArchive::format_version;
+  header.byte_order_mark = Details::flat_binary_archive_byte_order_mark;
+  header.number_of_arrays = d_directory.size();
+  header.directory_offset = directory_offset;
+  header.directory_size = directory_size;
+
+  d_stream.seekp( 0 );
+  d_stream.write( reinterpret_cast<const char*>( &header ), sizeof(header) );
+  d_stream.close();
+
+  TEST_FOR_EXCEPTION( d_stream.fail(),
+                      std::runtime_error,
+                      "Could not finish writing the flat binary archive "
+                      << d_archive_name.string() << "!" );
+}
+
+// Constructor
+FlatBinaryIArchive::FlatBinaryIArchive(
+                       const boost::filesystem::path& archive_name_with_path )
+  : d_file( new MemoryMappedFile( archive_name_with_path ) ),
+    d_format_version( 0 ),
+    d_directory(),
+    d_prefix()
+{
+  const char* data = d_file->getData();
+  const size_t size = d_file->getSize();
+
+  TEST_FOR_EXCEPTION( size < sizeof(Details::FlatBinaryArchiveHeader),
+                      std::runtime_error,
+                      "File " << archive_name_with_path.string() << " is "
+                      "not a flat binary archive!" );
+
+  Details::FlatBinaryArchiveHeader header;
+  std::memcpy( &header, data, sizeof(header) );
+
+  TEST_FOR_EXCEPTION( std::memcmp( header.magic,
+                                   Details::flat_binary_archive_magic,
+                                   sizeof(header.magic) ) != 0,
+                      std::runtime_error,
+                      "File " << archive_name_with_path.string() << " is "
+                      "not a flat binary archive!" );
+
+  TEST_FOR_EXCEPTION( header.byte_order_mark !=
+                      Details::flat_binary_archive_byte_order_mark,
+                      std::runtime_error,
+                      "The flat binary archive "
+                      << archive_name_with_path.string() << " was created "
+                      "on a machine with a different byte order!" );
+
+  TEST_FOR_EXCEPTION( header.format_version == 0 ||
+                      header.format_version > FlatBinaryOArchive::format_version,
+                      std::runtime_error,
+                      "The flat binary archive "
+                      << archive_name_with_path.string() << " has an "
+                      "unsupported format version (" << header.format_version
+                      << ")!" );
+
+  TEST_FOR_EXCEPTION( header.directory_offset > size ||
+                      header.directory_size > size - header.directory_offset,
+                      std::runtime_error,
+                      "The flat binary archive "
+                      << archive_name_with_path.string() << " has been "
+                      "truncated!" );
+
+  d_format_version = header.format_version;
+
+  // Read the directory
+  const char* directory = data + header.directory_offset;
+  size_t position = 0;
+
+  d_directory.reserve( header.number_of_arrays );
+
+  for( uint64_t i = 0; i < header.number_of_arrays; ++i )
+  {
+    Details::FlatBinaryArchiveEntry entry;
+
+    const uint32_t name_size =
+      Details::readFlatBinaryArchiveValue<uint32_t>(
+                                 directory, header.directory_size, position );
+
+    TEST_FOR_EXCEPTION( position + name_size > header.directory_size,
+                        std::runtime_error,
+                        "The flat binary archive directory is corrupt!" );
+
+    entry.name.assign( directory + position, name_size );
+    position += name_size;
+
+    entry.type_code = Details::readFlatBinaryArchiveValue<uint32_t>(
+                                 directory, header.directory_size, position );
+    entry.offset = Details::readFlatBinaryArchiveValue<uint64_t>(
+                                 directory, header.directory_size, position );
+    entry.number_of_elements = Details::readFlatBinaryArchiveValue<uint64_t>(
+                                 directory, header.directory_size, position );
+
+    // The low byte of the type code is the element size
+    const uint64_t element_size = entry.type_code & 0xFF;
+
+    TEST_FOR_EXCEPTION( element_size == 0 ||
+                        entry.offset%Details::flat_binary_archive_alignment != 0 ||
+                        entry.offset > header.directory_offset ||
+                        entry.number_of_elements >
+                        (header.directory_offset - entry.offset)/element_size,
+                        std::runtime_error,
+                        "Array " << entry.name << " in the flat binary "
+                        "archive " << archive_name_with_path.string() <<
+                        " is corrupt!" );
+
+    std::string name = entry.name;
+
+    TEST_FOR_EXCEPTION( !d_directory.emplace( std::move( name ),
+                                              std::move( entry ) ).second,
+                        std::runtime_error,
+                        "The flat binary archive "
+                        << archive_name_with_path.string() << " contains "
+                        "duplicate arrays!" );
+  }
+}
+
+// Return the format version of the archive
+uint32_t FlatBinaryIArchive::getFormatVersion() const
+{
+  return d_format_version;
+}
+
+// Return the number of arrays in the archive
+size_t FlatBinaryIArchive::getNumberOfArrays() const
+{
+  return d_directory.size();
+}
+
+// Check if the archive contains an array
+bool FlatBinaryIArchive::hasArray( const std::string& name ) const
+{
+  return d_directory.find( name ) != d_directory.end();
+}
+
+// Return the mapped file
+std::shared_ptr<const MemoryMappedFile> FlatBinaryIArchive::getMappedFile() const
+{
+  return d_file;
+}
+
+// Return the directory entry for an array
+const Details::FlatBinaryArchiveEntry& FlatBinaryIArchive::getEntry(
+                                            const std::string& name,
+                                            const uint32_t type_code ) const
+{
+  std::unordered_map<std::string,Details::FlatBinaryArchiveEntry>::const_iterator
+    entry_it = d_directory.find( name );
+
+  TEST_FOR_EXCEPTION( entry_it == d_directory.end(),
+                      std::runtime_error,
+                      "Array " << name << " does not exist in the flat "
+                      "binary archive " << d_file->getFileName().string() <<
+                      "!" );
+
+  TEST_FOR_EXCEPTION( entry_it->second.type_code != type_code,
+                      std::runtime_error,
+                      "Array " << name << " in the flat binary archive "
+                      << d_file->getFileName().string() << " has type code "
+                      << entry_it->second.type_code << " but type code "
+                      << type_code << " was requested!" );
+
+  return entry_it->second;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatBinaryArchive.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,289 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatBinaryArchive.hpp
+//! \author Alex Robinson
+//! \brief  Flat binary (memory mapped) archive class declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_BINARY_ARCHIVE_HPP
+#define UTILITY_FLAT_BINARY_ARCHIVE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <fstream>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstdint>
+#include <type_traits>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/mpl/bool.hpp>
+
+// FRENSIE Includes
+#include "Utility_MemoryMappedFile.hpp"
+#include "Utility_ArrayView.hpp"
+
+/*! \defgroup flat_binary_archive Flat Binary Archive
+ *
+ * The flat binary archive (.fbin) stores every array of arithmetic values
+ * contiguously in a single file so that it can be memory mapped and read
+ * without any parsing. The file starts with a 64 byte header (magic string,
+ * format version, byte order mark, number of arrays and the location of the
+ * array directory). Every array is aligned on a 64 byte boundary, which
+ * allows the arrays to be accessed in place as zero-copy
+ * Utility::ArrayView objects (see Utility::FlatBinaryIArchive::getArrayView).
+ * The directory at the end of the file maps the array names to their
+ * locations.
+ *
+ * Objects are stored using their boost serialization save/load methods. Only
+ * name-value pairs are supported (e.g. ar & BOOST_SERIALIZATION_NVP( d_x ))
+ * and the value types must be arithmetic types, enums, std::string,
+ * std::vector, std::set, std::map, std::pair (nested to any depth) or
+ * objects that are only composed of these types. Collections are flattened
+ * into compressed sparse row style arrays (e.g. a std::map<unsigned,
+ * std::vector<double> > named "x" is stored in the "x/offsets", "x/keys",
+ * "x/values/offsets" and "x/values/values" arrays). The archive is not
+ * portable between machines with different byte orders (this will be
+ * detected when the archive is opened).
+ */
+
+namespace Utility{
+
+namespace Details{
+
+//! The flat binary archive header
+struct FlatBinaryArchiveHeader
+{
+  char magic[8];
+  uint32_t format_version;
+  uint32_t byte_order_mark;
+  uint64_t number_of_arrays;
+  uint64_t directory_offset;
+  uint64_t directory_size;
+  char reserved[24];
+};
+
+//! The flat binary archive directory entry
+struct FlatBinaryArchiveEntry
+{
+  std::string name;
+  uint32_t type_code;
+  uint64_t offset;
+  uint64_t number_of_elements;
+};
+
+//! The flat binary archive type code
+template<typename T>
+struct FlatBinaryArchiveTypeCode;
+
+//! The flat binary archive storage type
+template<typename T>
+struct FlatBinaryArchiveStorageType
+{
+  typedef T type;
+};
+
+//! The flat binary archive storage type (bool)
+template<>
+struct FlatBinaryArchiveStorageType<bool>
+{
+  typedef unsigned char type;
+};
+
+//! The flat binary archive list traits
+template<typename T, typename Enabled = void>
+struct FlatBinaryArchiveListTraits;
+
+} // end Details namespace
+
+/*! Check if a type can be stored in a flat binary archive
+ *
+ * Only types that are composed of the types listed in the flat binary
+ * archive description can be stored. This must be declared explicitly (by
+ * specializing this struct or with the FLAT_BINARY_ARCHIVABLE_CLASS macro)
+ * for every archivable object (see Utility::IArchivableObject) that supports
+ * the .fbin extension.
+ * \ingroup flat_binary_archive
+ */
+template<typename T>
+struct IsFlatBinaryArchivable : public std::false_type
+{ /* ... */ };
+
+/*! Declare that a class can be stored in a flat binary archive
+ *
+ * This macro must be called in the global namespace.
+ * \ingroup flat_binary_archive
+ */
+#define FLAT_BINARY_ARCHIVABLE_CLASS( Class, Namespace ) \
+  namespace Utility{                                     \
+    template<>                                           \
+    struct IsFlatBinaryArchivable<Namespace::Class> : public std::true_type \
+    { /* ... */ };                                       \
+  }
+
+/*! The flat binary output archive
+ * \details The archive will only be complete once the close method has been
+ * called (the destructor will also call close).
+ * \ingroup flat_binary_archive
+ */
+class FlatBinaryOArchive
+{
+
+public:
+
+  //! This archive saves data
+  typedef boost::mpl::bool_<true> is_saving;
+
+  //! This archive does not load data
+  typedef boost::mpl::bool_<false> is_loading;
+
+  //! The format version
+  static const uint32_t format_version;
+
+  //! Constructor
+  FlatBinaryOArchive( const boost::filesystem::path& archive_name_with_path );
+
+  //! Destructor
+  ~FlatBinaryOArchive();
+
+  //! Save a name-value pair
+  template<typename T>
+  FlatBinaryOArchive& operator<<( const boost::serialization::nvp<T>& nvp );
+
+  //! Save a name-value pair
+  template<typename T>
+  FlatBinaryOArchive& operator&( const boost::serialization::nvp<T>& nvp );
+
+  //! Save an array of arithmetic values
+  template<typename T>
+  void saveArray( const std::string& name,
+                  const T* values,
+                  const size_t number_of_values );
+
+  //! Save an object
+  template<typename T>
+  void saveObject( const std::string& name, const T& object );
+
+  //! Finish writing the archive
+  void close();
+
+private:
+
+  // Save an array of raw data
+  void saveRawArray( const std::string& name,
+                     const uint32_t type_code,
+                     const size_t element_size,
+                     const void* values,
+                     const size_t number_of_values );
+
+  // The archive name
+  boost::filesystem::path d_archive_name;
+
+  // The archive file stream
+  std::ofstream d_stream;
+
+  // The current name prefix
+  std::string d_prefix;
+
+  // The array directory
+  std::vector<Details::FlatBinaryArchiveEntry> d_directory;
+
+  // The array names
+  std::unordered_set<std::string> d_names;
+
+  // Records if the archive has been closed
+  bool d_closed;
+};
+
+/*! The flat binary input archive
+ * \details The archive file is memory mapped - the arrays will only be read
+ * from disk when they are first accessed. The array views returned by
+ * getArrayView are valid for as long as the mapped file (see getMappedFile)
+ * exists.
+ * \ingroup flat_binary_archive
+ */
+class FlatBinaryIArchive
+{
+
+public:
+
+  //! This archive does not save data
+  typedef boost::mpl::bool_<false> is_saving;
+
+  //! This archive loads data
+  typedef boost::mpl::bool_<true> is_loading;
+
+  //! Constructor
+  FlatBinaryIArchive( const boost::filesystem::path& archive_name_with_path );
+
+  //! Destructor
+  ~FlatBinaryIArchive()
+  { /* ... */ }
+
+  //! Load a name-value pair
+  template<typename T>
+  FlatBinaryIArchive& operator>>( const boost::serialization::nvp<T>& nvp );
+
+  //! Load a name-value pair
+  template<typename T>
+  FlatBinaryIArchive& operator&( const boost::serialization::nvp<T>& nvp );
+
+  //! Return the format version of the archive
+  uint32_t getFormatVersion() const;
+
+  //! Return the number of arrays in the archive
+  size_t getNumberOfArrays() const;
+
+  //! Check if the archive contains an array
+  bool hasArray( const std::string& name ) const;
+
+  //! Return a view of an array of arithmetic values (zero-copy)
+  template<typename T>
+  Utility::ArrayView<const T> getArrayView( const std::string& name ) const;
+
+  //! Load an object
+  template<typename T>
+  void loadObject( const std::string& name, T& object );
+
+  //! Return the mapped file
+  std::shared_ptr<const MemoryMappedFile> getMappedFile() const;
+
+private:
+
+  // Return the directory entry for an array
+  const Details::FlatBinaryArchiveEntry& getEntry( const std::string& name,
+                                                   const uint32_t type_code ) const;
+
+  // The mapped archive file
+  std::shared_ptr<const MemoryMappedFile> d_file;
+
+  // The archive format version
+  uint32_t d_format_version;
+
+  // The array directory
+  std::unordered_map<std::string,Details::FlatBinaryArchiveEntry> d_directory;
+
+  // The current name prefix
+  std::string d_prefix;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_FlatBinaryArchive_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_FLAT_BINARY_ARCHIVE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatBinaryArchive.hpp
+//---------------------------------------------------------------------------//
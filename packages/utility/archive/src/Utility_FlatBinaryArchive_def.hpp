@@ -0,0 +1,543 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatBinaryArchive_def.hpp
+//! \author Alex Robinson
+//! \brief  Flat binary (memory mapped) archive template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_BINARY_ARCHIVE_DEF_HPP
+#define UTILITY_FLAT_BINARY_ARCHIVE_DEF_HPP
+
+// Std Lib Includes
+#include <type_traits>
+#include <iterator>
+#include <utility>
+#include <set>
+#include <map>
+
+// Boost Includes
+#include <boost/serialization/serialization.hpp>
+#include <boost/serialization/version.hpp>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Utility{
+
+namespace Details{
+
+// Validate the offsets of a flattened collection array
+void validateFlatBinaryArchiveOffsets(
+                               const Utility::ArrayView<const uint64_t>& offsets,
+                               const size_t number_of_collections,
+                               const std::string& name );
+
+/*! The flat binary archive type code
+ *
+ * The type code encodes the kind of arithmetic type (1 = signed integer,
+ * 2 = unsigned integer, 3 = floating point, 4 = character) in the second
+ * byte and the size of the type in the first byte.
+ */
+template<typename T>
+struct FlatBinaryArchiveTypeCode
+{
+  static_assert( std::is_arithmetic<T>::value,
+                 "Only arithmetic types can be stored in flat binary "
+                 "archive arrays!" );
+
+  static const uint32_t value =
+    ((std::is_same<T,char>::value ? 4u :
+      (std::is_floating_point<T>::value ? 3u :
+       (std::is_signed<T>::value ? 1u : 2u))) << 8) | sizeof(T);
+};
+
+/*! The flat binary archive list traits (objects)
+ *
+ * The list traits store a list of values of the same type in one or more
+ * arrays. Objects are stored using their serialization methods, which is why
+ * only a single object can be stored in a list.
+ */
+template<typename T, typename Enabled>
+struct FlatBinaryArchiveListTraits
+{
+  //! Save a list of values
+  static void save( FlatBinaryOArchive& ar,
+                    const std::string& name,
+                    const std::vector<const T*>& values )
+  {
+    TEST_FOR_EXCEPTION( values.size() != 1,
+                        std::runtime_error,
+                        "Collections of objects cannot be stored in a flat "
+                        "binary archive (" << name << ")!" );
+
+    ar.saveObject( name, *values.front() );
+  }
+
+  //! Load a list of values
+  static void load( FlatBinaryIArchive& ar,
+                    const std::string& name,
+                    const std::vector<T*>& values )
+  {
+    TEST_FOR_EXCEPTION( values.size() != 1,
+                        std::runtime_error,
+                        "Collections of objects cannot be loaded from a flat "
+                        "binary archive (" << name << ")!" );
+
+    ar.loadObject( name, *values.front() );
+  }
+};
+
+//! The flat binary archive list traits (arithmetic types)
+template<typename T>
+struct FlatBinaryArchiveListTraits<T,typename std::enable_if<std::is_arithmetic<T>::value>::type>
+{
+  //! The storage type
+  typedef typename FlatBinaryArchiveStorageType<T>::type StorageType;
+
+  //! Save a list of values
+  static void save( FlatBinaryOArchive& ar,
+                    const std::string& name,
+                    const std::vector<const T*>& values )
+  {
+    std::vector<StorageType> raw_values( values.size() );
+
+    for( size_t i = 0; i < values.size(); ++i )
+      raw_values[i] = static_cast<StorageType>( *values[i] );
+
+    ar.saveArray( name, raw_values.data(), raw_values.size() );
+  }
+
+  //! Load a list of values
+  static void load( FlatBinaryIArchive& ar,
+                    const std::string& name,
+                    const std::vector<T*>& values )
+  {
+    Utility::ArrayView<const StorageType> raw_values =
+      ar.template getArrayView<StorageType>( name );
+
+    TEST_FOR_EXCEPTION( raw_values.size() != values.size(),
+                        std::runtime_error,
+                        "Flat binary archive array " << name << " has "
+                        << raw_values.size() << " values but "
+                        << values.size() << " were expected!" );
+
+    for( size_t i = 0; i < values.size(); ++i )
+      *values[i] = static_cast<T>( raw_values[i] );
+  }
+};
+
+//! The flat binary archive list traits (enums)
+template<typename T>
+struct FlatBinaryArchiveListTraits<T,typename std::enable_if<std::is_enum<T>::value>::type>
+{
+  //! The underlying type
+  typedef typename std::underlying_type<T>::type UnderlyingType;
+
+  //! Save a list of values
+  static void save( FlatBinaryOArchive& ar,
+                    const std::string& name,
+                    const std::vector<const T*>& values )
+  {
+    std::vector<UnderlyingType> raw_values( values.size() );
+
+    for( size_t i = 0; i < values.size(); ++i )
+      raw_values[i] = static_cast<UnderlyingType>( *values[i] );
+
+    ar.saveArray( name, raw_values.data(), raw_values.size() );
+  }
+
+  //! Load a list of values
+  static void load( FlatBinaryIArchive& ar,
+                    const std::string& name,
+                    const std::vector<T*>& values )
+  {
+    Utility::ArrayView<const UnderlyingType> raw_values =
+      ar.template getArrayView<UnderlyingType>( name );
+
+    TEST_FOR_EXCEPTION( raw_values.size() != values.size(),
+                        std::runtime_error,
+                        "Flat binary archive array " << name << " has "
+                        << raw_values.size() << " values but "
+                        << values.size() << " were expected!" );
+
+    for( size_t i = 0; i < values.size(); ++i )
+      *values[i] = static_cast<T>( raw_values[i] );
+  }
+};
+
+/*! The flat binary archive list traits (sequences)
+ *
+ * All of the sequences in the list are concatenated. The offsets array
+ * stores the index of the first value of each sequence. Sequences of
+ * arithmetic values are constructed directly from the mapped values.
+ */
+template<typename Sequence>
+struct FlatBinaryArchiveSequenceListTraits
+{
+  //! The value type
+  typedef typename Sequence::value_type ValueType;
+
+  //! Save a list of values
+  static void save( FlatBinaryOArchive& ar,
+                    const std::string& name,
+                    const std::vector<const Sequence*>& sequences )
+  {
+    std::vector<uint64_t> offsets( 1, 0 );
+    offsets.reserve( sequences.size()+1 );
+
+    std::vector<const ValueType*> values;
+
+    for( size_t i = 0; i < sequences.size(); ++i )
+    {
+      for( auto&& value : *sequences[i] )
+        values.push_back( &value );
+
+      offsets.push_back( values.size() );
+    }
+
+    ar.saveArray( name + "/offsets", offsets.data(), offsets.size() );
+
+    FlatBinaryArchiveListTraits<ValueType>::save( ar, name + "/values", values );
+  }
+
+  //! Load a list of values
+  static void load( FlatBinaryIArchive& ar,
+                    const std::string& name,
+                    const std::vector<Sequence*>& sequences )
+  {
+    Utility::ArrayView<const uint64_t> offsets =
+      ar.template getArrayView<uint64_t>( name + "/offsets" );
+
+    validateFlatBinaryArchiveOffsets( offsets, sequences.size(), name );
+
+    FlatBinaryArchiveSequenceListTraits<Sequence>::loadValues(
+           ar, name + "/values", offsets, sequences,
+           std::integral_constant<bool,std::is_arithmetic<ValueType>::value>() );
+  }
+
+private:
+
+  // Load the sequence values (arithmetic)
+  static void loadValues( FlatBinaryIArchive& ar,
+                          const std::string& name,
+                          const Utility::ArrayView<const uint64_t>& offsets,
+                          const std::vector<Sequence*>& sequences,
+                          std::true_type )
+  {
+    typedef typename FlatBinaryArchiveStorageType<ValueType>::type StorageType;
+
+    Utility::ArrayView<const StorageType> values =
+      ar.template getArrayView<StorageType>( name );
+
+    TEST_FOR_EXCEPTION( values.size() != offsets.back(),
+                        std::runtime_error,
+                        "Flat binary archive array " << name << " has "
+                        << values.size() << " values but "
+                        << offsets.back() << " were expected!" );
+
+    for( size_t i = 0; i < sequences.size(); ++i )
+    {
+      *sequences[i] = Sequence( values.data() + offsets[i],
+                                values.data() + offsets[i+1] );
+    }
+  }
+
+  // Load the sequence values (non-arithmetic)
+  static void loadValues( FlatBinaryIArchive& ar,
+                          const std::string& name,
+                          const Utility::ArrayView<const uint64_t>& offsets,
+                          const std::vector<Sequence*>& sequences,
+                          std::false_type )
+  {
+    std::vector<ValueType> values( offsets.back() );
+    std::vector<ValueType*> value_pointers( values.size() );
+
+    for( size_t i = 0; i < values.size(); ++i )
+      value_pointers[i] = &values[i];
+
+    FlatBinaryArchiveListTraits<ValueType>::load( ar, name, value_pointers );
+
+    for( size_t i = 0; i < sequences.size(); ++i )
+    {
+      *sequences[i] =
+        Sequence( std::make_move_iterator( values.begin() + offsets[i] ),
+                  std::make_move_iterator( values.begin() + offsets[i+1] ) );
+    }
+  }
+};
+
+//! The flat binary archive list traits (std::vector)
+template<typename T, typename Alloc>
+struct FlatBinaryArchiveListTraits<std::vector<T,Alloc> > : public FlatBinaryArchiveSequenceListTraits<std::vector<T,Alloc> >
+{ /* ... */ };
+
+//! The flat binary archive list traits (std::set)
+template<typename T, typename Compare, typename Alloc>
+struct FlatBinaryArchiveListTraits<std::set<T,Compare,Alloc> > : public FlatBinaryArchiveSequenceListTraits<std::set<T,Compare,Alloc> >
+{ /* ... */ };
+
+//! The flat binary archive list traits (std::basic_string)
+template<typename CharT, typename Traits, typename Alloc>
+struct FlatBinaryArchiveListTraits<std::basic_string<CharT,Traits,Alloc> > : public FlatBinaryArchiveSequenceListTraits<std::basic_string<CharT,Traits,Alloc> >
+{ /* ... */ };
+
+/*! The flat binary archive list traits (std::map)
+ *
+ * The keys and the mapped values of all of the maps in the list are stored in
+ * two separate lists. The offsets array stores the index of the first
+ * key of each map.
+ */
+template<typename Key, typename T, typename Compare, typename Alloc>
+struct FlatBinaryArchiveListTraits<std::map<Key,T,Compare,Alloc> >
+{
+  //! The map type
+  typedef std::map<Key,T,Compare,Alloc> MapType;
+
+  //! Save a list of values
+  static void save( FlatBinaryOArchive& ar,
+                    const std::string& name,
+                    const std::vector<const MapType*>& maps )
+  {
+    std::vector<uint64_t> offsets( 1, 0 );
+    offsets.reserve( maps.size()+1 );
+
+    std::vector<const Key*> keys;
+    std::vector<const T*> values;
+
+    for( size_t i = 0; i < maps.size(); ++i )
+    {
+      for( auto&& key_value_pair : *maps[i] )
+      {
+        keys.push_back( &key_value_pair.first );
+        values.push_back( &key_value_pair.second );
+      }
+
+      offsets.push_back( keys.size() );
+    }
+
+    ar.saveArray( name + "/offsets", offsets.data(), offsets.size() );
+
+    FlatBinaryArchiveListTraits<Key>::save( ar, name + "/keys", keys );
+    FlatBinaryArchiveListTraits<T>::save( ar, name + "/values", values );
+  }
+
+  //! Load a list of values
+  static void load( FlatBinaryIArchive& ar,
+                    const std::string& name,
+                    const std::vector<MapType*>& maps )
+  {
+    Utility::ArrayView<const uint64_t> offsets =
+      ar.template getArrayView<uint64_t>( name + "/offsets" );
+
+    validateFlatBinaryArchiveOffsets( offsets, maps.size(), name );
+
+    std::vector<Key> keys( offsets.back() );
+    std::vector<Key*> key_pointers( keys.size() );
+
+    std::vector<T> values( offsets.back() );
+    std::vector<T*> value_pointers( values.size() );
+
+    for( size_t i = 0; i < keys.size(); ++i )
+    {
+      key_pointers[i] = &keys[i];
+      value_pointers[i] = &values[i];
+    }
+
+    FlatBinaryArchiveListTraits<Key>::load( ar, name + "/keys", key_pointers );
+    FlatBinaryArchiveListTraits<T>::load( ar, name + "/values", value_pointers );
+
+    for( size_t i = 0; i < maps.size(); ++i )
+    {
+      maps[i]->clear();
+
+      for( size_t j = offsets[i]; j < offsets[i+1]; ++j )
+      {
+        maps[i]->emplace_hint( maps[i]->end(),
+                               std::move( keys[j] ),
+                               std::move( values[j] ) );
+      }
+    }
+  }
+};
+
+//! The flat binary archive list traits (std::pair)
+template<typename T1, typename T2>
+struct FlatBinaryArchiveListTraits<std::pair<T1,T2> >
+{
+  //! The pair type
+  typedef std::pair<T1,T2> PairType;
+
+  //! Save a list of values
+  static void save( FlatBinaryOArchive& ar,
+                    const std::string& name,
+                    const std::vector<const PairType*>& pairs )
+  {
+    std::vector<const T1*> first_values( pairs.size() );
+    std::vector<const T2*> second_values( pairs.size() );
+
+    for( size_t i = 0; i < pairs.size(); ++i )
+    {
+      first_values[i] = &pairs[i]->first;
+      second_values[i] = &pairs[i]->second;
+    }
+
+    FlatBinaryArchiveListTraits<T1>::save( ar, name + "/first", first_values );
+    FlatBinaryArchiveListTraits<T2>::save( ar, name + "/second", second_values );
+  }
+
+  //! Load a list of values
+  static void load( FlatBinaryIArchive& ar,
+                    const std::string& name,
+                    const std::vector<PairType*>& pairs )
+  {
+    std::vector<T1*> first_values( pairs.size() );
+    std::vector<T2*> second_values( pairs.size() );
+
+    for( size_t i = 0; i < pairs.size(); ++i )
+    {
+      first_values[i] = &pairs[i]->first;
+      second_values[i] = &pairs[i]->second;
+    }
+
+    FlatBinaryArchiveListTraits<T1>::load( ar, name + "/first", first_values );
+    FlatBinaryArchiveListTraits<T2>::load( ar, name + "/second", second_values );
+  }
+};
+
+} // end Details namespace
+
+// Save a name-value pair
+template<typename T>
+FlatBinaryOArchive& FlatBinaryOArchive::operator<<(
+                                   const boost::serialization::nvp<T>& nvp )
+{
+  typedef typename std::remove_const<T>::type ValueType;
+
+  std::vector<const ValueType*> values( 1, &nvp.const_value() );
+
+  Details::FlatBinaryArchiveListTraits<ValueType>::save(
+                              *this, d_prefix + nvp.name(), values );
+
+  return *this;
+}
+
+// Save a name-value pair
+template<typename T>
+FlatBinaryOArchive& FlatBinaryOArchive::operator&(
+                                   const boost::serialization::nvp<T>& nvp )
+{
+  return *this << nvp;
+}
+
+// Save an array of arithmetic values
+template<typename T>
+void FlatBinaryOArchive::saveArray( const std::string& name,
+                                    const T* values,
+                                    const size_t number_of_values )
+{
+  this->saveRawArray( name,
+                      Details::FlatBinaryArchiveTypeCode<T>::value,
+                      sizeof(T),
+                      values,
+                      number_of_values );
+}
+
+// Save an object
+/*! \details The object's serialization method will be used to save the
+ * object. The names of the object's name-value pairs will be prefixed with
+ * the object name. The object's class version is also saved.
+ */
+template<typename T>
+void FlatBinaryOArchive::saveObject( const std::string& name, const T& object )
+{
+  const std::string parent_prefix = d_prefix;
+
+  d_prefix = name + "/";
+
+  const uint32_t class_version = boost::serialization::version<T>::value;
+
+  this->saveArray( d_prefix + "class_version", &class_version, 1 );
+
+  boost::serialization::serialize_adl( *this,
+                                       const_cast<T&>( object ),
+                                       class_version );
+
+  d_prefix = parent_prefix;
+}
+
+// Load a name-value pair
+template<typename T>
+FlatBinaryIArchive& FlatBinaryIArchive::operator>>(
+                                   const boost::serialization::nvp<T>& nvp )
+{
+  std::vector<T*> values( 1, &nvp.value() );
+
+  Details::FlatBinaryArchiveListTraits<T>::load(
+                              *this, d_prefix + nvp.name(), values );
+
+  return *this;
+}
+
+// Load a name-value pair
+template<typename T>
+FlatBinaryIArchive& FlatBinaryIArchive::operator&(
+                                   const boost::serialization::nvp<T>& nvp )
+{
+  return *this >> nvp;
+}
+
+// Return a view of an array of arithmetic values (zero-copy)
+/*! \details The view will only be valid for as long as the mapped file
+ * exists (see getMappedFile).
+ */
+template<typename T>
+Utility::ArrayView<const T> FlatBinaryIArchive::getArrayView(
+                                                const std::string& name ) const
+{
+  const Details::FlatBinaryArchiveEntry& entry =
+    this->getEntry( name, Details::FlatBinaryArchiveTypeCode<T>::value );
+
+  return Utility::ArrayView<const T>(
+          reinterpret_cast<const T*>( d_file->getData() + entry.offset ),
+          entry.number_of_elements );
+}
+
+// Load an object
+/*! \details The object's serialization method will be used to load the
+ * object.
+ */
+template<typename T>
+void FlatBinaryIArchive::loadObject( const std::string& name, T& object )
+{
+  const std::string parent_prefix = d_prefix;
+
+  d_prefix = name + "/";
+
+  Utility::ArrayView<const uint32_t> class_version =
+    this->getArrayView<uint32_t>( d_prefix + "class_version" );
+
+  TEST_FOR_EXCEPTION( class_version.size() != 1,
+                      std::runtime_error,
+                      "The class version of object " << name << " could "
+                      "not be determined!" );
+
+  TEST_FOR_EXCEPTION( class_version[0] > boost::serialization::version<T>::value,
+                      std::runtime_error,
+                      "Object " << name << " was saved with class version "
+                      << class_version[0] << ", which is newer than the "
+                      "supported class version ("
+                      << boost::serialization::version<T>::value << ")!" );
+
+  boost::serialization::serialize_adl( *this, object, class_version[0] );
+
+  d_prefix = parent_prefix;
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_FLAT_BINARY_ARCHIVE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatBinaryArchive_def.hpp
+//---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <type_traits>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -67,6 +68,14 @@ private:
   // Archive the object using the required archive
   template<typename Archive>
   void loadFromArchive( Archive& archive );
+
+  // Load the object from a flat binary archive
+  void loadFromFlatBinaryArchive( const boost::filesystem::path& archive_name_with_path,
+                                  std::true_type );
+
+  // Load the object from a flat binary archive (not supported)
+  void loadFromFlatBinaryArchive( const boost::filesystem::path& archive_name_with_path,
+                                  std::false_type );
 };
   
 } // end Utility namespace
@@ -21,7 +21,7 @@ namespace Utility{
 
 // Load the archived object
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .fbin)
  */
 template<typename DerivedType>
 void IArchivableObject<DerivedType>::loadFromFile( const boost::filesystem::path& archive_name_with_path )
@@ -31,7 +31,7 @@ void IArchivableObject<DerivedType>::loadFromFile( const boost::filesystem::path
 
 // Load the archived object (implementation)
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .fbin)
  */
 template<typename DerivedType>
 void IArchivableObject<DerivedType>::loadFromFileImpl( const boost::filesystem::path& archive_name_with_path )
@@ -87,6 +87,11 @@ void IArchivableObject<DerivedType>::loadFromFileImpl( const boost::filesystem::
     this->loadFromArchive( archive );
   }
 #endif // end HAVE_FRENSIE_HDF5
+  else if( extension == ".fbin" )
+  {
+    this->loadFromFlatBinaryArchive( archive_name_with_path,
+                                     Utility::IsFlatBinaryArchivable<DerivedType>() );
+  }
   else
   {
     THROW_EXCEPTION( std::runtime_error,
@@ -141,6 +146,9 @@ const boost::archive::detail::basic_pointer_iserializer* IArchivableObject<Deriv
     }
   }
 #endif // end HAVE_FRENSIE_HDF5
+  // The flat binary archive does not use pointer serializers
+  else if( extension == ".fbin" )
+    bpis = NULL;
   else
   {
     THROW_EXCEPTION( std::runtime_error,
@@ -200,6 +208,30 @@ void IArchivableObject<DerivedType>::loadFromArchive( Archive& archive )
                               "archive!" );
 }
 
+// Load the object from a flat binary archive
+template<typename DerivedType>
+void IArchivableObject<DerivedType>::loadFromFlatBinaryArchive(
+                         const boost::filesystem::path& archive_name_with_path,
+                         std::true_type )
+{
+  Utility::FlatBinaryIArchive archive( archive_name_with_path );
+
+  this->loadFromArchive( archive );
+}
+
+// Load the object from a flat binary archive (not supported)
+template<typename DerivedType>
+void IArchivableObject<DerivedType>::loadFromFlatBinaryArchive(
+                         const boost::filesystem::path& archive_name_with_path,
+                         std::false_type )
+{
+  THROW_EXCEPTION( std::runtime_error,
+                   "Cannot create the input archive "
+                   << archive_name_with_path.string() <<
+                   " because the object cannot be stored in a flat binary "
+                   "archive!" );
+}
+
 } // end Utility namespace
 
 #endif // end UTILITY_IARCHIVABLE_OBJECT_DEF_HPP
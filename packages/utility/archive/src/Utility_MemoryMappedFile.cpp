@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MemoryMappedFile.cpp
+//! \author Alex Robinson
+//! \brief  Read-only memory mapped file class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <stdexcept>
+#include <cerrno>
+#include <cstring>
+
+// POSIX Includes
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// FRENSIE Includes
+#include "Utility_MemoryMappedFile.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Utility{
+
+// Constructor
+MemoryMappedFile::MemoryMappedFile(
+                          const boost::filesystem::path& file_name_with_path )
+  : d_file_name( file_name_with_path ),
+    d_data( NULL ),
+    d_size( 0 )
+{
+  int file_descriptor = ::open( d_file_name.string().c_str(), O_RDONLY );
+
+  TEST_FOR_EXCEPTION( file_descriptor < 0,
+                      std::runtime_error,
+                      "Could not open file " << d_file_name.string() <<
+                      " (" << std::strerror( errno ) << ")!" );
+
+  struct stat file_stats;
+
+  if( ::fstat( file_descriptor, &file_stats ) != 0 )
+  {
+    const int error_number = errno;
+
+    ::close( file_descriptor );
+
+    THROW_EXCEPTION( std::runtime_error,
+                     "Could not determine the size of file "
+                     << d_file_name.string() << " ("
+                     << std::strerror( error_number ) << ")!" );
+  }
+
+  d_size = file_stats.st_size;
+
+  // Empty files cannot be mapped
+  if( d_size > 0 )
+  {
+    d_data = ::mmap( NULL, d_size, PROT_READ, MAP_SHARED, file_descriptor, 0 );
+
+    if( d_data == MAP_FAILED )
+    {
+      const int error_number = errno;
+
+      d_data = NULL;
+
+      ::close( file_descriptor );
+
+      THROW_EXCEPTION( std::runtime_error,
+                       "Could not map file " << d_file_name.string() <<
+                       " into memory (" << std::strerror( error_number )
+                       << ")!" );
+    }
+  }
+
+  // The mapping remains valid after the file descriptor is closed
+  ::close( file_descriptor );
+}
+
+// Destructor
+MemoryMappedFile::~MemoryMappedFile()
+{
+  if( d_data )
+    ::munmap( d_data, d_size );
+}
+
+// Return the file name
+const boost::filesystem::path& MemoryMappedFile::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the mapped file data
+const char* MemoryMappedFile::getData() const
+{
+  return static_cast<const char*>( d_data );
+}
+
+// Return the size of the mapped file (bytes)
+size_t MemoryMappedFile::getSize() const
+{
+  return d_size;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_MemoryMappedFile.cpp
+//---------------------------------------------------------------------------//
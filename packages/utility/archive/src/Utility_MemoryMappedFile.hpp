@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MemoryMappedFile.hpp
+//! \author Alex Robinson
+//! \brief  Read-only memory mapped file class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_MEMORY_MAPPED_FILE_HPP
+#define UTILITY_MEMORY_MAPPED_FILE_HPP
+
+// Std Lib Includes
+#include <string>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+namespace Utility{
+
+/*! The read-only memory mapped file
+ * \details The contents of the file are mapped into the address space of the
+ * process. Nothing is read from the file until a page is first accessed,
+ * which means that the cost of opening a large file is independent of its
+ * size. The mapping is shared, so processes on the same node that map the
+ * same file will share the physical pages (through the page cache).
+ */
+class MemoryMappedFile
+{
+
+public:
+
+  //! Constructor
+  MemoryMappedFile( const boost::filesystem::path& file_name_with_path );
+
+  //! Destructor
+  ~MemoryMappedFile();
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the mapped file data
+  const char* getData() const;
+
+  //! Return the size of the mapped file (bytes)
+  size_t getSize() const;
+
+private:
+
+  // No copy constructor
+  MemoryMappedFile( const MemoryMappedFile& other );
+
+  // No assignment operator
+  MemoryMappedFile& operator=( const MemoryMappedFile& other );
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The mapped file data
+  void* d_data;
+
+  // The size of the mapped file
+  size_t d_size;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_MEMORY_MAPPED_FILE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_MemoryMappedFile.hpp
+//---------------------------------------------------------------------------//
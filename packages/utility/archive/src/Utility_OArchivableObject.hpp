@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <type_traits>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -69,6 +70,14 @@ private:
   // Archive the object using the required archive
   template<typename Archive>
   void saveToArchive( Archive& archive ) const;
+
+  // Save the object to a flat binary archive
+  void saveToFlatBinaryArchive( const boost::filesystem::path& archive_name_with_path,
+                                std::true_type ) const;
+
+  // Save the object to a flat binary archive (not supported)
+  void saveToFlatBinaryArchive( const boost::filesystem::path& archive_name_with_path,
+                                std::false_type ) const;
 };
   
 } // end Utility namespace
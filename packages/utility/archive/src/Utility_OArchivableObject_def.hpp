@@ -25,7 +25,7 @@ namespace Utility{
 
 // Archive the object
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .fbin)
  */
 template<typename DerivedType>
 void OArchivableObject<DerivedType>::saveToFile(
@@ -37,7 +37,7 @@ void OArchivableObject<DerivedType>::saveToFile(
 
 // Archive the object (implementation)
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .fbin)
  */
 template<typename DerivedType>
 void OArchivableObject<DerivedType>::saveToFileImpl(
@@ -109,6 +109,11 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
     this->saveToArchive( archive );
   }
 #endif // end HAVE_FRENSIE_HDF5
+  else if( extension == ".fbin" )
+  {
+    this->saveToFlatBinaryArchive( archive_name_with_path,
+                                   Utility::IsFlatBinaryArchivable<DerivedType>() );
+  }
   else
   {
     THROW_EXCEPTION( std::runtime_error,
@@ -163,6 +168,9 @@ const boost::archive::detail::basic_pointer_oserializer* OArchivableObject<Deriv
     }
   }
 #endif // end HAVE_FRENSIE_HDF5
+  // The flat binary archive does not use pointer serializers
+  else if( extension == ".fbin" )
+    bpos = NULL;
   else
   {
     THROW_EXCEPTION( std::runtime_error,
@@ -222,6 +230,32 @@ void OArchivableObject<DerivedType>::saveToArchive( Archive& archive ) const
                               "archive!" );
 }
 
+// Save the object to a flat binary archive
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::saveToFlatBinaryArchive(
+                         const boost::filesystem::path& archive_name_with_path,
+                         std::true_type ) const
+{
+  Utility::FlatBinaryOArchive archive( archive_name_with_path );
+
+  this->saveToArchive( archive );
+
+  archive.close();
+}
+
+// Save the object to a flat binary archive (not supported)
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::saveToFlatBinaryArchive(
+                         const boost::filesystem::path& archive_name_with_path,
+                         std::false_type ) const
+{
+  THROW_EXCEPTION( std::runtime_error,
+                   "Cannot create the output archive "
+                   << archive_name_with_path.string() <<
+                   " because the object cannot be stored in a flat binary "
+                   "archive!" );
+}
+
 } // end Utility namespace
 
 #endif // end UTILITY_OARCHIVABLE_OBJECT_DEF_HPP
@@ -0,0 +1,284 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFlatBinaryArchive.cpp
+//! \author Alex Robinson
+//! \brief  Flat binary archive unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <fstream>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatBinaryArchive.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Tuple.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+enum TestEnum{ TEST_ENUM_A = 1, TEST_ENUM_B = 3 };
+
+class TestSubObject
+{
+public:
+
+  //! Default constructor
+  TestSubObject()
+    : d_energy( 0.0 ), d_name()
+  { /* ... */ }
+
+  //! Constructor
+  TestSubObject( const double energy, const std::string& name )
+    : d_energy( energy ), d_name( name )
+  { /* ... */ }
+
+  double d_energy;
+  std::string d_name;
+
+private:
+
+  // Serialize the data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_energy );
+    ar & BOOST_SERIALIZATION_NVP( d_name );
+  }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+
+class TestObject
+{
+public:
+
+  bool d_flag;
+  int d_index;
+  TestEnum d_enum;
+  std::string d_notes;
+  std::vector<double> d_grid;
+  std::vector<std::vector<double> > d_table;
+  std::set<unsigned> d_subshells;
+  std::map<unsigned,std::vector<double> > d_cross_sections;
+  std::map<unsigned,std::map<double,std::vector<double> > > d_distributions;
+  std::map<unsigned,std::vector<std::pair<unsigned,unsigned> > > d_transitions;
+  std::map<unsigned,std::string> d_labels;
+  TestSubObject d_sub_object;
+
+private:
+
+  // Save the data
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_flag );
+    ar & BOOST_SERIALIZATION_NVP( d_index );
+    ar & BOOST_SERIALIZATION_NVP( d_enum );
+    ar & BOOST_SERIALIZATION_NVP( d_notes );
+    ar & BOOST_SERIALIZATION_NVP( d_grid );
+    ar & BOOST_SERIALIZATION_NVP( d_table );
+    ar & BOOST_SERIALIZATION_NVP( d_subshells );
+    ar & BOOST_SERIALIZATION_NVP( d_cross_sections );
+    ar & BOOST_SERIALIZATION_NVP( d_distributions );
+    ar & BOOST_SERIALIZATION_NVP( d_transitions );
+    ar & BOOST_SERIALIZATION_NVP( d_labels );
+    ar & BOOST_SERIALIZATION_NVP( d_sub_object );
+  }
+
+  // Load the data
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_flag );
+    ar & BOOST_SERIALIZATION_NVP( d_index );
+    ar & BOOST_SERIALIZATION_NVP( d_enum );
+    ar & BOOST_SERIALIZATION_NVP( d_notes );
+    ar & BOOST_SERIALIZATION_NVP( d_grid );
+    ar & BOOST_SERIALIZATION_NVP( d_table );
+    ar & BOOST_SERIALIZATION_NVP( d_subshells );
+    ar & BOOST_SERIALIZATION_NVP( d_cross_sections );
+    ar & BOOST_SERIALIZATION_NVP( d_distributions );
+    ar & BOOST_SERIALIZATION_NVP( d_transitions );
+    ar & BOOST_SERIALIZATION_NVP( d_labels );
+    ar & BOOST_SERIALIZATION_NVP( d_sub_object );
+  }
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+};
+
+BOOST_CLASS_VERSION( TestObject, 2 );
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+TestObject test_object;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that an object can be archived and restored
+FRENSIE_UNIT_TEST( FlatBinaryArchive, archive_object )
+{
+  {
+    Utility::FlatBinaryOArchive oarchive( "test_flat_binary_archive.fbin" );
+
+    FRENSIE_REQUIRE_NO_THROW( oarchive << boost::serialization::make_nvp( "test_object", test_object ) );
+  }
+
+  Utility::FlatBinaryIArchive iarchive( "test_flat_binary_archive.fbin" );
+
+  FRENSIE_CHECK_EQUAL( iarchive.getFormatVersion(), 1 );
+  FRENSIE_CHECK( iarchive.hasArray( "test_object/class_version" ) );
+  FRENSIE_CHECK( iarchive.hasArray( "test_object/d_cross_sections/keys" ) );
+  FRENSIE_CHECK( !iarchive.hasArray( "test_object/d_dummy" ) );
+
+  TestObject restored_object;
+
+  FRENSIE_REQUIRE_NO_THROW( iarchive >> boost::serialization::make_nvp( "test_object", restored_object ) );
+
+  FRENSIE_CHECK_EQUAL( restored_object.d_flag, test_object.d_flag );
+  FRENSIE_CHECK_EQUAL( restored_object.d_index, test_object.d_index );
+  FRENSIE_CHECK( restored_object.d_enum == test_object.d_enum );
+  FRENSIE_CHECK_EQUAL( restored_object.d_notes, test_object.d_notes );
+  FRENSIE_CHECK_EQUAL( restored_object.d_grid, test_object.d_grid );
+  FRENSIE_CHECK_EQUAL( restored_object.d_table, test_object.d_table );
+  FRENSIE_CHECK_EQUAL( restored_object.d_subshells, test_object.d_subshells );
+  FRENSIE_CHECK_EQUAL( restored_object.d_cross_sections,
+                       test_object.d_cross_sections );
+  FRENSIE_CHECK_EQUAL( restored_object.d_distributions,
+                       test_object.d_distributions );
+  FRENSIE_CHECK_EQUAL( restored_object.d_transitions,
+                       test_object.d_transitions );
+  FRENSIE_CHECK_EQUAL( restored_object.d_labels, test_object.d_labels );
+  FRENSIE_CHECK_EQUAL( restored_object.d_sub_object.d_energy,
+                       test_object.d_sub_object.d_energy );
+  FRENSIE_CHECK_EQUAL( restored_object.d_sub_object.d_name,
+                       test_object.d_sub_object.d_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the arrays can be viewed without copying
+FRENSIE_UNIT_TEST( FlatBinaryArchive, getArrayView )
+{
+  {
+    Utility::FlatBinaryOArchive oarchive( "test_flat_binary_archive.fbin" );
+
+    oarchive << boost::serialization::make_nvp( "test_object", test_object );
+  }
+
+  Utility::FlatBinaryIArchive iarchive( "test_flat_binary_archive.fbin" );
+
+  Utility::ArrayView<const double> grid_view =
+    iarchive.getArrayView<double>( "test_object/d_grid/values" );
+
+  FRENSIE_CHECK_EQUAL( grid_view, Utility::arrayViewOfConst( test_object.d_grid ) );
+
+  // The arrays must be aligned
+  FRENSIE_CHECK_EQUAL( ((size_t)grid_view.data())%64, 0 );
+
+  // The view must point into the mapped file
+  FRENSIE_CHECK( grid_view.data() >= (const double*)iarchive.getMappedFile()->getData() );
+  FRENSIE_CHECK( grid_view.data() < (const double*)(iarchive.getMappedFile()->getData() + iarchive.getMappedFile()->getSize()) );
+
+  // The requested type must match the stored type
+  FRENSIE_CHECK_THROW( iarchive.getArrayView<float>( "test_object/d_grid/values" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( iarchive.getArrayView<double>( "test_object/d_dummy" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that arrays can be saved directly
+FRENSIE_UNIT_TEST( FlatBinaryArchive, saveArray )
+{
+  std::vector<unsigned long long> values( {1ull, 2ull, 3ull} );
+
+  {
+    Utility::FlatBinaryOArchive oarchive( "test_flat_binary_archive.fbin" );
+
+    oarchive.saveArray( "values", values.data(), values.size() );
+    oarchive.saveArray( "empty", values.data(), 0 );
+
+    // Array names must be unique
+    FRENSIE_CHECK_THROW( oarchive.saveArray( "values", values.data(), 1 ),
+                         std::runtime_error );
+
+    oarchive.close();
+
+    // No arrays can be added after the archive has been closed
+    FRENSIE_CHECK_THROW( oarchive.saveArray( "other_values", values.data(), 1 ),
+                         std::runtime_error );
+  }
+
+  Utility::FlatBinaryIArchive iarchive( "test_flat_binary_archive.fbin" );
+
+  FRENSIE_CHECK_EQUAL( iarchive.getNumberOfArrays(), 2 );
+  FRENSIE_CHECK_EQUAL( iarchive.getArrayView<unsigned long long>( "values" ),
+                       Utility::arrayViewOfConst( values ) );
+  FRENSIE_CHECK_EQUAL( iarchive.getArrayView<unsigned long long>( "empty" ).size(),
+                       0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid files are detected
+FRENSIE_UNIT_TEST( FlatBinaryArchive, invalid_file )
+{
+  {
+    std::ofstream invalid_file( "test_invalid_flat_binary_archive.fbin" );
+
+    invalid_file << "this is not a flat binary archive but it is long enough "
+                 << "to contain a flat binary archive header";
+  }
+
+  FRENSIE_CHECK_THROW( Utility::FlatBinaryIArchive( "test_invalid_flat_binary_archive.fbin" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Utility::FlatBinaryIArchive( "test_missing_flat_binary_archive.fbin" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  test_object.d_flag = true;
+  test_object.d_index = -3;
+  test_object.d_enum = TEST_ENUM_B;
+  test_object.d_notes = "flat binary archive test";
+  test_object.d_grid = {1e-3, 1e-2, 1e-1, 1.0, 10.0, 20.0};
+  test_object.d_table = {{1.0, 2.0}, {}, {3.0}};
+  test_object.d_subshells = {1u, 3u, 5u};
+  test_object.d_cross_sections[1] = {0.5, 0.25};
+  test_object.d_cross_sections[3] = {};
+  test_object.d_cross_sections[5] = {1.5};
+  test_object.d_distributions[1][1e-3] = {-1.0, 0.0, 1.0};
+  test_object.d_distributions[1][20.0] = {-1.0, 1.0};
+  test_object.d_distributions[3];
+  test_object.d_transitions[1] = {std::make_pair( 3u, 5u ),
+                                  std::make_pair( 5u, 5u )};
+  test_object.d_labels[1] = "K";
+  test_object.d_labels[3] = "L1";
+  test_object.d_sub_object = TestSubObject( 0.511, "electron" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstFlatBinaryArchive.cpp
+//---------------------------------------------------------------------------//
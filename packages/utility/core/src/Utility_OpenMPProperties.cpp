@@ -160,6 +160,34 @@ unsigned OpenMPProperties::getThreadId()
 #endif
 }
 
+// Set the schedule used by loops with a runtime schedule
+/*! \details This schedule will be used by all omp for loops that are
+ * declared with schedule(runtime). A chunk size of 0 will result in the
+ * implementation default chunk size being used. If OpenMP is not used this
+ * function will do nothing.
+ */
+void OpenMPProperties::setRuntimeSchedule( const ScheduleType schedule_type,
+                                           const unsigned chunk_size )
+{
+#ifdef HAVE_FRENSIE_OPENMP
+  omp_sched_t omp_schedule_type;
+
+  switch( schedule_type )
+  {
+  case DYNAMIC_SCHEDULE:
+    omp_schedule_type = omp_sched_dynamic;
+    break;
+  case GUIDED_SCHEDULE:
+    omp_schedule_type = omp_sched_guided;
+    break;
+  default:
+    omp_schedule_type = omp_sched_static;
+  }
+
+  omp_set_schedule( omp_schedule_type, (int)chunk_size );
+#endif
+}
+
 // Return if OpenMP has been configured for use
 bool OpenMPProperties::isOpenMPUsed()
 {
@@ -22,6 +22,13 @@ class OpenMPProperties
 {
 public:
 
+  //! The loop schedule types
+  enum ScheduleType{
+    STATIC_SCHEDULE = 0,
+    DYNAMIC_SCHEDULE,
+    GUIDED_SCHEDULE
+  };
+
   //! Set the number of threads to use in parallel blocks
   static void setNumberOfThreads( const unsigned number_of_threads );
 
@@ -34,6 +41,10 @@ public:
   //! Get the thread id within the current scope
   static unsigned getThreadId();
 
+  //! Set the schedule used by loops with a runtime schedule
+  static void setRuntimeSchedule( const ScheduleType schedule_type,
+                                  const unsigned chunk_size );
+
   //! Create a timer using the OpenMP interface
   static std::shared_ptr<Timer> createTimer();
 
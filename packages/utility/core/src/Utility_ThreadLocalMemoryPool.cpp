@@ -0,0 +1,216 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ThreadLocalMemoryPool.cpp
+//! \author Alex Robinson
+//! \brief  Thread local memory pool class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <new>
+
+// FRENSIE Includes
+#include "Utility_ThreadLocalMemoryPool.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+namespace{
+
+// The size class granularity
+constexpr size_t size_class_granularity = 16;
+
+// The number of size classes (blocks up to 1024 bytes will be pooled)
+constexpr size_t number_of_size_classes = 64;
+
+// A free block (the link is stored in the block itself)
+struct FreeBlock
+{
+  FreeBlock* next;
+};
+
+// The free lists of a thread
+struct FreeLists
+{
+  // The top block of each free list
+  FreeBlock* heads[number_of_size_classes];
+
+  // The number of blocks in each free list
+  size_t sizes[number_of_size_classes];
+};
+
+// The free lists of the calling thread (created on first use)
+thread_local FreeLists* thread_free_lists = NULL;
+
+// Records if the free lists of the calling thread have been destroyed
+thread_local bool thread_free_lists_destroyed = false;
+
+// Release the free lists of a thread when it exits
+struct FreeListsGuard
+{
+  ~FreeListsGuard()
+  {
+    ThreadLocalMemoryPool::releaseCachedBlocks();
+
+    delete thread_free_lists;
+
+    thread_free_lists = NULL;
+    thread_free_lists_destroyed = true;
+  }
+};
+
+thread_local FreeListsGuard thread_free_lists_guard;
+
+// Return the free lists of the calling thread
+/*! \details Null will be returned once the thread has started to exit (e.g.
+ * when objects are released by other thread local or static destructors).
+ */
+FreeLists* getThreadFreeLists()
+{
+  if( thread_free_lists == NULL && !thread_free_lists_destroyed )
+  {
+    // Make sure that the guard is constructed so that the lists are
+    // released when the thread exits
+    (void)&thread_free_lists_guard;
+
+    thread_free_lists = new FreeLists;
+
+    for( size_t i = 0; i < number_of_size_classes; ++i )
+    {
+      thread_free_lists->heads[i] = NULL;
+      thread_free_lists->sizes[i] = 0;
+    }
+  }
+
+  return thread_free_lists;
+}
+
+} // end anonymous namespace
+
+// Initialize static member data
+const size_t ThreadLocalMemoryPool::s_size_class_granularity =
+  size_class_granularity;
+
+const size_t ThreadLocalMemoryPool::s_number_of_size_classes =
+  number_of_size_classes;
+
+const size_t ThreadLocalMemoryPool::s_max_cached_blocks_per_size_class =
+  16384;
+
+// Allocate a block of memory
+/*! \details The block will be popped from the free list of the calling
+ * thread if one is available. Otherwise a new block will be allocated.
+ */
+void* ThreadLocalMemoryPool::allocate( const size_t size )
+{
+  if( size == 0 || size > ThreadLocalMemoryPool::getMaxPooledBlockSize() )
+    return ::operator new( size );
+
+  const size_t size_class = ThreadLocalMemoryPool::getSizeClass( size );
+
+  FreeLists* free_lists = getThreadFreeLists();
+
+  if( free_lists != NULL && free_lists->heads[size_class] != NULL )
+  {
+    FreeBlock* block = free_lists->heads[size_class];
+
+    free_lists->heads[size_class] = block->next;
+    --free_lists->sizes[size_class];
+
+    return block;
+  }
+  else
+    return ::operator new( (size_class+1)*s_size_class_granularity );
+}
+
+// Deallocate a block of memory
+/*! \details The size must be the size that was used to allocate the block.
+ * The block will be pushed onto the free list of the calling thread unless
+ * the free list is full.
+ */
+void ThreadLocalMemoryPool::deallocate( void* block, const size_t size )
+{
+  if( block == NULL )
+    return;
+
+  if( size == 0 || size > ThreadLocalMemoryPool::getMaxPooledBlockSize() )
+  {
+    ::operator delete( block );
+
+    return;
+  }
+
+  const size_t size_class = ThreadLocalMemoryPool::getSizeClass( size );
+
+  FreeLists* free_lists = getThreadFreeLists();
+
+  if( free_lists != NULL &&
+      free_lists->sizes[size_class] < s_max_cached_blocks_per_size_class )
+  {
+    FreeBlock* free_block = static_cast<FreeBlock*>( block );
+
+    free_block->next = free_lists->heads[size_class];
+
+    free_lists->heads[size_class] = free_block;
+    ++free_lists->sizes[size_class];
+  }
+  else
+    ::operator delete( block );
+}
+
+// Return the number of blocks cached by the calling thread
+size_t ThreadLocalMemoryPool::getNumberOfCachedBlocks()
+{
+  size_t number_of_blocks = 0;
+
+  if( thread_free_lists != NULL )
+  {
+    for( size_t i = 0; i < s_number_of_size_classes; ++i )
+      number_of_blocks += thread_free_lists->sizes[i];
+  }
+
+  return number_of_blocks;
+}
+
+// Release the blocks cached by the calling thread
+void ThreadLocalMemoryPool::releaseCachedBlocks()
+{
+  if( thread_free_lists != NULL )
+  {
+    for( size_t i = 0; i < s_number_of_size_classes; ++i )
+    {
+      while( thread_free_lists->heads[i] != NULL )
+      {
+        FreeBlock* block = thread_free_lists->heads[i];
+
+        thread_free_lists->heads[i] = block->next;
+
+        ::operator delete( block );
+      }
+
+      thread_free_lists->sizes[i] = 0;
+    }
+  }
+}
+
+// Return the maximum block size that will be pooled
+size_t ThreadLocalMemoryPool::getMaxPooledBlockSize()
+{
+  return s_number_of_size_classes*s_size_class_granularity;
+}
+
+// Return the size class of a block
+size_t ThreadLocalMemoryPool::getSizeClass( const size_t size )
+{
+  // Make sure the size is valid
+  testPrecondition( size > 0 );
+  testPrecondition( size <= ThreadLocalMemoryPool::getMaxPooledBlockSize() );
+
+  return (size - 1)/s_size_class_granularity;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_ThreadLocalMemoryPool.cpp
+//---------------------------------------------------------------------------//
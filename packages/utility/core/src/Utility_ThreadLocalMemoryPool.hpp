@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ThreadLocalMemoryPool.hpp
+//! \author Alex Robinson
+//! \brief  Thread local memory pool class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_THREAD_LOCAL_MEMORY_POOL_HPP
+#define UTILITY_THREAD_LOCAL_MEMORY_POOL_HPP
+
+// Std Lib Includes
+#include <cstddef>
+
+namespace Utility{
+
+/*! The thread local memory pool
+ * \details Small blocks are grouped into size classes and each thread keeps a
+ * LIFO free list for every size class. A deallocated block is pushed onto
+ * the free list of the calling thread and the next allocation of the same
+ * size class on that thread pops it again, so the most recently released
+ * (cache hot) block is always reused first. Since all blocks of a size class
+ * are interchangeable, a block can be released by a different thread than
+ * the one that allocated it. Blocks that are larger than the maximum pooled
+ * block size are passed to the global allocation functions directly. The
+ * blocks cached by a thread are released when the thread exits. Classes
+ * that are allocated and released frequently (e.g. particle states and
+ * navigators) can use this pool by defining class specific operator new
+ * and operator delete methods that forward to it.
+ */
+class ThreadLocalMemoryPool
+{
+
+public:
+
+  //! Allocate a block of memory
+  static void* allocate( const size_t size );
+
+  //! Deallocate a block of memory
+  static void deallocate( void* block, const size_t size );
+
+  //! Return the number of blocks cached by the calling thread
+  static size_t getNumberOfCachedBlocks();
+
+  //! Release the blocks cached by the calling thread
+  static void releaseCachedBlocks();
+
+  //! Return the maximum block size that will be pooled
+  static size_t getMaxPooledBlockSize();
+
+private:
+
+  // Return the size class of a block
+  static size_t getSizeClass( const size_t size );
+
+  // The size class granularity (also the minimum block alignment)
+  static const size_t s_size_class_granularity;
+
+  // The number of size classes
+  static const size_t s_number_of_size_classes;
+
+  // The maximum number of blocks cached in each free list
+  static const size_t s_max_cached_blocks_per_size_class;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_THREAD_LOCAL_MEMORY_POOL_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_ThreadLocalMemoryPool.hpp
+//---------------------------------------------------------------------------//
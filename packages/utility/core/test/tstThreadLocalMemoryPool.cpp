@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstThreadLocalMemoryPool.cpp
+//! \author Alex Robinson
+//! \brief  Thread local memory pool unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_ThreadLocalMemoryPool.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+//! A pooled object
+struct PooledObject
+{
+  PooledObject( const double value )
+    : value( value )
+  { /* ... */ }
+
+  virtual ~PooledObject()
+  { /* ... */ }
+
+  static void* operator new( size_t size )
+  { return Utility::ThreadLocalMemoryPool::allocate( size ); }
+
+  static void operator delete( void* block, size_t size )
+  { Utility::ThreadLocalMemoryPool::deallocate( block, size ); }
+
+  double value;
+};
+
+//! A derived pooled object
+struct DerivedPooledObject : public PooledObject
+{
+  DerivedPooledObject( const double value )
+    : PooledObject( value ),
+      other_values()
+  { /* ... */ }
+
+  double other_values[20];
+};
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that released blocks are reused in LIFO order
+FRENSIE_UNIT_TEST( ThreadLocalMemoryPool, allocate_lifo_reuse )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  void* block_a = Utility::ThreadLocalMemoryPool::allocate( 40 );
+  void* block_b = Utility::ThreadLocalMemoryPool::allocate( 40 );
+
+  FRENSIE_CHECK( block_a != block_b );
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+
+  Utility::ThreadLocalMemoryPool::deallocate( block_a, 40 );
+  Utility::ThreadLocalMemoryPool::deallocate( block_b, 40 );
+
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 2 );
+
+  // Blocks in the same size class are interchangeable
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::allocate( 33 ), block_b );
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::allocate( 48 ), block_a );
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+
+  Utility::ThreadLocalMemoryPool::deallocate( block_a, 48 );
+  Utility::ThreadLocalMemoryPool::deallocate( block_b, 33 );
+
+  // Blocks in a different size class will not be reused
+  void* block_c = Utility::ThreadLocalMemoryPool::allocate( 64 );
+
+  FRENSIE_CHECK( block_c != block_a );
+  FRENSIE_CHECK( block_c != block_b );
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 2 );
+
+  Utility::ThreadLocalMemoryPool::deallocate( block_c, 64 );
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that large blocks are not pooled
+FRENSIE_UNIT_TEST( ThreadLocalMemoryPool, allocate_large )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  const size_t size =
+    Utility::ThreadLocalMemoryPool::getMaxPooledBlockSize() + 1;
+
+  void* block = Utility::ThreadLocalMemoryPool::allocate( size );
+
+  FRENSIE_REQUIRE( block != NULL );
+
+  Utility::ThreadLocalMemoryPool::deallocate( block, size );
+
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that objects with class specific allocation functions are recycled
+FRENSIE_UNIT_TEST( ThreadLocalMemoryPool, class_allocation )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  PooledObject* object = new DerivedPooledObject( 1.0 );
+
+  const void* object_address = object;
+
+  // The size of the derived type must be used to release the block
+  delete object;
+
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 1 );
+
+  PooledObject* base_object = new PooledObject( 2.0 );
+
+  FRENSIE_CHECK( (const void*)base_object != object_address );
+
+  object = new DerivedPooledObject( 3.0 );
+
+  FRENSIE_CHECK_EQUAL( (const void*)object, object_address );
+  FRENSIE_CHECK_EQUAL( object->value, 3.0 );
+
+  delete object;
+  delete base_object;
+
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+}
+
+//---------------------------------------------------------------------------//
+// Check that each thread has its own free lists
+FRENSIE_UNIT_TEST( ThreadLocalMemoryPool, thread_local_free_lists )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  void* block = Utility::ThreadLocalMemoryPool::allocate( 128 );
+
+  Utility::ThreadLocalMemoryPool::deallocate( block, 128 );
+
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 1 );
+
+  size_t other_thread_cached_blocks = 1;
+
+  #pragma omp parallel num_threads( 2 )
+  {
+    if( Utility::OpenMPProperties::getThreadId() == 1 )
+    {
+      other_thread_cached_blocks =
+        Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks();
+    }
+  }
+
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+  {
+    FRENSIE_CHECK_EQUAL( other_thread_cached_blocks, 0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 1 );
+
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+}
+
+//---------------------------------------------------------------------------//
+// end tstThreadLocalMemoryPool.cpp
+//---------------------------------------------------------------------------//
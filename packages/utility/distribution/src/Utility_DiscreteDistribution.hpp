@@ -18,6 +18,17 @@
 namespace Utility{
 
 /*! The unit-aware discrete distribution class
+ * \details By default a sample is drawn by searching the CDF (O(log N)). If
+ * alias sampling is requested at construction, an alias table
+ * (Walker/Vose) will be constructed, which allows samples to be drawn in O(1)
+ * time. This is useful when the distribution has many independent values
+ * (e.g. gamma line sources). Alias sampling only changes how the random number
+ * used by the sample, sampleAndRecordTrials and sampleAndRecordBinIndex
+ * methods is mapped to a bin - sampling with a specific random number or in
+ * a subrange will always be done with the CDF. The bin sampling frequencies
+ * are the same with both methods but a given random number will generally
+ * select a different bin, so enabling alias sampling changes the random
+ * number stream of an existing calculation.
  * \ingroup univariate_distributions
  */
 template<typename IndependentUnit,typename DependentUnit>
@@ -59,42 +70,48 @@ public:
 			const std::vector<double>& dependent_values =
                         ThisType::getDefaultDepValues<double>(),
 			const bool interpret_dependent_values_as_cdf = false,
-                        const bool treat_as_continuous = false );
+                        const bool treat_as_continuous = false,
+                        const bool use_alias_sampling = false );
 
   //! Basic View Constructor (potentially dangerous)
   UnitAwareDiscreteDistribution(
                     const Utility::ArrayView<const double>& independent_values,
                     const Utility::ArrayView<const double>& dependent_values,
                     const bool interpret_dependent_values_as_cdf = false,
-                    const bool treat_as_continuous = false );
+                    const bool treat_as_continuous = false,
+                    const bool use_alias_sampling = false );
 
   //! CDF constructor
   template<typename InputIndepQuantity>
   UnitAwareDiscreteDistribution(
 	      const std::vector<InputIndepQuantity>& independent_quantities,
 	      const std::vector<double>& cdf_values,
-              const bool treat_as_continuous = false );
+              const bool treat_as_continuous = false,
+              const bool use_alias_sampling = false );
 
   //! CDF view constructor
   template<typename InputIndepQuantity>
   UnitAwareDiscreteDistribution(
     const Utility::ArrayView<const InputIndepQuantity>& independent_quantities,
     const Utility::ArrayView<const double>& cdf_values,
-    const bool treat_as_continuous = false );
+    const bool treat_as_continuous = false,
+    const bool use_alias_sampling = false );
 
   //! Constructor
   template<typename InputIndepQuantity, typename InputDepQuantity>
   UnitAwareDiscreteDistribution(
 	      const std::vector<InputIndepQuantity>& independent_quantities,
 	      const std::vector<InputDepQuantity>& dependent_quantities,
-              const bool treat_as_continuous = false );
+              const bool treat_as_continuous = false,
+              const bool use_alias_sampling = false );
 
   //! View constructor
   template<typename InputIndepQuantity, typename InputDepQuantity>
   UnitAwareDiscreteDistribution(
     const Utility::ArrayView<const InputIndepQuantity>& independent_quantities,
     const Utility::ArrayView<const InputDepQuantity>& dependent_quantities,
-    const bool treat_as_continuous = false );
+    const bool treat_as_continuous = false,
+    const bool use_alias_sampling = false );
 
   //! Copy constructor
   template<typename InputIndepUnit, typename InputDepUnit>
@@ -152,6 +169,9 @@ public:
   //! Test if the distribution is continuous
   bool isContinuous() const override;
 
+  //! Check if alias sampling is used
+  bool isAliasSamplingUsed() const;
+
   //! Method for placing the object in an output stream
   void toStream( std::ostream& os ) const override;
 
@@ -189,6 +209,13 @@ private:
   IndepQuantity sampleImplementation( double random_number,
 				      size_t& sampled_bin_index ) const;
 
+  // Return a random sample using the alias table and record the bin index
+  IndepQuantity sampleAliasImplementation( const double random_number,
+                                           size_t& sampled_bin_index ) const;
+
+  // Initialize the alias table
+  void initializeAliasTable();
+
   // Initialize the distribution
   void initializeDistribution(
                     const Utility::ArrayView<const double>& independent_values,
@@ -258,6 +285,16 @@ private:
 
   // Bool to treat the distribution as continuous or not
   bool d_continuous;
+
+  // Bool to sample using the alias table or not
+  bool d_alias_sampling;
+
+  // The alias table thresholds (a scaled random number that falls at or
+  // below the threshold of a bin will select the bin alias)
+  std::vector<double> d_alias_thresholds;
+
+  // The alias table bin aliases
+  std::vector<size_t> d_alias_indices;
 };
 
 /*! The discrete distribution (unit-agnostic)
@@ -267,7 +304,7 @@ typedef UnitAwareDiscreteDistribution<void,void> DiscreteDistribution;
   
 } // end Utility namespace
 
-BOOST_SERIALIZATION_DISTRIBUTION2_VERSION( UnitAwareDiscreteDistribution, 0 );
+BOOST_SERIALIZATION_DISTRIBUTION2_VERSION( UnitAwareDiscreteDistribution, 1 );
 BOOST_SERIALIZATION_DISTRIBUTION2_EXPORT_STANDARD_KEY( DiscreteDistribution );
 
 //---------------------------------------------------------------------------//
@@ -34,11 +34,13 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
 			      const std::vector<double>& independent_values,
 			      const std::vector<double>& dependent_values,
 			      const bool interpret_dependent_values_as_cdf,
-                              const bool treat_as_continuous )
+                              const bool treat_as_continuous,
+                              const bool use_alias_sampling )
   : UnitAwareDiscreteDistribution( Utility::arrayViewOfConst( independent_values ),
                                    Utility::arrayViewOfConst( dependent_values ),
                                    interpret_dependent_values_as_cdf,
-                                   treat_as_continuous )
+                                   treat_as_continuous,
+                                   use_alias_sampling )
 { /* ... */ }
 
 // Basic View Constructor (potentially dangerous)
@@ -50,10 +52,14 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
                     const Utility::ArrayView<const double>& independent_values,
                     const Utility::ArrayView<const double>& dependent_values,
                     const bool interpret_dependent_values_as_cdf,
-                    const bool treat_as_continuous )
+                    const bool treat_as_continuous,
+                    const bool use_alias_sampling )
   : d_distribution( independent_values.size() ),
     d_norm_constant(),
-    d_continuous( treat_as_continuous )
+    d_continuous( treat_as_continuous ),
+    d_alias_sampling( use_alias_sampling ),
+    d_alias_thresholds(),
+    d_alias_indices()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_values,
@@ -73,10 +79,12 @@ template<typename InputIndepQuantity>
 UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteDistribution(
 	      const std::vector<InputIndepQuantity>& independent_quantities,
 	      const std::vector<double>& dependent_values,
-              const bool treat_as_continuous )
+              const bool treat_as_continuous,
+              const bool use_alias_sampling )
   : UnitAwareDiscreteDistribution( Utility::arrayViewOfConst(independent_quantities),
                                    Utility::arrayViewOfConst(dependent_values),
-                                   treat_as_continuous )
+                                   treat_as_continuous,
+                                   use_alias_sampling )
 { /* ... */ }
 
 // CDF view constructor
@@ -85,10 +93,14 @@ template<typename InputIndepQuantity>
 UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteDistribution(
     const Utility::ArrayView<const InputIndepQuantity>& independent_quantities,
     const Utility::ArrayView<const double>& dependent_values,
-    const bool treat_as_continuous )
+    const bool treat_as_continuous,
+    const bool use_alias_sampling )
   : d_distribution( independent_quantities.size() ),
     d_norm_constant(),
-    d_continuous( treat_as_continuous )
+    d_continuous( treat_as_continuous ),
+    d_alias_sampling( use_alias_sampling ),
+    d_alias_thresholds(),
+    d_alias_indices()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_quantities, dependent_values, true );
@@ -105,10 +117,12 @@ template<typename InputIndepQuantity,typename InputDepQuantity>
 UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteDistribution(
 	      const std::vector<InputIndepQuantity>& independent_quantities,
 	      const std::vector<InputDepQuantity>& dependent_quantities,
-              const bool treat_as_continuous )
+              const bool treat_as_continuous,
+              const bool use_alias_sampling )
   : UnitAwareDiscreteDistribution( Utility::arrayViewOfConst(independent_quantities),
                                    Utility::arrayViewOfConst(dependent_quantities),
-                                   treat_as_continuous )
+                                   treat_as_continuous,
+                                   use_alias_sampling )
 { /* ... */ }
 
 // View constructor
@@ -117,10 +131,14 @@ template<typename InputIndepQuantity,typename InputDepQuantity>
 UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteDistribution(
     const Utility::ArrayView<const InputIndepQuantity>& independent_quantities,
     const Utility::ArrayView<const InputDepQuantity>& dependent_quantities,
-    const bool treat_as_continuous )
+    const bool treat_as_continuous,
+    const bool use_alias_sampling )
   : d_distribution( independent_quantities.size() ),
     d_norm_constant(),
-    d_continuous( treat_as_continuous )
+    d_continuous( treat_as_continuous ),
+    d_alias_sampling( use_alias_sampling ),
+    d_alias_thresholds(),
+    d_alias_indices()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_quantities,
@@ -146,7 +164,10 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
 	  const UnitAwareDiscreteDistribution<InputIndepUnit,InputDepUnit>& dist_instance )
   : d_distribution(),
     d_norm_constant(),
-    d_continuous( dist_instance.d_continuous )
+    d_continuous( dist_instance.d_continuous ),
+    d_alias_sampling( dist_instance.d_alias_sampling ),
+    d_alias_thresholds(),
+    d_alias_indices()
 {
   // Make sure that the distribution is valid
   testPrecondition( dist_instance.d_distribution.size() > 0 );
@@ -175,7 +196,10 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
   const UnitAwareDiscreteDistribution<void,void>& unitless_dist_instance, int )
   : d_distribution(),
     d_norm_constant(),
-    d_continuous( unitless_dist_instance.d_continuous )
+    d_continuous( unitless_dist_instance.d_continuous ),
+    d_alias_sampling( unitless_dist_instance.d_alias_sampling ),
+    d_alias_thresholds(),
+    d_alias_indices()
 {
   // Make sure that the distribution is valid
   testPrecondition( unitless_dist_instance.d_distribution.size() > 0 );
@@ -227,6 +251,9 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::operator=(
     d_distribution = dist_instance.d_distribution;
     d_norm_constant = dist_instance.d_norm_constant;
     d_continuous = dist_instance.d_continuous;
+    d_alias_sampling = dist_instance.d_alias_sampling;
+    d_alias_thresholds = dist_instance.d_alias_thresholds;
+    d_alias_indices = dist_instance.d_alias_indices;
   }
 
   return *this;
@@ -329,7 +356,10 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sample() const
 
   size_t dummy_index;
 
-  return this->sampleImplementation( random_number, dummy_index );
+  if( d_alias_sampling )
+    return this->sampleAliasImplementation( random_number, dummy_index );
+  else
+    return this->sampleImplementation( random_number, dummy_index );
 }
 
 // Return a random sample and record the number of trials
@@ -350,7 +380,10 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sampleAndRecordBin
 {
   double random_number = RandomNumberGenerator::getRandomNumber<double>();
 
-  return this->sampleImplementation( random_number, sampled_bin_index );
+  if( d_alias_sampling )
+    return this->sampleAliasImplementation( random_number, sampled_bin_index );
+  else
+    return this->sampleImplementation( random_number, sampled_bin_index );
 }
 
 // Return a random sample and sampled index from the corresponding CDF
@@ -398,6 +431,38 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sampleImplementati
   return Utility::get<0>(d_distribution[sampled_bin_index]);
 }
 
+// Return a random sample using the alias table and record the bin index
+/*! \details The random number is scaled by the number of bins. The integer
+ * part selects a bin and the fractional part decides if the bin or its
+ * alias will be sampled.
+ */
+template<typename IndependentUnit,typename DependentUnit>
+inline typename UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::IndepQuantity
+UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sampleAliasImplementation(
+					    const double random_number,
+					    size_t& sampled_bin_index ) const
+{
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+  // Make sure that the alias table has been constructed
+  testPrecondition( d_alias_thresholds.size() == d_distribution.size() );
+
+  const double scaled_random_number = random_number*d_alias_thresholds.size();
+
+  size_t bin_index = (size_t)scaled_random_number;
+
+  if( bin_index == d_alias_thresholds.size() )
+    --bin_index;
+
+  if( scaled_random_number - bin_index <= d_alias_thresholds[bin_index] )
+    sampled_bin_index = d_alias_indices[bin_index];
+  else
+    sampled_bin_index = bin_index;
+
+  return Utility::get<0>(d_distribution[sampled_bin_index]);
+}
+
 // Return a random sample from the distribution at the given CDF value in a subrange
 template<typename IndependentUnit,typename DependentUnit>
 inline typename UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::IndepQuantity
@@ -451,6 +516,13 @@ bool UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::isContinuous(
   return d_continuous;
 }
 
+// Check if alias sampling is used
+template<typename IndependentUnit,typename DependentUnit>
+bool UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::isAliasSamplingUsed() const
+{
+  return d_alias_sampling;
+}
+
 // Method for placing the object in an output stream
 template<typename IndependentUnit,typename DependentUnit>
 void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::toStream( std::ostream& os ) const
@@ -477,6 +549,9 @@ void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::save( Archive
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_continuous );
+  ar & BOOST_SERIALIZATION_NVP( d_alias_sampling );
+
+  // The alias table will be reconstructed when the distribution is loaded
 }
 
 // Load the distribution from an archive
@@ -491,6 +566,17 @@ void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::load( Archive
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_continuous );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_alias_sampling );
+  else
+    d_alias_sampling = false;
+
+  d_alias_thresholds.clear();
+  d_alias_indices.clear();
+
+  if( d_alias_sampling )
+    this->initializeAliasTable();
 }
 
 // Equality comparison operator
@@ -586,6 +672,9 @@ void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::initializeDis
 
   // Set the normalization constant
   setQuantity( d_norm_constant, 1.0 );
+
+  if( d_alias_sampling )
+    this->initializeAliasTable();
 }
 
 // Initialize the distribution
@@ -623,6 +712,84 @@ void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::initializeDis
 
   // Create a CDF from the raw distribution data
   DataProcessor::calculateDiscreteCDF<1,1>( d_distribution );
+
+  if( d_alias_sampling )
+    this->initializeAliasTable();
+}
+
+// Initialize the alias table
+/*! \details The alias table is constructed with Vose's method. Every bin
+ * of the table has a probability of 1/N. The scaled random number range of
+ * each bin is split so that the bin alias occupies the lower part of the
+ * range and the bin itself occupies the upper part. Bins that do not need
+ * an alias are their own alias.
+ */
+template<typename IndependentUnit,typename DependentUnit>
+void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::initializeAliasTable()
+{
+  const size_t num_bins = d_distribution.size();
+
+  d_alias_thresholds.resize( num_bins );
+  d_alias_indices.resize( num_bins );
+
+  // Calculate the scaled bin probabilities (mean of 1.0)
+  std::vector<double> scaled_probabilities( num_bins );
+
+  std::vector<size_t> small_bins, large_bins;
+  small_bins.reserve( num_bins );
+  large_bins.reserve( num_bins );
+
+  for( size_t i = 0; i < num_bins; ++i )
+  {
+    if( i == 0 )
+      scaled_probabilities[i] = Utility::get<1>(d_distribution[i]);
+    else
+    {
+      scaled_probabilities[i] = Utility::get<1>(d_distribution[i]) -
+        Utility::get<1>(d_distribution[i-1]);
+    }
+
+    scaled_probabilities[i] *= num_bins;
+
+    if( scaled_probabilities[i] < 1.0 )
+      small_bins.push_back( i );
+    else
+      large_bins.push_back( i );
+  }
+
+  // Fill the under-full bins with the over-full bins
+  while( !small_bins.empty() && !large_bins.empty() )
+  {
+    const size_t small_bin = small_bins.back();
+    small_bins.pop_back();
+
+    const size_t large_bin = large_bins.back();
+
+    d_alias_thresholds[small_bin] = 1.0 - scaled_probabilities[small_bin];
+    d_alias_indices[small_bin] = large_bin;
+
+    scaled_probabilities[large_bin] =
+      (scaled_probabilities[large_bin] + scaled_probabilities[small_bin]) - 1.0;
+
+    if( scaled_probabilities[large_bin] < 1.0 )
+    {
+      large_bins.pop_back();
+      small_bins.push_back( large_bin );
+    }
+  }
+
+  // The remaining bins are full (any deviation is due to round-off)
+  for( size_t i = 0; i < large_bins.size(); ++i )
+  {
+    d_alias_thresholds[large_bins[i]] = 0.0;
+    d_alias_indices[large_bins[i]] = large_bins[i];
+  }
+
+  for( size_t i = 0; i < small_bins.size(); ++i )
+  {
+    d_alias_thresholds[small_bins[i]] = 0.0;
+    d_alias_indices[small_bins[i]] = small_bins[i];
+  }
 }
 
 // Reconstruct original distribution
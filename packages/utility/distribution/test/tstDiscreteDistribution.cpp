@@ -900,6 +900,137 @@ FRENSIE_UNIT_TEST( DiscreteDistribution, sampleAndRecordBinIndex )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled using an alias table
+FRENSIE_UNIT_TEST( DiscreteDistribution, sampleAndRecordBinIndex_alias )
+{
+  Utility::DiscreteDistribution alias_distribution( {-1.0, 0.0, 1.0},
+                                                    {1.0, 2.0, 1.0},
+                                                    false,
+                                                    false,
+                                                    true );
+
+  std::vector<double> fake_stream( 7 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.05;
+  fake_stream[2] = 0.1;
+  fake_stream[3] = 0.5;
+  fake_stream[4] = 0.7;
+  fake_stream[5] = 0.8;
+  fake_stream[6] = 1.0 - 1.0e-15;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  size_t bin_index;
+
+  // The first alias table bin (first bin: 3/4, alias (second bin): 1/4)
+  double sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 0.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 1u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 0.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 1u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, -1.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 0u );
+
+  // The second alias table bin (second bin: 1)
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 0.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 1u );
+
+  // The third alias table bin (third bin: 3/4, alias (second bin): 1/4)
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 0.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 1u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 1.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 2u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 1.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 2u );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // Sampling with a random number always uses the cdf
+  FRENSIE_CHECK_EQUAL( alias_distribution.sampleWithRandomNumber( 0.1 ), -1.0 );
+  FRENSIE_CHECK_EQUAL( alias_distribution.sampleWithRandomNumber( 0.7 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( alias_distribution.sampleWithRandomNumber( 0.8 ), 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the alias table sampling frequencies match the bin probabilities
+FRENSIE_UNIT_TEST( DiscreteDistribution, sampleAndRecordBinIndex_alias_frequencies )
+{
+  // The first bin probability is below 1/2 (the alias table maps random
+  // numbers to bins differently than the cdf)
+  std::vector<double> probabilities( {0.1, 0.2, 0.3, 0.15, 0.25} );
+
+  Utility::DiscreteDistribution alias_distribution( {-2.0, -1.0, 0.0, 1.0, 2.0},
+                                                    probabilities,
+                                                    false,
+                                                    false,
+                                                    true );
+
+  Utility::DiscreteDistribution cdf_distribution( {-2.0, -1.0, 0.0, 1.0, 2.0},
+                                                  probabilities );
+
+  FRENSIE_CHECK( alias_distribution.isAliasSamplingUsed() );
+  FRENSIE_CHECK( !cdf_distribution.isAliasSamplingUsed() );
+
+  // Sample with a uniform grid of random numbers
+  const size_t number_of_samples = 100000;
+
+  std::vector<double> fake_stream( number_of_samples );
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+    fake_stream[i] = (i + 0.5)/number_of_samples;
+
+  std::vector<double> alias_frequencies( probabilities.size(), 0.0 ),
+    cdf_frequencies( probabilities.size(), 0.0 );
+
+  size_t bin_index;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+  {
+    alias_distribution.sampleAndRecordBinIndex( bin_index );
+
+    alias_frequencies[bin_index] += 1.0/number_of_samples;
+  }
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+  {
+    cdf_distribution.sampleAndRecordBinIndex( bin_index );
+
+    cdf_frequencies[bin_index] += 1.0/number_of_samples;
+  }
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( alias_frequencies, probabilities, 1e-3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( cdf_frequencies, probabilities, 1e-3 );
+
+  // The sampling frequencies must also match with a true random stream
+  std::fill( alias_frequencies.begin(), alias_frequencies.end(), 0.0 );
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+  {
+    alias_distribution.sampleAndRecordBinIndex( bin_index );
+
+    alias_frequencies[bin_index] += 1.0/number_of_samples;
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( alias_frequencies, probabilities, 5e-2 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the unit-aware distribution can be sampled
 FRENSIE_UNIT_TEST( UnitAwareDiscreteDistribution, sampleAndRecordBinIndex )
@@ -1453,6 +1584,32 @@ FRENSIE_UNIT_TEST( DiscreteDistribution, isContinuous )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check if alias sampling is used
+FRENSIE_UNIT_TEST( DiscreteDistribution, isAliasSamplingUsed )
+{
+  {
+    Utility::DiscreteDistribution tmp_dist( {-1.0, 0.0, 1.0},
+                                            {1.0, 2.0, 1.0} );
+
+    FRENSIE_CHECK( !tmp_dist.isAliasSamplingUsed() );
+  }
+
+  {
+    Utility::DiscreteDistribution tmp_dist( {-1.0, 0.0, 1.0},
+                                            {1.0, 2.0, 1.0},
+                                            false,
+                                            false,
+                                            true );
+
+    FRENSIE_CHECK( tmp_dist.isAliasSamplingUsed() );
+
+    Utility::DiscreteDistribution copy_tmp_dist( tmp_dist );
+
+    FRENSIE_CHECK( copy_tmp_dist.isAliasSamplingUsed() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check if the distribution is continuous
 FRENSIE_UNIT_TEST( UnitAwareDiscreteDistribution, isContinuous )
@@ -1647,8 +1804,12 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DiscreteDistribution,
     Utility::DiscreteDistribution
       discrete_dist_a( independent_values, dependent_values );
 
+    Utility::DiscreteDistribution
+      discrete_dist_c( independent_values, dependent_values, false, false, true );
+
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << boost::serialization::make_nvp( "discrete_dist_a", discrete_dist_a ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << boost::serialization::make_nvp( "discrete_dist_b", cdf_cons_distribution ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << boost::serialization::make_nvp( "discrete_dist_c", discrete_dist_c ) );
   }
 
   // Copy the archive ostream to an istream
@@ -1684,6 +1845,22 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DiscreteDistribution,
   FRENSIE_CHECK_EQUAL( discrete_dist_b->evaluate( 0.5 ), 0.0 );
   FRENSIE_CHECK_EQUAL( discrete_dist_b->evaluate( 1.0 ), 0.25 );
   FRENSIE_CHECK_EQUAL( discrete_dist_b->evaluate( 2.0 ), 0.0 );
+
+  Utility::DiscreteDistribution discrete_dist_c;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> boost::serialization::make_nvp( "discrete_dist_c", discrete_dist_c ) );
+  FRENSIE_CHECK( !discrete_dist_a.isAliasSamplingUsed() );
+  FRENSIE_CHECK( discrete_dist_c.isAliasSamplingUsed() );
+  FRENSIE_CHECK_EQUAL( discrete_dist_c.evaluate( 0.0 ), 2.0 );
+
+  std::vector<double> fake_stream( {0.1, 0.7} );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  FRENSIE_CHECK_EQUAL( discrete_dist_c.sample(), -1.0 );
+  FRENSIE_CHECK_EQUAL( discrete_dist_c.sample(), 0.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
 //---------------------------------------------------------------------------//
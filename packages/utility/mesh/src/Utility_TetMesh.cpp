@@ -6,6 +6,11 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
 // Boost Includes
 #include <boost/serialization/array_wrapper.hpp>
 
@@ -116,6 +121,20 @@ private:
   void createKDTree( moab::Range& all_tet_elements,
                      const bool verbose );
 
+  // Create the tet face adjacency data
+  void createTetAdjacencyData( const bool verbose );
+
+  // Find the tet that a ray enters the mesh through
+  bool findRayEntryTet( const double start_point[3],
+                        const double direction[3],
+                        const double track_length,
+                        const double current_distance,
+                        std::vector<double>& ray_tet_intersections,
+                        bool& ray_tet_intersections_computed,
+                        double& entry_distance,
+                        double& exit_distance,
+                        size_t& entry_tet_index ) const;
+
 #endif // end HAVE_FRENSIE_MOAB
 
   // Save the data to an archive
@@ -134,6 +153,12 @@ private:
   // The tolerance used for geometric tests
   static const double s_tol;
 
+  // The neighbor index assigned to a tet face on the mesh boundary
+  static const size_t s_no_neighbor;
+
+  // The max number of consecutive zero length steps allowed in a tet walk
+  static const size_t s_max_zero_length_steps;
+
 #ifdef HAVE_FRENSIE_MOAB
 
   // The input file that stores the mesh
@@ -160,11 +185,19 @@ private:
 
   // The tet element handles
   std::vector<ElementHandle> d_tets;
+
+  // The tet element handle indices
+  std::unordered_map<ElementHandle,size_t> d_tet_indices;
+
+  // The neighbor of each tet across each face (face i is opposite vertex i)
+  std::vector<std::array<size_t,4> > d_tet_neighbors;
 #endif // end HAVE_FRENSIE_MOAB
 };
 
 // Initialize the static member data
 const double TetMeshImpl::s_tol = 1e-6;
+const size_t TetMeshImpl::s_no_neighbor = std::numeric_limits<size_t>::max();
+const size_t TetMeshImpl::s_max_zero_length_steps = 64;
 
 } // end Utility namespace
 
@@ -216,7 +249,9 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
     d_kd_tree_root(),
     d_kd_tree( new moab::AdaptiveKDTree( d_moab_interface.get() ) ),
     d_tet_barycentric_data(),
-    d_tets()
+    d_tets(),
+    d_tet_indices(),
+    d_tet_neighbors()
 #endif // end HAVE_FRENSIE_MOAB
 {
 #ifdef HAVE_FRENSIE_MOAB
@@ -277,6 +312,9 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
     }
   }
 
+  // Create the tet face adjacency data
+  this->createTetAdjacencyData( verbose_construction );
+
   // Create the kd-tree
   this->createKDTree( all_tet_elements, verbose_construction );
 #endif // end HAVE_FRENSIE_MOAB
@@ -400,6 +438,187 @@ void TetMeshImpl::createKDTree( moab::Range& all_tet_elements,
     FRENSIE_LOG_NOTIFICATION( "done." );
   }
 }
+
+// Create the tet face adjacency data
+/*! \details Each face of a tet is identified by the sorted coordinates of
+ * its three vertices (the vertex coordinates are used instead of the vertex
+ * handles since some mesh file formats store a separate copy of each vertex
+ * for every tet). Sorting the faces of all tets will place the two faces that
+ * are shared by neighboring tets next to each other. Face i of a tet is
+ * opposite vertex i, which is consistent with the vertex ordering used for
+ * the barycentric transform data.
+ */
+void TetMeshImpl::createTetAdjacencyData( const bool verbose_construction )
+{
+  if( verbose_construction )
+  {
+    FRENSIE_LOG_PARTIAL_NOTIFICATION( "Constructing tet adjacency data ... " );
+  }
+
+  // The tet faces (sorted vertex coordinates, tet index, face index)
+  typedef std::tuple<std::array<std::array<double,3>,3>,size_t,unsigned>
+    TetFace;
+
+  std::vector<TetFace> tet_faces;
+  tet_faces.reserve( 4*d_tets.size() );
+
+  d_tet_indices.clear();
+  d_tet_neighbors.assign( d_tets.size(),
+                          std::array<size_t,4>( {s_no_neighbor,
+                                                 s_no_neighbor,
+                                                 s_no_neighbor,
+                                                 s_no_neighbor} ) );
+
+  for( size_t i = 0; i < d_tets.size(); ++i )
+  {
+    d_tet_indices[d_tets[i]] = i;
+
+    moab::EntityHandle tet_handle = d_tets[i];
+
+    std::vector<moab::EntityHandle> vertex_handles;
+
+    moab::ErrorCode return_value =
+      d_moab_interface->get_connectivity( &tet_handle, 1, vertex_handles );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        Utility::MOABException,
+                        moab::ErrorCodeStr[return_value] );
+
+    std::array<double,3> vertices[4];
+
+    for( size_t j = 0; j < 4; ++j )
+    {
+      d_moab_interface->get_coords( &vertex_handles[j],
+                                    1,
+                                    vertices[j].data() );
+    }
+
+    for( unsigned j = 0; j < 4; ++j )
+    {
+      std::array<std::array<double,3>,3> face_vertices;
+
+      for( unsigned k = 0, l = 0; k < 4; ++k )
+      {
+        if( k != j )
+          face_vertices[l++] = vertices[k];
+      }
+
+      std::sort( face_vertices.begin(), face_vertices.end() );
+
+      tet_faces.push_back( std::make_tuple( face_vertices, i, j ) );
+    }
+  }
+
+  std::sort( tet_faces.begin(),
+             tet_faces.end(),
+             []( const TetFace& a, const TetFace& b ){
+               return std::get<0>( a ) < std::get<0>( b ); } );
+
+  for( size_t i = 1; i < tet_faces.size(); ++i )
+  {
+    const TetFace& face = tet_faces[i];
+    const TetFace& previous_face = tet_faces[i-1];
+
+    if( std::get<0>( face ) == std::get<0>( previous_face ) )
+    {
+      d_tet_neighbors[std::get<1>( face )][std::get<2>( face )] =
+        std::get<1>( previous_face );
+
+      d_tet_neighbors[std::get<1>( previous_face )][std::get<2>( previous_face )] =
+        std::get<1>( face );
+    }
+  }
+
+  if( verbose_construction )
+  {
+    FRENSIE_LOG_NOTIFICATION( "done." );
+  }
+}
+
+// Find the tet that a ray enters the mesh through
+/*! \details The kd-tree will be used to find the intersections of the ray
+ * with the tet faces the first time that this method is called for a ray
+ * (the intersections will be cached). The first segment between consecutive
+ * intersections that lies beyond the current distance and inside of the mesh
+ * determines the entry tet. The distance to the end of the segment will also
+ * be returned.
+ */
+bool TetMeshImpl::findRayEntryTet( const double start_point[3],
+                                   const double direction[3],
+                                   const double track_length,
+                                   const double current_distance,
+                                   std::vector<double>& ray_tet_intersections,
+                                   bool& ray_tet_intersections_computed,
+                                   double& entry_distance,
+                                   double& exit_distance,
+                                   size_t& entry_tet_index ) const
+{
+  if( !ray_tet_intersections_computed )
+  {
+    std::vector<moab::EntityHandle> tet_surface_triangles;
+
+    moab::ErrorCode return_value =
+      d_kd_tree->ray_intersect_triangles( d_kd_tree_root,
+                                          s_tol,
+                                          direction,
+                                          start_point,
+                                          tet_surface_triangles,
+                                          ray_tet_intersections,
+                                          0,
+                                          track_length );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        Utility::MOABException,
+                        moab::ErrorCodeStr[return_value] );
+
+    std::sort( ray_tet_intersections.begin(), ray_tet_intersections.end() );
+
+    ray_tet_intersections_computed = true;
+  }
+
+  double segment_start = current_distance;
+
+  for( size_t i = 0; i <= ray_tet_intersections.size(); ++i )
+  {
+    const double segment_end = (i < ray_tet_intersections.size() ?
+                                std::min( ray_tet_intersections[i],
+                                          track_length ) :
+                                track_length );
+
+    // Only consider segments that lie beyond the current distance
+    if( segment_end <= segment_start )
+      continue;
+
+    const double segment_mid = (segment_start + segment_end)/2;
+
+    double segment_mid_point[3] =
+      {direction[0]*segment_mid + start_point[0],
+       direction[1]*segment_mid + start_point[1],
+       direction[2]*segment_mid + start_point[2]};
+
+    // Check that the segment falls in the mesh - if the mesh is concave
+    // it is possible that it falls outside
+    if( this->isPointInMesh( segment_mid_point ) )
+    {
+      ElementHandle element_handle =
+        this->whichElementIsPointIn( segment_mid_point );
+
+      // Make sure that a tet was found (tolerance issue may prevent this)
+      if( element_handle != 0 )
+      {
+        entry_distance = segment_start;
+        exit_distance = segment_end;
+        entry_tet_index = d_tet_indices.find( element_handle )->second;
+
+        return true;
+      }
+    }
+
+    segment_start = segment_end;
+  }
+
+  return false;
+}
 #endif // end HAVE_FRENSIE_MOAB
 
 // Get the mesh type name
@@ -684,6 +903,13 @@ void TetMesh::computeTrackLengths( const double start_point[3],
 }
 
 // Determine the mesh elements that a line segment intersects
+/*! \details The kd-tree is only used to find the tet that the line segment
+ * starts in (or enters the mesh through). The line segment is then walked
+ * from tet to tet using the face adjacency data, with the exit face of each
+ * tet determined from the barycentric coordinates of the current point. The
+ * kd-tree will be used again if the line segment leaves the mesh before it
+ * ends (concave mesh) to find the tet that it re-enters the mesh through.
+ */
 void TetMeshImpl::computeTrackLengths( const double start_point[3],
                                        const double end_point[3],
                                        ElementHandleTrackLengthArray&
@@ -698,138 +924,175 @@ void TetMeshImpl::computeTrackLengths( const double start_point[3],
   double track_length =
     Utility::normalizeVectorAndReturnMagnitude( direction );
 
-  // Determine the distances to intersections with mesh elements
+  // Reset the tet element track lengths
+  tet_element_track_lengths.clear();
+
+  // The intersections of the ray with the tet faces (only computed if the
+  // start point is outside of the mesh or the ray leaves the mesh)
   std::vector<double> ray_tet_intersections;
-  std::vector<moab::EntityHandle> tet_surface_triangles;
+  bool ray_tet_intersections_computed = false;
 
-  moab::ErrorCode return_value =
-    d_kd_tree->ray_intersect_triangles( d_kd_tree_root,
-                                        s_tol,
-                                        direction,
-                                        start_point,
-                                        tet_surface_triangles,
-                                        ray_tet_intersections,
-                                        0,
-                                        track_length );
+  // Find the tet that the ray starts in
+  double current_distance = 0.0;
+  size_t current_tet_index;
 
-  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
-                      Utility::MOABException,
-                      moab::ErrorCodeStr[return_value] );
+  if( this->isPointInMesh( start_point ) )
+  {
+    ElementHandle element_handle = this->whichElementIsPointIn( start_point );
 
-  // Clear the tet surface triangles - not used
-  tet_surface_triangles.clear();
+    if( element_handle != 0 )
+      current_tet_index = d_tet_indices.find( element_handle )->second;
+    else
+      current_tet_index = s_no_neighbor;
+  }
+  else
+    current_tet_index = s_no_neighbor;
 
-  // Reset the tet element track lengths
-  tet_element_track_lengths.clear();
+  // Find the tet that the ray enters the mesh through
+  double segment_exit_distance;
 
-  if( ray_tet_intersections.size() > 0 )
+  if( current_tet_index == s_no_neighbor )
   {
-    // Sort all intersections of the ray with the tets
-    std::sort( ray_tet_intersections.begin(),
-               ray_tet_intersections.end() );
+    if( !this->findRayEntryTet( start_point,
+                                direction,
+                                track_length,
+                                current_distance,
+                                ray_tet_intersections,
+                                ray_tet_intersections_computed,
+                                current_distance,
+                                segment_exit_distance,
+                                current_tet_index ) )
+    {
+      // The track entirely misses the mesh
+      return;
+    }
+  }
 
-    // Remove the first intersection if it is zero (start point on surface)
-    if( ray_tet_intersections.front() == 0.0 )
-      ray_tet_intersections.erase( ray_tet_intersections.begin() );
+  std::array<double,3> current_point;
 
-    // Calculate the tet intersection points and partial track lengths
-    std::vector<moab::CartVect> array_of_hit_points;
+  size_t zero_length_steps = 0;
 
-    // Add the origin point
-    {
-      moab::CartVect start_point_cv( start_point[0],
-                                     start_point[1],
-                                     start_point[2] );
+  // Walk the ray through the tets
+  while( true )
+  {
+    const std::pair<std::array<double,9>,std::array<double,3> >&
+      tet_barycentric_data =
+      d_tet_barycentric_data.find( d_tets[current_tet_index] )->second;
 
-      array_of_hit_points.push_back( start_point_cv );
+    if( current_distance == 0.0 )
+    {
+      current_point = {start_point[0], start_point[1], start_point[2]};
+    }
+    else
+    {
+      current_point = {direction[0]*current_distance + start_point[0],
+                       direction[1]*current_distance + start_point[1],
+                       direction[2]*current_distance + start_point[2]};
     }
 
-    // Add all intermediate points
-    for( size_t i = 0; i < ray_tet_intersections.size(); ++i )
+    // Check if the ray has become stuck due to a tolerance issue - use the
+    // kd-tree intersections to move through the current segment
+    if( zero_length_steps > s_max_zero_length_steps )
     {
-      moab::CartVect hit_point;
+      zero_length_steps = 0;
+
+      if( !this->findRayEntryTet( start_point,
+                                  direction,
+                                  track_length,
+                                  current_distance,
+                                  ray_tet_intersections,
+                                  ray_tet_intersections_computed,
+                                  current_distance,
+                                  segment_exit_distance,
+                                  current_tet_index ) )
+      {
+        break;
+      }
 
-      hit_point[0] = direction[0]*ray_tet_intersections[i]
-        + start_point[0];
-      hit_point[1] = direction[1]*ray_tet_intersections[i]
-        + start_point[1];
-      hit_point[2] = direction[2]*ray_tet_intersections[i]
-        + start_point[2];
+      current_point = {direction[0]*current_distance + start_point[0],
+                       direction[1]*current_distance + start_point[1],
+                       direction[2]*current_distance + start_point[2]};
 
-      array_of_hit_points.push_back( hit_point );
-    }
+      tet_element_track_lengths.push_back( std::make_tuple(
+                                  d_tets[current_tet_index],
+                                  current_point,
+                                  segment_exit_distance - current_distance ) );
 
-    // Add the end point (don't add if the end point lies on the surface)
-    if( ray_tet_intersections.back() < track_length )
-    {
-      moab::CartVect end_point_cv(end_point[0], end_point[1], end_point[2]);
+      if( segment_exit_distance >= track_length )
+        break;
 
-      array_of_hit_points.push_back( end_point_cv );
+      current_distance = segment_exit_distance;
 
-      ray_tet_intersections.push_back( track_length );
+      continue;
     }
 
-    // Determine the tet that each line segment passes through
-    for( size_t i = 0; i < ray_tet_intersections.size(); ++i )
+    double next_distance;
+    unsigned exit_face;
+
+    // The ray ends in the current tet
+    if( Utility::isPointInTet( end_point,
+                               tet_barycentric_data.second.data(),
+                               tet_barycentric_data.first.data(),
+                               s_tol ) )
     {
-      moab::CartVect tet_centroid =
-        (array_of_hit_points[i+1] + array_of_hit_points[i])/2.0;
+      next_distance = track_length;
+    }
+    else
+    {
+      next_distance = current_distance +
+        Utility::calculateDistanceToTetExitFace(
+                                           current_point.data(),
+                                           direction,
+                                           tet_barycentric_data.second.data(),
+                                           tet_barycentric_data.first.data(),
+                                           exit_face,
+                                           s_tol );
+
+      if( next_distance > track_length )
+        next_distance = track_length;
+    }
 
-      // Check that the centroid falls in the mesh - if the mesh is concave
-      // it is possible that it falls outside
-      if( this->isPointInMesh( tet_centroid.array() ) )
-      {
-        ElementHandle element_handle =
-          this->whichElementIsPointIn( tet_centroid.array() );
-
-        // Make sure that a tet was found (tolerance issue may prevent this)
-        if( element_handle == 0 )
-          continue;
-
-        double tet_track_length;
-
-        if( i != 0 )
-        {
-          tet_track_length = ray_tet_intersections[i] -
-            ray_tet_intersections[i-1];
-        }
-        else
-          tet_track_length = ray_tet_intersections[i];
-
-        tet_element_track_lengths.push_back( std::make_tuple(
-                           element_handle,
-                           std::array<double,3>( {array_of_hit_points[i][0],
-                                                  array_of_hit_points[i][1],
-                                                  array_of_hit_points[i][2]} ),
-                           tet_track_length ) );
-      }
+    // Record the track length in the current tet (the ray can pass through
+    // a tet without traveling through it when it crosses an edge or vertex)
+    if( next_distance > current_distance )
+    {
+      tet_element_track_lengths.push_back( std::make_tuple(
+                                           d_tets[current_tet_index],
+                                           current_point,
+                                           next_distance - current_distance ) );
+
+      zero_length_steps = 0;
     }
-  }
+    else
+      ++zero_length_steps;
 
-  // Handle the cases where there are no intersections
-  else
-  {
-    double mid_point[3] = {(end_point[0]+start_point[0])/2,
-                           (end_point[1]+start_point[1])/2,
-                           (end_point[2]+start_point[2])/2};
+    if( next_distance >= track_length )
+      break;
 
-    // case 1: line segment is entirely in one tet
-    if( this->isPointInMesh( mid_point ) )
-    {
-      ElementHandle element_handle = this->whichElementIsPointIn( mid_point );
+    current_distance = next_distance;
 
-      if( element_handle != 0 )
+    // Move to the neighboring tet
+    current_tet_index = d_tet_neighbors[current_tet_index][exit_face];
+
+    // The ray has left the mesh - find the tet that it re-enters the mesh
+    // through (concave mesh)
+    if( current_tet_index == s_no_neighbor )
+    {
+      zero_length_steps = 0;
+
+      if( !this->findRayEntryTet( start_point,
+                                  direction,
+                                  track_length,
+                                  current_distance,
+                                  ray_tet_intersections,
+                                  ray_tet_intersections_computed,
+                                  current_distance,
+                                  segment_exit_distance,
+                                  current_tet_index ) )
       {
-        tet_element_track_lengths.push_back( std::make_tuple(
-                                      element_handle,
-                                      std::array<double,3>( {start_point[0],
-                                                             start_point[1],
-                                                             start_point[2]} ),
-                                      track_length ) );
+        break;
       }
     }
-
-    // case 2: track entirely misses mesh - do nothing
   }
 #endif // end HAVE_FRENSIE_MOAB
 }
@@ -916,6 +1179,9 @@ void TetMeshImpl::load( Archive& ar, const unsigned version )
                         "The tet mesh cannot be loaded from the archive "
                         "because the moab::EntityHandles have changed!" );
   }
+
+  // Reconstruct the tet face adjacency data
+  this->createTetAdjacencyData( false );
 #endif // end HAVE_FRENSIE_MOAB
 }
 
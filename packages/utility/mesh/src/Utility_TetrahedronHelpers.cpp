@@ -9,6 +9,7 @@
 // Std Lib Includes
 #include <math.h>
 #include <cstring>
+#include <limits>
 
 // FRENSIE Includes
 #include "Utility_TetrahedronHelpers.hpp"
@@ -124,6 +125,83 @@ bool isPointInTet( const double point[3],
   }
 }
 
+// Calculate the distance to the face that a ray exits a tet through
+/*! \details The faces of the tet are indexed by the vertex that they are
+ * opposite to (vertex a = 0, vertex b = 1, vertex c = 2,
+ * reference vertex = 3). The barycentric coordinates of a point on the ray
+ * are linear in the distance traveled along the ray, which allows the
+ * distance to each face to be calculated directly. If the point is on a face
+ * (within the tolerance) that the ray is leaving through, a distance of 0.0
+ * will be returned. The point is assumed to be in the tet (within the
+ * tolerance) and the direction is assumed to be a unit vector.
+ */
+double calculateDistanceToTetExitFace( const double point[3],
+                                       const double direction[3],
+                                       const double reference_vertex[3],
+                                       const double barycentric_matrix[9],
+                                       unsigned& exit_face,
+                                       const double tol )
+{
+  // The barycentric coordinates of the point
+  double barycentric_location_vector[4];
+
+  // The rate of change of the barycentric coordinates along the ray
+  double barycentric_direction_vector[4];
+
+  barycentric_location_vector[3] = 1.0;
+  barycentric_direction_vector[3] = 0.0;
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    barycentric_location_vector[i] = barycentric_matrix[3*i] *
+                                     (point[0] - reference_vertex[0]) +
+                                     barycentric_matrix[3*i+1] *
+                                     (point[1] - reference_vertex[1]) +
+                                     barycentric_matrix[3*i+2] *
+                                     (point[2] - reference_vertex[2]);
+
+    barycentric_direction_vector[i] = barycentric_matrix[3*i]*direction[0] +
+                                      barycentric_matrix[3*i+1]*direction[1] +
+                                      barycentric_matrix[3*i+2]*direction[2];
+
+    barycentric_location_vector[3] -= barycentric_location_vector[i];
+    barycentric_direction_vector[3] -= barycentric_direction_vector[i];
+  }
+
+  double distance = std::numeric_limits<double>::infinity();
+
+  exit_face = 0;
+
+  for( unsigned i = 0; i < 4; ++i )
+  {
+    // The ray is only leaving through faces with decreasing coordinates
+    if( barycentric_direction_vector[i] < 0.0 )
+    {
+      // The point is already on the face
+      if( barycentric_location_vector[i] <= tol )
+      {
+        exit_face = i;
+
+        return 0.0;
+      }
+
+      double face_distance =
+        -barycentric_location_vector[i]/barycentric_direction_vector[i];
+
+      if( face_distance < distance )
+      {
+        distance = face_distance;
+        exit_face = i;
+      }
+    }
+  }
+
+  // Make sure that an exit face was found
+  testPostcondition( distance < std::numeric_limits<double>::infinity() );
+
+  return distance;
+}
+
 } // end Utility namespace
 
 //---------------------------------------------------------------------------//
@@ -33,6 +33,14 @@ bool isPointInTet( const double point[3],
                    const double barycentric_matrix[9],
                    const double tol = 1e-6 );
 
+//! Calculate the distance to the face that a ray exits a tet through
+double calculateDistanceToTetExitFace( const double point[3],
+                                       const double direction[3],
+                                       const double reference_vertex[3],
+                                       const double barycentric_matrix[9],
+                                       unsigned& exit_face,
+                                       const double tol = 1e-6 );
+
 } // end Utility namespace
 
 #endif // end UTILITY_TETRAHEDRON_HELPERS_HPP
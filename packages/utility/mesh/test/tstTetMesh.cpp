@@ -447,6 +447,57 @@ FRENSIE_UNIT_TEST( TetMesh, computeTrackLengths )
   FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[0]),
                                    0.20412414523193148,
                                    1e-12 );
+
+  // Start point in mesh element, end point in a different mesh element
+  start_point[0] = 0.1;
+  start_point[1] = 0.2;
+  start_point[2] = 0.3;
+
+  end_point[0] = 0.9;
+  end_point[1] = 0.7;
+  end_point[2] = 0.95;
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[0]), 5764607523034234883 );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>(contribution[0]),
+                       (std::array<double,3>( {0.1, 0.2, 0.3} )) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[0]),
+                                   0.38188130791298636,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[1]), 5764607523034234881 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution[1]),
+                                   (std::array<double,3>( {0.36666666666666667, 0.36666666666666667, 0.51666666666666667} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[1]),
+                                   0.7637626158259736,
+                                   1e-12 );
+
+  // Start point in mesh element, end point in a different mesh element
+  // (the track passes through the edge shared by all mesh elements)
+  start_point[0] = 0.05;
+  start_point[1] = 0.9;
+  start_point[2] = 0.1;
+
+  end_point[0] = 0.95;
+  end_point[1] = 0.1;
+  end_point[2] = 0.9;
+
+  mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[0]), 5764607523034234884 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[0]),
+                                   0.722841614740048,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[1]), 5764607523034234882 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution[1]),
+                                   (std::array<double,3>( {0.5, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[1]),
+                                   0.722841614740048,
+                                   1e-12 );
 }
 
 //---------------------------------------------------------------------------//
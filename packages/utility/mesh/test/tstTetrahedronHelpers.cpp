@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <vector>
+#include <cmath>
 
 // FRENSIE Includes
 #include "Utility_TetrahedronHelpers.hpp"
@@ -103,6 +104,98 @@ FRENSIE_UNIT_TEST( TetrahedronHelpers, isPointInTet )
   FRENSIE_CHECK( !is_point_out_in_tet );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the distance to the exit face of a tet can be calculated
+FRENSIE_UNIT_TEST( TetrahedronHelpers, calculateDistanceToTetExitFace )
+{
+  const double reference_vertex[3] = { 0.0, 0.0, 1.0 };
+
+  std::array<double,9> transform_tuple =
+    {-1.0, -1.0, -1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0};
+
+  double point[3] = { 0.25, 0.25, 0.25 };
+  double direction[3] = { 1.0, 0.0, 0.0 };
+  unsigned exit_face;
+
+  double distance =
+    Utility::calculateDistanceToTetExitFace( point,
+                                             direction,
+                                             reference_vertex,
+                                             transform_tuple.data(),
+                                             exit_face );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.25, 1e-12 );
+  FRENSIE_CHECK_EQUAL( exit_face, 0 );
+
+  direction[0] = -1.0;
+
+  distance = Utility::calculateDistanceToTetExitFace( point,
+                                                      direction,
+                                                      reference_vertex,
+                                                      transform_tuple.data(),
+                                                      exit_face );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.25, 1e-12 );
+  FRENSIE_CHECK_EQUAL( exit_face, 1 );
+
+  direction[0] = 0.0;
+  direction[1] = -1.0;
+
+  distance = Utility::calculateDistanceToTetExitFace( point,
+                                                      direction,
+                                                      reference_vertex,
+                                                      transform_tuple.data(),
+                                                      exit_face );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.25, 1e-12 );
+  FRENSIE_CHECK_EQUAL( exit_face, 2 );
+
+  direction[1] = 0.0;
+  direction[2] = -1.0;
+
+  distance = Utility::calculateDistanceToTetExitFace( point,
+                                                      direction,
+                                                      reference_vertex,
+                                                      transform_tuple.data(),
+                                                      exit_face );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.25, 1e-12 );
+  FRENSIE_CHECK_EQUAL( exit_face, 3 );
+
+  point[0] = 0.1;
+  point[1] = 0.1;
+  point[2] = 0.1;
+  direction[0] = 1.0/sqrt(3.0);
+  direction[1] = 1.0/sqrt(3.0);
+  direction[2] = 1.0/sqrt(3.0);
+
+  distance = Utility::calculateDistanceToTetExitFace( point,
+                                                      direction,
+                                                      reference_vertex,
+                                                      transform_tuple.data(),
+                                                      exit_face );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.7/sqrt(3.0), 1e-12 );
+  FRENSIE_CHECK_EQUAL( exit_face, 0 );
+
+  // Point on the exit face
+  point[0] = 0.25;
+  point[1] = 0.25;
+  point[2] = 0.0;
+  direction[0] = 0.0;
+  direction[1] = 0.0;
+  direction[2] = -1.0;
+
+  distance = Utility::calculateDistanceToTetExitFace( point,
+                                                      direction,
+                                                      reference_vertex,
+                                                      transform_tuple.data(),
+                                                      exit_face );
+
+  FRENSIE_CHECK_EQUAL( distance, 0.0 );
+  FRENSIE_CHECK_EQUAL( exit_face, 3 );
+}
+
 //---------------------------------------------------------------------------//
 // end tstTetrahedronHelpers.cpp
 //---------------------------------------------------------------------------//
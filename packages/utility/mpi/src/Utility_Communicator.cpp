@@ -80,6 +80,24 @@ public:
   std::shared_ptr<const Communicator> split( int color, int key ) const override
   { return s_null_comm; }
 
+  /*! \brief Split the communicator into disjoint communicators each of which
+   * only contains processes that can share memory
+   */
+  std::shared_ptr<const Communicator> splitShared() const override
+  { return s_null_comm; }
+
+  //! Allocate a block of memory that is shared by all processes in the comm
+  std::shared_ptr<void> allocateSharedMemory( const size_t ) const override
+  {
+    THROW_EXCEPTION( InvalidCommunicator,
+                     "Shared memory cannot be allocated with a null "
+                     "communicator!" );
+  }
+
+  //! Free the blocks of shared memory that are no longer used
+  void freeSharedMemory() const override
+  { /* ... */ }
+
   //! Create a timer
   std::shared_ptr<Timer> createTimer() const override
   { return OpenMPProperties::createTimer(); }
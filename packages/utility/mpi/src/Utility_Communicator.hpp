@@ -473,6 +473,11 @@ void scan( const Communicator& comm,
            const Utility::ArrayView<T>& output_values,
            ReduceOperation op );
 
+//! Allocate an array that is shared by all processes in the comm
+template<typename T>
+std::shared_ptr<T> allocateSharedArray( const Communicator& comm,
+                                        const size_t number_of_elements );
+
 } // end Utility namespace
 
 //---------------------------------------------------------------------------//
@@ -181,6 +181,19 @@ public:
    */
   virtual std::shared_ptr<const Communicator> split( int color, int key ) const = 0;
 
+  /*! \brief Split the communicator into disjoint communicators each of which
+   * only contains processes that can share memory (i.e. are on the same node)
+   */
+  virtual std::shared_ptr<const Communicator> splitShared() const = 0;
+
+  /*! \brief Allocate a block of memory that is shared by all processes in
+   * the communicator (collective)
+   */
+  virtual std::shared_ptr<void> allocateSharedMemory( const size_t number_of_bytes ) const = 0;
+
+  //! Free the blocks of shared memory that are no longer used (collective)
+  virtual void freeSharedMemory() const = 0;
+
   //! Create a timer
   virtual std::shared_ptr<Timer> createTimer() const = 0;
 
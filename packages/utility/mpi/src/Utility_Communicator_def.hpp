@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <string>
 #include <utility>
+#include <type_traits>
 
 // FRENSIE Includes
 #include "Utility_Tuple.hpp"
@@ -2647,6 +2648,26 @@ void scan( const Communicator& comm,
   }
 }
 
+// Allocate an array that is shared by all processes in the comm
+/*! \details This is a collective operation (see
+ * Utility::Communicator::allocateSharedMemory). The array elements will not
+ * be initialized, which is why only trivially copyable types are allowed.
+ * \ingroup mpi
+ */
+template<typename T>
+std::shared_ptr<T> allocateSharedArray( const Communicator& comm,
+                                        const size_t number_of_elements )
+{
+  static_assert( std::is_trivially_copyable<T>::value,
+                 "Only trivially copyable types can be stored in shared "
+                 "memory!" );
+
+  std::shared_ptr<void> memory =
+    comm.allocateSharedMemory( number_of_elements*sizeof(T) );
+
+  return std::shared_ptr<T>( memory, static_cast<T*>( memory.get() ) );
+}
+
 } // end Utility namespace
 
 // Explicit templateinstantiations for comm helpers
@@ -6,12 +6,92 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <list>
+
 // FRENSIE Includes
 #include "Utility_MPICommunicator.hpp"
 #include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace Utility{
 
+#ifdef HAVE_FRENSIE_MPI
+namespace{
+
+// A shared memory window allocated with MPICommunicator::allocateSharedMemory
+struct SharedMemoryWindow
+{
+  // The communicator that the window was allocated with
+  boost::mpi::communicator comm;
+
+  // The window
+  MPI_Win window;
+
+  // The local handle to the window memory
+  std::weak_ptr<void> memory;
+};
+
+// The shared memory windows that have not been freed (in allocation order)
+std::list<SharedMemoryWindow>& getSharedMemoryWindows()
+{
+  static std::list<SharedMemoryWindow> windows;
+
+  return windows;
+}
+
+// Free all of the shared memory windows
+/*! \details This is the delete callback of an attribute that is attached to
+ * MPI_COMM_SELF, which MPI_Finalize calls before MPI is shut down. Every
+ * process frees its windows in allocation order so the collective
+ * MPI_Win_free calls will match up.
+ */
+int freeAllSharedMemoryWindows( MPI_Comm, int, void*, void* )
+{
+  std::list<SharedMemoryWindow>& windows = getSharedMemoryWindows();
+
+  while( !windows.empty() )
+  {
+    MPI_Win_free( &windows.front().window );
+
+    windows.pop_front();
+  }
+
+  return MPI_SUCCESS;
+}
+
+// Register a shared memory window
+void registerSharedMemoryWindow( const boost::mpi::communicator& comm,
+                                 const MPI_Win window,
+                                 const std::shared_ptr<void>& memory )
+{
+  static bool finalize_callback_attached = false;
+
+  if( !finalize_callback_attached )
+  {
+    int keyval;
+
+    MPI_Comm_create_keyval( MPI_COMM_NULL_COPY_FN,
+                            &freeAllSharedMemoryWindows,
+                            &keyval,
+                            NULL );
+
+    MPI_Comm_set_attr( MPI_COMM_SELF, keyval, NULL );
+
+    finalize_callback_attached = true;
+  }
+
+  SharedMemoryWindow new_window;
+  new_window.comm = comm;
+  new_window.window = window;
+  new_window.memory = memory;
+
+  getSharedMemoryWindows().push_back( new_window );
+}
+  
+} // end anonymous namespace
+#endif // end HAVE_FRENSIE_MPI
+
 // Constructor
 MPICommunicator::MPICommunicator()
 { /* ... */ }
@@ -139,6 +219,149 @@ MPICommunicator::split( int MPI_ENABLED_PARAMETER(color),
 #endif // end HAVE_FRENSIE_MPI
 }
 
+// Split the communicator into disjoint communicators each of which only
+// contains processes that can share memory (i.e. are on the same node)
+/*! \details The rank ordering of the processes in each sub-communicator will
+ * follow the rank ordering of this communicator.
+ */
+std::shared_ptr<const Communicator> MPICommunicator::splitShared() const
+{
+#ifdef HAVE_FRENSIE_MPI
+  MPI_Comm raw_sub_comm;
+
+  int return_value = MPI_Comm_split_type( (MPI_Comm)d_comm,
+                                          MPI_COMM_TYPE_SHARED,
+                                          d_comm.rank(),
+                                          MPI_INFO_NULL,
+                                          &raw_sub_comm );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+                      CommunicationError,
+                      "The communicator could not be split into shared "
+                      "memory communicators (MPI error code = "
+                      << return_value << ")!" );
+
+  boost::mpi::communicator sub_comm( raw_sub_comm,
+                                     boost::mpi::comm_take_ownership );
+
+  return std::shared_ptr<const Communicator>( new MPICommunicator( sub_comm ) );
+#else
+  return Communicator::getNull();
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Allocate a block of memory that is shared by all processes in the comm
+/*! \details This is a collective operation - every process in the
+ * communicator must call it. All of the processes must also be able to share
+ * memory, which can be guaranteed by only calling this method with a
+ * communicator returned from splitShared. The memory is allocated by the
+ * process with rank 0 in an MPI-3 shared memory window and every other
+ * process maps it into its own address space. Writes made by one process are
+ * only guaranteed to be visible to the other processes after a barrier.
+ * Freeing the window is also a collective operation, which is why the
+ * memory is not freed when the returned pointer is destroyed (the processes
+ * will not destroy their copies at the same time). The memory will be freed
+ * by freeSharedMemory once the processes no longer use it, or by
+ * MPI_Finalize.
+ */
+std::shared_ptr<void> MPICommunicator::allocateSharedMemory(
+                     const size_t MPI_ENABLED_PARAMETER(number_of_bytes) ) const
+{
+#ifdef HAVE_FRENSIE_MPI
+  MPI_Win window;
+  void* local_memory;
+
+  int return_value =
+    MPI_Win_allocate_shared( (d_comm.rank() == 0 ? (MPI_Aint)number_of_bytes : 0),
+                             1,
+                             MPI_INFO_NULL,
+                             (MPI_Comm)d_comm,
+                             &local_memory,
+                             &window );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+                      CommunicationError,
+                      "Could not allocate " << number_of_bytes << " bytes "
+                      "of shared memory (MPI error code = "
+                      << return_value << ")!" );
+
+  // Map the memory allocated by the root process
+  MPI_Aint shared_size;
+  int displacement_unit;
+  void* shared_memory;
+
+  return_value = MPI_Win_shared_query( window,
+                                       0,
+                                       &shared_size,
+                                       &displacement_unit,
+                                       &shared_memory );
+
+  if( return_value != MPI_SUCCESS )
+  {
+    MPI_Win_free( &window );
+
+    THROW_EXCEPTION( CommunicationError,
+                     "Could not query the shared memory allocated by the "
+                     "root process (MPI error code = "
+                     << return_value << ")!" );
+  }
+
+  // The window will be freed by freeSharedMemory or MPI_Finalize
+  std::shared_ptr<void> memory( shared_memory, []( void* ){} );
+
+  registerSharedMemoryWindow( d_comm, window, memory );
+
+  return memory;
+#else
+  return std::shared_ptr<void>();
+#endif // end HAVE_FRENSIE_MPI
+}
+
+// Free the blocks of shared memory that are no longer used
+/*! \details This is a collective operation - every process that has
+ * allocated shared memory (see allocateSharedMemory) must call it. A block of
+ * shared memory will only be freed once every process that shares it has
+ * destroyed all copies of the pointer returned by allocateSharedMemory. Blocks
+ * that are still in use by any process will be left alone, so it is always
+ * safe to call this method (e.g. after a simulation has been torn down).
+ */
+void MPICommunicator::freeSharedMemory() const
+{
+#ifdef HAVE_FRENSIE_MPI
+  std::list<SharedMemoryWindow>& windows = getSharedMemoryWindows();
+
+  std::list<SharedMemoryWindow>::iterator window_it = windows.begin();
+
+  while( window_it != windows.end() )
+  {
+    int locally_unused = (window_it->memory.expired() ? 1 : 0);
+    int globally_unused;
+
+    int return_value = MPI_Allreduce( &locally_unused,
+                                      &globally_unused,
+                                      1,
+                                      MPI_INT,
+                                      MPI_LAND,
+                                      (MPI_Comm)window_it->comm );
+
+    TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+                        CommunicationError,
+                        "Could not determine if a block of shared memory is "
+                        "still in use (MPI error code = "
+                        << return_value << ")!" );
+
+    if( globally_unused )
+    {
+      MPI_Win_free( &window_it->window );
+
+      window_it = windows.erase( window_it );
+    }
+    else
+      ++window_it;
+  }
+#endif // end HAVE_FRENSIE_MPI
+}
+
 // Create a timer
 std::shared_ptr<Timer> MPICommunicator::createTimer() const
 {
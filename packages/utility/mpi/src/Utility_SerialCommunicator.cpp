@@ -95,6 +95,32 @@ std::shared_ptr<const Communicator> SerialCommunicator::split( int color, int ke
   return s_serial_comm;
 }
 
+// Split the communicator into disjoint communicators each of which only
+// contains processes that can share memory
+std::shared_ptr<const Communicator> SerialCommunicator::splitShared() const
+{
+  return s_serial_comm;
+}
+
+// Allocate a block of memory that is shared by all processes in the comm
+/*! \details Since there is only a single process, the memory will simply be
+ * allocated on the heap.
+ */
+std::shared_ptr<void> SerialCommunicator::allocateSharedMemory(
+                                          const size_t number_of_bytes ) const
+{
+  return std::shared_ptr<void>( new char[number_of_bytes],
+                                std::default_delete<char[]>() );
+}
+
+// Free the blocks of shared memory that are no longer used
+/*! \details The memory allocated by this communicator is freed when the last
+ * copy of the pointer returned by allocateSharedMemory is destroyed so this
+ * method does nothing.
+ */
+void SerialCommunicator::freeSharedMemory() const
+{ /* ... */ }
+
 // Create a timer
 std::shared_ptr<Timer> SerialCommunicator::createTimer() const
 {
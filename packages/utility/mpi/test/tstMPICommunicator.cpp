@@ -200,6 +200,90 @@ FRENSIE_UNIT_TEST( MPICommunicator, split )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a mpi communicator can be split into shared memory comms
+FRENSIE_UNIT_TEST( MPICommunicator, splitShared )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    comm->splitShared();
+
+  FRENSIE_REQUIRE( node_comm.get() != NULL );
+  FRENSIE_REQUIRE( node_comm->isValid() );
+  FRENSIE_CHECK( node_comm->size() >= 1 );
+  FRENSIE_CHECK( node_comm->size() <= comm->size() );
+  FRENSIE_CHECK( node_comm->rank() <= comm->rank() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that shared memory can be allocated
+FRENSIE_UNIT_TEST( MPICommunicator, allocateSharedMemory )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitShared();
+
+  {
+    std::shared_ptr<void> memory =
+      node_comm->allocateSharedMemory( node_comm->size()*sizeof(int) );
+
+    FRENSIE_REQUIRE( memory.get() != NULL );
+
+    // Every process writes its own element
+    int* array = static_cast<int*>( memory.get() );
+
+    array[node_comm->rank()] = node_comm->rank();
+
+    node_comm->barrier();
+
+    // Every process can see the elements written by the other processes
+    for( int i = 0; i < node_comm->size(); ++i )
+    {
+      FRENSIE_CHECK_EQUAL( array[i], i );
+    }
+
+    node_comm->barrier();
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that shared memory is only freed once no process uses it
+FRENSIE_UNIT_TEST( MPICommunicator, freeSharedMemory )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    comm->splitShared();
+
+  std::shared_ptr<void> memory =
+    node_comm->allocateSharedMemory( sizeof(int) );
+
+  FRENSIE_REQUIRE( memory.get() != NULL );
+
+  if( node_comm->rank() == 0 )
+    *static_cast<int*>( memory.get() ) = 5;
+
+  node_comm->barrier();
+
+  // The processes release the memory at different times - the memory must
+  // not be freed while any process still uses it
+  if( node_comm->rank() == 0 )
+    memory.reset();
+
+  FRENSIE_REQUIRE_NO_THROW( comm->freeSharedMemory() );
+
+  if( node_comm->rank() != 0 )
+  {
+    FRENSIE_CHECK_EQUAL( *static_cast<int*>( memory.get() ), 5 );
+  }
+
+  memory.reset();
+
+  FRENSIE_REQUIRE_NO_THROW( comm->freeSharedMemory() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a timer can be created
 FRENSIE_UNIT_TEST( MPICommunicator, createTimer )
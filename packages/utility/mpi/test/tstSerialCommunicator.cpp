@@ -90,6 +90,58 @@ FRENSIE_UNIT_TEST( SerialCommunicator, split )
   FRENSIE_CHECK_EQUAL( new_comm->size(), 1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a serial communicator can be split into shared memory comms
+FRENSIE_UNIT_TEST( SerialCommunicator, splitShared )
+{
+  std::shared_ptr<const Utility::Communicator> comm = 
+    Utility::SerialCommunicator::get();
+
+  std::shared_ptr<const Utility::Communicator> new_comm = comm->splitShared();
+
+  FRENSIE_REQUIRE( new_comm.get() != NULL );
+  FRENSIE_REQUIRE( new_comm->isValid() );
+  FRENSIE_CHECK( *new_comm == *comm );
+  FRENSIE_CHECK_EQUAL( new_comm->rank(), 0 );
+  FRENSIE_CHECK_EQUAL( new_comm->size(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that shared memory can be allocated
+FRENSIE_UNIT_TEST( SerialCommunicator, allocateSharedMemory )
+{
+  std::shared_ptr<const Utility::Communicator> comm = 
+    Utility::SerialCommunicator::get();
+
+  std::shared_ptr<void> memory = comm->allocateSharedMemory( 10*sizeof(double) );
+
+  FRENSIE_REQUIRE( memory.get() != NULL );
+
+  double* array = static_cast<double*>( memory.get() );
+
+  for( size_t i = 0; i < 10; ++i )
+    array[i] = i;
+
+  FRENSIE_CHECK_EQUAL( array[0], 0.0 );
+  FRENSIE_CHECK_EQUAL( array[9], 9.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that unused shared memory can be freed
+FRENSIE_UNIT_TEST( SerialCommunicator, freeSharedMemory )
+{
+  std::shared_ptr<const Utility::Communicator> comm = 
+    Utility::SerialCommunicator::get();
+
+  std::shared_ptr<void> memory = comm->allocateSharedMemory( sizeof(double) );
+
+  *static_cast<double*>( memory.get() ) = 1.0;
+
+  FRENSIE_REQUIRE_NO_THROW( comm->freeSharedMemory() );
+
+  FRENSIE_CHECK_EQUAL( *static_cast<double*>( memory.get() ), 1.0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a timer can be created
 FRENSIE_UNIT_TEST( SerialCommunicator, createTimer )
@@ -36,7 +36,7 @@ public:
   { /* ... */ }
 
   //! Return a random number from the fake stream
-  double getRandomNumber();
+  double getRandomNumber() override;
 
 private:
 
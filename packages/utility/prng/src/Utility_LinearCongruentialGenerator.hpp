@@ -10,13 +10,16 @@
 #ifndef UTILITY_LINEAR_CONGRUENTIAL_GENERATOR_HPP
 #define UTILITY_LINEAR_CONGRUENTIAL_GENERATOR_HPP
 
+// FRENSIE Includes
+#include "Utility_PseudoRandomNumberGenerator.hpp"
+
 namespace Utility{
 
 //! A linear congruential pseudo-random number generator (LCG)
 /*! \details A modulus of 2^64 is used so that modular arithmetic is done
  * implicitly (using integer overflow).
  */
-class LinearCongruentialGenerator
+class LinearCongruentialGenerator : public PseudoRandomNumberGenerator
 {
 
 public:
@@ -29,16 +32,16 @@ public:
   { /* ... */}
 
   //! Return a random number for the current history
-  virtual double getRandomNumber();
+  virtual double getRandomNumber() override;
 
   //! Return the state of the random number
-  virtual unsigned long long getGeneratorState() const;
+  virtual unsigned long long getGeneratorState() const override;
 
   //! Initialize the generator for the desired history
-  void changeHistory( const unsigned long long history_number );
+  void changeHistory( const unsigned long long history_number ) override;
 
   //! Initialize the generator for the next history
-  void nextHistory();
+  void nextHistory() override;
 
 protected:
 
@@ -0,0 +1,198 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PhiloxGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Definition of a counter-based Philox pseudo-random number
+//!         generator that can be used to create reproducible parallel random
+//!         number streams.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+PhiloxGenerator::PhiloxGenerator( const unsigned long long seed )
+  : d_history( 0ULL ),
+    d_next_block( 0ULL ),
+    d_buffer_index( PhiloxGenerator::buffer_size ),
+    d_state( 0ULL )
+{
+  d_key[0] = (uint32_t)seed;
+  d_key[1] = (uint32_t)(seed >> 32);
+}
+
+// Apply the Philox4x32-10 bijection to a counter using the desired key
+void PhiloxGenerator::computeBlock( const uint32_t counter[4],
+                                    const uint32_t key[2],
+                                    uint32_t block[4] )
+{
+  uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for( unsigned round = 0; round < 10; ++round )
+  {
+    const uint64_t product_0 = (uint64_t)0xD2511F53U*c0;
+    const uint64_t product_1 = (uint64_t)0xCD9E8D57U*c2;
+
+    const uint32_t new_c0 = (uint32_t)(product_1 >> 32) ^ c1 ^ k0;
+    const uint32_t new_c2 = (uint32_t)(product_0 >> 32) ^ c3 ^ k1;
+
+    c1 = (uint32_t)product_1;
+    c3 = (uint32_t)product_0;
+    c0 = new_c0;
+    c2 = new_c2;
+
+    // Bump the key (Weyl sequence)
+    k0 += 0x9E3779B9U;
+    k1 += 0xBB67AE85U;
+  }
+
+  block[0] = c0;
+  block[1] = c1;
+  block[2] = c2;
+  block[3] = c3;
+}
+
+// Generate a batch of raw random numbers (two per block)
+void PhiloxGenerator::generateRawBlocks(
+                            const unsigned long long first_block,
+                            const size_t number_of_blocks,
+                            unsigned long long* raw_random_numbers ) const
+{
+  const uint32_t history_low = (uint32_t)d_history;
+  const uint32_t history_high = (uint32_t)(d_history >> 32);
+
+  #pragma omp simd
+  for( size_t i = 0; i < number_of_blocks; ++i )
+  {
+    const unsigned long long block_index = first_block + i;
+
+    const uint32_t counter[4] = {(uint32_t)block_index,
+                                 (uint32_t)(block_index >> 32),
+                                 history_low,
+                                 history_high};
+    uint32_t block[4];
+
+    PhiloxGenerator::computeBlock( counter, d_key, block );
+
+    raw_random_numbers[2*i] = ((unsigned long long)block[1] << 32) | block[0];
+    raw_random_numbers[2*i+1] = ((unsigned long long)block[3] << 32) | block[2];
+  }
+}
+
+// Generate a batch of random numbers (two per block)
+void PhiloxGenerator::generateBlocks( const unsigned long long first_block,
+                                      const size_t number_of_blocks,
+                                      double* random_numbers ) const
+{
+  const uint32_t history_low = (uint32_t)d_history;
+  const uint32_t history_high = (uint32_t)(d_history >> 32);
+
+  #pragma omp simd
+  for( size_t i = 0; i < number_of_blocks; ++i )
+  {
+    const unsigned long long block_index = first_block + i;
+
+    const uint32_t counter[4] = {(uint32_t)block_index,
+                                 (uint32_t)(block_index >> 32),
+                                 history_low,
+                                 history_high};
+    uint32_t block[4];
+
+    PhiloxGenerator::computeBlock( counter, d_key, block );
+
+    random_numbers[2*i] = PhiloxGenerator::convertToDouble(
+                        ((unsigned long long)block[1] << 32) | block[0] );
+    random_numbers[2*i+1] = PhiloxGenerator::convertToDouble(
+                        ((unsigned long long)block[3] << 32) | block[2] );
+  }
+}
+
+// Refill the raw random number buffer
+void PhiloxGenerator::refillBuffer()
+{
+  this->generateRawBlocks( d_next_block,
+                           PhiloxGenerator::buffer_size/2,
+                           d_buffer );
+
+  d_next_block += PhiloxGenerator::buffer_size/2;
+  d_buffer_index = 0;
+}
+
+// Return a batch of random numbers for the current history
+/*! \details The random numbers will be identical to the random numbers that
+ * would be returned by consecutive calls to getRandomNumber.
+ */
+void PhiloxGenerator::getRandomNumbers( double* random_numbers,
+                                        const size_t number_of_random_numbers )
+{
+  size_t i = 0;
+
+  // Use the buffered random numbers first
+  while( i < number_of_random_numbers &&
+         d_buffer_index < PhiloxGenerator::buffer_size )
+  {
+    random_numbers[i] = this->getRandomNumber();
+
+    ++i;
+  }
+
+  // Generate the remaining pairs of random numbers directly
+  const size_t number_of_blocks = (number_of_random_numbers - i)/2;
+
+  if( number_of_blocks > 0 )
+  {
+    this->generateBlocks( d_next_block, number_of_blocks, random_numbers+i );
+
+    // Update the state to the last raw random number
+    unsigned long long last_raw_random_numbers[2];
+
+    this->generateRawBlocks( d_next_block + number_of_blocks - 1,
+                             1,
+                             last_raw_random_numbers );
+
+    d_state = last_raw_random_numbers[1];
+
+    d_next_block += number_of_blocks;
+    i += 2*number_of_blocks;
+  }
+
+  // Generate the last random number using the buffer
+  if( i < number_of_random_numbers )
+    random_numbers[i] = this->getRandomNumber();
+}
+
+// Return the state of the random number
+/*! \details The state is the last raw (64-bit) random number that was
+ * generated.
+ */
+unsigned long long PhiloxGenerator::getGeneratorState() const
+{
+  return d_state;
+}
+
+// Initialize the generator for the desired history
+/*! \details The first history number is assumed to be 0.
+ */
+void PhiloxGenerator::changeHistory( const unsigned long long history_number )
+{
+  d_history = history_number;
+  d_next_block = 0ULL;
+  d_buffer_index = PhiloxGenerator::buffer_size;
+}
+
+// Initialize the generator for the next history
+void PhiloxGenerator::nextHistory()
+{
+  this->changeHistory( d_history + 1ULL );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_PhiloxGenerator.cpp
+//---------------------------------------------------------------------------//
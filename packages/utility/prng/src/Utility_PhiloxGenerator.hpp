@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PhiloxGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Declaration of a counter-based Philox pseudo-random number
+//!         generator that can be used to create reproducible parallel random
+//!         number streams.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PHILOX_GENERATOR_HPP
+#define UTILITY_PHILOX_GENERATOR_HPP
+
+// Std Lib Includes
+#include <stdint.h>
+
+// FRENSIE Includes
+#include "Utility_PseudoRandomNumberGenerator.hpp"
+
+namespace Utility{
+
+//! A counter-based Philox4x32-10 pseudo-random number generator
+/*! \details The generator is keyed by the seed and the counter is
+ * constructed from the history number and the number of blocks that have
+ * been generated for the current history. Because every random number is
+ * a function of (history, counter) only, any history can be started in
+ * constant time (there is no stride to skip over). Each block of the
+ * Philox4x32-10 bijection provides two 64-bit random integers, which are
+ * converted to doubles with 53 bits of precision. The blocks are generated
+ * in batches using a loop that can be vectorized by the compiler.
+ * Reference: J. Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+ * SC11 (2011).
+ */
+class PhiloxGenerator : public PseudoRandomNumberGenerator
+{
+
+public:
+
+  //! Constructor
+  PhiloxGenerator( const unsigned long long seed = PhiloxGenerator::default_seed );
+
+  //! Destructor
+  ~PhiloxGenerator()
+  { /* ... */ }
+
+  //! Return a random number for the current history
+  double getRandomNumber() override;
+
+  //! Return a batch of random numbers for the current history
+  void getRandomNumbers( double* random_numbers,
+                         const size_t number_of_random_numbers ) override;
+
+  //! Return the state of the random number
+  unsigned long long getGeneratorState() const override;
+
+  //! Initialize the generator for the desired history
+  void changeHistory( const unsigned long long history_number ) override;
+
+  //! Initialize the generator for the next history
+  void nextHistory() override;
+
+  //! Apply the Philox4x32-10 bijection to a counter using the desired key
+  static void computeBlock( const uint32_t counter[4],
+                            const uint32_t key[2],
+                            uint32_t block[4] );
+
+private:
+
+  // Generate a batch of raw random numbers (two per block)
+  void generateRawBlocks( const unsigned long long first_block,
+                          const size_t number_of_blocks,
+                          unsigned long long* raw_random_numbers ) const;
+
+  // Generate a batch of random numbers (two per block)
+  void generateBlocks( const unsigned long long first_block,
+                       const size_t number_of_blocks,
+                       double* random_numbers ) const;
+
+  // Refill the raw random number buffer
+  void refillBuffer();
+
+  // Convert a raw random number to a random number in [0,1)
+  static double convertToDouble( const unsigned long long raw_random_number );
+
+  // The default seed
+  static const unsigned long long default_seed = 19073486328125ULL;
+
+  // The number of raw random numbers that are buffered
+  static const size_t buffer_size = 8;
+
+  // The generator key (seed)
+  uint32_t d_key[2];
+
+  // The current history
+  unsigned long long d_history;
+
+  // The next block of the current history that will be generated
+  unsigned long long d_next_block;
+
+  // The buffered raw random numbers
+  unsigned long long d_buffer[buffer_size];
+
+  // The index of the next buffered raw random number
+  size_t d_buffer_index;
+
+  // The last raw random number
+  unsigned long long d_state;
+};
+
+// Convert a raw random number to a random number in [0,1)
+inline double PhiloxGenerator::convertToDouble(
+                                 const unsigned long long raw_random_number )
+{
+  // Use the upper 53 bits (2^-53)
+  return (raw_random_number >> 11)*1.1102230246251565404e-16;
+}
+
+// Return a random number for the current history
+inline double PhiloxGenerator::getRandomNumber()
+{
+  if( d_buffer_index == PhiloxGenerator::buffer_size )
+    this->refillBuffer();
+
+  d_state = d_buffer[d_buffer_index];
+
+  ++d_buffer_index;
+
+  return PhiloxGenerator::convertToDouble( d_state );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_PHILOX_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PhiloxGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,55 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PseudoRandomNumberGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Definition of the pseudo-random number generator base class
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstdlib>
+#include <new>
+
+// FRENSIE Includes
+#include "Utility_PseudoRandomNumberGenerator.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Return a batch of random numbers for the current history
+/*! \details The random numbers will be identical to the random numbers that
+ * would be returned by consecutive calls to getRandomNumber.
+ */
+void PseudoRandomNumberGenerator::getRandomNumbers(
+                                      double* random_numbers,
+                                      const size_t number_of_random_numbers )
+{
+  for( size_t i = 0; i < number_of_random_numbers; ++i )
+    random_numbers[i] = this->getRandomNumber();
+}
+
+// Allocate the memory for a generator (aligned to a cache line)
+/*! \details Because every generator starts on a cache line boundary, no two
+ * generators will share a cache line.
+ */
+void* PseudoRandomNumberGenerator::operator new( std::size_t size )
+{
+  void* ptr = NULL;
+
+  if( posix_memalign( &ptr, PseudoRandomNumberGenerator::cache_line_size, size ) != 0 )
+    throw std::bad_alloc();
+
+  return ptr;
+}
+
+// Deallocate the memory for a generator
+void PseudoRandomNumberGenerator::operator delete( void* ptr )
+{
+  free( ptr );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_PseudoRandomNumberGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,70 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PseudoRandomNumberGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Declaration of the pseudo-random number generator base class
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PSEUDO_RANDOM_NUMBER_GENERATOR_HPP
+#define UTILITY_PSEUDO_RANDOM_NUMBER_GENERATOR_HPP
+
+// Std Lib Includes
+#include <cstddef>
+
+namespace Utility{
+
+/*! The pseudo-random number generator base class
+ * \details Every generator that is allocated on the heap will start on its
+ * own cache line so that the generators that are used by different threads
+ * never share a cache line (the state of a generator is updated every time a
+ * random number is requested).
+ */
+class PseudoRandomNumberGenerator
+{
+
+public:
+
+  //! Constructor
+  PseudoRandomNumberGenerator()
+  { /* ... */ }
+
+  //! Destructor
+  virtual ~PseudoRandomNumberGenerator()
+  { /* ... */ }
+
+  //! Return a random number for the current history
+  virtual double getRandomNumber() = 0;
+
+  //! Return a batch of random numbers for the current history
+  virtual void getRandomNumbers( double* random_numbers,
+                                 const size_t number_of_random_numbers );
+
+  //! Return the state of the generator
+  virtual unsigned long long getGeneratorState() const = 0;
+
+  //! Initialize the generator for the desired history
+  virtual void changeHistory( const unsigned long long history_number ) = 0;
+
+  //! Initialize the generator for the next history
+  virtual void nextHistory() = 0;
+
+  //! Allocate the memory for a generator (aligned to a cache line)
+  static void* operator new( std::size_t size );
+
+  //! Deallocate the memory for a generator
+  static void operator delete( void* ptr );
+
+private:
+
+  // The assumed cache line size (bytes)
+  static const size_t cache_line_size = 64;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_PSEUDO_RANDOM_NUMBER_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PseudoRandomNumberGenerator.hpp
+//---------------------------------------------------------------------------//
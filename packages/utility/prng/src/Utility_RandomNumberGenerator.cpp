@@ -9,18 +9,61 @@
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_FakeGenerator.hpp"
+#include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Utility{
 
+// Initialize the generator type
+RandomNumberGenerator::GeneratorType
+RandomNumberGenerator::generator_type =
+  RandomNumberGenerator::LINEAR_CONGRUENTIAL_GENERATOR;
+
 // Initialize the stored generator pointer
-boost::ptr_vector<LinearCongruentialGenerator>
+boost::ptr_vector<PseudoRandomNumberGenerator>
 RandomNumberGenerator::generator( 1 );
 
 // Constructor
 RandomNumberGenerator::RandomNumberGenerator()
 { /* ... */ }
 
+// Set the type of generator that will be used by the streams
+/*! \details The linear congruential generator is the default generator (it
+ * must be used to reproduce results from previous versions). The generator
+ * type will only be used by streams that are created after it has been set.
+ */
+void RandomNumberGenerator::setGeneratorType( const GeneratorType type )
+{
+  generator_type = type;
+}
+
+// Return the type of generator that is used by the streams
+auto RandomNumberGenerator::getGeneratorType() -> GeneratorType
+{
+  return generator_type;
+}
+
+// Create a generator of the desired type
+PseudoRandomNumberGenerator* RandomNumberGenerator::createGenerator(
+                                                    const GeneratorType type )
+{
+  switch( type )
+  {
+    case LINEAR_CONGRUENTIAL_GENERATOR:
+      return new LinearCongruentialGenerator();
+    case PHILOX_GENERATOR:
+      return new PhiloxGenerator();
+    default:
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "The random number generator type " << type <<
+                       " is not supported!" );
+    }
+  }
+}
+
 //! Check if the streams have been created
 bool RandomNumberGenerator::hasStreams()
 {
@@ -40,7 +83,10 @@ bool RandomNumberGenerator::hasStreams()
 
 // Create the number of random number streams required
 /*! \details The number of streams that are created will be determined by
- * the number of threads requested at run time
+ * the number of threads requested at run time. Each stream is created by the
+ * thread that will use it (and placed on its own cache line) so that the
+ * threads never write to a shared cache line when random numbers are
+ * requested.
  */
 void RandomNumberGenerator::createStreams()
 {
@@ -54,7 +100,7 @@ void RandomNumberGenerator::createStreams()
     #pragma omp barrier
 
     generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
+		       RandomNumberGenerator::createGenerator( generator_type ) );
   }
 
   // Make sure the streams have been created
@@ -115,7 +161,7 @@ void RandomNumberGenerator::unsetFakeStream( const unsigned thread_id )
   if( thread_id == OpenMPProperties::getThreadId() )
   {
     generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
+		       RandomNumberGenerator::createGenerator( generator_type ) );
   }
 
   // Make sure that the generator has been created
@@ -17,7 +17,7 @@
 #include <boost/scoped_ptr.hpp>
 
 // FRENSIE includes
-#include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_PseudoRandomNumberGenerator.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -29,6 +29,18 @@ class RandomNumberGenerator
 
 public:
 
+  //! The generator types
+  enum GeneratorType{
+    LINEAR_CONGRUENTIAL_GENERATOR = 0,
+    PHILOX_GENERATOR
+  };
+
+  //! Set the type of generator that will be used by the streams
+  static void setGeneratorType( const GeneratorType type );
+
+  //! Return the type of generator that is used by the streams
+  static GeneratorType getGeneratorType();
+
   //! Check if the streams have been created
   static bool hasStreams();
 
@@ -52,6 +64,10 @@ public:
   template<typename ScalarType>
   static ScalarType getRandomNumber();
 
+  //! Return a batch of random numbers in interval [0,1)
+  static void getRandomNumbers( double* random_numbers,
+                                const size_t number_of_random_numbers );
+
   //! Destructor
   ~RandomNumberGenerator()
   { /* ... */ }
@@ -61,8 +77,14 @@ private:
   // Constructor
   RandomNumberGenerator();
 
+  // Create a generator of the desired type
+  static PseudoRandomNumberGenerator* createGenerator( const GeneratorType type );
+
+  // The generator type
+  static GeneratorType generator_type;
+
   // Pointer to generator
-  static boost::ptr_vector<LinearCongruentialGenerator> generator;
+  static boost::ptr_vector<PseudoRandomNumberGenerator> generator;
 };
 
 // Return a random number in interval [0,1)
@@ -78,6 +100,20 @@ inline ScalarType RandomNumberGenerator::getRandomNumber()
 	     generator[OpenMPProperties::getThreadId()].getRandomNumber() );
 }
 
+// Return a batch of random numbers in interval [0,1)
+inline void RandomNumberGenerator::getRandomNumbers(
+                                      double* random_numbers,
+                                      const size_t number_of_random_numbers )
+{
+  // Make sure the generator has been set up correctly
+  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
+  // Make sure that the generator has been initialized
+  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+
+  generator[OpenMPProperties::getThreadId()].getRandomNumbers(
+                                 random_numbers, number_of_random_numbers );
+}
+
 // Return a random double in interval [0,1)
 template<>
 inline double RandomNumberGenerator::getRandomNumber<double>()
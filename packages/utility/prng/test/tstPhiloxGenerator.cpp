@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPhiloxGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Philox generator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the Philox4x32-10 bijection is correct (known answer tests)
+FRENSIE_UNIT_TEST( PhiloxGenerator, computeBlock )
+{
+  uint32_t counter[4] = {0u, 0u, 0u, 0u};
+  uint32_t key[2] = {0u, 0u};
+  uint32_t block[4];
+
+  Utility::PhiloxGenerator::computeBlock( counter, key, block );
+
+  FRENSIE_CHECK_EQUAL( block[0], 0x6627e8d5u );
+  FRENSIE_CHECK_EQUAL( block[1], 0xe169c58du );
+  FRENSIE_CHECK_EQUAL( block[2], 0xbc57ac4cu );
+  FRENSIE_CHECK_EQUAL( block[3], 0x9b00dbd8u );
+
+  counter[0] = 0x243f6a88u;
+  counter[1] = 0x85a308d3u;
+  counter[2] = 0x13198a2eu;
+  counter[3] = 0x03707344u;
+  key[0] = 0xa4093822u;
+  key[1] = 0x299f31d0u;
+
+  Utility::PhiloxGenerator::computeBlock( counter, key, block );
+
+  FRENSIE_CHECK_EQUAL( block[0], 0xd16cfe09u );
+  FRENSIE_CHECK_EQUAL( block[1], 0x94fdccebu );
+  FRENSIE_CHECK_EQUAL( block[2], 0x5001e420u );
+  FRENSIE_CHECK_EQUAL( block[3], 0x24126ea1u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a random number in the interval [0,1) can be obtained
+FRENSIE_UNIT_TEST( PhiloxGenerator, getRandomNumber )
+{
+  Utility::PhiloxGenerator generator;
+
+  for( size_t i = 0; i < 100; ++i )
+  {
+    double random_number = generator.getRandomNumber();
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( random_number, 0.0 );
+    FRENSIE_CHECK_LESS( random_number, 1.0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a batch of random numbers can be obtained
+FRENSIE_UNIT_TEST( PhiloxGenerator, getRandomNumbers )
+{
+  Utility::PhiloxGenerator generator;
+
+  std::vector<double> random_numbers( 37 );
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+    random_numbers[i] = generator.getRandomNumber();
+
+  unsigned long long state = generator.getGeneratorState();
+
+  // Consume part of the buffer before requesting the batch
+  generator.changeHistory( 0 );
+
+  std::vector<double> batch_random_numbers( 37 );
+
+  batch_random_numbers[0] = generator.getRandomNumber();
+  batch_random_numbers[1] = generator.getRandomNumber();
+  batch_random_numbers[2] = generator.getRandomNumber();
+
+  generator.getRandomNumbers( batch_random_numbers.data()+3, 34 );
+
+  FRENSIE_CHECK_EQUAL( batch_random_numbers, random_numbers );
+  FRENSIE_CHECK_EQUAL( generator.getGeneratorState(), state );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be initialized for any history
+FRENSIE_UNIT_TEST( PhiloxGenerator, changeHistory )
+{
+  Utility::PhiloxGenerator generator;
+
+  generator.changeHistory( 999999 );
+  generator.getRandomNumber();
+  generator.nextHistory();
+
+  double random_number = generator.getRandomNumber();
+
+  generator.changeHistory( 1000000 );
+
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), random_number );
+
+  // Different histories must produce different streams
+  generator.changeHistory( 1000001 );
+
+  FRENSIE_CHECK( generator.getRandomNumber() != random_number );
+
+  // Different seeds must produce different streams
+  Utility::PhiloxGenerator seeded_generator( 1ULL );
+
+  seeded_generator.changeHistory( 1000000 );
+
+  FRENSIE_CHECK( seeded_generator.getRandomNumber() != random_number );
+}
+
+//---------------------------------------------------------------------------//
+// end tstPhiloxGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -133,6 +133,51 @@ FRENSIE_UNIT_TEST( RandomNumberGenerator, initialize_history )
   FRENSIE_CHECK_EQUAL( all_random_numbers.size(), random_set.size() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the generator type can be set
+FRENSIE_UNIT_TEST( RandomNumberGenerator, setGeneratorType )
+{
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::RandomNumberGenerator::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  Utility::RandomNumberGenerator::setGeneratorType(
+                         Utility::RandomNumberGenerator::PHILOX_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::RandomNumberGenerator::PHILOX_GENERATOR );
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  FRENSIE_CHECK( Utility::RandomNumberGenerator::hasStreams() );
+
+  // A batch of random numbers must be identical to consecutive random numbers
+  Utility::RandomNumberGenerator::initialize( 10 );
+
+  std::vector<double> random_numbers( 11 );
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    random_numbers[i] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  Utility::RandomNumberGenerator::initialize( 10 );
+
+  std::vector<double> batch_random_numbers( 11 );
+
+  Utility::RandomNumberGenerator::getRandomNumbers(
+                                                batch_random_numbers.data(),
+                                                batch_random_numbers.size() );
+
+  FRENSIE_CHECK_EQUAL( batch_random_numbers, random_numbers );
+
+  // Restore the default generator
+  Utility::RandomNumberGenerator::setGeneratorType(
+            Utility::RandomNumberGenerator::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  Utility::RandomNumberGenerator::createStreams();
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -8,30 +8,43 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <vector>
 #include <time.h>
 
-// Boost Scoped Pointer
-#include <boost/scoped_ptr.hpp>
-#include <boost/shared_ptr.hpp>
-
-// Trilinos Includes
-#include <Teuchos_RCP.hpp>
-
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_PhiloxGenerator.hpp"
 
 // Time macro
 #define TIME() (clock()/((double)CLOCKS_PER_SEC))
 
-// Generator timing function
-void timeGenerator( const int trial_size, const int histories = 1 )
+// Print the generation speed
+void printGenerationSpeed( const std::string& generator_name,
+                           const int trial_size,
+                           const double time_interval )
 {
-  // Raw generator
-  Utility::LinearCongruentialGenerator generator;
+  if( time_interval < 1.0e-15 )
+  {
+    std::cout << "  " << generator_name << ":\tTiming information not "
+              << "accurate enough for this generator." << std::endl;
+  }
+  else
+  {
+    // Calculate the generation speed (Millions/sec)
+    std::cout << "  " << generator_name << ":\tTime = " << time_interval
+              << " seconds " << "=> " << trial_size/time_interval/1e6
+              << std::endl;
+  }
+}
+
+// Time the wrapped generator
+double timeWrappedGenerator( const int trial_size, const int histories )
+{
+  Utility::RandomNumberGenerator::createStreams();
 
   double time1 = TIME();
 
-  // Wrapped double generator timing
   for( int i = 0; i < histories; ++i )
   {
     Utility::RandomNumberGenerator::initialize( i );
@@ -39,11 +52,24 @@ void timeGenerator( const int trial_size, const int histories = 1 )
     for( int j = 0; j < trial_size/histories; ++j )
       Utility::RandomNumberGenerator::getRandomNumber<double>();
   }
-  std::cout << std::endl;
 
   double time2 = TIME();
 
-  // Raw double generator timing
+  std::cout << "  Last random number generated: "
+            << Utility::RandomNumberGenerator::getRandomNumber<double>()
+            << std::endl;
+
+  return time2 - time1;
+}
+
+// Time a raw generator
+template<typename Generator>
+double timeRawGenerator( Generator& generator,
+                         const int trial_size,
+                         const int histories )
+{
+  double time1 = TIME();
+
   for( int i = 0; i < histories; ++i )
   {
     for( int j = 0; j < trial_size/histories; ++j )
@@ -52,46 +78,95 @@ void timeGenerator( const int trial_size, const int histories = 1 )
     generator.nextHistory();
   }
 
-  double time3 = TIME();
+  double time2 = TIME();
 
-  // Check for valid time intervals
-  if( time2 - time1 < 1.0e-15 || time3 - time2 < 1.0e-15 )
-  {
-    std::cerr << "Timing information not accurate enough for this generator."
-	      << std::endl;
-  }
-  else
+  std::cout << "  Last random number generated: "
+            << generator.getRandomNumber() << std::endl;
+
+  return time2 - time1;
+}
+
+// Time a raw generator using batches of random numbers
+template<typename Generator>
+double timeRawBatchGenerator( Generator& generator,
+                              const int trial_size,
+                              const int histories )
+{
+  std::vector<double> random_numbers( trial_size/histories );
+
+  double time1 = TIME();
+
+  for( int i = 0; i < histories; ++i )
   {
-    // Calculate the generation speed (Millions/sec)
-    double mdbls_per_sec_wrapped = trial_size/(time2-time1)/1e6;
-    double mdbls_per_sec_raw = trial_size/(time3-time2)/1e6;
-
-    // Print the last double generated
-    std::cout << "Last random number generated: "
-	      << generator.getRandomNumber() << " "
-	      << Utility::RandomNumberGenerator::getRandomNumber<double>()
-	      << std::endl
-	      << "Random numbers per history: " << trial_size/histories
-	      << std::endl
-	      << "User + System time information (NOTE: MRS = Million Random "
-	      << "Numbers Per Second)\n" << std::endl
-	      << "  Wrapped Double generator:\tTime = " << time2-time1
-	      << " seconds " << "=> " << mdbls_per_sec_wrapped
-	      << std::endl
-	      << "  Raw Double generator:\t\tTime = " << time3-time2
-	      << " seconds " << "=> " << mdbls_per_sec_raw
-	      << std::endl << std::endl;
+    generator.getRandomNumbers( random_numbers.data(),
+                                random_numbers.size() );
+
+    generator.nextHistory();
   }
+
+  double time2 = TIME();
+
+  std::cout << "  Last random number generated: "
+            << random_numbers.back() << std::endl;
+
+  return time2 - time1;
+}
+
+// Generator timing function
+void timeGenerator( const int trial_size, const int histories = 1 )
+{
+  std::cout << "Random numbers per history: " << trial_size/histories
+            << std::endl;
+
+  // Wrapped LCG timing
+  Utility::RandomNumberGenerator::setGeneratorType(
+            Utility::RandomNumberGenerator::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  double wrapped_lcg_time = timeWrappedGenerator( trial_size, histories );
+
+  // Wrapped Philox timing
+  Utility::RandomNumberGenerator::setGeneratorType(
+                         Utility::RandomNumberGenerator::PHILOX_GENERATOR );
+
+  double wrapped_philox_time = timeWrappedGenerator( trial_size, histories );
+
+  // Raw LCG timing
+  Utility::LinearCongruentialGenerator lcg;
+
+  double raw_lcg_time = timeRawGenerator( lcg, trial_size, histories );
+
+  // Raw Philox timing
+  Utility::PhiloxGenerator philox;
+
+  double raw_philox_time = timeRawGenerator( philox, trial_size, histories );
+
+  // Raw batch timing
+  lcg.changeHistory( 0 );
+
+  double batch_lcg_time = timeRawBatchGenerator( lcg, trial_size, histories );
+
+  philox.changeHistory( 0 );
+
+  double batch_philox_time =
+    timeRawBatchGenerator( philox, trial_size, histories );
+
+  std::cout << "User + System time information (NOTE: MRS = Million Random "
+            << "Numbers Per Second)\n" << std::endl;
+
+  printGenerationSpeed( "Wrapped LCG generator", trial_size, wrapped_lcg_time );
+  printGenerationSpeed( "Wrapped Philox generator", trial_size, wrapped_philox_time );
+  printGenerationSpeed( "Raw LCG generator", trial_size, raw_lcg_time );
+  printGenerationSpeed( "Raw Philox generator", trial_size, raw_philox_time );
+  printGenerationSpeed( "Batch LCG generator", trial_size, batch_lcg_time );
+  printGenerationSpeed( "Batch Philox generator", trial_size, batch_philox_time );
+
+  std::cout << std::endl;
 }
 
 
 // Main itming function
 int main()
 {
-  Utility::RandomNumberGenerator::createStreams();
-
-  Utility::RandomNumberGenerator::initialize();
-
   int trial_size = 10000000;
 
   std::cout << "Timing generator for single history" << std::endl;
@@ -106,6 +181,9 @@ int main()
   std::cout << "Timing generator for 1000 histories" << std::endl;
   timeGenerator( trial_size, 1000 );
 
+  std::cout << "Timing generator for 100000 histories" << std::endl;
+  timeGenerator( trial_size, 100000 );
+
   return 0;
 }
 